@@ -0,0 +1,108 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 20:31:46
+ * @LastEditTime: 2026-10-19 21:05:30
+ * @LastEditors: Matt.SHI
+ * @Description: timings of the cpu blur engines, no gl context needed
+ * @FilePath: /opengl_demo/features/bench/gaussian_blur_bench.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include <features/cpu/gaussian_blur_fixed.h>
+#include <features/cpu/gaussian_blur_iir.h>
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string.h>
+#include <vector>
+
+using namespace ESSILOR;
+
+struct BenchSize
+{
+    unsigned int w;
+    unsigned int h;
+};
+
+constexpr int BENCH_C = 3;
+constexpr int BENCH_WARMUP = 1;
+
+template<typename RUN>
+double timeMs(int iterations, RUN run)
+{
+    for (int i = 0; i < BENCH_WARMUP; i++)
+    {
+        run();
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        run();
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+int main(int argv, const char *argc[])
+{
+    int iterations = 5;
+    if (argv > 1)
+    {
+        iterations = std::max(1, atoi(argc[1]));
+    }
+
+    const BenchSize sizes[] = {{640, 480}, {1280, 720}, {1920, 1080}, {1920, 1440}, {3840, 2160}};
+    // zone values, 12 is a 2 pixel sigma, 240 a 40 pixel sigma
+    const unsigned char zones[] = {12, 60, 120, 240};
+
+    std::cout << "[BENCH] fixed point kernels: " << GassianBlurFixed::simdName()
+              << ", " << iterations << " iterations, ms per frame" << std::endl;
+    std::cout << std::setw(10) << "size" << std::setw(6) << "zone"
+              << std::setw(10) << "strided" << std::setw(10) << "blocked" << std::setw(10) << "auto" << std::setw(10) << "iir" << std::endl;
+
+    std::mt19937 rng(7);
+    GassianBlurFixed fixed;
+    GassianBlurIIR iir;
+    for (const BenchSize &size : sizes)
+    {
+        const size_t len = (size_t)size.w * size.h * BENCH_C;
+        std::vector<unsigned char> base(len);
+        std::vector<unsigned char> zone(len);
+        std::vector<unsigned char> strided_out(len);
+        std::vector<unsigned char> blocked_out(len);
+        std::vector<unsigned char> auto_out(len);
+        std::vector<unsigned char> iir_out(len);
+        for (size_t i = 0; i < len; i++)
+        {
+            base[i] = (unsigned char)(rng() & 0xff);
+        }
+
+        for (unsigned char zone_value : zones)
+        {
+            memset(zone.data(), zone_value, len);
+            auto runFixed = [&](int vertical_pass, unsigned char *out)
+            {
+                fixed.set_vertical_pass(vertical_pass);
+                fixed.process(base.data(), size.w, size.h, BENCH_C, zone.data(), size.w, size.h, BENCH_C, out, BENCH_C);
+            };
+
+            double strided_ms = timeMs(iterations, [&]() { runFixed(FIXED_VERTICAL_STRIDED, strided_out.data()); });
+            double blocked_ms = timeMs(iterations, [&]() { runFixed(FIXED_VERTICAL_TRANSPOSED, blocked_out.data()); });
+            double auto_ms = timeMs(iterations, [&]() { runFixed(FIXED_VERTICAL_AUTO, auto_out.data()); });
+            double iir_ms = timeMs(iterations, [&]()
+                                   { iir.process(base.data(), size.w, size.h, BENCH_C, zone.data(), size.w, size.h, BENCH_C, iir_out.data(), BENCH_C); });
+
+            std::cout << std::setw(5) << size.w << "x" << std::setw(4) << std::left << size.h << std::right
+                      << std::setw(6) << (int)zone_value << std::fixed << std::setprecision(2)
+                      << std::setw(10) << strided_ms << std::setw(10) << blocked_ms << std::setw(10) << auto_ms << std::setw(10) << iir_ms;
+            if (strided_out != blocked_out || strided_out != auto_out)
+            {
+                std::cout << "  [MISMATCH]";
+            }
+            std::cout << std::endl;
+        }
+    }
+    return 0;
+}
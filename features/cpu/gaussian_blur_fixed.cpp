@@ -0,0 +1,396 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 18:45:37
+ * @LastEditTime: 2026-10-19 20:02:14
+ * @LastEditors: Matt.SHI
+ * @Description: separable gaussian on 8-bit frames with 16-bit fixed point weights
+ * @FilePath: /opengl_demo/features/cpu/gaussian_blur_fixed.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "gaussian_blur_fixed.h"
+#include "gaussian_blur_zone_index.h"
+#include "gaussian_blur_transpose.h"
+
+#include <features/gaussian_blur_defines.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+// samples are 8-bit values in Q7 (v << 7, at most 32640) so a pmulhrsw with a
+// Q15 weight gives a Q7 product rounded to nearest. the scalar code repeats
+// the exact same arithmetic, every path produces identical output
+namespace ESSILOR
+{
+    namespace
+    {
+        inline int16_t mulhrs(int16_t a, int16_t b)
+        {
+            return (int16_t)(((int32_t)a * b + 0x4000) >> 15);
+        }
+
+        inline int16_t adds(int16_t a, int16_t b)
+        {
+            int32_t sum = (int32_t)a + b;
+            return (int16_t)std::min(32767, std::max(-32768, sum));
+        }
+    }
+
+    // below this radius the strided vertical pass still fits the cache and
+    // beats paying for two transposes, measured with the blur benchmark
+    constexpr int FIXED_TRANSPOSE_MIN_RADIUS = 48;
+
+    GassianBlurFixed::GassianBlurFixed() : m_bucket_size(4),
+                                           m_max_radius(0),
+                                           m_vertical_pass(FIXED_VERTICAL_AUTO)
+    {
+        buildKernels();
+    }
+
+    GassianBlurFixed::~GassianBlurFixed()
+    {
+    }
+
+    const char *GassianBlurFixed::simdName()
+    {
+#if defined(__AVX2__)
+        return "avx2";
+#elif defined(__SSSE3__)
+        return "ssse3";
+#else
+        return "scalar";
+#endif
+    }
+
+    void GassianBlurFixed::set_zone_bucket_size(unsigned int bucket_size)
+    {
+        m_bucket_size = std::min(64u, std::max(1u, bucket_size));
+        buildKernels();
+    }
+
+    void GassianBlurFixed::set_vertical_pass(int vertical_pass)
+    {
+        if (vertical_pass < FIXED_VERTICAL_STRIDED || vertical_pass > FIXED_VERTICAL_AUTO)
+        {
+            vertical_pass = FIXED_VERTICAL_AUTO;
+        }
+        m_vertical_pass = vertical_pass;
+    }
+
+    void GassianBlurFixed::buildKernels()
+    {
+        m_kernels.clear();
+        m_max_radius = 0;
+        for (unsigned int bucket_start = 0; bucket_start < 256; bucket_start += m_bucket_size)
+        {
+            FixedKernel kernel;
+            float centre = bucket_start + (m_bucket_size - 1) * 0.5f;
+            buildKernel(centre * GAUSSIAN_BLUR_ZONE_TO_SIGMA, kernel);
+            m_max_radius = std::max(m_max_radius, kernel.radius);
+            for (unsigned int v = bucket_start; v < std::min(256u, bucket_start + m_bucket_size); v++)
+            {
+                m_kernel_of_zone[v] = (unsigned char)m_kernels.size();
+            }
+            m_kernels.push_back(kernel);
+        }
+    }
+
+    // +-3 sigma, the rounding residue goes to the centre tap so a flat image
+    // stays flat
+    void GassianBlurFixed::buildKernel(float sigma, FixedKernel &kernel)
+    {
+        if (sigma < 0.5f)
+        {
+            kernel.radius = 0;
+            kernel.weights.assign(1, 32767);
+            return;
+        }
+
+        kernel.radius = (int)std::ceil(3.0f * sigma);
+        std::vector<double> weights(2 * kernel.radius + 1);
+        double sum = 0.0;
+        for (int k = -kernel.radius; k <= kernel.radius; k++)
+        {
+            weights[k + kernel.radius] = std::exp(-(double)(k * k) / (2.0 * sigma * sigma));
+            sum += weights[k + kernel.radius];
+        }
+
+        kernel.weights.resize(weights.size());
+        int fixed_sum = 0;
+        for (size_t i = 0; i < weights.size(); i++)
+        {
+            kernel.weights[i] = (int16_t)std::lround(weights[i] / sum * 32768.0);
+            fixed_sum += kernel.weights[i];
+        }
+        kernel.weights[kernel.radius] += (int16_t)(32768 - fixed_sum);
+    }
+
+    void GassianBlurFixed::accumulateTaps(const int16_t *const *taps, const int16_t *weights, int tap_count,
+                                          int16_t *dst, int count)
+    {
+        if (tap_count == 1)
+        {
+            memcpy(dst, taps[0], count * sizeof(int16_t));
+            return;
+        }
+
+        int i = 0;
+#if defined(__AVX2__)
+        // 32 channels per step
+        for (; i + 32 <= count; i += 32)
+        {
+            __m256i acc0 = _mm256_setzero_si256();
+            __m256i acc1 = _mm256_setzero_si256();
+            for (int k = 0; k < tap_count; k++)
+            {
+                __m256i w = _mm256_set1_epi16(weights[k]);
+                __m256i s0 = _mm256_loadu_si256((const __m256i *)(taps[k] + i));
+                __m256i s1 = _mm256_loadu_si256((const __m256i *)(taps[k] + i + 16));
+                acc0 = _mm256_adds_epi16(acc0, _mm256_mulhrs_epi16(s0, w));
+                acc1 = _mm256_adds_epi16(acc1, _mm256_mulhrs_epi16(s1, w));
+            }
+            _mm256_storeu_si256((__m256i *)(dst + i), acc0);
+            _mm256_storeu_si256((__m256i *)(dst + i + 16), acc1);
+        }
+#elif defined(__SSSE3__)
+        // 16 channels per step
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i acc0 = _mm_setzero_si128();
+            __m128i acc1 = _mm_setzero_si128();
+            for (int k = 0; k < tap_count; k++)
+            {
+                __m128i w = _mm_set1_epi16(weights[k]);
+                __m128i s0 = _mm_loadu_si128((const __m128i *)(taps[k] + i));
+                __m128i s1 = _mm_loadu_si128((const __m128i *)(taps[k] + i + 8));
+                acc0 = _mm_adds_epi16(acc0, _mm_mulhrs_epi16(s0, w));
+                acc1 = _mm_adds_epi16(acc1, _mm_mulhrs_epi16(s1, w));
+            }
+            _mm_storeu_si128((__m128i *)(dst + i), acc0);
+            _mm_storeu_si128((__m128i *)(dst + i + 8), acc1);
+        }
+#endif
+        for (; i < count; i++)
+        {
+            int16_t acc = 0;
+            for (int k = 0; k < tap_count; k++)
+            {
+                acc = adds(acc, mulhrs(taps[k][i], weights[k]));
+            }
+            dst[i] = acc;
+        }
+    }
+
+    void GassianBlurFixed::loadQ7(const unsigned char *src, int16_t *dst, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            dst[i] = (int16_t)(src[i] << 7);
+        }
+    }
+
+    void GassianBlurFixed::storeQ7(const int16_t *src, unsigned char *dst, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            int v = (src[i] + 64) >> 7;
+            dst[i] = (unsigned char)std::min(255, std::max(0, v));
+        }
+    }
+
+    void GassianBlurFixed::padRow(int16_t *padded, int pad, int w, int c)
+    {
+        for (int x = 0; x < pad; x++)
+        {
+            memcpy(padded + x * c, padded + pad * c, c * sizeof(int16_t));
+            memcpy(padded + (pad + w + x) * c, padded + (pad + w - 1) * c, c * sizeof(int16_t));
+        }
+    }
+
+    // pixels of a row sharing a kernel form a run, a run is one
+    // accumulateTaps call over its interleaved channels
+    void GassianBlurFixed::filterRowRuns(const int16_t *padded, int pad, const unsigned char *zone_row,
+                                         int w, int c, int16_t *dst)
+    {
+        int x0 = 0;
+        while (x0 < w)
+        {
+            int kernel_idx = m_kernel_of_zone[zone_row[x0]];
+            int x1 = x0 + 1;
+            while (x1 < w && m_kernel_of_zone[zone_row[x1]] == kernel_idx)
+                x1++;
+
+            const FixedKernel &kernel = m_kernels[kernel_idx];
+            int tap_count = 2 * kernel.radius + 1;
+            for (int k = 0; k < tap_count; k++)
+            {
+                m_taps[k] = padded + (size_t)(pad + x0 - kernel.radius + k) * c;
+            }
+            accumulateTaps(m_taps.data(), kernel.weights.data(), tap_count, dst + (size_t)x0 * c, (x1 - x0) * c);
+            x0 = x1;
+        }
+    }
+
+    void GassianBlurFixed::storeRow(const int16_t *row, int w, int c, unsigned char *dst, unsigned int result_channel)
+    {
+        const int row_len = w * c;
+        if ((unsigned int)c == result_channel)
+        {
+            storeQ7(row, dst, row_len);
+            return;
+        }
+        m_out_row_u8.resize(row_len);
+        storeQ7(row, m_out_row_u8.data(), row_len);
+        for (int x = 0; x < w; x++)
+        {
+            const unsigned char *p = &m_out_row_u8[(size_t)x * c];
+            for (unsigned int k = 0; k < result_channel; k++)
+            {
+                dst[x * result_channel + k] = (k < (unsigned int)c) ? p[k] : ((k == 3) ? 255 : p[0]);
+            }
+        }
+    }
+
+    int GassianBlurFixed::maxRadiusInUse() const
+    {
+        bool used[256] = {false};
+        for (size_t i = 0; i < m_zone.size(); i++)
+        {
+            used[m_zone[i]] = true;
+        }
+        int radius = 0;
+        for (int v = 0; v < 256; v++)
+        {
+            if (used[v])
+                radius = std::max(radius, m_kernels[m_kernel_of_zone[v]].radius);
+        }
+        return radius;
+    }
+
+    // horizontal pass into m_rows
+    void GassianBlurFixed::filterRows(const unsigned char *base_image_data, int w, int h, int c)
+    {
+        const int pad = m_max_radius;
+        const size_t row_len = (size_t)w * c;
+        m_padded_row.resize((size_t)(std::max(w, h) + 2 * pad) * c);
+        m_rows.resize(row_len * h);
+
+        for (int y = 0; y < h; y++)
+        {
+            loadQ7(base_image_data + row_len * y, m_padded_row.data() + pad * c, (int)row_len);
+            padRow(m_padded_row.data(), pad, w, c);
+            filterRowRuns(m_padded_row.data(), pad, &m_zone[(size_t)y * w], w, c, &m_rows[row_len * y]);
+        }
+    }
+
+    // vertical pass, taps are whole rows of m_rows. every 32 output channels
+    // touch one cache line per tap row, fine for small kernels but a wide
+    // kernel walks far more lines than l1 holds
+    void GassianBlurFixed::filterColumnsStrided(int w, int h, int c, unsigned char *result, unsigned int result_channel)
+    {
+        const size_t row_len = (size_t)w * c;
+        m_out_row.resize(row_len);
+
+        for (int y = 0; y < h; y++)
+        {
+            const unsigned char *zone_row = &m_zone[(size_t)y * w];
+            int x0 = 0;
+            while (x0 < w)
+            {
+                int kernel_idx = m_kernel_of_zone[zone_row[x0]];
+                int x1 = x0 + 1;
+                while (x1 < w && m_kernel_of_zone[zone_row[x1]] == kernel_idx)
+                    x1++;
+
+                const FixedKernel &kernel = m_kernels[kernel_idx];
+                int tap_count = 2 * kernel.radius + 1;
+                for (int k = 0; k < tap_count; k++)
+                {
+                    // rows outside the image repeat the border row
+                    int src_y = std::min(h - 1, std::max(0, y - kernel.radius + k));
+                    m_taps[k] = &m_rows[row_len * src_y + (size_t)x0 * c];
+                }
+                accumulateTaps(m_taps.data(), kernel.weights.data(), tap_count,
+                               &m_out_row[(size_t)x0 * c], (x1 - x0) * c);
+                x0 = x1;
+            }
+            storeRow(m_out_row.data(), w, c, result + (size_t)y * w * result_channel, result_channel);
+        }
+    }
+
+    // vertical pass as a row pass over the transposed image, the taps of a
+    // run are neighbouring pixels again. the transposes walk 16x16 tiles
+    void GassianBlurFixed::filterColumnsTransposed(int w, int h, int c, unsigned char *result, unsigned int result_channel)
+    {
+        const int pad = m_max_radius;
+        const size_t column_len = (size_t)h * c;
+        m_transposed.resize(m_rows.size());
+        m_transposed_out.resize(m_rows.size());
+        m_zone_transposed.resize(m_zone.size());
+
+        transposeBlockedChannels(m_rows.data(), w, h, c, m_transposed.data());
+        transposeBlocked(m_zone.data(), w, h, m_zone_transposed.data());
+        for (int x = 0; x < w; x++)
+        {
+            memcpy(m_padded_row.data() + pad * c, &m_transposed[column_len * x], column_len * sizeof(int16_t));
+            padRow(m_padded_row.data(), pad, h, c);
+            filterRowRuns(m_padded_row.data(), pad, &m_zone_transposed[(size_t)x * h], h, c,
+                          &m_transposed_out[column_len * x]);
+        }
+        // back into m_rows, the horizontal result is not needed any more
+        transposeBlockedChannels(m_transposed_out.data(), h, w, c, m_rows.data());
+
+        const size_t row_len = (size_t)w * c;
+        for (int y = 0; y < h; y++)
+        {
+            storeRow(&m_rows[row_len * y], w, c, result + (size_t)y * w * result_channel, result_channel);
+        }
+    }
+
+    int GassianBlurFixed::process(const unsigned char *base_image_data,
+                                  unsigned int base_image_width,
+                                  unsigned int base_image_height,
+                                  unsigned int base_image_channel,
+                                  const unsigned char *filter_zone_image_data,
+                                  unsigned int filter_zone_image_width,
+                                  unsigned int filter_zone_image_height,
+                                  unsigned int filter_zone_image_channel,
+                                  unsigned char *result,
+                                  unsigned int result_channel)
+    {
+        if (nullptr == base_image_data || nullptr == filter_zone_image_data || nullptr == result ||
+            base_image_width == 0 || base_image_height == 0 ||
+            filter_zone_image_width == 0 || filter_zone_image_height == 0 ||
+            base_image_channel == 0 || base_image_channel > 4)
+        {
+            return -1;
+        }
+
+        const int w = (int)base_image_width;
+        const int h = (int)base_image_height;
+        const int c = (int)base_image_channel;
+        m_zone.resize((size_t)w * h);
+        buildZoneIndex(filter_zone_image_data, filter_zone_image_width, filter_zone_image_height,
+                       filter_zone_image_channel, w, h, m_zone.data());
+        m_taps.resize(2 * m_max_radius + 1);
+
+        filterRows(base_image_data, w, h, c);
+        int vertical_pass = m_vertical_pass;
+        if (vertical_pass == FIXED_VERTICAL_AUTO)
+        {
+            vertical_pass = (maxRadiusInUse() >= FIXED_TRANSPOSE_MIN_RADIUS) ? FIXED_VERTICAL_TRANSPOSED : FIXED_VERTICAL_STRIDED;
+        }
+        if (vertical_pass == FIXED_VERTICAL_STRIDED)
+            filterColumnsStrided(w, h, c, result, result_channel);
+        else
+            filterColumnsTransposed(w, h, c, result, result_channel);
+        return 0;
+    }
+}
@@ -0,0 +1,101 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 18:45:37
+ * @LastEditTime: 2026-10-19 20:02:14
+ * @LastEditors: Matt.SHI
+ * @Description: separable gaussian on 8-bit frames with 16-bit fixed point
+ *               weights, avx2 / ssse3 / plain c++ with the same rounding
+ * @FilePath: /opengl_demo/features/cpu/gaussian_blur_fixed.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_FIXED_H_
+#define _ESSILOR_GAUSSIAN_BLUR_FIXED_H_
+
+#include <stdint.h>
+#include <vector>
+
+namespace ESSILOR
+{
+    enum FixedVerticalPass
+    {
+        FIXED_VERTICAL_STRIDED = 0,     // taps read whole rows of the image
+        FIXED_VERTICAL_TRANSPOSED,      // blocked transpose, row kernel, transpose back
+        FIXED_VERTICAL_AUTO,            // transposed once a frame uses a wide kernel
+    };
+
+    class GassianBlurFixed
+    {
+        public:
+            GassianBlurFixed();
+            virtual ~GassianBlurFixed();
+
+        public:
+            // zone values sharing one kernel, 1..64
+            void set_zone_bucket_size(unsigned int bucket_size);
+            // FixedVerticalPass
+            void set_vertical_pass(int vertical_pass);
+
+            // same contract as GassianBlurIIR::process
+            int process(const unsigned char *base_image_data,
+                unsigned int base_image_width,
+                unsigned int base_image_height,
+                unsigned int base_image_channel,
+                const unsigned char *filter_zone_image_data,
+                unsigned int filter_zone_image_width,
+                unsigned int filter_zone_image_height,
+                unsigned int filter_zone_image_channel,
+                unsigned char *result,
+                unsigned int result_channel);
+
+            // name of the instruction set the kernels were built for
+            static const char *simdName();
+
+        protected:
+            // 2 * radius + 1 weights in Q15, they sum to exactly 32768
+            struct FixedKernel
+            {
+                int radius;
+                std::vector<int16_t> weights;
+            };
+
+            void buildKernels();
+            static void buildKernel(float sigma, FixedKernel &kernel);
+
+            // dst[i] = sum over k of taps[k][i] * weights[k], Q7 samples
+            static void accumulateTaps(const int16_t *const *taps, const int16_t *weights, int tap_count,
+                int16_t *dst, int count);
+            static void loadQ7(const unsigned char *src, int16_t *dst, int count);
+            static void storeQ7(const int16_t *src, unsigned char *dst, int count);
+
+            // padded holds pad replicated pixels on both sides of the w pixels
+            void filterRowRuns(const int16_t *padded, int pad, const unsigned char *zone_row,
+                int w, int c, int16_t *dst);
+            static void padRow(int16_t *padded, int pad, int w, int c);
+            void storeRow(const int16_t *row, int w, int c, unsigned char *dst, unsigned int result_channel);
+
+            int maxRadiusInUse() const;
+            void filterRows(const unsigned char *base_image_data, int w, int h, int c);
+            void filterColumnsStrided(int w, int h, int c, unsigned char *result, unsigned int result_channel);
+            void filterColumnsTransposed(int w, int h, int c, unsigned char *result, unsigned int result_channel);
+
+        private:
+            std::vector<FixedKernel> m_kernels;
+            unsigned char m_kernel_of_zone[256];
+            unsigned int m_bucket_size;
+            int m_max_radius;
+            int m_vertical_pass;
+
+            std::vector<unsigned char> m_zone;
+            std::vector<int16_t> m_padded_row;
+            std::vector<int16_t> m_rows;
+            std::vector<int16_t> m_out_row;
+            std::vector<unsigned char> m_out_row_u8;
+            std::vector<int16_t> m_transposed;
+            std::vector<int16_t> m_transposed_out;
+            std::vector<unsigned char> m_zone_transposed;
+            std::vector<const int16_t *> m_taps;
+    };
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_FIXED_H_
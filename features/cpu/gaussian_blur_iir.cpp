@@ -0,0 +1,219 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 16:32:18
+ * @LastEditTime: 2026-10-19 18:10:02
+ * @LastEditors: Matt.SHI
+ * @Description: recursive (Young - van Vliet) gaussian on the cpu
+ * @FilePath: /opengl_demo/features/cpu/gaussian_blur_iir.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "gaussian_blur_iir.h"
+#include "gaussian_blur_simd.h"
+#include "gaussian_blur_zone_index.h"
+
+#include <features/gaussian_blur_defines.h>
+
+#include <cmath>
+
+namespace ESSILOR
+{
+    GassianBlurIIR::GassianBlurIIR() : m_bucket_size(4)
+    {
+        buildCoefficients();
+    }
+
+    GassianBlurIIR::~GassianBlurIIR()
+    {
+    }
+
+    void GassianBlurIIR::set_zone_bucket_size(unsigned int bucket_size)
+    {
+        m_bucket_size = std::min(64u, std::max(1u, bucket_size));
+        buildCoefficients();
+    }
+
+    // every zone value of a bucket uses the coefficients of the bucket centre
+    void GassianBlurIIR::buildCoefficients()
+    {
+        for (unsigned int bucket_start = 0; bucket_start < 256; bucket_start += m_bucket_size)
+        {
+            float centre = bucket_start + (m_bucket_size - 1) * 0.5f;
+            IIRCoefficients coefficients = computeCoefficients(centre * GAUSSIAN_BLUR_ZONE_TO_SIGMA);
+            for (unsigned int v = bucket_start; v < std::min(256u, bucket_start + m_bucket_size); v++)
+            {
+                m_coefficients[v] = coefficients;
+            }
+        }
+    }
+
+    // I.T. Young, L.J. van Vliet, "Recursive implementation of the Gaussian
+    // filter", Signal Processing 44 (1995)
+    GassianBlurIIR::IIRCoefficients GassianBlurIIR::computeCoefficients(float sigma)
+    {
+        IIRCoefficients coefficients = {1.0f, 0.0f, 0.0f, 0.0f, {0.0f}};
+        // too small to blur, passes the signal through
+        if (sigma >= 0.5f)
+        {
+            double q = 0.0;
+            if (sigma >= 2.5f)
+                q = 0.98711 * sigma - 0.96330;
+            else
+                q = 3.97156 - 4.14554 * std::sqrt(1.0 - 0.26891 * sigma);
+
+            double q2 = q * q;
+            double q3 = q2 * q;
+            double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+            double b1 = 2.44413 * q + 2.85619 * q2 + 1.26661 * q3;
+            double b2 = -(1.4281 * q2 + 1.26661 * q3);
+            double b3 = 0.422205 * q3;
+
+            coefficients.b1 = (float)(b1 / b0);
+            coefficients.b2 = (float)(b2 / b0);
+            coefficients.b3 = (float)(b3 / b0);
+            coefficients.B = 1.0f - (coefficients.b1 + coefficients.b2 + coefficients.b3);
+        }
+
+        // B. Triggs, M. Sdika, "Boundary conditions for Young - van Vliet
+        // recursive filtering", IEEE Trans. Signal Processing 54 (2006)
+        double a1 = coefficients.b1;
+        double a2 = coefficients.b2;
+        double a3 = coefficients.b3;
+        double scale = 1.0 / ((1.0 + a1 - a2 + a3) * (1.0 - a1 - a2 - a3) * (1.0 + a2 + (a1 - a3) * a3));
+        double M[9] = {
+            -a3 * a1 + 1.0 - a3 * a3 - a2,
+            (a3 + a1) * (a2 + a3 * a1),
+            a3 * (a1 + a3 * a2),
+            a1 + a3 * a2,
+            -(a2 - 1.0) * (a2 + a3 * a1),
+            -a3 * (a3 * a1 + a3 * a3 + a2 - 1.0),
+            a3 * a1 + a2 + a1 * a1 - a2 * a2,
+            a1 * a2 + a3 * a2 * a2 - a1 * a3 * a3 - a3 * a3 * a3 - a3 * a2 + a3,
+            a3 * (a1 + a3 * a2)};
+        for (int k = 0; k < 9; k++)
+        {
+            coefficients.M[k] = (float)(scale * M[k] * coefficients.B);
+        }
+        return coefficients;
+    }
+
+    // in place, one rgba pixel per simd register. the coefficients follow the
+    // zone value of every pixel. outside the line the input repeats its edge
+    // pixel: the causal pass starts from the steady state of that constant, the
+    // anticausal pass from the Triggs - Sdika state, which also accounts for
+    // the causal outputs the clamped input would have produced past the end
+    void GassianBlurIIR::filterLine(Pixel4f *line, const unsigned char *zone_line, int count,
+                                    const IIRCoefficients *coefficients)
+    {
+        using namespace simd;
+
+        // causal pass
+        const f4 last = load4(line[count - 1].v);
+        f4 w1 = load4(line[0].v);
+        f4 w2 = w1;
+        f4 w3 = w1;
+        for (int i = 0; i < count; i++)
+        {
+            const IIRCoefficients &c = coefficients[zone_line[i]];
+            f4 w = mul4(set1(c.B), load4(line[i].v));
+            w = add4(w, mul4(set1(c.b1), w1));
+            w = add4(w, mul4(set1(c.b2), w2));
+            w = add4(w, mul4(set1(c.b3), w3));
+            store4(line[i].v, w);
+            w3 = w2;
+            w2 = w1;
+            w1 = w;
+        }
+
+        // anticausal pass, y1..y3 are the outputs at count - 1, count and
+        // count + 1 from the last three causal outputs w1..w3
+        const IIRCoefficients &e = coefficients[zone_line[count - 1]];
+        const f4 d1 = sub4(w1, last);
+        const f4 d2 = sub4(w2, last);
+        const f4 d3 = sub4(w3, last);
+        f4 y1 = add4(last, add4(mul4(set1(e.M[0]), d1), add4(mul4(set1(e.M[1]), d2), mul4(set1(e.M[2]), d3))));
+        f4 y2 = add4(last, add4(mul4(set1(e.M[3]), d1), add4(mul4(set1(e.M[4]), d2), mul4(set1(e.M[5]), d3))));
+        f4 y3 = add4(last, add4(mul4(set1(e.M[6]), d1), add4(mul4(set1(e.M[7]), d2), mul4(set1(e.M[8]), d3))));
+        store4(line[count - 1].v, y1);
+        for (int i = count - 2; i >= 0; i--)
+        {
+            const IIRCoefficients &c = coefficients[zone_line[i]];
+            f4 y = mul4(set1(c.B), load4(line[i].v));
+            y = add4(y, mul4(set1(c.b1), y1));
+            y = add4(y, mul4(set1(c.b2), y2));
+            y = add4(y, mul4(set1(c.b3), y3));
+            store4(line[i].v, y);
+            y3 = y2;
+            y2 = y1;
+            y1 = y;
+        }
+    }
+
+    int GassianBlurIIR::process(const unsigned char *base_image_data,
+                                unsigned int base_image_width,
+                                unsigned int base_image_height,
+                                unsigned int base_image_channel,
+                                const unsigned char *filter_zone_image_data,
+                                unsigned int filter_zone_image_width,
+                                unsigned int filter_zone_image_height,
+                                unsigned int filter_zone_image_channel,
+                                unsigned char *result,
+                                unsigned int result_channel)
+    {
+        if (nullptr == base_image_data || nullptr == filter_zone_image_data || nullptr == result ||
+            base_image_width == 0 || base_image_height == 0 ||
+            filter_zone_image_width == 0 || filter_zone_image_height == 0)
+        {
+            return -1;
+        }
+
+        const int w = (int)base_image_width;
+        const int h = (int)base_image_height;
+        const size_t pixel_count = (size_t)w * h;
+        m_image.resize(pixel_count);
+        m_transposed.resize(pixel_count);
+        m_zone.resize(pixel_count);
+        m_zone_transposed.resize(pixel_count);
+
+        // widen to float rgba, missing channels become opaque / gray
+        for (size_t i = 0; i < pixel_count; i++)
+        {
+            const unsigned char *src = base_image_data + i * base_image_channel;
+            float *dst = m_image[i].v;
+            dst[0] = src[0];
+            dst[1] = (base_image_channel > 1) ? src[1] : src[0];
+            dst[2] = (base_image_channel > 2) ? src[2] : src[0];
+            dst[3] = (base_image_channel > 3) ? src[3] : 255.0f;
+        }
+
+        buildZoneIndex(filter_zone_image_data, filter_zone_image_width, filter_zone_image_height,
+                       filter_zone_image_channel, w, h, m_zone.data());
+
+        // rows
+        for (int y = 0; y < h; y++)
+        {
+            filterLine(&m_image[(size_t)y * w], &m_zone[(size_t)y * w], w, m_coefficients);
+        }
+
+        // columns run as rows of the transposed image
+        transposeBlocked(m_image.data(), w, h, m_transposed.data());
+        transposeBlocked(m_zone.data(), w, h, m_zone_transposed.data());
+        for (int x = 0; x < w; x++)
+        {
+            filterLine(&m_transposed[(size_t)x * h], &m_zone_transposed[(size_t)x * h], h, m_coefficients);
+        }
+        transposeBlocked(m_transposed.data(), h, w, m_image.data());
+
+        for (size_t i = 0; i < pixel_count; i++)
+        {
+            const float *src = m_image[i].v;
+            unsigned char *dst = result + i * result_channel;
+            for (unsigned int k = 0; k < result_channel && k < 4; k++)
+            {
+                float v = src[k] + 0.5f;
+                dst[k] = (unsigned char)(v <= 0.0f ? 0.0f : (v >= 255.0f ? 255.0f : v));
+            }
+        }
+        return 0;
+    }
+}
@@ -0,0 +1,72 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 16:32:18
+ * @LastEditTime: 2026-10-19 18:10:02
+ * @LastEditors: Matt.SHI
+ * @Description: recursive (Young - van Vliet) gaussian on the cpu, the cost per
+ *               pixel does not depend on the blur radius
+ * @FilePath: /opengl_demo/features/cpu/gaussian_blur_iir.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_IIR_H_
+#define _ESSILOR_GAUSSIAN_BLUR_IIR_H_
+
+#include "gaussian_blur_transpose.h"
+
+#include <vector>
+
+namespace ESSILOR
+{
+    class GassianBlurIIR
+    {
+        public:
+            GassianBlurIIR();
+            virtual ~GassianBlurIIR();
+
+        public:
+            // zone values sharing one coefficient set, 1..64
+            void set_zone_bucket_size(unsigned int bucket_size);
+
+            // base and result have the same size, the filter zone image is
+            // sampled nearest when its size differs. returns 0 on success
+            int process(const unsigned char *base_image_data,
+                unsigned int base_image_width,
+                unsigned int base_image_height,
+                unsigned int base_image_channel,
+                const unsigned char *filter_zone_image_data,
+                unsigned int filter_zone_image_width,
+                unsigned int filter_zone_image_height,
+                unsigned int filter_zone_image_channel,
+                unsigned char *result,
+                unsigned int result_channel);
+
+        protected:
+            // third order causal + anticausal recursion, normalized by b0
+            struct IIRCoefficients
+            {
+                float B;
+                float b1;
+                float b2;
+                float b3;
+                // Triggs - Sdika boundary matrix, premultiplied by B
+                float M[9];
+            };
+
+            void buildCoefficients();
+            static IIRCoefficients computeCoefficients(float sigma);
+            static void filterLine(Pixel4f *line, const unsigned char *zone_line, int count,
+                const IIRCoefficients *coefficients);
+
+        private:
+            IIRCoefficients m_coefficients[256];
+            unsigned int m_bucket_size;
+
+            std::vector<Pixel4f> m_image;
+            std::vector<Pixel4f> m_transposed;
+            std::vector<unsigned char> m_zone;
+            std::vector<unsigned char> m_zone_transposed;
+    };
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_IIR_H_
@@ -0,0 +1,54 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 16:11:40
+ * @LastEditTime: 2026-10-19 16:11:40
+ * @LastEditors: Matt.SHI
+ * @Description: 4 lane float helpers for the cpu engines, sse / neon / plain c++
+ * @FilePath: /opengl_demo/features/cpu/gaussian_blur_simd.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_SIMD_H_
+#define _ESSILOR_GAUSSIAN_BLUR_SIMD_H_
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define GAUSSIAN_BLUR_SIMD_SSE 1
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define GAUSSIAN_BLUR_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace ESSILOR
+{
+namespace simd
+{
+#if defined(GAUSSIAN_BLUR_SIMD_SSE)
+    typedef __m128 f4;
+    inline f4 load4(const float *p) { return _mm_load_ps(p); }
+    inline void store4(float *p, f4 v) { _mm_store_ps(p, v); }
+    inline f4 set1(float v) { return _mm_set1_ps(v); }
+    inline f4 add4(f4 a, f4 b) { return _mm_add_ps(a, b); }
+    inline f4 sub4(f4 a, f4 b) { return _mm_sub_ps(a, b); }
+    inline f4 mul4(f4 a, f4 b) { return _mm_mul_ps(a, b); }
+#elif defined(GAUSSIAN_BLUR_SIMD_NEON)
+    typedef float32x4_t f4;
+    inline f4 load4(const float *p) { return vld1q_f32(p); }
+    inline void store4(float *p, f4 v) { vst1q_f32(p, v); }
+    inline f4 set1(float v) { return vdupq_n_f32(v); }
+    inline f4 add4(f4 a, f4 b) { return vaddq_f32(a, b); }
+    inline f4 sub4(f4 a, f4 b) { return vsubq_f32(a, b); }
+    inline f4 mul4(f4 a, f4 b) { return vmulq_f32(a, b); }
+#else
+    struct f4 { float v[4]; };
+    inline f4 load4(const float *p) { f4 r = {{p[0], p[1], p[2], p[3]}}; return r; }
+    inline void store4(float *p, f4 a) { p[0] = a.v[0]; p[1] = a.v[1]; p[2] = a.v[2]; p[3] = a.v[3]; }
+    inline f4 set1(float v) { f4 r = {{v, v, v, v}}; return r; }
+    inline f4 add4(f4 a, f4 b) { f4 r = {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}}; return r; }
+    inline f4 sub4(f4 a, f4 b) { f4 r = {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}}; return r; }
+    inline f4 mul4(f4 a, f4 b) { f4 r = {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}}; return r; }
+#endif
+}
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_SIMD_H_
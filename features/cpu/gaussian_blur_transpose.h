@@ -0,0 +1,76 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 16:20:51
+ * @LastEditTime: 2026-10-19 16:20:51
+ * @LastEditors: Matt.SHI
+ * @Description: cache blocked transposes, column passes run on transposed rows
+ * @FilePath: /opengl_demo/features/cpu/gaussian_blur_transpose.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_TRANSPOSE_H_
+#define _ESSILOR_GAUSSIAN_BLUR_TRANSPOSE_H_
+
+#include <algorithm>
+#include <stdint.h>
+
+namespace ESSILOR
+{
+    // one rgba pixel of the float working images
+    struct alignas(16) Pixel4f
+    {
+        float v[4];
+    };
+
+    // one pixel of the fixed point working images
+    template<int C>
+    struct PixelS16
+    {
+        int16_t v[C];
+    };
+
+    // src is w x h, dst becomes h x w. the image is walked in tile x tile
+    // blocks so both the read and the write side of a block stay in L1
+    template<typename PIXEL>
+    inline void transposeBlocked(const PIXEL *src, int w, int h, PIXEL *dst, int tile = 16)
+    {
+        for (int ty = 0; ty < h; ty += tile)
+        {
+            int ty_end = std::min(ty + tile, h);
+            for (int tx = 0; tx < w; tx += tile)
+            {
+                int tx_end = std::min(tx + tile, w);
+                for (int y = ty; y < ty_end; y++)
+                {
+                    const PIXEL *src_row = src + (size_t)y * w;
+                    for (int x = tx; x < tx_end; x++)
+                    {
+                        dst[(size_t)x * h + y] = src_row[x];
+                    }
+                }
+            }
+        }
+    }
+
+    // transposeBlocked over int16 pixels with a channel count known at run time
+    inline void transposeBlockedChannels(const int16_t *src, int w, int h, int c, int16_t *dst, int tile = 16)
+    {
+        switch (c)
+        {
+        case 1:
+            transposeBlocked((const PixelS16<1> *)src, w, h, (PixelS16<1> *)dst, tile);
+            break;
+        case 2:
+            transposeBlocked((const PixelS16<2> *)src, w, h, (PixelS16<2> *)dst, tile);
+            break;
+        case 3:
+            transposeBlocked((const PixelS16<3> *)src, w, h, (PixelS16<3> *)dst, tile);
+            break;
+        default:
+            transposeBlocked((const PixelS16<4> *)src, w, h, (PixelS16<4> *)dst, tile);
+            break;
+        }
+    }
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_TRANSPOSE_H_
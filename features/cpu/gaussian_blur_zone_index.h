@@ -0,0 +1,39 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 18:42:05
+ * @LastEditTime: 2026-10-19 18:42:05
+ * @LastEditors: Matt.SHI
+ * @Description: per pixel zone values for the cpu engines
+ * @FilePath: /opengl_demo/features/cpu/gaussian_blur_zone_index.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_ZONE_INDEX_H_
+#define _ESSILOR_GAUSSIAN_BLUR_ZONE_INDEX_H_
+
+#include <stddef.h>
+
+namespace ESSILOR
+{
+    // w x h zone values, nearest sample of the first channel of the zone image
+    inline void buildZoneIndex(const unsigned char *filter_zone_image_data,
+                               unsigned int filter_zone_image_width,
+                               unsigned int filter_zone_image_height,
+                               unsigned int filter_zone_image_channel,
+                               int w, int h, unsigned char *dst)
+    {
+        for (int y = 0; y < h; y++)
+        {
+            unsigned int zy = (unsigned int)((unsigned long)y * filter_zone_image_height / h);
+            const unsigned char *zone_row = filter_zone_image_data + (size_t)zy * filter_zone_image_width * filter_zone_image_channel;
+            unsigned char *dst_row = dst + (size_t)y * w;
+            for (int x = 0; x < w; x++)
+            {
+                unsigned int zx = (unsigned int)((unsigned long)x * filter_zone_image_width / w);
+                dst_row[x] = zone_row[zx * filter_zone_image_channel];
+            }
+        }
+    }
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_ZONE_INDEX_H_
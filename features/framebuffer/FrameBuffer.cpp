@@ -8,10 +8,11 @@
 // single-sampled FBO. If msaa > 0 (even number), it creates a multi-sampled
 // FBO.
 //
-// NOTE: This class does not use GL_ARB_texture_multisample extension yet. Call
-//       update() function explicitly to blit color/depth buffers from
-//       multi-sample FBO to single-sample FBO if you want to get single-sample
-//       color and depth data from MSAA FBO.
+// With FrameBufferDesc::msaaTextures the multi-sample color attachments are
+// GL_ARB_texture_multisample textures, a shader may resolve them itself.
+// Otherwise call update() function explicitly to blit color/depth buffers from
+// multi-sample FBO to single-sample FBO if you want to get single-sample color
+// and depth data from MSAA FBO.
 //
 //  AUTHOR: Song Ho Ahn (song.ahn@gmail.com)
 // CREATED: 2015-03-05
@@ -19,19 +20,78 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <sstream>
+#include <cstring>
+#include <algorithm>
+#include <mutex>
+#include <new>
 #include "glExtension.h"
 #include "FrameBuffer.h"
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// KHR_debug group around the work of one call, so a capture tool shows which
+// FrameBuffer step a blit or a readback belongs to. no-op without KHR_debug
+///////////////////////////////////////////////////////////////////////////////
+static void pushDebugGroup(const char* name)
+{
+#ifndef __APPLE__
+    if(!glExtension::getInstance().hasFeature(glExtension::FEATURE_KHR_DEBUG))
+        return;
+#ifdef _WIN32
+    if(!glPushDebugGroup)
+        return;
+#endif
+    glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+#endif
+}
+
+static void popDebugGroup()
+{
+#ifndef __APPLE__
+    if(!glExtension::getInstance().hasFeature(glExtension::FEATURE_KHR_DEBUG))
+        return;
+#ifdef _WIN32
+    if(!glPopDebugGroup)
+        return;
+#endif
+    glPopDebugGroup();
+#endif
+}
+
+struct DebugGroupScope
+{
+    DebugGroupScope(const char* name) { pushDebugGroup(name); }
+    ~DebugGroupScope()                { popDebugGroup(); }
+};
+
+
+
+// live instances for the memory accounting, workers create their own
+static std::mutex instanceMutex;
+static std::vector<const FrameBuffer*> instances;
+
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // ctor
 ///////////////////////////////////////////////////////////////////////////////
 FrameBuffer::FrameBuffer() : width(0), height(0), msaa(0), colorBuffer(0), depthBuffer(0),
-                             fboMsaaId(0), rboMsaaColorId(0), rboMsaaDepthId(0),
-                             fboId(0), texId(0), rboId(0),
-                             errorMessage("no error")
+                             colorBufferBytes(0), depthBufferBytes(0),
+                             allocFunc(0), freeFunc(0), allocUserData(0),
+                             fboMsaaId(0), rboMsaaDepthId(0),
+                             fboId(0), rboId(0),
+                             errorMessage("no error"), nextTicket(1)
 {
+    for(int i = 0; i < FRAME_BUFFER_MAX_COLOR_ATTACHMENTS; ++i)
+    {
+        rboMsaaColorIds[i] = 0;
+        texMsaaIds[i] = 0;
+        texIds[i] = 0;
+    }
+
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    instances.push_back(this);
 }
 
 
@@ -42,6 +102,9 @@ FrameBuffer::FrameBuffer() : width(0), height(0), msaa(0), colorBuffer(0), depth
 FrameBuffer::~FrameBuffer()
 {
     deleteBuffers();
+
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    instances.erase(std::remove(instances.begin(), instances.end(), this), instances.end());
 }
 
 
@@ -49,18 +112,31 @@ FrameBuffer::~FrameBuffer()
 ///////////////////////////////////////////////////////////////////////////////
 // create buffers
 ///////////////////////////////////////////////////////////////////////////////
-bool FrameBuffer::init(int width, int height, int msaa)
+bool FrameBuffer::init(int width, int height, int msaa, GLenum colorFormat)
+{
+    // callers of this form always got a mipmap chain from update()
+    FrameBufferDesc desc(width, height, colorFormat, true, msaa);
+    desc.mipmaps = true;
+    return init(desc);
+}
+
+bool FrameBuffer::init(const FrameBufferDesc& desc)
 {
+    DebugGroupScope group("FrameBuffer::init");
+
     // check w/h
-    if(width <= 0 || height <= 0)
+    if(desc.width <= 0 || desc.height <= 0)
     {
         errorMessage = "The buffer size is not positive.";
         return true;
     }
 
-    // validate multi sample count
-    int maxMsaa = 0;
-    glGetIntegerv(GL_MAX_SAMPLES, &maxMsaa);
+    // validate multi sample count, against the texture limit for textures
+    const glExtension& ext = glExtension::getInstance();
+    int maxMsaa = ext.getLimits().maxSamples;
+    if(desc.msaaTextures)
+        maxMsaa = std::min(maxMsaa, ext.getLimits().maxColorTextureSamples);
+    int msaa = desc.msaa;
     if(msaa < 0)
         msaa = 0;
     else if(msaa > maxMsaa)
@@ -68,43 +144,28 @@ bool FrameBuffer::init(int width, int height, int msaa)
     else if(msaa % 2 != 0)
         msaa--;
 
+    // validate color attachment count
+    int maxColors = std::min(ext.getLimits().maxColorAttachments, ext.getLimits().maxDrawBuffers);
+    int colorCount = std::max(0, std::min(desc.colorCount, std::min(maxColors, FRAME_BUFFER_MAX_COLOR_ATTACHMENTS)));
+
     // reset error message
     errorMessage = "no error";
 
-    this->width = width;
-    this->height = height;
-    this->msaa = msaa;
-
-    // reset buffers
+    // reset buffers, the arrays are allocated by the first copy
     deleteBuffers();
 
-    // create arrays
-    colorBuffer = new unsigned char[width * height * 4];    // 32 bits per pixel
-    depthBuffer = new float[width * height];                // 32 bits per pixel
-
-    // create single-sample FBO
-    glGenFramebuffers(1, &fboId);
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-
-    // create a texture object to store colour info, and attach it to fbo
-    glGenTextures(1, &texId);
-    glBindTexture(GL_TEXTURE_2D, texId);
-    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE); // automatic mipmap generation included in OpenGL v1.4
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texId, 0);
-
-    // create a renderbuffer object to store depth info, attach it to fbo
-    glGenRenderbuffers(1, &rboId);
-    glBindRenderbuffer(GL_RENDERBUFFER, rboId);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rboId);
+    this->desc = desc;
+    this->desc.msaa = msaa;
+    this->desc.colorCount = colorCount;
+    this->width = desc.width;
+    this->height = desc.height;
+    this->msaa = msaa;
 
-    // check FBO completeness
-    bool status = checkFrameBufferStatus();
+    // with multi-sample textures a shader can resolve on its own, the
+    // single-sample fbo is only created by the first update() or copy
+    bool status = true;
+    if(msaa == 0 || !this->desc.msaaTextures)
+        status = createResolveBuffers();
 
     // create multi-sample fbo
     if(msaa > 0)
@@ -112,21 +173,39 @@ bool FrameBuffer::init(int width, int height, int msaa)
         glGenFramebuffers(1, &fboMsaaId);
         glBindFramebuffer(GL_FRAMEBUFFER, fboMsaaId);
 
-        // create a render buffer object to store colour info
-        glGenRenderbuffers(1, &rboMsaaColorId);
-        glBindRenderbuffer(GL_RENDERBUFFER, rboMsaaColorId);
-        glRenderbufferStorageMultisample(GL_RENDERBUFFER, msaa, GL_RGBA8, width, height);
-
-        // attach a renderbuffer to FBO color attachment point
-        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, rboMsaaColorId);
+        // create render buffer objects (or multisample textures) to store
+        // colour info and attach them
+        for(int i = 0; i < colorCount; ++i)
+        {
+            if(this->desc.msaaTextures)
+            {
+                // fixed sample locations, required next to a renderbuffer depth
+                glGenTextures(1, &texMsaaIds[i]);
+                glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, texMsaaIds[i]);
+                glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, msaa, this->desc.colorFormats[i], width, height, GL_TRUE);
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D_MULTISAMPLE, texMsaaIds[i], 0);
+            }
+            else
+            {
+                glGenRenderbuffers(1, &rboMsaaColorIds[i]);
+                glBindRenderbuffer(GL_RENDERBUFFER, rboMsaaColorIds[i]);
+                glRenderbufferStorageMultisample(GL_RENDERBUFFER, msaa, this->desc.colorFormats[i], width, height);
+                glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_RENDERBUFFER, rboMsaaColorIds[i]);
+            }
+        }
+        glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
+        setDrawBuffers();
 
-        // create a renderbuffer object to store depth info
-        glGenRenderbuffers(1, &rboMsaaDepthId);
-        glBindRenderbuffer(GL_RENDERBUFFER, rboMsaaDepthId);
-        glRenderbufferStorageMultisample(GL_RENDERBUFFER, msaa, GL_DEPTH_COMPONENT, width, height);
+        if(this->desc.depth)
+        {
+            // create a renderbuffer object to store depth info
+            glGenRenderbuffers(1, &rboMsaaDepthId);
+            glBindRenderbuffer(GL_RENDERBUFFER, rboMsaaDepthId);
+            glRenderbufferStorageMultisample(GL_RENDERBUFFER, msaa, GL_DEPTH_COMPONENT, width, height);
 
-        // attach a renderbuffer to FBO depth attachment point
-        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rboMsaaDepthId);
+            // attach a renderbuffer to FBO depth attachment point
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rboMsaaDepthId);
+        }
 
         // check FBO completeness again
         status = checkFrameBufferStatus();
@@ -141,15 +220,112 @@ bool FrameBuffer::init(int width, int height, int msaa)
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// create the single-sample fbo, its textures and depth rbo. the multi-sample
+// fbo resolves into them
+///////////////////////////////////////////////////////////////////////////////
+bool FrameBuffer::createResolveBuffers()
+{
+    // create single-sample FBO
+    glGenFramebuffers(1, &fboId);
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+
+    // create texture objects to store colour info, and attach them to fbo
+    for(int i = 0; i < desc.colorCount; ++i)
+    {
+        GLenum format = desc.colorFormats[i];
+        glGenTextures(1, &texIds[i]);
+        glBindTexture(GL_TEXTURE_2D, texIds[i]);
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        if(desc.mipmaps)
+        {
+            glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE); // automatic mipmap generation included in OpenGL v1.4
+        }
+        else
+        {
+            // level 0 alone is complete, nobody pays for a chain nobody samples
+            glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+        }
+        // no data is uploaded, the type only has to suit the format
+        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, GL_RGBA,
+                     isFloatFormat(format) ? GL_FLOAT : GL_UNSIGNED_BYTE, 0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, texIds[i], 0);
+    }
+    setDrawBuffers();
+
+    // create a renderbuffer object to store depth info, attach it to fbo
+    if(desc.depth)
+    {
+        glGenRenderbuffers(1, &rboId);
+        glBindRenderbuffer(GL_RENDERBUFFER, rboId);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rboId);
+    }
+
+    // check FBO completeness
+    bool status = checkFrameBufferStatus();
+
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return status;
+}
+
+// creates them on first use, changes the framebuffer binding then
+bool FrameBuffer::ensureResolveBuffers()
+{
+    if(fboId)
+        return true;
+    if(width <= 0 || height <= 0)
+        return false;
+    return createResolveBuffers();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// one draw writes every color attachment, fragment output i to attachment i
+// (assume the FBO is bound)
+///////////////////////////////////////////////////////////////////////////////
+void FrameBuffer::setDrawBuffers()
+{
+    if(desc.colorCount == 0)
+    {
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+        return;
+    }
+    GLenum drawBuffers[FRAME_BUFFER_MAX_COLOR_ATTACHMENTS];
+    for(int i = 0; i < desc.colorCount; ++i)
+        drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+    glDrawBuffers(desc.colorCount, drawBuffers);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+}
+
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // clear the previous buffers
 ///////////////////////////////////////////////////////////////////////////////
 void FrameBuffer::deleteBuffers()
 {
-    if(rboMsaaColorId)
+    deleteReadbacks();
+
+    for(int i = 0; i < FRAME_BUFFER_MAX_COLOR_ATTACHMENTS; ++i)
     {
-        glDeleteRenderbuffers(1, &rboMsaaColorId);
-        rboMsaaColorId = 0;
+        if(rboMsaaColorIds[i])
+        {
+            glDeleteRenderbuffers(1, &rboMsaaColorIds[i]);
+            rboMsaaColorIds[i] = 0;
+        }
+        if(texMsaaIds[i])
+        {
+            glDeleteTextures(1, &texMsaaIds[i]);
+            texMsaaIds[i] = 0;
+        }
     }
     if(rboMsaaDepthId)
     {
@@ -161,10 +337,13 @@ void FrameBuffer::deleteBuffers()
         glDeleteFramebuffers(1, &fboMsaaId);
         fboMsaaId = 0;
     }
-    if(texId)
+    for(int i = 0; i < FRAME_BUFFER_MAX_COLOR_ATTACHMENTS; ++i)
     {
-        glDeleteTextures(1, &texId);
-        texId = 0;
+        if(texIds[i])
+        {
+            glDeleteTextures(1, &texIds[i]);
+            texIds[i] = 0;
+        }
     }
     if(rboId)
     {
@@ -177,8 +356,179 @@ void FrameBuffer::deleteBuffers()
         fboId = 0;
     }
 
-    delete [] colorBuffer;  colorBuffer = 0;
-    delete [] depthBuffer;  depthBuffer = 0;
+    releaseShadowBuffers();
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// CPU copies of the color/depth buffer, allocated on demand
+///////////////////////////////////////////////////////////////////////////////
+void FrameBuffer::setShadowAllocator(FrameBufferAllocFunc allocFunc, FrameBufferFreeFunc freeFunc, void* userData)
+{
+    releaseShadowBuffers();
+    // both or none, memory must go back where it came from
+    bool custom = allocFunc && freeFunc;
+    this->allocFunc = custom ? allocFunc : 0;
+    this->freeFunc = custom ? freeFunc : 0;
+    this->allocUserData = custom ? userData : 0;
+}
+
+void* FrameBuffer::allocShadowBuffer(size_t bytes)
+{
+    if(allocFunc)
+        return allocFunc(bytes, allocUserData);
+    return new (std::nothrow) unsigned char[bytes];
+}
+
+void FrameBuffer::releaseShadowBuffers()
+{
+    void* buffers[2] = {colorBuffer, depthBuffer};
+    size_t sizes[2] = {colorBufferBytes, depthBufferBytes};
+    for(int i = 0; i < 2; ++i)
+    {
+        if(!buffers[i])
+            continue;
+        if(freeFunc)
+            freeFunc(buffers[i], sizes[i], allocUserData);
+        else
+            delete [] (unsigned char*)buffers[i];
+    }
+    colorBuffer = 0;
+    depthBuffer = 0;
+    colorBufferBytes = 0;
+    depthBufferBytes = 0;
+}
+
+bool FrameBuffer::ensureColorBuffer()
+{
+    if(!colorBuffer && width > 0 && height > 0)
+    {
+        colorBuffer = (unsigned char*)allocShadowBuffer((size_t)width * height * 4);   // 32 bits per pixel
+        colorBufferBytes = colorBuffer ? (size_t)width * height * 4 : 0;
+    }
+    return colorBuffer != 0;
+}
+
+bool FrameBuffer::ensureDepthBuffer()
+{
+    if(!depthBuffer && width > 0 && height > 0)
+    {
+        depthBuffer = (float*)allocShadowBuffer((size_t)width * height * sizeof(float));
+        depthBufferBytes = depthBuffer ? (size_t)width * height * sizeof(float) : 0;
+    }
+    return depthBuffer != 0;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// memory accounting
+///////////////////////////////////////////////////////////////////////////////
+size_t FrameBuffer::getFormatBytes(GLenum format)
+{
+    switch(format)
+    {
+    case GL_R8:             return 1;
+    case GL_RG8:            return 2;
+    case GL_R16F:           return 2;
+    case GL_RG16F:          return 4;
+    case GL_R32F:           return 4;
+    case GL_RG32F:          return 8;
+    case GL_R11F_G11F_B10F: return 4;
+    case GL_RGB16F:         return 6;
+    case GL_RGBA16F:        return 8;
+    case GL_RGB32F:         return 12;
+    case GL_RGBA32F:        return 16;
+    default:                return 4;
+    }
+}
+
+bool FrameBuffer::isFloatFormat(GLenum format)
+{
+    switch(format)
+    {
+    case GL_R16F:
+    case GL_RG16F:
+    case GL_R32F:
+    case GL_RG32F:
+    case GL_R11F_G11F_B10F:
+    case GL_RGB16F:
+    case GL_RGBA16F:
+    case GL_RGB32F:
+    case GL_RGBA32F:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t FrameBuffer::getPixelBytes(const FrameBufferDesc& desc)
+{
+    // color attachments and depth24 rbo
+    size_t pixelBytes = desc.depth ? 4 : 0;
+    for(int i = 0; i < desc.colorCount; ++i)
+        pixelBytes += getFormatBytes(desc.colorFormats[i]);
+    return pixelBytes;
+}
+
+size_t FrameBuffer::estimateGpuBytes(const FrameBufferDesc& desc)
+{
+    // what init() creates: the single-sample textures unless multi-sample
+    // textures defer them to the first resolve, plus the multi-sample storage
+    size_t pixels = (size_t)desc.width * desc.height;
+    size_t pixelBytes = getPixelBytes(desc);
+    size_t bytes = 0;
+    if(desc.msaa == 0 || !desc.msaaTextures)
+        bytes += pixels * pixelBytes;
+    if(desc.msaa > 0)
+        bytes += pixels * desc.msaa * pixelBytes;
+    return bytes;
+}
+
+size_t FrameBuffer::getGpuBytes() const
+{
+    if(!fboId && !fboMsaaId)
+        return 0;
+    size_t bytes = estimateGpuBytes(desc);
+    // single-sample textures created later by a resolve
+    if(fboId && msaa > 0 && desc.msaaTextures)
+        bytes += (size_t)width * height * getPixelBytes(desc);
+    return bytes;
+}
+
+FrameBufferMemoryStats FrameBuffer::getMemoryStats()
+{
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    FrameBufferMemoryStats stats = {0, 0, 0};
+    for(size_t i = 0; i < instances.size(); ++i)
+    {
+        stats.count++;
+        stats.gpuBytes += instances[i]->getGpuBytes();
+        stats.cpuBytes += instances[i]->getCpuBytes();
+    }
+    return stats;
+}
+
+std::string FrameBuffer::getMemoryReport()
+{
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    std::stringstream ss;
+    size_t gpuBytes = 0;
+    size_t cpuBytes = 0;
+    for(size_t i = 0; i < instances.size(); ++i)
+    {
+        const FrameBuffer* fb = instances[i];
+        ss << "FBO " << fb->getId() << ": " << fb->width << "x" << fb->height << ", " << fb->desc.colorCount << " color";
+        for(int c = 0; c < fb->desc.colorCount; ++c)
+            ss << " " << convertInternalFormatToString(fb->desc.colorFormats[c]);
+        ss << (fb->desc.depth ? ", depth" : ", no depth") << ", MSAA " << fb->msaa
+           << ", GPU " << fb->getGpuBytes() / 1024 << " KB, CPU " << fb->getCpuBytes() / 1024 << " KB" << std::endl;
+        gpuBytes += fb->getGpuBytes();
+        cpuBytes += fb->getCpuBytes();
+    }
+    ss << instances.size() << " frame buffers, GPU " << gpuBytes / 1024 << " KB, CPU " << cpuBytes / 1024 << " KB" << std::endl;
+    return ss.str();
 }
 
 
@@ -217,36 +567,78 @@ void FrameBuffer::unbind()
 ///////////////////////////////////////////////////////////////////////////////
 // explicitly blit color/depth buffer from multi-sample fbo to single-sample fbo
 // this call is necessary to update the single-sample color/depth buffer and to
-// generate mipmaps explicitly
+// generate mipmaps explicitly (only if the FBO was created with mipmaps).
+// A shader reading getMsaaColorId() directly does not need it at all.
 ///////////////////////////////////////////////////////////////////////////////
 void FrameBuffer::update()
 {
+    DebugGroupScope group("FrameBuffer::update");
+    if(!ensureResolveBuffers())
+        return;
     if(msaa > 0)
     {
-        // blit color buffer
-        glBindFramebuffer(GL_READ_FRAMEBUFFER, fboMsaaId);
-        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fboId);
-        glBlitFramebuffer(0, 0, width, height,
-                          0, 0, width, height,
-                          GL_COLOR_BUFFER_BIT,
-                          GL_LINEAR);
+        // blit color buffers
+        resolveColor();
 
         //NOTE: blit separately depth buffer because different scale filter
         //NOTE: scale filter for depth buffer must be GL_NEAREST, otherwise, invalid op
-        glBlitFramebuffer(0, 0, width, height,
-                          0, 0, width, height,
-                          GL_DEPTH_BUFFER_BIT,
-                          GL_NEAREST);
+        if(desc.depth)
+        {
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, fboMsaaId);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fboId);
+            glBlitFramebuffer(0, 0, width, height,
+                              0, 0, width, height,
+                              GL_DEPTH_BUFFER_BIT,
+                              GL_NEAREST);
+        }
     }
 
-    // also, generate mipmaps for color buffer (texture)
-    glBindTexture(GL_TEXTURE_2D, texId);
-    glGenerateMipmap(GL_TEXTURE_2D);
+    // also, generate mipmaps for color buffers (textures)
+    if(desc.mipmaps)
+        generateMipmaps();
+}
+
+void FrameBuffer::generateMipmaps()
+{
+    if(!desc.mipmaps || !fboId)
+        return;
+    for(int i = 0; i < desc.colorCount; ++i)
+    {
+        glBindTexture(GL_TEXTURE_2D, texIds[i]);
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// blit every multi-sample color attachment to the texture of the same index.
+// a blit writes all draw buffers of the destination, so they are narrowed to
+// one attachment at a time and restored afterwards
+///////////////////////////////////////////////////////////////////////////////
+void FrameBuffer::resolveColor()
+{
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fboMsaaId);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fboId);
+    for(int i = 0; i < desc.colorCount; ++i)
+    {
+        glReadBuffer(GL_COLOR_ATTACHMENT0 + i);
+        glDrawBuffer(GL_COLOR_ATTACHMENT0 + i);
+        glBlitFramebuffer(0, 0, width, height,
+                          0, 0, width, height,
+                          GL_COLOR_BUFFER_BIT,
+                          GL_LINEAR);
+    }
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    setDrawBuffers();
+    glBindFramebuffer(GL_FRAMEBUFFER, fboMsaaId);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+}
+
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // copy the color/depth buffer to the destination FBO
 // x, y, width and height params are the dimension of the destination FBO.
@@ -291,10 +683,15 @@ void FrameBuffer::blitDepthTo(GLuint dstId, int x, int y, int width, int height)
 ///////////////////////////////////////////////////////////////////////////////
 void FrameBuffer::copyColorBuffer()
 {
+    DebugGroupScope group("FrameBuffer::copyColorBuffer");
+    if(desc.colorCount == 0 || !ensureResolveBuffers())
+        return;
     if(msaa > 0)
     {
-        blitColorTo(fboId); // copy multi-sample to single-sample first
+        resolveColor(); // copy multi-sample to single-sample first
     }
+    if(!ensureColorBuffer())
+        return;
     // store pixel data to internal array
     glBindFramebuffer(GL_READ_FRAMEBUFFER, fboId);
     glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, colorBuffer);
@@ -308,16 +705,169 @@ void FrameBuffer::copyColorBuffer()
 ///////////////////////////////////////////////////////////////////////////////
 void FrameBuffer::copyDepthBuffer()
 {
+    DebugGroupScope group("FrameBuffer::copyDepthBuffer");
+    if(!desc.depth || !ensureResolveBuffers())
+        return;
     if(msaa > 0)
     {
         blitDepthTo(fboId);  // copy multi-sample to single-sample first
     }
+    if(!ensureDepthBuffer())
+        return;
     glBindFramebuffer(GL_READ_FRAMEBUFFER, fboId);
     glReadPixels(0, 0, width, height, GL_DEPTH_COMPONENT, GL_FLOAT, depthBuffer);
 }
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// start an asynchronous copy of the color/depth buffer into a pixel pack
+// buffer. glReadPixels returns immediately, a fence tells when the copy is done
+// If MSAA > 0, copy multi-sample buffer to single-sample buffer first
+///////////////////////////////////////////////////////////////////////////////
+int FrameBuffer::requestColorReadback()
+{
+    return requestReadback(false);
+}
+
+int FrameBuffer::requestDepthReadback()
+{
+    return requestReadback(true);
+}
+
+int FrameBuffer::requestReadback(bool depth)
+{
+    DebugGroupScope group("FrameBuffer::requestReadback");
+    if((depth ? !desc.depth : desc.colorCount == 0) || !ensureResolveBuffers())
+        return 0;
+
+    if(msaa > 0)
+    {
+        if(depth)
+            blitDepthTo(fboId);
+        else
+            resolveColor();
+    }
+
+    PixelReadback readback;
+    readback.ticket = nextTicket++;
+    readback.depth = depth;
+    if(!freePboIds.empty())
+    {
+        readback.pboId = freePboIds.back();
+        freePboIds.pop_back();
+    }
+    else
+    {
+        glGenBuffers(1, &readback.pboId);
+    }
+
+    // rgba8 and float depth both take 4 bytes per pixel
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pboId);
+    glBufferData(GL_PIXEL_PACK_BUFFER, width * height * 4, 0, GL_STREAM_READ);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fboId);
+    if(depth)
+        glReadPixels(0, 0, width, height, GL_DEPTH_COMPONENT, GL_FLOAT, 0);
+    else
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    readbacks.push_back(readback);
+    return readback.ticket;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// finish an asynchronous copy. returns false if the ticket is unknown or, when
+// not waiting, the GPU has not reached the fence yet
+///////////////////////////////////////////////////////////////////////////////
+bool FrameBuffer::tryGetColorBuffer(int ticket, unsigned char* dst)
+{
+    if(!dst && !ensureColorBuffer())
+        return false;
+    return finishReadback(ticket, false, dst ? (void*)dst : (void*)colorBuffer, false);
+}
+
+bool FrameBuffer::waitColorBuffer(int ticket, unsigned char* dst)
+{
+    if(!dst && !ensureColorBuffer())
+        return false;
+    return finishReadback(ticket, false, dst ? (void*)dst : (void*)colorBuffer, true);
+}
+
+bool FrameBuffer::tryGetDepthBuffer(int ticket, float* dst)
+{
+    if(!dst && !ensureDepthBuffer())
+        return false;
+    return finishReadback(ticket, true, dst ? (void*)dst : (void*)depthBuffer, false);
+}
+
+bool FrameBuffer::waitDepthBuffer(int ticket, float* dst)
+{
+    if(!dst && !ensureDepthBuffer())
+        return false;
+    return finishReadback(ticket, true, dst ? (void*)dst : (void*)depthBuffer, true);
+}
+
+bool FrameBuffer::finishReadback(int ticket, bool depth, void* dst, bool wait)
+{
+    std::vector<PixelReadback>::iterator it = readbacks.begin();
+    while(it != readbacks.end() && it->ticket != ticket)
+        ++it;
+    if(it == readbacks.end() || it->depth != depth)
+        return false;
+
+    // the first check flushes, otherwise the fence may never be reached
+    GLenum result = glClientWaitSync(it->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    while(wait && result == GL_TIMEOUT_EXPIRED)
+        result = glClientWaitSync(it->fence, 0, 1000000000);   // 1s
+    if(result == GL_TIMEOUT_EXPIRED)
+        return false;
+
+    bool copied = false;
+    if(result != GL_WAIT_FAILED)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, it->pboId);
+        void* src = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+        if(src)
+        {
+            memcpy(dst, src, width * height * 4);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            copied = true;
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    glDeleteSync(it->fence);
+    freePboIds.push_back(it->pboId);
+    readbacks.erase(it);
+    return copied;
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// drop the readbacks in flight and their pixel pack buffers
+///////////////////////////////////////////////////////////////////////////////
+void FrameBuffer::deleteReadbacks()
+{
+    for(size_t i = 0; i < readbacks.size(); ++i)
+    {
+        glDeleteSync(readbacks[i].fence);
+        glDeleteBuffers(1, &readbacks[i].pboId);
+    }
+    readbacks.clear();
+    if(!freePboIds.empty())
+    {
+        glDeleteBuffers((GLsizei)freePboIds.size(), &freePboIds[0]);
+        freePboIds.clear();
+    }
+}
+
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // check FBO completeness (assume the FBO is bound)
 // It returns false if FBO is incomplete
@@ -383,13 +933,11 @@ std::string FrameBuffer::getStatus() const
     ss << "\n===== FBO STATUS =====\n";
 
     // print max # of colorbuffers supported by FBO
-    int colorBufferCount = 0;
-    glGetIntegerv(GL_MAX_COLOR_ATTACHMENTS, &colorBufferCount);
+    int colorBufferCount = glExtension::getInstance().getLimits().maxColorAttachments;
     ss << "Max Number of Color Buffer Attachment Points: " << colorBufferCount << std::endl;
 
     // get max # of multi samples
-    int multiSampleCount = 0;
-    glGetIntegerv(GL_MAX_SAMPLES, &multiSampleCount);
+    int multiSampleCount = glExtension::getInstance().getLimits().maxSamples;
     ss << "Max Number of Samples for MSAA: " << multiSampleCount << std::endl;
 
     int objectType;
@@ -412,7 +960,9 @@ std::string FrameBuffer::getStatus() const
             std::string formatName;
 
             ss << "Color Attachment " << i << ": ";
-            if(objectType == GL_TEXTURE)
+            if(objectType == GL_TEXTURE && msaa > 0)
+                ss << "GL_TEXTURE_2D_MULTISAMPLE, " << FrameBuffer::getTextureParameters(objectId, GL_TEXTURE_2D_MULTISAMPLE) << std::endl;
+            else if(objectType == GL_TEXTURE)
                 ss << "GL_TEXTURE, " << FrameBuffer::getTextureParameters(objectId) << std::endl;
             else if(objectType == GL_RENDERBUFFER)
                 ss << "GL_RENDERBUFFER, " << FrameBuffer::getRenderbufferParameters(objectId) << std::endl;
@@ -479,23 +1029,27 @@ std::string FrameBuffer::getStatus() const
 ///////////////////////////////////////////////////////////////////////////////
 // return texture parameters as string using glGetTexLevelParameteriv()
 ///////////////////////////////////////////////////////////////////////////////
-std::string FrameBuffer::getTextureParameters(GLuint id)
+std::string FrameBuffer::getTextureParameters(GLuint id, GLenum target)
 {
     if(glIsTexture(id) == GL_FALSE)
         return "Not texture object";
 
-    int width, height, format;
+    int width, height, format, samples = 0;
     std::string formatName;
-    glBindTexture(GL_TEXTURE_2D, id);
-    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);            // get texture width
-    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);          // get texture height
-    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format); // get texture internal format
-    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindTexture(target, id);
+    glGetTexLevelParameteriv(target, 0, GL_TEXTURE_WIDTH, &width);            // get texture width
+    glGetTexLevelParameteriv(target, 0, GL_TEXTURE_HEIGHT, &height);          // get texture height
+    glGetTexLevelParameteriv(target, 0, GL_TEXTURE_INTERNAL_FORMAT, &format); // get texture internal format
+    if(target == GL_TEXTURE_2D_MULTISAMPLE)
+        glGetTexLevelParameteriv(target, 0, GL_TEXTURE_SAMPLES, &samples);    // get # of samples
+    glBindTexture(target, 0);
 
     formatName = FrameBuffer::convertInternalFormatToString(format);
 
     std::stringstream ss;
     ss << width << "x" << height << ", " << formatName;
+    if(samples > 0)
+        ss << ", MSAA(" << samples << ")";
     return ss.str();
 }
 
@@ -4,14 +4,26 @@
 // class for OpenGL Frame Buffer Object (FBO)
 // It contains a 32bit color buffer and a depth buffer as GL_DEPTH_COMPONENT24
 // Call init() to create/resize a FBO with given width and height params.
+// init() with a FrameBufferDesc creates up to 4 color attachments of their own
+// formats, all written by one draw (MRT), and the depth buffer only on demand.
 // It supports MSAA (Multi Sample Anti Aliasing) FBO. If msaa=0, it creates a
 // single-sampled FBO. If msaa > 0 (even number), it creates a multi-sampled
 // FBO.
 //
-// NOTE: This class does not use GL_ARB_texture_multisample extension yet. Call
-//       update() function explicitly to blit color/depth buffers from
-//       multi-sample FBO to single-sample FBO if you want to get single-sample
-//       color and depth data from MSAA FBO.
+// The CPU copies of the color/depth buffers are only allocated by the first
+// copy into them, optionally through a caller-supplied allocator.
+//
+// With FrameBufferDesc::msaaTextures the multi-sample color attachments are
+// GL_ARB_texture_multisample textures (getMsaaColorId()) that a shader can
+// read through sampler2DMS. The single-sample FBO and its textures are then
+// not created by init(), only by the first update() or copy, so a consumer
+// that never resolves never allocates them. Otherwise call update() function
+// explicitly to blit color/depth buffers from multi-sample FBO to
+// single-sample FBO if you want to get single-sample color and depth data
+// from MSAA FBO.
+//
+// The textures only get a mipmap chain with FrameBufferDesc::mipmaps, and
+// update() only regenerates it then.
 //
 //  AUTHOR: Song Ho Ahn (song.ahn@gmail.com)
 // CREATED: 2015-03-05
@@ -34,6 +46,27 @@
 #ifndef GL_RGB16F
 #define GL_RGB16F  0x881B
 #endif
+#ifndef GL_R8
+#define GL_R8      0x8229
+#endif
+#ifndef GL_RG8
+#define GL_RG8     0x822B
+#endif
+#ifndef GL_R16F
+#define GL_R16F    0x822D
+#endif
+#ifndef GL_R32F
+#define GL_R32F    0x822E
+#endif
+#ifndef GL_RG16F
+#define GL_RG16F   0x822F
+#endif
+#ifndef GL_RG32F
+#define GL_RG32F   0x8230
+#endif
+#ifndef GL_R11F_G11F_B10F
+#define GL_R11F_G11F_B10F 0x8C3A
+#endif
 
 #ifdef _WIN32
 #ifndef WIN32_LEAN_AND_MEAN
@@ -48,7 +81,67 @@
 #include <GL/gl.h>
 #endif
 
+#include <cstddef>
 #include <string>
+#include <vector>
+
+#define FRAME_BUFFER_MAX_COLOR_ATTACHMENTS 4
+
+// what init() creates: color attachments 0..colorCount-1 as textures of the
+// given formats, an optional depth renderbuffer and msaa samples (0 = none)
+struct FrameBufferDesc
+{
+    int width;
+    int height;
+    int msaa;
+    int colorCount;
+    GLenum colorFormats[FRAME_BUFFER_MAX_COLOR_ATTACHMENTS];
+    bool depth;
+    bool mipmaps;                   // consumers sample coarser levels of the textures
+    bool msaaTextures;              // multi-sample colors as textures, not renderbuffers
+
+    FrameBufferDesc(int width=0, int height=0, GLenum colorFormat=GL_RGBA8, bool depth=true, int msaa=0)
+        : width(width), height(height), msaa(msaa), colorCount(1), depth(depth),
+          mipmaps(false), msaaTextures(false)
+    {
+        for(int i = 0; i < FRAME_BUFFER_MAX_COLOR_ATTACHMENTS; ++i)
+            colorFormats[i] = GL_RGBA8;
+        colorFormats[0] = colorFormat;
+    }
+
+    FrameBufferDesc& addColor(GLenum format)
+    {
+        if(colorCount < FRAME_BUFFER_MAX_COLOR_ATTACHMENTS)
+            colorFormats[colorCount++] = format;
+        return *this;
+    }
+
+    bool operator==(const FrameBufferDesc& other) const
+    {
+        if(width != other.width || height != other.height || msaa != other.msaa ||
+           colorCount != other.colorCount || depth != other.depth ||
+           mipmaps != other.mipmaps || msaaTextures != other.msaaTextures)
+            return false;
+        for(int i = 0; i < colorCount; ++i)
+        {
+            if(colorFormats[i] != other.colorFormats[i])
+                return false;
+        }
+        return true;
+    }
+};
+
+// allocator of the CPU copies, bytes is the same for both calls
+typedef void* (*FrameBufferAllocFunc)(size_t bytes, void* userData);
+typedef void (*FrameBufferFreeFunc)(void* ptr, size_t bytes, void* userData);
+
+// all live FrameBuffer instances
+struct FrameBufferMemoryStats
+{
+    int count;
+    size_t gpuBytes;                // estimated from size, format and samples
+    size_t cpuBytes;                // CPU copies allocated so far
+};
 
 class FrameBuffer
 {
@@ -56,28 +149,57 @@ public:
     FrameBuffer();
     ~FrameBuffer();
 
-    bool init(int width, int height, int msaa=0);   // create buffer objects
+    bool init(int width, int height, int msaa=0, GLenum colorFormat=GL_RGBA8);  // create buffer objects
+    bool init(const FrameBufferDesc& desc);         // create the attachments of desc
     void bind();                                    // bind fbo
     void unbind();                                  // unbind fbo
-    void update();                                  // copy multi-sample to single-sample and generate mipmaps
+    void update();                                  // copy multi-sample to single-sample and generate mipmaps if any
+    void generateMipmaps();                         // rebuild the mipmaps of the single-sample textures
 
     void blitColorTo(FrameBuffer& fb);              // blit color to another FrameBuffer instance
     void blitColorTo(GLuint fboId, int x=0, int y=0, int w=0, int h=0); // copy color buffer using FBO ID
     void blitDepthTo(FrameBuffer& fb);              // blit depth to another FrameBuffer instance
     void blitDepthTo(GLuint fboId, int x=0, int y=0, int w=0, int h=0); // copy depth buffer using FBO ID
 
-    void copyColorBuffer();                         // copy color to array
+    void copyColorBuffer();                         // copy color attachment 0 to array
     void copyDepthBuffer();                         // copy depth to array
-    const unsigned char* getColorBuffer() const     { return colorBuffer; }
-    const float* getDepthBuffer() const             { return depthBuffer; }
+    const unsigned char* getColorBuffer() const     { return colorBuffer; }   // 0 before the first copy
+    const float* getDepthBuffer() const             { return depthBuffer; }   // 0 before the first copy
+
+    // frees the CPU copies with the previous allocator, 0 for new/delete
+    void setShadowAllocator(FrameBufferAllocFunc allocFunc, FrameBufferFreeFunc freeFunc, void* userData=0);
+    void releaseShadowBuffers();                    // free the CPU copies until the next copy
+
+    size_t getGpuBytes() const;
+    size_t getCpuBytes() const                      { return colorBufferBytes + depthBufferBytes; }
+    static size_t estimateGpuBytes(const FrameBufferDesc& desc);   // what init() allocates
+    static FrameBufferMemoryStats getMemoryStats();
+    static std::string getMemoryReport();           // one line per FrameBuffer
+
+    // asynchronous copies through pixel pack buffers, several may be in flight.
+    // request*Readback() returns a ticket (0 on error), try*() returns false
+    // while the GPU is not done yet, wait*() blocks. both copy to dst, or to
+    // the internal array if dst is 0, and release the ticket once they succeed
+    int requestColorReadback();                     // attachment 0 as rgba, 4 bytes per pixel
+    int requestDepthReadback();                     // 1 float per pixel, 0 without depth
+    bool tryGetColorBuffer(int ticket, unsigned char* dst=0);
+    bool waitColorBuffer(int ticket, unsigned char* dst=0);
+    bool tryGetDepthBuffer(int ticket, float* dst=0);
+    bool waitDepthBuffer(int ticket, float* dst=0);
+    int getPendingReadbackCount() const             { return (int)readbacks.size(); }
 
     GLuint getId() const;
-    GLuint getColorId() const                       { return texId; }   // single-sample texture object
-    GLuint getDepthId() const                       { return rboId; }   // single-sample rbo
+    GLuint getColorId(int index=0) const            { return texIds[index]; }   // single-sample texture object, with msaaTextures 0 before the first update()
+    GLuint getMsaaColorId(int index=0) const        { return texMsaaIds[index]; }   // GL_TEXTURE_2D_MULTISAMPLE, 0 without msaaTextures
+    GLuint getDepthId() const                       { return rboId; }   // single-sample rbo, 0 without depth or before a deferred resolve
+    int getColorCount() const                       { return desc.colorCount; }
+    bool hasDepth() const                           { return desc.depth; }
+    const FrameBufferDesc& getDesc() const          { return desc; }
 
     int getWidth() const                            { return width; }
     int getHeight() const                           { return height; }
     int getMsaa() const                             { return msaa; }
+    GLenum getColorFormat(int index=0) const        { return desc.colorFormats[index]; }
     std::string getStatus() const;                  // return FBO info
     std::string getErrorMessage() const             { return errorMessage; }
 
@@ -87,24 +209,56 @@ private:
     // member functions
     void deleteBuffers();
     bool checkFrameBufferStatus();
+    void setDrawBuffers();                          // all color attachments of the bound fbo
+    void resolveColor();                            // multi-sample to single-sample, per attachment
+    bool createResolveBuffers();                    // single-sample fbo, textures and depth rbo
+    bool ensureResolveBuffers();                    // create them if init() deferred them
+
+    struct PixelReadback
+    {
+        int ticket;
+        bool depth;
+        GLuint pboId;
+        GLsync fence;
+    };
+    int requestReadback(bool depth);
+    bool finishReadback(int ticket, bool depth, void* dst, bool wait);
+    void deleteReadbacks();
+    void* allocShadowBuffer(size_t bytes);
+    bool ensureColorBuffer();
+    bool ensureDepthBuffer();
 
-    static std::string getTextureParameters(GLuint id);
+    static std::string getTextureParameters(GLuint id, GLenum target=GL_TEXTURE_2D);
     static std::string getRenderbufferParameters(GLuint id);
     static std::string convertInternalFormatToString(GLenum format);
+    static size_t getFormatBytes(GLenum format);
+    static size_t getPixelBytes(const FrameBufferDesc& desc);
+    static bool isFloatFormat(GLenum format);
 
     // member vars
     int width;                      // buffer width
     int height;                     // buffer height
     int msaa;                       // # of multi samples; 0, 2, 4, 8,...
+    FrameBufferDesc desc;           // attachments of the last init()
     unsigned char* colorBuffer;     // color buffer (rgba)
     float* depthBuffer;             // depth buffer
+    size_t colorBufferBytes;        // 0 until allocated
+    size_t depthBufferBytes;
+    FrameBufferAllocFunc allocFunc;
+    FrameBufferFreeFunc freeFunc;
+    void* allocUserData;
     GLuint fboMsaaId;               // primary id for multisample FBO
-    GLuint rboMsaaColorId;          // id for multisample RBO (color buffer)
+    GLuint rboMsaaColorIds[FRAME_BUFFER_MAX_COLOR_ATTACHMENTS];    // ids for multisample RBO (color buffers)
+    GLuint texMsaaIds[FRAME_BUFFER_MAX_COLOR_ATTACHMENTS];         // ids for multisample textures (color buffers)
     GLuint rboMsaaDepthId;          // id for multisample RBO (depth buffer)
     GLuint fboId;                   // secondary id for frame buffer object
-    GLuint texId;                   // id for texture object (color buffer)
+    GLuint texIds[FRAME_BUFFER_MAX_COLOR_ATTACHMENTS];     // ids for texture objects (color buffers)
     GLuint rboId;                   // id for render buffer object (depth buffer)
     std::string errorMessage;
+
+    std::vector<PixelReadback> readbacks;   // in flight, oldest first
+    std::vector<GLuint> freePboIds;         // pixel pack buffers of finished readbacks
+    int nextTicket;
 };
 
 #endif
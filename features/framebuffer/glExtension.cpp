@@ -7,6 +7,8 @@
 // NOTE: In order to get valid OpenGL extensions on Windows system, HDC must be
 // passed to wglGetExtensionsStringARB() function. The size of HDC in 64bit
 // Windows is 8 bytes.
+// The extensions, the core version, a few features and the implementation
+// limits are read once, with the first getInstance().
 //
 // extensions
 // ==========
@@ -15,6 +17,8 @@
 // GL_ARB_direct_state_access
 // GL_ARB_instanced_arays (GL_ARB_draw_instanced)
 // GL_ARB_multisample
+// GL_ARB_texture_multisample
+// GL_KHR_debug
 // GL_ARB_multitexture
 // GL_ARB_pixel_buffer_objects, GL_ARB_vertex_buffer_object
 // GL_ARB_shader_objects, GL_ARB_vertex_program, GL_ARB_fragment_program, GL_ARB_vertex_shader, GL_ARB_fragment_shader
@@ -32,6 +36,8 @@
 
 #include <iostream>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include "glExtension.h"
 
 
@@ -50,6 +56,7 @@ PFNGLFRAMEBUFFERTEXTURELAYERPROC                pglFramebufferTextureLayer = 0;
 PFNGLFRAMEBUFFERRENDERBUFFERPROC                pglFramebufferRenderbuffer = 0;             // FBO renderbuffer attachement procedure
 PFNGLISFRAMEBUFFERPROC                          pglIsFramebuffer = 0;                       // FBO state = true/false
 PFNGLBLITFRAMEBUFFERPROC                        pglBlitFramebuffer = 0;                     // FBO copy
+PFNGLDRAWBUFFERSPROC                            pglDrawBuffers = 0;                         // FBO multiple render targets
 PFNGLGENRENDERBUFFERSPROC                       pglGenRenderbuffers = 0;                    // renderbuffer generation procedure
 PFNGLDELETERENDERBUFFERSPROC                    pglDeleteRenderbuffers = 0;                 // renderbuffer deletion procedure
 PFNGLBINDRENDERBUFFERPROC                       pglBindRenderbuffer = 0;                    // renderbuffer bind procedure
@@ -61,6 +68,12 @@ PFNGLISRENDERBUFFERPROC                         pglIsRenderbuffer = 0;
 // GL_ARB_multisample
 PFNGLSAMPLECOVERAGEARBPROC  pglSampleCoverageARB = 0;
 
+// GL_ARB_texture_multisample
+PFNGLTEXIMAGE2DMULTISAMPLEPROC  pglTexImage2DMultisample = 0;
+
+// v3.0 core
+PFNGLGETSTRINGIPROC pglGetStringi = 0;
+
 // GL_ARB_multitexture
 //@@ v1.2.1 core version
 PFNGLACTIVETEXTUREPROC   pglActiveTexture = 0;
@@ -325,6 +338,11 @@ PFNGLDEBUGMESSAGECALLBACKARBPROC pglDebugMessageCallbackARB = 0;
 PFNGLGETDEBUGMESSAGELOGARBPROC   pglGetDebugMessageLogARB = 0;
 */
 
+// GL_KHR_debug
+//@@ v4.3 core version
+PFNGLPUSHDEBUGGROUPPROC pglPushDebugGroup = 0;
+PFNGLPOPDEBUGGROUPPROC  pglPopDebugGroup = 0;
+
 // GL_ARB_direct_state_access
 PFNGLCREATETRANSFORMFEEDBACKSPROC                 pglCreateTransformFeedbacks = 0; // for transform feedback object
 PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC              pglTransformFeedbackBufferBase = 0;
@@ -459,10 +477,13 @@ PFNWGLGETSWAPINTERVALEXTPROC    pwglGetSwapIntervalEXT = 0;
 ///////////////////////////////////////////////////////////////////////////////
 // ctor / dtor
 ///////////////////////////////////////////////////////////////////////////////
-glExtension::glExtension()
+glExtension::glExtension() : majorVersion(0), minorVersion(0)
 {
     // must be called after OpenGL RC is open
+    getVersion();
     getExtensionStrings();
+    getFeatures();
+    getLimitValues();
 
 #ifdef _WIN32
     getFunctionPointers();
@@ -488,19 +509,9 @@ glExtension& glExtension::getInstance()
 ///////////////////////////////////////////////////////////////////////////////
 // check if opengl extension is available
 ///////////////////////////////////////////////////////////////////////////////
-bool glExtension::isSupported(const std::string& ext)
+bool glExtension::isSupported(const std::string& ext) const
 {
-    // search corresponding extension
-    std::vector<std::string>::const_iterator iter = this->extensions.begin();
-    std::vector<std::string>::const_iterator endIter = this->extensions.end();
-    while(iter != endIter)
-    {
-        if(toLower(ext) == toLower(*iter))
-            return true;
-        else
-            ++iter;
-    }
-    return false;
+    return extensionSet.find(toLower(ext)) != extensionSet.end();
 }
 
 
@@ -524,25 +535,33 @@ const std::vector<std::string>& glExtension::getExtensions()
 ///////////////////////////////////////////////////////////////////////////////
 void glExtension::getExtensionStrings()
 {
-    const char* cstr = (const char*)glGetString(GL_EXTENSIONS);
-    if(!cstr) // check null ptr
-        return;
+    extensions.clear();
 
-    std::string str(cstr);
-    std::string token;
-    std::string::const_iterator cursor = str.begin();
-    while(cursor != str.end())
+#ifdef _WIN32
+    glGetStringi = (PFNGLGETSTRINGIPROC)wglGetProcAddress("glGetStringi");
+#endif
+
+    // core profiles (v3.0+) list them one by one, GL_EXTENSIONS is an invalid
+    // enum there. older contexts only have the long string
+    int count = 0;
+    if(majorVersion >= 3)
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+#ifdef _WIN32
+    if(!glGetStringi)
+        count = 0;
+#endif
+    if(count > 0)
     {
-        if(*cursor != ' ')
+        for(int i = 0; i < count; ++i)
         {
-            token += *cursor;
+            const char* name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+            if(name)
+                extensions.push_back(name);
         }
-        else
-        {
-            extensions.push_back(token);
-            token.clear();
-        }
-        ++cursor;
+    }
+    else
+    {
+        addExtensionStrings((const char*)glGetString(GL_EXTENSIONS));
     }
 
 #ifdef _WIN32 //===========================================
@@ -551,28 +570,101 @@ void glExtension::getExtensionStrings()
     HDC hdc = wglGetCurrentDC();
     wglGetExtensionsStringARB = (PFNWGLGETEXTENSIONSSTRINGARBPROC)wglGetProcAddress("wglGetExtensionsStringARB");
     if(wglGetExtensionsStringARB && hdc)
+        addExtensionStrings((const char*)wglGetExtensionsStringARB(hdc));
+#endif //==================================================
+
+    // sort extension by alphabetical order
+    std::sort(this->extensions.begin(), this->extensions.end());
+
+    extensionSet.clear();
+    for(size_t i = 0; i < extensions.size(); ++i)
+        extensionSet.insert(toLower(extensions[i]));
+}
+
+void glExtension::addExtensionStrings(const char* str)
+{
+    if(!str) // check null ptr
+        return;
+
+    std::string token;
+    for(const char* cursor = str; ; ++cursor)
     {
-        str = (const char*)wglGetExtensionsStringARB(hdc);
-        std::string token;
-        std::string::const_iterator cursor = str.begin();
-        while(cursor != str.end())
+        if(*cursor != ' ' && *cursor != '\0')
         {
-            if(*cursor != ' ')
-            {
-                token += *cursor;
-            }
-            else
-            {
+            token += *cursor;
+        }
+        else
+        {
+            if(!token.empty())
                 extensions.push_back(token);
-                token.clear();
-            }
-            ++cursor;
+            token.clear();
         }
+        if(*cursor == '\0')
+            break;
     }
-#endif //==================================================
+}
 
-    // sort extension by alphabetical order
-    std::sort(this->extensions.begin(), this->extensions.end());
+
+
+///////////////////////////////////////////////////////////////////////////////
+// core version of the current context, "major.minor ..." before v3.0
+///////////////////////////////////////////////////////////////////////////////
+void glExtension::getVersion()
+{
+    majorVersion = 0;
+    minorVersion = 0;
+    const char* str = (const char*)glGetString(GL_VERSION);
+    if(!str)
+        return;
+
+    // OpenGL ES contexts prefix the numbers
+    std::string version(str);
+    size_t pos = version.find_first_of("0123456789");
+    if(pos == std::string::npos)
+        return;
+    std::sscanf(version.c_str() + pos, "%d.%d", &majorVersion, &minorVersion);
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// features the engines branch on, by core version or by extension
+///////////////////////////////////////////////////////////////////////////////
+void glExtension::getFeatures()
+{
+    features.reset();
+    features.set(FEATURE_COMPUTE_SHADER,      isVersionAtLeast(4, 3) || isSupported("GL_ARB_compute_shader"));
+    features.set(FEATURE_BUFFER_STORAGE,      isVersionAtLeast(4, 4) || isSupported("GL_ARB_buffer_storage"));
+    features.set(FEATURE_TEXTURE_STORAGE,     isVersionAtLeast(4, 2) || isSupported("GL_ARB_texture_storage"));
+    features.set(FEATURE_TIMER_QUERY,         isVersionAtLeast(3, 3) || isSupported("GL_ARB_timer_query"));
+    features.set(FEATURE_PROGRAM_BINARY,      isVersionAtLeast(4, 1) || isSupported("GL_ARB_get_program_binary"));
+    features.set(FEATURE_KHR_DEBUG,           isVersionAtLeast(4, 3) || isSupported("GL_KHR_debug"));
+    features.set(FEATURE_TEXTURE_MULTISAMPLE, isVersionAtLeast(3, 2) || isSupported("GL_ARB_texture_multisample"));
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// implementation limits, a query the context does not know leaves 0
+///////////////////////////////////////////////////////////////////////////////
+void glExtension::getLimitValues()
+{
+    std::memset(&limits, 0, sizeof(limits));
+    glGetIntegerv(GL_MAX_SAMPLES, &limits.maxSamples);
+    glGetIntegerv(GL_MAX_COLOR_ATTACHMENTS, &limits.maxColorAttachments);
+    glGetIntegerv(GL_MAX_DRAW_BUFFERS, &limits.maxDrawBuffers);
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &limits.maxTextureSize);
+    glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE, &limits.maxRenderbufferSize);
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &limits.maxTextureImageUnits);
+    if(hasFeature(FEATURE_TEXTURE_MULTISAMPLE))
+    {
+        glGetIntegerv(GL_MAX_COLOR_TEXTURE_SAMPLES, &limits.maxColorTextureSamples);
+        glGetIntegerv(GL_MAX_DEPTH_TEXTURE_SAMPLES, &limits.maxDepthTextureSamples);
+    }
+
+    // the queries above may have raised GL_INVALID_ENUM on old contexts
+    while(glGetError() != GL_NO_ERROR)
+        ;
 }
 
 
@@ -613,6 +705,7 @@ void glExtension::getFunctionPointers()
             glFramebufferRenderbuffer             = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)wglGetProcAddress("glFramebufferRenderbuffer");
             glIsFramebuffer                       = (PFNGLISFRAMEBUFFERPROC)wglGetProcAddress("glIsFramebuffer");
             glBlitFramebuffer                     = (PFNGLBLITFRAMEBUFFERPROC)wglGetProcAddress("glBlitFramebuffer");
+            glDrawBuffers                         = (PFNGLDRAWBUFFERSPROC)wglGetProcAddress("glDrawBuffers");
             glGenRenderbuffers                    = (PFNGLGENRENDERBUFFERSPROC)wglGetProcAddress("glGenRenderbuffers");
             glDeleteRenderbuffers                 = (PFNGLDELETERENDERBUFFERSPROC)wglGetProcAddress("glDeleteRenderbuffers");
             glBindRenderbuffer                    = (PFNGLBINDRENDERBUFFERPROC)wglGetProcAddress("glBindRenderbuffer");
@@ -625,6 +718,10 @@ void glExtension::getFunctionPointers()
         {
             glSampleCoverageARB = (PFNGLSAMPLECOVERAGEARBPROC)wglGetProcAddress("glSampleCoverageARB");
         }
+        else if(extensions[i] == "GL_ARB_texture_multisample")
+        {
+            glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)wglGetProcAddress("glTexImage2DMultisample");
+        }
         else if(extensions[i] == "GL_ARB_multitexture")
         {
             glActiveTexture = (PFNGLACTIVETEXTUREPROC)wglGetProcAddress("glActiveTexture");
@@ -891,6 +988,19 @@ void glExtension::getFunctionPointers()
             glGetDebugMessageLogARB   = (PFNGLGETDEBUGMESSAGELOGARBPROC)wglGetProcAddress("glGetDebugMessageLogARB");
             */
         }
+        else if(extensions[i] == "GL_KHR_debug")
+        {
+            glPushDebugGroup        = (PFNGLPUSHDEBUGGROUPPROC)wglGetProcAddress("glPushDebugGroup");
+            glPopDebugGroup         = (PFNGLPOPDEBUGGROUPPROC)wglGetProcAddress("glPopDebugGroup");
+            // drivers exposing only KHR_debug still need the message functions
+            if(!glDebugMessageCallback)
+            {
+                glDebugMessageControl   = (PFNGLDEBUGMESSAGECONTROLPROC)wglGetProcAddress("glDebugMessageControl");
+                glDebugMessageInsert    = (PFNGLDEBUGMESSAGEINSERTPROC)wglGetProcAddress("glDebugMessageInsert");
+                glDebugMessageCallback  = (PFNGLDEBUGMESSAGECALLBACKPROC)wglGetProcAddress("glDebugMessageCallback");
+                glGetDebugMessageLog    = (PFNGLGETDEBUGMESSAGELOGPROC)wglGetProcAddress("glGetDebugMessageLog");
+            }
+        }
         else if(extensions[i] == "GL_ARB_direct_state_access")
         {
              // for transform feedback object
@@ -7,6 +7,10 @@
 // NOTE: In order to get valid OpenGL extensions on Windows system, HDC must be
 // passed to wglGetExtensionsStringARB() function. The size of HDC in 64bit
 // Windows is 8 bytes.
+// The extensions, the core version, a few features and the implementation
+// limits are read once, with the first getInstance(). hasFeature() and
+// getLimits() are plain lookups afterwards, isSupported() a hashed one.
+// Contexts created later must be shared with or equivalent to the first one.
 //
 // extensions
 // ==========
@@ -15,6 +19,8 @@
 // GL_ARB_direct_state_access
 // GL_ARB_instanced_arays (GL_ARB_draw_instanced)
 // GL_ARB_multisample
+// GL_ARB_texture_multisample
+// GL_KHR_debug
 // GL_ARB_multitexture
 // GL_ARB_pixel_buffer_objects, GL_ARB_vertex_buffer_object
 // GL_ARB_shader_objects, GL_ARB_vertex_program, GL_ARB_fragment_program, GL_ARB_vertex_shader, GL_ARB_fragment_shader
@@ -51,25 +57,67 @@
 
 #include <string>
 #include <vector>
+#include <bitset>
+#include <unordered_set>
 #include "glext.h"
 
 class glExtension
 {
 public:
+    // features checked on hot paths, by core version or extension
+    enum Feature
+    {
+        FEATURE_COMPUTE_SHADER = 0,     // v4.3, GL_ARB_compute_shader
+        FEATURE_BUFFER_STORAGE,         // v4.4, GL_ARB_buffer_storage
+        FEATURE_TEXTURE_STORAGE,        // v4.2, GL_ARB_texture_storage
+        FEATURE_TIMER_QUERY,            // v3.3, GL_ARB_timer_query
+        FEATURE_PROGRAM_BINARY,         // v4.1, GL_ARB_get_program_binary
+        FEATURE_KHR_DEBUG,              // v4.3, GL_KHR_debug
+        FEATURE_TEXTURE_MULTISAMPLE,    // v3.2, GL_ARB_texture_multisample
+        FEATURE_COUNT
+    };
+
+    // implementation limits, 0 if the query is not supported
+    struct Limits
+    {
+        int maxSamples;                 // GL_MAX_SAMPLES
+        int maxColorAttachments;        // GL_MAX_COLOR_ATTACHMENTS
+        int maxDrawBuffers;             // GL_MAX_DRAW_BUFFERS
+        int maxTextureSize;             // GL_MAX_TEXTURE_SIZE
+        int maxRenderbufferSize;        // GL_MAX_RENDERBUFFER_SIZE
+        int maxTextureImageUnits;       // GL_MAX_TEXTURE_IMAGE_UNITS
+        int maxColorTextureSamples;     // GL_MAX_COLOR_TEXTURE_SAMPLES
+        int maxDepthTextureSamples;     // GL_MAX_DEPTH_TEXTURE_SAMPLES
+    };
+
     ~glExtension();
     static glExtension& getInstance();                  // must be called after RC is open
 
-    bool isSupported(const std::string& extStr);        // check if a extension is available
+    bool isSupported(const std::string& extStr) const;  // check if a extension is available
     const std::vector<std::string>& getExtensions();
+    bool hasFeature(Feature feature) const              { return features.test(feature); }
+    const Limits& getLimits() const                     { return limits; }
+    int getMajorVersion() const                         { return majorVersion; }
+    int getMinorVersion() const                         { return minorVersion; }
+    bool isVersionAtLeast(int major, int minor) const   { return majorVersion > major || (majorVersion == major && minorVersion >= minor); }
 
 private:
     glExtension();                                      // prevent calling ctor
     glExtension(const glExtension& rhs);                // no implementation
+    void getVersion();
     void getExtensionStrings();
+    void addExtensionStrings(const char* str);          // space separated names
+    void getFeatures();
+    void getLimitValues();
     void getFunctionPointers();
-    std::string toLower(const std::string& str);
+    static std::string toLower(const std::string& str);
 
     std::vector <std::string> extensions;
+    std::unordered_set<std::string> extensionSet;       // lower case names
+    std::bitset<FEATURE_COUNT> features;
+    Limits limits;
+    int majorVersion;
+    int minorVersion;
 };
 
 
@@ -89,6 +137,7 @@ extern PFNGLFRAMEBUFFERTEXTURELAYERPROC             pglFramebufferTextureLayer;
 extern PFNGLFRAMEBUFFERRENDERBUFFERPROC             pglFramebufferRenderbuffer;             // FBO renderbuffer attachement procedure
 extern PFNGLISFRAMEBUFFERPROC                       pglIsFramebuffer;                       // FBO state = true/false
 extern PFNGLBLITFRAMEBUFFERPROC                     pglBlitFramebuffer;                     // FBO copy
+extern PFNGLDRAWBUFFERSPROC                         pglDrawBuffers;                         // FBO multiple render targets
 extern PFNGLGENRENDERBUFFERSPROC                    pglGenRenderbuffers;                    // renderbuffer generation procedure
 extern PFNGLDELETERENDERBUFFERSPROC                 pglDeleteRenderbuffers;                 // renderbuffer deletion procedure
 extern PFNGLBINDRENDERBUFFERPROC                    pglBindRenderbuffer;                    // renderbuffer bind procedure
@@ -109,6 +158,7 @@ extern PFNGLISRENDERBUFFERPROC                      pglIsRenderbuffer;
 #define glFramebufferRenderbuffer                   pglFramebufferRenderbuffer
 #define glIsFramebuffer                             pglIsFramebuffer
 #define glBlitFramebuffer                           pglBlitFramebuffer
+#define glDrawBuffers                               pglDrawBuffers
 #define glGenRenderbuffers                          pglGenRenderbuffers
 #define glDeleteRenderbuffers                       pglDeleteRenderbuffers
 #define glBindRenderbuffer                          pglBindRenderbuffer
@@ -121,6 +171,14 @@ extern PFNGLISRENDERBUFFERPROC                      pglIsRenderbuffer;
 extern PFNGLSAMPLECOVERAGEARBPROC   pglSampleCoverageARB;
 #define glSampleCoverageARB         pglSampleCoverageARB
 
+// GL_ARB_texture_multisample (included v3.2)
+extern PFNGLTEXIMAGE2DMULTISAMPLEPROC  pglTexImage2DMultisample;
+#define glTexImage2DMultisample         pglTexImage2DMultisample
+
+// v3.0 core, the only way to list the extensions of a core profile context
+extern PFNGLGETSTRINGIPROC  pglGetStringi;
+#define glGetStringi        pglGetStringi
+
 // GL_ARB_multitexture (included v1.2.1)
 //@@ v1.2.1 core version
 extern PFNGLACTIVETEXTUREPROC       pglActiveTexture;
@@ -617,6 +675,13 @@ extern PFNGLGETDEBUGMESSAGELOGARBPROC   pglGetDebugMessageLogARB;
 #define glGetDebugMessageLogARB         pglGetDebugMessageLogARB
 */
 
+// GL_KHR_debug (debug groups, the rest is shared with GL_ARB_debug_output)
+//@@ v4.3 core version
+extern PFNGLPUSHDEBUGGROUPPROC pglPushDebugGroup;
+extern PFNGLPOPDEBUGGROUPPROC  pglPopDebugGroup;
+#define glPushDebugGroup       pglPushDebugGroup
+#define glPopDebugGroup        pglPopDebugGroup
+
 // GL_ARB_direct_state_access
 extern PFNGLCREATETRANSFORMFEEDBACKSPROC                 pglCreateTransformFeedbacks; // for transform feedback object
 extern PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC              pglTransformFeedbackBufferBase;
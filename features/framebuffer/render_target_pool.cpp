@@ -0,0 +1,220 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-20 03:05:12
+ * @LastEditTime: 2026-10-20 03:52:40
+ * @LastEditors: Matt.SHI
+ * @Description: render target pool
+ * @FilePath: /opengl_demo/features/framebuffer/render_target_pool.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "render_target_pool.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace ESSILOR
+{
+    RenderTargetLease::RenderTargetLease() : m_pool(nullptr), m_target(nullptr)
+    {
+    }
+
+    RenderTargetLease::RenderTargetLease(RenderTargetPool *pool, FrameBuffer *target) : m_pool(pool), m_target(target)
+    {
+    }
+
+    RenderTargetLease::RenderTargetLease(RenderTargetLease &&other) : m_pool(other.m_pool), m_target(other.m_target)
+    {
+        other.m_pool = nullptr;
+        other.m_target = nullptr;
+    }
+
+    RenderTargetLease &RenderTargetLease::operator=(RenderTargetLease &&other)
+    {
+        if (this != &other)
+        {
+            release();
+            m_pool = other.m_pool;
+            m_target = other.m_target;
+            other.m_pool = nullptr;
+            other.m_target = nullptr;
+        }
+        return *this;
+    }
+
+    RenderTargetLease::~RenderTargetLease()
+    {
+        release();
+    }
+
+    void RenderTargetLease::release()
+    {
+        if (nullptr != m_pool && nullptr != m_target)
+        {
+            m_pool->release(m_target);
+        }
+        m_pool = nullptr;
+        m_target = nullptr;
+    }
+
+    RenderTargetPool::RenderTargetPool() : m_budget(RENDER_TARGET_POOL_DEFAULT_BUDGET),
+                                           m_clock(0),
+                                           m_stats()
+    {
+    }
+
+    RenderTargetPool::~RenderTargetPool()
+    {
+        for (size_t i = 0; i < m_entries.size(); i++)
+        {
+            if (m_entries[i].leased)
+            {
+                std::cout << "[RT_POOL] target " << m_entries[i].key.width << "x" << m_entries[i].key.height
+                          << " still leased at destruction" << std::endl;
+            }
+            delete m_entries[i].target;
+        }
+    }
+
+    void RenderTargetPool::set_budget(size_t budget_bytes)
+    {
+        m_budget = budget_bytes;
+        evict(m_budget);
+    }
+
+    size_t RenderTargetPool::get_budget() const
+    {
+        return m_budget;
+    }
+
+    size_t RenderTargetPool::estimateBytes(const RenderTargetKey &key)
+    {
+        return FrameBuffer::estimateGpuBytes(key);
+    }
+
+    RenderTargetLease RenderTargetPool::acquire(int width, int height, GLenum format, int msaa)
+    {
+        return acquire(RenderTargetKey(width, height, format, true, msaa));
+    }
+
+    RenderTargetLease RenderTargetPool::acquire(const RenderTargetKey &key)
+    {
+        m_clock++;
+        for (size_t i = 0; i < m_entries.size(); i++)
+        {
+            PoolEntry &entry = m_entries[i];
+            if (!entry.leased && entry.key == key)
+            {
+                entry.leased = true;
+                entry.last_used = m_clock;
+                m_stats.hits++;
+                updateStats();
+                return RenderTargetLease(this, entry.target);
+            }
+        }
+
+        m_stats.misses++;
+        PoolEntry entry;
+        entry.key = key;
+        entry.bytes = estimateBytes(key);
+        entry.leased = true;
+        entry.last_used = m_clock;
+        // room for the new one first, the idle ones are the candidates
+        evict(m_budget > entry.bytes ? m_budget - entry.bytes : 0);
+
+        entry.target = new FrameBuffer();
+        if (!entry.target->init(key))
+        {
+            std::cout << "[RT_POOL] frame buffer error: " << entry.target->getErrorMessage() << std::endl;
+        }
+        m_entries.push_back(entry);
+        updateStats();
+        return RenderTargetLease(this, entry.target);
+    }
+
+    void RenderTargetPool::release(FrameBuffer *target)
+    {
+        for (size_t i = 0; i < m_entries.size(); i++)
+        {
+            if (m_entries[i].target == target)
+            {
+                m_entries[i].leased = false;
+                m_entries[i].last_used = ++m_clock;
+                break;
+            }
+        }
+        evict(m_budget);
+    }
+
+    void RenderTargetPool::trim()
+    {
+        evict(0);
+    }
+
+    // least recently used idle targets go until the pool fits budget_bytes,
+    // leased ones are never touched even if the pool stays above it
+    void RenderTargetPool::evict(size_t budget_bytes)
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < m_entries.size(); i++)
+        {
+            total += m_entries[i].bytes;
+        }
+        while (total > budget_bytes)
+        {
+            std::vector<PoolEntry>::iterator oldest = m_entries.end();
+            for (std::vector<PoolEntry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+            {
+                if (!it->leased && (oldest == m_entries.end() || it->last_used < oldest->last_used))
+                {
+                    oldest = it;
+                }
+            }
+            if (oldest == m_entries.end())
+            {
+                break;
+            }
+            total -= oldest->bytes;
+            delete oldest->target;
+            m_entries.erase(oldest);
+            m_stats.evictions++;
+        }
+        updateStats();
+    }
+
+    void RenderTargetPool::updateStats()
+    {
+        m_stats.leased_bytes = 0;
+        m_stats.idle_bytes = 0;
+        m_stats.leased_count = 0;
+        m_stats.idle_count = 0;
+        for (size_t i = 0; i < m_entries.size(); i++)
+        {
+            if (m_entries[i].leased)
+            {
+                m_stats.leased_bytes += m_entries[i].bytes;
+                m_stats.leased_count++;
+            }
+            else
+            {
+                m_stats.idle_bytes += m_entries[i].bytes;
+                m_stats.idle_count++;
+            }
+        }
+        m_stats.peak_bytes = std::max(m_stats.peak_bytes, m_stats.leased_bytes + m_stats.idle_bytes);
+    }
+
+    const RenderTargetPoolStats &RenderTargetPool::getStats() const
+    {
+        return m_stats;
+    }
+
+    void RenderTargetPool::printStats() const
+    {
+        std::cout << "[RT_POOL] hits:" << m_stats.hits << " misses:" << m_stats.misses
+                  << " evictions:" << m_stats.evictions
+                  << " leased:" << m_stats.leased_count << " (" << m_stats.leased_bytes / 1024 << " KB)"
+                  << " idle:" << m_stats.idle_count << " (" << m_stats.idle_bytes / 1024 << " KB)"
+                  << " peak:" << m_stats.peak_bytes / 1024 << " KB" << std::endl;
+    }
+}
@@ -0,0 +1,122 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-20 03:05:12
+ * @LastEditTime: 2026-10-20 03:52:40
+ * @LastEditors: Matt.SHI
+ * @Description: recycles FrameBuffer objects across passes and resizes,
+ *               leases release on destruction, idle targets are evicted
+ *               least recently used first under a memory budget
+ * @FilePath: /opengl_demo/features/framebuffer/render_target_pool.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_RENDER_TARGET_POOL_H_
+#define _ESSILOR_RENDER_TARGET_POOL_H_
+
+#include "FrameBuffer.h"
+
+#include <stddef.h>
+#include <vector>
+
+namespace ESSILOR
+{
+    // idle plus leased targets, evictions start above it
+    constexpr size_t RENDER_TARGET_POOL_DEFAULT_BUDGET = 256u * 1024u * 1024u;
+
+    // size, samples, colour attachment formats and depth
+    typedef FrameBufferDesc RenderTargetKey;
+
+    struct RenderTargetPoolStats
+    {
+        unsigned long hits;
+        unsigned long misses;
+        unsigned long evictions;
+        size_t leased_bytes;
+        size_t idle_bytes;
+        size_t peak_bytes;
+        unsigned int leased_count;
+        unsigned int idle_count;
+    };
+
+    class RenderTargetPool;
+
+    // move only, gives the target back to its pool when it goes away.
+    // leases must not outlive their pool
+    class RenderTargetLease
+    {
+        friend class RenderTargetPool;
+
+        public:
+            RenderTargetLease();
+            RenderTargetLease(RenderTargetLease &&other);
+            RenderTargetLease &operator=(RenderTargetLease &&other);
+            RenderTargetLease(const RenderTargetLease &) = delete;
+            RenderTargetLease &operator=(const RenderTargetLease &) = delete;
+            virtual ~RenderTargetLease();
+
+        public:
+            void release();
+            FrameBuffer *get() const { return m_target; }
+            FrameBuffer *operator->() const { return m_target; }
+            explicit operator bool() const { return nullptr != m_target; }
+
+        protected:
+            RenderTargetLease(RenderTargetPool *pool, FrameBuffer *target);
+
+        private:
+            RenderTargetPool *m_pool;
+            FrameBuffer *m_target;
+    };
+
+    // owns every target it created, all calls on the thread of the gl context
+    // the targets belong to. FrameBuffer::init() of a new target rebinds
+    // textures on the active unit
+    class RenderTargetPool
+    {
+        friend class RenderTargetLease;
+
+        public:
+            RenderTargetPool();
+            virtual ~RenderTargetPool();
+
+        public:
+            // bytes of gpu memory, 0 keeps no idle target at all
+            void set_budget(size_t budget_bytes);
+            size_t get_budget() const;
+
+            // an idle target of that key or a new one. the contents are undefined
+            RenderTargetLease acquire(const RenderTargetKey &key);
+            // one colour attachment with depth
+            RenderTargetLease acquire(int width, int height, GLenum format = GL_RGBA8, int msaa = 0);
+            // deletes the idle targets
+            void trim();
+
+            const RenderTargetPoolStats &getStats() const;
+            void printStats() const;
+
+            // colour, depth and the resolve target of multisampled ones
+            static size_t estimateBytes(const RenderTargetKey &key);
+
+        protected:
+            struct PoolEntry
+            {
+                FrameBuffer *target;
+                RenderTargetKey key;
+                size_t bytes;
+                bool leased;
+                unsigned long last_used;
+            };
+
+            void release(FrameBuffer *target);
+            void evict(size_t budget_bytes);
+            void updateStats();
+
+        private:
+            std::vector<PoolEntry> m_entries;
+            size_t m_budget;
+            unsigned long m_clock;
+            RenderTargetPoolStats m_stats;
+    };
+}
+
+#endif //_ESSILOR_RENDER_TARGET_POOL_H_
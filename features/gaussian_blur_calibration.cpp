@@ -0,0 +1,127 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-20 01:40:26
+ * @LastEditTime: 2026-10-20 02:18:03
+ * @LastEditors: Matt.SHI
+ * @Description: engine calibration
+ * @FilePath: /opengl_demo/features/gaussian_blur_calibration.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "gaussian_blur_calibration.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace ESSILOR
+{
+    GassianBlurCalibration::GassianBlurCalibration(const std::string &cache_file) : m_cache_file(cache_file)
+    {
+        load();
+    }
+
+    GassianBlurCalibration::~GassianBlurCalibration()
+    {
+    }
+
+    std::string GassianBlurCalibration::makeKey(const char *vendor, const char *renderer,
+                                                unsigned int width, unsigned int height, unsigned int channel)
+    {
+        std::ostringstream key;
+        key << (vendor ? vendor : "unknown") << "|" << (renderer ? renderer : "unknown") << "|"
+            << width << "x" << height << "x" << channel;
+        // one entry per line
+        std::string text = key.str();
+        std::replace(text.begin(), text.end(), '\n', ' ');
+        return text;
+    }
+
+    void GassianBlurCalibration::load()
+    {
+        m_entries.clear();
+        std::ifstream file(m_cache_file);
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::istringstream fields(line);
+            int engine = 0;
+            std::string key;
+            if (!(fields >> engine) || !std::getline(fields >> std::ws, key) || key.empty())
+                continue;
+            m_entries.push_back(std::make_pair(key, engine));
+        }
+    }
+
+    bool GassianBlurCalibration::lookup(const std::string &key, int &engine)
+    {
+        for (const auto &entry : m_entries)
+        {
+            if (entry.first == key)
+            {
+                engine = entry.second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool GassianBlurCalibration::store(const std::string &key, int engine)
+    {
+        auto it = std::find_if(m_entries.begin(), m_entries.end(),
+                               [&key](const std::pair<std::string, int> &entry) { return entry.first == key; });
+        if (it != m_entries.end())
+            it->second = engine;
+        else
+            m_entries.push_back(std::make_pair(key, engine));
+
+        std::ofstream file(m_cache_file, std::ios::trunc);
+        if (!file)
+        {
+            std::cout << "[CALIBRATION] can not write " << m_cache_file << std::endl;
+            return false;
+        }
+        for (const auto &entry : m_entries)
+        {
+            file << entry.second << " " << entry.first << "\n";
+        }
+        return true;
+    }
+
+    void GassianBlurCalibration::fillSyntheticFrame(unsigned int width, unsigned int height, unsigned int channel,
+                                                    std::vector<unsigned char> &base_image, std::vector<unsigned char> &zone_image)
+    {
+        base_image.resize((size_t)width * height * channel);
+        zone_image.resize((size_t)width * height * 4);
+
+        unsigned int seed = 0x2545f491u;
+        float cx = 0.5f * width;
+        float cy = 0.5f * height;
+        float max_distance = std::sqrt(cx * cx + cy * cy);
+        for (unsigned int y = 0; y < height; y++)
+        {
+            for (unsigned int x = 0; x < width; x++)
+            {
+                size_t i = (size_t)y * width + x;
+                // checker edges, a gradient and some noise for the cpu engines' caches
+                seed = seed * 1664525u + 1013904223u;
+                int checker = (((x >> 4) ^ (y >> 4)) & 1) ? 160 : 64;
+                int value = checker + (int)(x * 64 / std::max(1u, width)) + (int)(seed >> 28);
+                for (unsigned int k = 0; k < channel; k++)
+                {
+                    base_image[i * channel + k] = (unsigned char)std::min(255, value + (int)k * 8);
+                }
+
+                float dx = x - cx;
+                float dy = y - cy;
+                unsigned char zone = (unsigned char)(255.0f * std::sqrt(dx * dx + dy * dy) / max_distance);
+                zone_image[i * 4 + 0] = zone;
+                zone_image[i * 4 + 1] = zone;
+                zone_image[i * 4 + 2] = zone;
+                zone_image[i * 4 + 3] = 255;
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-20 01:40:26
+ * @LastEditTime: 2026-10-20 02:18:03
+ * @LastEditors: Matt.SHI
+ * @Description: engine calibration, synthetic frames and the per device and
+ *               resolution cache of the fastest engine
+ * @FilePath: /opengl_demo/features/gaussian_blur_calibration.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_CALIBRATION_H_
+#define _ESSILOR_GAUSSIAN_BLUR_CALIBRATION_H_
+
+#include <string>
+#include <vector>
+
+namespace ESSILOR
+{
+    // timed runs per engine after one warm up run, the median is kept
+    constexpr int GAUSSIAN_BLUR_CALIBRATION_RUNS = 3;
+
+    // the cache is a text file, one "<engine> <key>" line per device and size
+    class GassianBlurCalibration
+    {
+        public:
+            explicit GassianBlurCalibration(const std::string &cache_file);
+            virtual ~GassianBlurCalibration();
+
+        public:
+            // vendor and renderer strings of the gl context plus the output size
+            static std::string makeKey(const char *vendor, const char *renderer,
+                unsigned int width, unsigned int height, unsigned int channel);
+
+            // false when the key was never calibrated
+            bool lookup(const std::string &key, int &engine);
+            // replaces the line of key, the whole file is written again
+            bool store(const std::string &key, int engine);
+
+            // textured base image and a radial zone ramp over the whole 0..255
+            // range, the mix of light and heavy zones of a lens map
+            static void fillSyntheticFrame(unsigned int width, unsigned int height, unsigned int channel,
+                std::vector<unsigned char> &base_image, std::vector<unsigned char> &zone_image);
+
+        protected:
+            void load();
+
+        private:
+            std::string m_cache_file;
+            std::vector<std::pair<std::string, int>> m_entries;
+    };
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_CALIBRATION_H_
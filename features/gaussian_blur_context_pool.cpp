@@ -0,0 +1,303 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 13:02:44
+ * @LastEditTime: 2026-10-19 15:37:09
+ * @LastEditors: Matt.SHI
+ * @Description: several shared GL contexts blurring frames in parallel
+ * @FilePath: /opengl_demo/features/gaussian_blur_context_pool.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "gaussian_blur_context_pool.h"
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <learnopengl/shader_m.h>
+
+#include <features/framebuffer/FrameBuffer.h>
+#include <tools/bounded_queue.h>
+
+#include <iostream>
+#include <string.h>
+
+namespace ESSILOR
+{
+    struct GassianBlurContextPool::BlurJob
+    {
+        unsigned long frame_id;
+        std::vector<unsigned char> base_image;
+        unsigned int base_image_width;
+        unsigned int base_image_height;
+        unsigned int base_image_channel;
+        std::vector<unsigned char> result;
+        BlurDoneCallback callback;
+    };
+
+    struct GassianBlurContextPool::BlurWorker
+    {
+        unsigned int index;
+        GLFWwindow *window;
+        std::thread thread;
+        tools::BoundedQueue<BlurJob*> *jobs;
+        std::atomic<unsigned int> pending;
+
+        // only valid on the worker's own context
+        unsigned int vao;
+        unsigned int base_texture;
+        FrameBuffer *target;
+    };
+
+    GassianBlurContextPool::GassianBlurContextPool() : m_core(nullptr),
+                                                       m_dispatch(CONTEXT_POOL_LEAST_LOADED),
+                                                       m_round_robin_index(0),
+                                                       m_next_frame_id(0),
+                                                       m_next_deliver_id(0)
+    {
+    }
+
+    GassianBlurContextPool::~GassianBlurContextPool()
+    {
+        unit();
+    }
+
+    int GassianBlurContextPool::init(GassianBlurCore *core, unsigned int worker_count,
+                                     ContextPoolDispatch dispatch, unsigned int queue_depth)
+    {
+        if (nullptr == core || nullptr == core->m_glWindow || nullptr == core->m_shader)
+        {
+            std::cout << "[POOL] the core has to be initialized first" << std::endl;
+            return -1;
+        }
+        unit();
+        m_core = core;
+        m_dispatch = dispatch;
+        m_round_robin_index = 0;
+        m_next_frame_id = 0;
+        m_next_deliver_id = 0;
+
+        // glfw windows can only be created on the main thread, the context
+        // hints of the core's window are still in effect
+        glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+        for (unsigned int i = 0; i < worker_count; i++)
+        {
+            GLFWwindow *window = glfwCreateWindow(16, 16, "blur worker", NULL, core->m_glWindow);
+            if (nullptr == window)
+            {
+                std::cout << "[POOL] failed to create shared context " << i << std::endl;
+                break;
+            }
+            BlurWorker *worker = new BlurWorker();
+            worker->index = i;
+            worker->window = window;
+            worker->jobs = new tools::BoundedQueue<BlurJob*>(queue_depth);
+            worker->pending = 0;
+            worker->vao = 0;
+            worker->base_texture = 0;
+            worker->target = nullptr;
+            m_workers.push_back(worker);
+        }
+        if (m_workers.empty())
+        {
+            return -1;
+        }
+
+        // the program's sampler and pixel size uniforms are set by now, make
+        // sure the workers see the finished objects
+        glFinish();
+        for (size_t i = 0; i < m_workers.size(); i++)
+        {
+            m_workers[i]->thread = std::thread(&GassianBlurContextPool::workerLoop, this, m_workers[i]);
+        }
+        std::cout << "[POOL] started " << m_workers.size() << " shared contexts" << std::endl;
+        return 0;
+    }
+
+    void GassianBlurContextPool::unit()
+    {
+        for (size_t i = 0; i < m_workers.size(); i++)
+        {
+            m_workers[i]->jobs->Close();
+        }
+        for (size_t i = 0; i < m_workers.size(); i++)
+        {
+            BlurWorker *worker = m_workers[i];
+            worker->thread.join();
+            glfwDestroyWindow(worker->window);
+            delete worker->jobs;
+            delete worker;
+        }
+        m_workers.clear();
+
+        std::lock_guard<std::mutex> lock(m_deliver_mutex);
+        for (auto it = m_done_jobs.begin(); it != m_done_jobs.end(); ++it)
+        {
+            delete it->second;
+        }
+        m_done_jobs.clear();
+        m_core = nullptr;
+    }
+
+    void GassianBlurContextPool::updateFilterZone(unsigned char *filter_zone_image_data,
+                                                  unsigned int filter_zone_image_width,
+                                                  unsigned int filter_zone_image_height,
+                                                  unsigned int filter_zone_image_channel)
+    {
+        if (nullptr == m_core)
+            return;
+        // workers must not sample the texture while it is respecified
+        flush();
+        // callers may hand over the same buffer with new contents
+        m_core->invalidateFilterZone();
+        m_core->uploadFilterZone(filter_zone_image_data, filter_zone_image_width,
+                                 filter_zone_image_height, filter_zone_image_channel);
+        // other contexts see the new texels once these commands completed
+        // and they bind the texture again
+        glFinish();
+    }
+
+    void GassianBlurContextPool::setKernelProfile(int profile)
+    {
+        if (nullptr == m_core)
+            return;
+        flush();
+        m_core->setKernelProfile(profile);
+        m_core->refreshKernelLut();
+        glFinish();
+    }
+
+    long GassianBlurContextPool::submit(unsigned char *base_image_data,
+                                        unsigned int base_image_width,
+                                        unsigned int base_image_height,
+                                        unsigned int base_image_channel,
+                                        BlurDoneCallback callback)
+    {
+        if (m_workers.empty() || nullptr == base_image_data)
+            return -1;
+
+        BlurJob *job = new BlurJob();
+        job->frame_id = m_next_frame_id++;
+        job->base_image.assign(base_image_data, base_image_data + base_image_width * base_image_height * base_image_channel);
+        job->base_image_width = base_image_width;
+        job->base_image_height = base_image_height;
+        job->base_image_channel = base_image_channel;
+        job->callback = callback;
+
+        BlurWorker *worker = pickWorker();
+        worker->pending++;
+        // blocks while the chosen worker's queue is full
+        if (!worker->jobs->Push(job))
+        {
+            worker->pending--;
+            delete job;
+            return -1;
+        }
+        return (long)job->frame_id;
+    }
+
+    void GassianBlurContextPool::flush()
+    {
+        std::unique_lock<std::mutex> lock(m_deliver_mutex);
+        m_delivered.wait(lock, [this]() { return m_next_deliver_id == m_next_frame_id; });
+    }
+
+    GassianBlurContextPool::BlurWorker *GassianBlurContextPool::pickWorker()
+    {
+        if (m_dispatch == CONTEXT_POOL_ROUND_ROBIN)
+        {
+            BlurWorker *worker = m_workers[m_round_robin_index];
+            m_round_robin_index = (m_round_robin_index + 1) % m_workers.size();
+            return worker;
+        }
+
+        BlurWorker *least = m_workers[0];
+        for (size_t i = 1; i < m_workers.size(); i++)
+        {
+            if (m_workers[i]->pending < least->pending)
+            {
+                least = m_workers[i];
+            }
+        }
+        return least;
+    }
+
+    void GassianBlurContextPool::workerLoop(BlurWorker *worker)
+    {
+        glfwMakeContextCurrent(worker->window);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+        worker->vao = GassianBlurCore::createQuadVertexArray(m_core->m_VBO, m_core->m_EBO);
+        unsigned int *textureIdxs = m_core->createTexture2D(1);
+        worker->base_texture = textureIdxs[0];
+        delete[] textureIdxs;
+        worker->target = new FrameBuffer();
+        if (!worker->target->init(m_core->m_result_w, m_core->m_result_h))
+        {
+            std::cout << "[POOL] worker " << worker->index << " frame buffer error: " << worker->target->getErrorMessage() << std::endl;
+        }
+        glViewport(0, 0, m_core->m_result_w, m_core->m_result_h);
+
+        BlurJob *job = nullptr;
+        while (worker->jobs->Pop(job))
+        {
+            renderJob(worker, job);
+            worker->pending--;
+            deliver(job);
+        }
+
+        delete worker->target;
+        worker->target = nullptr;
+        glDeleteTextures(1, &worker->base_texture);
+        glDeleteVertexArrays(1, &worker->vao);
+        glfwMakeContextCurrent(NULL);
+    }
+
+    void GassianBlurContextPool::renderJob(BlurWorker *worker, BlurJob *job)
+    {
+        auto shader_base_pixel_fmt = (job->base_image_channel == 3) ? GL_RGB : GL_RGBA;
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, worker->base_texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, job->base_image_width, job->base_image_height, 0,
+                     shader_base_pixel_fmt, GL_UNSIGNED_BYTE, job->base_image.data());
+        glGenerateMipmap(GL_TEXTURE_2D);
+        // rebinding picks up zone map changes made on the core's context
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, m_core->m_filter_zone_textureIdx);
+        glActiveTexture(GL_TEXTURE3);
+        glBindTexture(GL_TEXTURE_2D, m_core->m_kernel_lut_textureIdx);
+
+        worker->target->bind();
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(m_core->m_shader->ID);
+        glBindVertexArray(worker->vao);
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+
+        job->result.resize(m_core->getOutBufLen());
+        glReadPixels(0, 0, m_core->m_result_w, m_core->m_result_h,
+                     (m_core->m_result_channel == 4) ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE, job->result.data());
+    }
+
+    // workers finish out of order, results are held back until every
+    // earlier frame was delivered
+    void GassianBlurContextPool::deliver(BlurJob *job)
+    {
+        std::lock_guard<std::mutex> lock(m_deliver_mutex);
+        m_done_jobs[job->frame_id] = job;
+        auto it = m_done_jobs.find(m_next_deliver_id);
+        while (it != m_done_jobs.end())
+        {
+            BlurJob *ready = it->second;
+            if (ready->callback)
+            {
+                ready->callback(ready->frame_id, ready->result.data(), (unsigned long)ready->result.size());
+            }
+            delete ready;
+            m_done_jobs.erase(it);
+            m_next_deliver_id++;
+            it = m_done_jobs.find(m_next_deliver_id);
+        }
+        m_delivered.notify_all();
+    }
+}
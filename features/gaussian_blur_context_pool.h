@@ -0,0 +1,89 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 13:02:44
+ * @LastEditTime: 2026-10-19 15:37:09
+ * @LastEditors: Matt.SHI
+ * @Description: several shared GL contexts blurring frames in parallel
+ * @FilePath: /opengl_demo/features/gaussian_blur_context_pool.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_CONTEXT_POOL_H_
+#define _ESSILOR_GAUSSIAN_BLUR_CONTEXT_POOL_H_
+
+#include "gaussian_blur_core.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ESSILOR
+{
+    enum ContextPoolDispatch
+    {
+        CONTEXT_POOL_ROUND_ROBIN = 0,
+        CONTEXT_POOL_LEAST_LOADED,
+    };
+
+    // every worker owns a hidden window whose context shares objects with the
+    // core's one: the blur program, the quad buffers and the filter zone texture
+    // are used as they are, vertex arrays and render targets are per worker.
+    // frames are handed out to the workers and come back in submission order.
+    class GassianBlurContextPool
+    {
+        public:
+            GassianBlurContextPool();
+            virtual ~GassianBlurContextPool();
+
+        public:
+            // call on the thread owning the core's context, after core.init()
+            int init(GassianBlurCore *core, unsigned int worker_count,
+                ContextPoolDispatch dispatch = CONTEXT_POOL_LEAST_LOADED, unsigned int queue_depth = 2);
+            void unit();
+
+            // waits for in-flight frames, then uploads on the core's context
+            void updateFilterZone(unsigned char *filter_zone_image_data,
+                unsigned int filter_zone_image_width,
+                unsigned int filter_zone_image_height,
+                unsigned int filter_zone_image_channel);
+            // GassianBlurCore::setKernelProfile for the workers, same waiting
+            void setKernelProfile(int profile);
+
+            // base_image_data is copied, returns the frame id or -1
+            long submit(unsigned char *base_image_data,
+                unsigned int base_image_width,
+                unsigned int base_image_height,
+                unsigned int base_image_channel,
+                BlurDoneCallback callback);
+            // wait until every submitted frame was delivered
+            void flush();
+
+            unsigned int getWorkerCount() const { return (unsigned int)m_workers.size(); }
+
+        protected:
+            struct BlurJob;
+            struct BlurWorker;
+
+            void workerLoop(BlurWorker *worker);
+            void renderJob(BlurWorker *worker, BlurJob *job);
+            void deliver(BlurJob *job);
+            BlurWorker *pickWorker();
+
+        private:
+            GassianBlurCore *m_core;
+            std::vector<BlurWorker*> m_workers;
+            ContextPoolDispatch m_dispatch;
+            unsigned int m_round_robin_index;
+
+            unsigned long m_next_frame_id;
+            unsigned long m_next_deliver_id;
+            std::map<unsigned long, BlurJob*> m_done_jobs;
+            std::mutex m_deliver_mutex;
+            std::condition_variable m_delivered;
+    };
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_CONTEXT_POOL_H_
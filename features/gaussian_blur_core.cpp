@@ -9,6 +9,14 @@
  */
 
 #include "gaussian_blur_core.h"
+#include "gaussian_blur_calibration.h"
+#include "gaussian_blur_debug.h"
+#include "gaussian_blur_shader_reload.h"
+#include "gaussian_blur_defines.h"
+#include "gaussian_blur_kernel_lut.h"
+#include "gaussian_blur_zone_map.h"
+#include "cpu/gaussian_blur_iir.h"
+#include "cpu/gaussian_blur_fixed.h"
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
@@ -29,25 +37,107 @@
 #include <learnopengl/shader_m.h>
 
 #include <features/framebuffer/FrameBuffer.h>
+#include <features/framebuffer/render_target_pool.h>
 
 #include <iostream>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string.h>
 
 namespace ESSILOR
 {
-    GassianBlurCore::GassianBlurCore() : m_result_buffer(nullptr),
-                                         m_frameBuffer(nullptr),
+    // every frame in flight owns its upload, texture and readback buffers so
+    // frame n+1 can be uploaded while the gpu still works on frame n
+    struct GassianBlurCore::BlurPipelineSlot
+    {
+        unsigned int upload_pbo;
+        unsigned int readback_pbo;
+        unsigned int base_texture;
+        unsigned int texture_w;
+        unsigned int texture_h;
+        unsigned int texture_channel;
+        GLsync fence;
+        bool busy;
+        unsigned long frame_id;
+        BlurDoneCallback callback;
+    };
+
+    struct GassianBlurCore::RenderTargets
+    {
+        std::vector<RenderTargetLease> frames;  // offscreen frames, m_render_target_index
+        RenderTargetLease low_res;
+        RenderTargetLease batch;
+    };
+
+    struct GassianBlurCore::ShaderUniforms
+    {
+        UniformHandle kernel_pixel_size_x;
+        UniformHandle kernel_pixel_size_y;
+        UniformHandle blur_pass;
+        UniformHandle source_lod;
+        UniformHandle low_res_scale;
+        UniformHandle low_res_texel_size;
+        UniformHandle half_res_zone;
+        UniformHandle half_res_blend;
+        UniformHandle upsample_mode;
+        UniformHandle batch_mode;
+        UniformHandle batch_texel_size;
+        UniformHandle batch_rects;
+        UniformHandle source_samples;
+        UniformHandle copy_pass_through_zone;
+    };
+
+    GassianBlurCore::GassianBlurCore() : m_shader(nullptr),
+                                         m_copy_shader(nullptr),
+                                         m_shader_variants(nullptr),
+                                         m_uniforms(new ShaderUniforms()),
+                                         m_target_pool(new RenderTargetPool()),
+                                         m_targets(new RenderTargets()),
+                                         m_render_target_count(3),
+                                         m_render_target_index(0),
                                          m_glWindow(nullptr),
-                                         m_shader(nullptr),
+                                         m_result_buffer(nullptr),
                                          m_flags_using_framebuffer(false),
                                          m_flags_enable_gui(false),
                                          m_shader_pixel_size_x(0.002),
-                                         m_shader_pixel_size_y(0.002)
+                                         m_shader_pixel_size_y(0.002),
+                                         m_pipeline_depth(2),
+                                         m_pipeline_head(0),
+                                         m_pipeline_next_id(0),
+                                         m_engine(GAUSSIAN_BLUR_ENGINE_SHADER),
+                                         m_cpu_iir(nullptr),
+                                         m_cpu_fixed(nullptr),
+                                         m_auto_engine(false),
+                                         m_half_res_scale(1),
+                                         m_half_res_upsample(GAUSSIAN_BLUR_UPSAMPLE_BILATERAL),
+                                         m_half_res_zone(27.0f),
+                                         m_half_res_blend(6.0f),
+                                         m_zone_map(new GassianBlurZoneMap()),
+                                         m_kernel_lut(new GassianBlurKernelLut()),
+                                         m_kernel_lut_dirty(false),
+                                         m_zone_early_out(true),
+                                         m_gl_debug(false),
+                                         m_debug(nullptr),
+                                         m_frame_count(0),
+                                         m_shader_reload_enabled(false),
+                                         m_shader_reload(nullptr),
+                                         m_batch_textureIdx(0),
+                                         m_batch_texture_w(0),
+                                         m_batch_texture_h(0)
     {
     }
 
     GassianBlurCore::~GassianBlurCore()
     {
+        delete m_zone_map;
+        delete m_kernel_lut;
+        delete m_debug;
+        delete m_uniforms;
+        delete m_shader_variants;
+        // the leases go back to the pool before it goes
+        delete m_targets;
+        delete m_target_pool;
     }
 
     int GassianBlurCore::init(unsigned int outbuf_w, unsigned int outbuf_h, unsigned int outbuf_channel,
@@ -65,6 +155,11 @@ namespace ESSILOR
             m_shader_pixel_size_x = 1.0 / outbuf_w;
             m_shader_pixel_size_y = 1.0 / outbuf_h;
             set_pixel_size(m_shader_pixel_size_x,m_shader_pixel_size_y);
+
+            if (m_auto_engine)
+            {
+                calibrateEngine();
+            }
         }
         catch (const std::exception &e)
         {
@@ -84,12 +179,209 @@ namespace ESSILOR
         m_flags_enable_gui = enable;
     }
 
+    void GassianBlurCore::set_pipeline_depth(unsigned int depth)
+    {
+        if (!m_pipeline_slots.empty())
+        {
+            std::cout << "[PIPELINE] depth can not change after the first submit" << std::endl;
+            return;
+        }
+        m_pipeline_depth = std::min(4u, std::max(2u, depth));
+    }
+
+    void GassianBlurCore::set_render_target_count(unsigned int count)
+    {
+        m_render_target_count = std::max(1u, count);
+    }
+
+    void GassianBlurCore::set_engine(int engine)
+    {
+        if (engine != GAUSSIAN_BLUR_ENGINE_SHADER && engine != GAUSSIAN_BLUR_ENGINE_CPU_IIR &&
+            engine != GAUSSIAN_BLUR_ENGINE_CPU_FIXED)
+        {
+            std::cout << "[ENGINE] unknown engine " << engine << ", keeping " << m_engine << std::endl;
+            return;
+        }
+        m_engine = engine;
+    }
+
+    int GassianBlurCore::get_engine()
+    {
+        return m_engine;
+    }
+
+    void GassianBlurCore::set_auto_engine(bool enable, const char *cache_file)
+    {
+        m_auto_engine = enable;
+        m_auto_engine_cache = cache_file ? cache_file : "";
+    }
+
+    void GassianBlurCore::calibrateEngine()
+    {
+        std::string key = GassianBlurCalibration::makeKey((const char *)glGetString(GL_VENDOR),
+                                                          (const char *)glGetString(GL_RENDERER),
+                                                          m_result_w, m_result_h, m_result_channel);
+        GassianBlurCalibration calibration(m_auto_engine_cache);
+        int engine = GAUSSIAN_BLUR_ENGINE_SHADER;
+        if (calibration.lookup(key, engine))
+        {
+            set_engine(engine);
+            std::cout << "[CALIBRATION] cached engine " << m_engine << " for " << key << std::endl;
+            return;
+        }
+
+        std::vector<unsigned char> base_image;
+        std::vector<unsigned char> zone_image;
+        GassianBlurCalibration::fillSyntheticFrame(m_result_w, m_result_h, m_result_channel, base_image, zone_image);
+
+        const int engines[] = {GAUSSIAN_BLUR_ENGINE_SHADER, GAUSSIAN_BLUR_ENGINE_CPU_IIR, GAUSSIAN_BLUR_ENGINE_CPU_FIXED};
+        int best_engine = GAUSSIAN_BLUR_ENGINE_SHADER;
+        double best_ms = 0.0;
+        for (int candidate : engines)
+        {
+            m_engine = candidate;
+            double ms = timeEngine(base_image.data(), zone_image.data());
+            std::cout << "[CALIBRATION] engine " << candidate << ": " << ms << " ms" << std::endl;
+            if (candidate == engines[0] || ms < best_ms)
+            {
+                best_engine = candidate;
+                best_ms = ms;
+            }
+        }
+        m_engine = best_engine;
+        // the synthetic zones must not pass for the caller's first frame
+        m_zone_map->invalidate();
+
+        calibration.store(key, m_engine);
+        std::cout << "[CALIBRATION] picked engine " << m_engine << " for " << key << std::endl;
+    }
+
+    double GassianBlurCore::timeEngine(unsigned char *base_image_data, unsigned char *filter_zone_image_data)
+    {
+        std::vector<double> times;
+        for (int run = 0; run <= GAUSSIAN_BLUR_CALIBRATION_RUNS; run++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            if (!runCpuEngine(base_image_data, m_result_w, m_result_h, m_result_channel,
+                              filter_zone_image_data, m_result_w, m_result_h, 4))
+            {
+                updateTexture2DMemData(m_base_textureIdx, GL_TEXTURE0, m_result_w, m_result_h, m_result_channel,
+                                       GL_RGBA, (m_result_channel == 3) ? GL_RGB : GL_RGBA, base_image_data);
+                uploadFilterZone(filter_zone_image_data, m_result_w, m_result_h, 4);
+                glActiveTexture(GL_TEXTURE0);
+                drawBlur();
+                // the readback waits for the gpu
+                readResult(m_result_buffer);
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            // the first run builds kernels and allocates
+            if (run > 0)
+            {
+                times.push_back(ms);
+            }
+        }
+        std::sort(times.begin(), times.end());
+        return times[times.size() / 2];
+    }
+
+    void GassianBlurCore::set_half_res_mode(unsigned int scale, int upsample)
+    {
+        if (scale != 1 && scale != 2 && scale != 4)
+        {
+            std::cout << "[HALF_RES] scale " << scale << " not supported, use 1, 2 or 4" << std::endl;
+            return;
+        }
+        m_half_res_scale = scale;
+        m_half_res_upsample = (upsample == GAUSSIAN_BLUR_UPSAMPLE_BILINEAR) ? GAUSSIAN_BLUR_UPSAMPLE_BILINEAR : GAUSSIAN_BLUR_UPSAMPLE_BILATERAL;
+    }
+
+    void GassianBlurCore::set_half_res_zone(float zone_value, float blend_width)
+    {
+        m_half_res_zone = zone_value;
+        m_half_res_blend = std::max(0.0f, blend_width);
+    }
+
+    void GassianBlurCore::invalidateFilterZone()
+    {
+        m_zone_map->invalidate();
+    }
+
+    const GassianBlurZoneMap *GassianBlurCore::getZoneMap()
+    {
+        return m_zone_map;
+    }
+
+    void GassianBlurCore::set_zone_early_out(bool enable)
+    {
+        m_zone_early_out = enable;
+    }
+
+    void GassianBlurCore::setKernelProfile(int profile)
+    {
+        if (profile != GAUSSIAN_BLUR_PROFILE_FAST && profile != GAUSSIAN_BLUR_PROFILE_BALANCED &&
+            profile != GAUSSIAN_BLUR_PROFILE_EXACT)
+        {
+            std::cout << "[KERNEL] unknown profile " << profile << ", keeping " << m_kernel_lut->profile() << std::endl;
+            return;
+        }
+        if (profile == m_kernel_lut->profile())
+            return;
+        m_kernel_lut->build(profile);
+        m_kernel_lut_dirty = true;
+    }
+
+    void GassianBlurCore::set_gl_debug(bool enable)
+    {
+        m_gl_debug = enable;
+    }
+
+    void GassianBlurCore::set_shader_reload(bool enable)
+    {
+        m_shader_reload_enabled = enable;
+    }
+
+    const GassianBlurDebugOutput *GassianBlurCore::getDebugOutput()
+    {
+        return (nullptr != m_debug && m_debug->isInstalled()) ? m_debug : nullptr;
+    }
+
+    int GassianBlurCore::getKernelProfile()
+    {
+        return m_kernel_lut->profile();
+    }
+
+    // R8 level 0 only when the zones changed. the shader samples that level
+    // alone, the max chain stays on the cpu for the classification
+    bool GassianBlurCore::uploadFilterZone(unsigned char *filter_zone_image_data,
+                                           unsigned int filter_zone_image_width,
+                                           unsigned int filter_zone_image_height,
+                                           unsigned int filter_zone_image_channel)
+    {
+        if (!m_zone_map->update(filter_zone_image_data, filter_zone_image_width,
+                                filter_zone_image_height, filter_zone_image_channel))
+        {
+            return false;
+        }
+
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, m_filter_zone_textureIdx);
+        const ZoneMapLevel &level = m_zone_map->level(0);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, level.width, level.height, 0, GL_RED, GL_UNSIGNED_BYTE, level.data.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+        std::cout << "[ZONE] uploaded " << filter_zone_image_width << "x" << filter_zone_image_height
+                  << " zones, values " << (int)m_zone_map->minValue()
+                  << "-" << (int)m_zone_map->maxValue() << std::endl;
+        return true;
+    }
+
     void GassianBlurCore::set_pixel_size(float pixel_size_x, float pixel_size_y)
     {
+        m_shader_pixel_size_x = pixel_size_x;
+        m_shader_pixel_size_y = pixel_size_y;
         if(nullptr != m_shader)
         {
-            m_shader->setFloat("kernelPixelSizeX",pixel_size_x);
-            m_shader->setFloat("kernelPixelSizeY",pixel_size_y);
+            m_shader->setFloat(m_uniforms->kernel_pixel_size_x, pixel_size_x);
+            m_shader->setFloat(m_uniforms->kernel_pixel_size_y, pixel_size_y);
         }
     }
 
@@ -104,56 +396,623 @@ namespace ESSILOR
         unsigned int filter_zone_image_height,
         unsigned int filter_zone_image_channel)
     {
-        unsigned long base_image_len = base_image_width * base_image_height * base_image_channel;
-        unsigned long filter_zone_image_len = filter_zone_image_width * filter_zone_image_height * filter_zone_image_channel;
+        if (runCpuEngine(base_image_data, base_image_width, base_image_height, base_image_channel,
+                         filter_zone_image_data, filter_zone_image_width, filter_zone_image_height, filter_zone_image_channel))
+        {
+            return m_result_buffer;
+        }
 
-        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
         // GLuint opTextureIdx = m_frameBuffer->getColorId();
 
         auto shader_base_pixel_fmt = GL_RGBA;
-        auto shader_filter_pixel_fmt = GL_RGBA;
         if(base_image_channel == 3)
         {
             shader_base_pixel_fmt = GL_RGB;
         }
-        if(base_image_channel == 3)
+
+        // update buffer
         {
-            shader_filter_pixel_fmt = GL_RGB;
+            GassianBlurDebugGroup group(m_debug, "upload");
+            updateTexture2DMemData(m_base_textureIdx, GL_TEXTURE0,
+                                   base_image_width, base_image_height, base_image_channel,
+                                   GL_RGBA, shader_base_pixel_fmt, base_image_data);
+
+            uploadFilterZone(filter_zone_image_data, filter_zone_image_width, filter_zone_image_height, filter_zone_image_channel);
+            glActiveTexture(GL_TEXTURE0);
         }
 
-        // update buffer
-        updateTexture2DMemData(m_base_textureIdx, GL_TEXTURE0,
-                               base_image_width, base_image_height, base_image_channel,
-                               GL_RGBA, shader_base_pixel_fmt, base_image_data);
+        drawBlur();
+        // read before swapping, the back buffer is undefined afterwards
+        readResult(m_result_buffer);
+        presentFrame();
+        return m_result_buffer;
+    }
 
-        updateTexture2DMemData(m_filter_zone_textureIdx, GL_TEXTURE1,
-                               filter_zone_image_width, filter_zone_image_height, filter_zone_image_channel,
-                               GL_RGBA, shader_filter_pixel_fmt, filter_zone_image_data);
+    long GassianBlurCore::submitGaussianBlur(
+        unsigned char *base_image_data,
+        unsigned int base_image_width,
+        unsigned int base_image_height,
+        unsigned int base_image_channel,
+
+        unsigned char *filter_zone_image_data,
+        unsigned int filter_zone_image_width,
+        unsigned int filter_zone_image_height,
+        unsigned int filter_zone_image_channel,
+        BlurDoneCallback callback)
+    {
+        if (nullptr == m_shader || nullptr == base_image_data)
+        {
+            return -1;
+        }
+        if (m_engine != GAUSSIAN_BLUR_ENGINE_SHADER)
+        {
+            // frames already on the gpu are delivered first to keep the order
+            flushGaussianBlur();
+            if (runCpuEngine(base_image_data, base_image_width, base_image_height, base_image_channel,
+                             filter_zone_image_data, filter_zone_image_width, filter_zone_image_height, filter_zone_image_channel))
+            {
+                unsigned long frame_id = m_pipeline_next_id++;
+                if (callback)
+                {
+                    callback(frame_id, m_result_buffer, getOutBufLen());
+                }
+                return (long)frame_id;
+            }
+        }
+        if (m_pipeline_slots.empty())
+        {
+            initPipeline();
+        }
+
+        BlurPipelineSlot *slot = m_pipeline_slots[m_pipeline_head];
+        if (slot->busy)
+        {
+            // the ring is full, the oldest frame has to leave first
+            completePipelineSlot(slot);
+        }
+
+        // upload the base image through the slot's own pbo
+        {
+            GassianBlurDebugGroup group(m_debug, "upload");
+            unsigned long base_image_len = base_image_width * base_image_height * base_image_channel;
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot->upload_pbo);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, base_image_len, nullptr, GL_STREAM_DRAW);
+            void *upload_ptr = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, base_image_len,
+                                                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+            if (nullptr == upload_ptr)
+            {
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                std::cout << "[PIPELINE] failed to map upload buffer" << std::endl;
+                return -1;
+            }
+            memcpy(upload_ptr, base_image_data, base_image_len);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+            auto shader_base_pixel_fmt = (base_image_channel == 3) ? GL_RGB : GL_RGBA;
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, slot->base_texture);
+            if (slot->texture_w != base_image_width || slot->texture_h != base_image_height ||
+                slot->texture_channel != base_image_channel)
+            {
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, base_image_width, base_image_height, 0,
+                             shader_base_pixel_fmt, GL_UNSIGNED_BYTE, 0);
+                slot->texture_w = base_image_width;
+                slot->texture_h = base_image_height;
+                slot->texture_channel = base_image_channel;
+            }
+            else
+            {
+                glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, base_image_width, base_image_height,
+                                shader_base_pixel_fmt, GL_UNSIGNED_BYTE, 0);
+            }
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            // wide kernels and the half resolution pass read coarser mip levels
+            glGenerateMipmap(GL_TEXTURE_2D);
+
+            uploadFilterZone(filter_zone_image_data, filter_zone_image_width, filter_zone_image_height, filter_zone_image_channel);
+        }
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, slot->base_texture);
+        drawBlur();
+
+        // queue the readback into the slot's pbo, nobody waits for it here
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->readback_pbo);
+        readResult(0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        presentFrame();
+
+        slot->busy = true;
+        slot->frame_id = m_pipeline_next_id++;
+        slot->callback = callback;
+        m_pipeline_head = (m_pipeline_head + 1) % m_pipeline_slots.size();
+        return (long)slot->frame_id;
+    }
+
+    void GassianBlurCore::flushGaussianBlur()
+    {
+        // the slot after head holds the oldest frame
+        for (size_t i = 0; i < m_pipeline_slots.size(); i++)
+        {
+            BlurPipelineSlot *slot = m_pipeline_slots[(m_pipeline_head + i) % m_pipeline_slots.size()];
+            if (slot->busy)
+            {
+                completePipelineSlot(slot);
+            }
+        }
+    }
+
+    void GassianBlurCore::completePipelineSlot(BlurPipelineSlot *slot)
+    {
+        // flush once, then keep waiting in 100ms steps
+        GLbitfield wait_flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        while (true)
+        {
+            GLenum wait_ret = glClientWaitSync(slot->fence, wait_flags, 100000000);
+            if (wait_ret == GL_ALREADY_SIGNALED || wait_ret == GL_CONDITION_SATISFIED)
+                break;
+            if (wait_ret == GL_WAIT_FAILED)
+            {
+                std::cout << "[PIPELINE] wait failed for frame " << slot->frame_id << std::endl;
+                break;
+            }
+            wait_flags = 0;
+        }
+        glDeleteSync(slot->fence);
+        slot->fence = 0;
+
+        unsigned long out_len = getOutBufLen();
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->readback_pbo);
+        const unsigned char *data = (const unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, out_len, GL_MAP_READ_BIT);
+        if (nullptr != data)
+        {
+            if (slot->callback)
+            {
+                slot->callback(slot->frame_id, data, out_len);
+            }
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        else
+        {
+            std::cout << "[PIPELINE] failed to map readback buffer of frame " << slot->frame_id << std::endl;
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        slot->busy = false;
+        slot->callback = nullptr;
+    }
+
+    // false when the frame has to go through the shader instead
+    bool GassianBlurCore::runCpuEngine(unsigned char *base_image_data,
+                                       unsigned int base_image_width,
+                                       unsigned int base_image_height,
+                                       unsigned int base_image_channel,
+                                       unsigned char *filter_zone_image_data,
+                                       unsigned int filter_zone_image_width,
+                                       unsigned int filter_zone_image_height,
+                                       unsigned int filter_zone_image_channel)
+    {
+        if (m_engine == GAUSSIAN_BLUR_ENGINE_SHADER || nullptr == m_result_buffer)
+        {
+            return false;
+        }
+        if (base_image_width != m_result_w || base_image_height != m_result_h)
+        {
+            std::cout << "[ENGINE] cpu engine needs a " << m_result_w << "x" << m_result_h
+                      << " base image, got " << base_image_width << "x" << base_image_height
+                      << ", using the shader" << std::endl;
+            return false;
+        }
+        if (m_engine == GAUSSIAN_BLUR_ENGINE_CPU_FIXED)
+        {
+            if (nullptr == m_cpu_fixed)
+            {
+                m_cpu_fixed = new GassianBlurFixed();
+                std::cout << "[ENGINE] fixed point kernels built for " << GassianBlurFixed::simdName() << std::endl;
+            }
+            return 0 == m_cpu_fixed->process(base_image_data, base_image_width, base_image_height, base_image_channel,
+                                             filter_zone_image_data, filter_zone_image_width, filter_zone_image_height, filter_zone_image_channel,
+                                             m_result_buffer, m_result_channel);
+        }
+        if (nullptr == m_cpu_iir)
+        {
+            m_cpu_iir = new GassianBlurIIR();
+        }
+        return 0 == m_cpu_iir->process(base_image_data, base_image_width, base_image_height, base_image_channel,
+                                       filter_zone_image_data, filter_zone_image_width, filter_zone_image_height, filter_zone_image_channel,
+                                       m_result_buffer, m_result_channel);
+    }
+
+    int GassianBlurCore::doGaussianBlurBatch(
+        BlurBatchImage *images,
+        unsigned int image_count,
+        unsigned char *filter_zone_image_data,
+        unsigned int filter_zone_image_width,
+        unsigned int filter_zone_image_height,
+        unsigned int filter_zone_image_channel)
+    {
+        if (nullptr == m_shader || nullptr == images)
+        {
+            return 0;
+        }
+        applyShaderReload();
+        // frames in flight use the same zone texture and program state
+        flushGaussianBlur();
+        uploadFilterZone(filter_zone_image_data, filter_zone_image_width, filter_zone_image_height, filter_zone_image_channel);
+
+        std::vector<BlurBatchImage *> accepted;
+        for (unsigned int i = 0; i < image_count; i++)
+        {
+            BlurBatchImage &image = images[i];
+            // the atlas takes rgb and rgba rows only
+            if (nullptr == image.data || nullptr == image.result || image.width == 0 || image.height == 0 ||
+                image.width > GAUSSIAN_BLUR_BATCH_MAX_SIZE || image.height > GAUSSIAN_BLUR_BATCH_MAX_SIZE ||
+                (image.channel != 3 && image.channel != 4))
+            {
+                std::cout << "[BATCH] skipping image " << i << " " << image.width << "x" << image.height
+                          << " channel:" << image.channel << std::endl;
+                continue;
+            }
+            accepted.push_back(&image);
+        }
+
+        int done = 0;
+        for (size_t first = 0; first < accepted.size(); first += GAUSSIAN_BLUR_BATCH_MAX)
+        {
+            unsigned int count = (unsigned int)std::min<size_t>(GAUSSIAN_BLUR_BATCH_MAX, accepted.size() - first);
+            done += drawBatch(&accepted[first], count);
+        }
+
+        // back to single frame state
+        m_shader->setInt(m_uniforms->batch_mode, 0);
+        set_pixel_size(1.0f / m_result_w, 1.0f / m_result_h);
+        glViewport(0, 0, m_result_w, m_result_h);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, m_base_textureIdx);
+        return done;
+    }
+
+    // the images sit on a grid of cells as large as the largest one, the
+    // atlas and the target are only reallocated when the grid grows. cells
+    // are aligned to the texel of the coarsest mip level a kernel reads and
+    // the image edge is repeated up to the cell size, so no texel of such a
+    // level mixes two images or unused atlas area
+    int GassianBlurCore::drawBatch(BlurBatchImage **images, unsigned int image_count)
+    {
+        if (nullptr != m_debug)
+        {
+            m_debug->set_frame(m_frame_count);
+        }
+        m_frame_count++;
+        GassianBlurDebugGroup group(m_debug, "batch");
+
+        unsigned int cell_w = 0;
+        unsigned int cell_h = 0;
+        for (unsigned int i = 0; i < image_count; i++)
+        {
+            cell_w = std::max(cell_w, images[i]->width);
+            cell_h = std::max(cell_h, images[i]->height);
+        }
+        const unsigned int align = 1u << m_kernel_lut->maxLod(GAUSSIAN_BLUR_LUT_ROWS - 1);
+        cell_w = (cell_w + align - 1) / align * align;
+        cell_h = (cell_h + align - 1) / align * align;
+        unsigned int cols = (unsigned int)std::ceil(std::sqrt((float)image_count));
+        unsigned int rows = (image_count + cols - 1) / cols;
+        unsigned int atlas_w = cols * cell_w;
+        unsigned int atlas_h = rows * cell_h;
+
+        glActiveTexture(GL_TEXTURE0);
+        if (0 == m_batch_textureIdx)
+        {
+            unsigned int *textureIdxs = createTexture2D(1);
+            m_batch_textureIdx = textureIdxs[0];
+            delete[] textureIdxs;
+        }
+        glBindTexture(GL_TEXTURE_2D, m_batch_textureIdx);
+        // a profile with coarser levels may need a new alignment of the atlas
+        if (atlas_w > m_batch_texture_w || atlas_h > m_batch_texture_h ||
+            m_batch_texture_w % align != 0 || m_batch_texture_h % align != 0)
+        {
+            m_batch_texture_w = (std::max(atlas_w, m_batch_texture_w) + align - 1) / align * align;
+            m_batch_texture_h = (std::max(atlas_h, m_batch_texture_h) + align - 1) / align * align;
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_batch_texture_w, m_batch_texture_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+
+            // FrameBuffer::init() rebinds textures, keep it away from the atlas on unit 0
+            glActiveTexture(GL_TEXTURE2);
+            m_targets->batch = m_target_pool->acquire(FrameBufferDesc(m_batch_texture_w, m_batch_texture_h, GL_RGBA8, false));
+            glActiveTexture(GL_TEXTURE0);
+            std::cout << "[BATCH] atlas w:" << m_batch_texture_w << " h:" << m_batch_texture_h << std::endl;
+        }
+
+        std::vector<float> rects(4 * image_count);
+        for (unsigned int i = 0; i < image_count; i++)
+        {
+            const BlurBatchImage *image = images[i];
+            unsigned int x = (i % cols) * cell_w;
+            unsigned int y = (i / cols) * cell_h;
+            unsigned int channel = image->channel;
+            auto pixel_fmt = (channel == 3) ? GL_RGB : GL_RGBA;
+            size_t row_len = (size_t)image->width * channel;
+            size_t cell_row_len = (size_t)cell_w * channel;
+            m_batch_cell.resize(cell_row_len * cell_h);
+            for (unsigned int row = 0; row < cell_h; row++)
+            {
+                unsigned char *dst = &m_batch_cell[row * cell_row_len];
+                memcpy(dst, image->data + std::min(row, image->height - 1) * row_len, row_len);
+                for (size_t k = row_len; k < cell_row_len; k++)
+                {
+                    dst[k] = dst[k - channel];
+                }
+            }
+            glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, cell_w, cell_h, pixel_fmt, GL_UNSIGNED_BYTE, m_batch_cell.data());
+            rects[4 * i + 0] = (float)x / m_batch_texture_w;
+            rects[4 * i + 1] = (float)y / m_batch_texture_h;
+            rects[4 * i + 2] = (float)image->width / m_batch_texture_w;
+            rects[4 * i + 3] = (float)image->height / m_batch_texture_h;
+        }
+        glGenerateMipmap(GL_TEXTURE_2D);
 
-        // call shader
         m_shader->use();
+        m_shader->setInt(m_uniforms->batch_mode, 1);
+        m_shader->setInt(m_uniforms->blur_pass, GAUSSIAN_BLUR_PASS_FULL);
+        m_shader->setFloat(m_uniforms->source_lod, 0.0f);
+        m_shader->setVec2(m_uniforms->batch_texel_size, 1.0f / m_batch_texture_w, 1.0f / m_batch_texture_h);
+        m_shader->setVec4Array(m_uniforms->batch_rects, (int)image_count, rects.data());
+        set_pixel_size(1.0f / m_batch_texture_w, 1.0f / m_batch_texture_h);
+
+        // the rects are in uv of the whole atlas texture, so is the viewport
+        refreshKernelLut();
+        m_targets->batch->bind();
+        glViewport(0, 0, m_batch_texture_w, m_batch_texture_h);
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glBindVertexArray(m_VAO);
+        glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, image_count);
+
+        // one transfer for the whole grid, then split into the images
+        unsigned int channel = (m_result_channel == 4) ? 4 : 3;
+        m_batch_readback.resize((size_t)atlas_w * atlas_h * channel);
+        glReadPixels(0, 0, atlas_w, atlas_h, (channel == 4) ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE, m_batch_readback.data());
+        for (unsigned int i = 0; i < image_count; i++)
+        {
+            BlurBatchImage *image = images[i];
+            unsigned int x = (i % cols) * cell_w;
+            unsigned int y = (i / cols) * cell_h;
+            size_t row_len = (size_t)image->width * channel;
+            for (unsigned int row = 0; row < image->height; row++)
+            {
+                memcpy(image->result + row * row_len,
+                       &m_batch_readback[((size_t)(y + row) * atlas_w + x) * channel], row_len);
+            }
+        }
+        return (int)image_count;
+    }
+
+    // expects the source image on texture unit 0 and the zones on unit 1
+    void GassianBlurCore::drawBlur()
+    {
+        if (nullptr != m_debug)
+        {
+            m_debug->set_frame(m_frame_count);
+        }
+        m_frame_count++;
+        GassianBlurDebugGroup group(m_debug, "blur");
+        applyShaderReload();
 
+        // call shader
+        m_shader->use();
         glBindVertexArray(m_VAO);
+        refreshKernelLut();
+
+        // the tile statistics tell whether zero radius pixels exist at all
+        int pass_through = m_kernel_lut->passThroughZone();
+        bool early_out = m_zone_early_out && nullptr != m_copy_shader && pass_through >= 0;
+        bool copy_only = early_out && m_zone_map->maxValue() <= pass_through;
+        bool masked = early_out && !copy_only && m_zone_map->minValue() <= pass_through;
+
+        if (m_half_res_scale > 1 && !copy_only)
+        {
+            drawLowResPass();
+        }
+
+        if (m_flags_using_framebuffer)
+        {
+            m_targets->frames[m_render_target_index]->bind();
+        }
+        else
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        }
+        glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+        glClearDepth(1.0);
+        glClear(masked ? (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT) : GL_COLOR_BUFFER_BIT);
+
+        if (copy_only || masked)
+        {
+            drawCopyPass(masked);
+        }
 
         // draw
+        if (!copy_only)
+        {
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        }
+
+        if (masked)
+        {
+            glDepthMask(GL_TRUE);
+            glDisable(GL_DEPTH_TEST);
+        }
+
+        if (m_half_res_scale > 1)
+        {
+            // the program is shared with the context pool, leave it in full mode
+            m_shader->setInt(m_uniforms->blur_pass, GAUSSIAN_BLUR_PASS_FULL);
+        }
+    }
+
+    // copies the zero radius pixels. with mask the copied pixels keep the
+    // quad's depth and the blur pass drawn next is depth tested out of them,
+    // the blur shader itself never discards and keeps its early depth test
+    void GassianBlurCore::drawCopyPass(bool mask)
+    {
+        GassianBlurDebugGroup group(m_debug, "zone early out copy");
+        if (mask)
+        {
+            glEnable(GL_DEPTH_TEST);
+            glDepthFunc(GL_ALWAYS);
+            glDepthMask(GL_TRUE);
+        }
+        m_copy_shader->use();
+        m_copy_shader->setFloat(m_uniforms->copy_pass_through_zone, (float)m_kernel_lut->passThroughZone());
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-        // swap buffer
-        glfwSwapBuffers(m_glWindow);
+        m_shader->use();
+        if (mask)
+        {
+            glDepthFunc(GL_LESS);
+            glDepthMask(GL_FALSE);
+        }
+    }
+
+    // heavy zones into the low resolution target, then sets up the composite pass
+    void GassianBlurCore::drawLowResPass()
+    {
+        GassianBlurDebugGroup group(m_debug, "low resolution pass");
+        unsigned int low_w = std::max(1u, m_result_w / m_half_res_scale);
+        unsigned int low_h = std::max(1u, m_result_h / m_half_res_scale);
+        FrameBuffer *low_res_target = m_targets->low_res.get();
+        if (nullptr == low_res_target || (unsigned int)low_res_target->getWidth() != low_w ||
+            (unsigned int)low_res_target->getHeight() != low_h)
+        {
+            // FrameBuffer::init() rebinds textures, keep it away from the source on unit 0
+            glActiveTexture(GL_TEXTURE2);
+            // blur passes never test depth
+            m_targets->low_res = m_target_pool->acquire(FrameBufferDesc(low_w, low_h, GL_RGBA8, false));
+            low_res_target = m_targets->low_res.get();
+            glActiveTexture(GL_TEXTURE0);
+            std::cout << "[HALF_RES] low resolution target w:" << low_w << " h:" << low_h << std::endl;
+        }
+
+        m_shader->setInt(m_uniforms->blur_pass, GAUSSIAN_BLUR_PASS_LOW_RES);
+        m_shader->setFloat(m_uniforms->source_lod, std::log2((float)m_half_res_scale));
+        m_shader->setFloat(m_uniforms->low_res_scale, (float)m_half_res_scale);
+        m_shader->setFloat(m_uniforms->half_res_zone, m_half_res_zone);
+        m_shader->setFloat(m_uniforms->half_res_blend, m_half_res_blend);
+        m_shader->setInt(m_uniforms->upsample_mode, m_half_res_upsample);
+        m_shader->setVec2(m_uniforms->low_res_texel_size, 1.0f / low_w, 1.0f / low_h);
+
+        low_res_target->bind();
+        glViewport(0, 0, low_w, low_h);
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        glViewport(0, 0, m_result_w, m_result_h);
+
+        glActiveTexture(GL_TEXTURE2);
+        glBindTexture(GL_TEXTURE_2D, low_res_target->getColorId());
+        glActiveTexture(GL_TEXTURE0);
+        m_shader->setInt(m_uniforms->blur_pass, GAUSSIAN_BLUR_PASS_COMPOSITE);
+        m_shader->setFloat(m_uniforms->source_lod, 0.0f);
+    }
+
+    // dst is an offset when a pixel pack buffer is bound.
+    // reads from whatever drawBlur() rendered into, still bound here
+    void GassianBlurCore::readResult(void *dst)
+    {
+        GassianBlurDebugGroup group(m_debug, "readback");
         // copy texture to frame buffer
         if (m_result_channel == 4)
         {
-            glReadPixels(0, 0, m_result_w, m_result_h, GL_RGBA, GL_UNSIGNED_BYTE, m_result_buffer);
+            glReadPixels(0, 0, m_result_w, m_result_h, GL_RGBA, GL_UNSIGNED_BYTE, dst);
         }
         else
         {
-            glReadPixels(0, 0, m_result_w, m_result_h, GL_RGB, GL_UNSIGNED_BYTE, m_result_buffer);
+            glReadPixels(0, 0, m_result_w, m_result_h, GL_RGB, GL_UNSIGNED_BYTE, dst);
         }
-        return m_result_buffer;
+    }
+
+    // headless frames rotate to the next offscreen target and never touch the
+    // presentation engine, only a visible window is swapped
+    void GassianBlurCore::presentFrame()
+    {
+        if (m_flags_using_framebuffer)
+        {
+            m_render_target_index = (m_render_target_index + 1) % m_targets->frames.size();
+        }
+        else
+        {
+            glfwSwapBuffers(m_glWindow);
+        }
+    }
+
+    void GassianBlurCore::initPipeline()
+    {
+        std::cout << "[PIPELINE] init with depth:" << m_pipeline_depth << std::endl;
+        unsigned int *textureIdxs = createTexture2D(m_pipeline_depth);
+        for (unsigned int i = 0; i < m_pipeline_depth; i++)
+        {
+            BlurPipelineSlot *slot = new BlurPipelineSlot();
+            glGenBuffers(1, &slot->upload_pbo);
+            glGenBuffers(1, &slot->readback_pbo);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->readback_pbo);
+            glBufferData(GL_PIXEL_PACK_BUFFER, getOutBufLen(), nullptr, GL_STREAM_READ);
+            slot->base_texture = textureIdxs[i];
+            slot->texture_w = 0;
+            slot->texture_h = 0;
+            slot->texture_channel = 0;
+            slot->fence = 0;
+            slot->busy = false;
+            slot->frame_id = 0;
+            m_pipeline_slots.push_back(slot);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        delete[] textureIdxs;
+        m_pipeline_head = 0;
+    }
+
+    void GassianBlurCore::unitPipeline()
+    {
+        flushGaussianBlur();
+        for (size_t i = 0; i < m_pipeline_slots.size(); i++)
+        {
+            BlurPipelineSlot *slot = m_pipeline_slots[i];
+            glDeleteBuffers(1, &slot->upload_pbo);
+            glDeleteBuffers(1, &slot->readback_pbo);
+            glDeleteTextures(1, &slot->base_texture);
+            delete slot;
+        }
+        m_pipeline_slots.clear();
     }
 
     void GassianBlurCore::unit()
     {
+        unitPipeline();
+        m_targets->frames.clear();
+        m_targets->low_res.release();
+        m_targets->batch.release();
+        m_target_pool->printStats();
+        if (nullptr != m_debug)
+        {
+            m_debug->printStats();
+            m_debug->uninstall();
+        }
+        // its compile context goes with glfwTerminate()
+        delete m_shader_reload;
+        m_shader_reload = nullptr;
+        FrameBufferMemoryStats memory = FrameBuffer::getMemoryStats();
+        std::cout << "[RT_POOL] " << memory.count << " frame buffers, gpu " << memory.gpuBytes / 1024
+                  << " KB, cpu " << memory.cpuBytes / 1024 << " KB" << std::endl;
+        // the frame buffers belong to the context terminated below
+        m_target_pool->trim();
+        glDeleteTextures(1, &m_batch_textureIdx);
+        m_batch_textureIdx = 0;
+        delete m_cpu_iir;
+        m_cpu_iir = nullptr;
+        delete m_cpu_fixed;
+        m_cpu_fixed = nullptr;
+        delete m_shader_variants;
+        m_shader_variants = nullptr;
+        m_shader = nullptr;
+        m_copy_shader = nullptr;
         glDeleteVertexArrays(1, &m_VAO);
         glDeleteBuffers(1, &m_VBO);
         glDeleteBuffers(1, &m_EBO);
@@ -181,6 +1040,8 @@ namespace ESSILOR
 #else
         glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
+        // drivers only report everything to a debug context
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, m_gl_debug ? GL_TRUE : GL_FALSE);
         m_glWindow = glfwCreateWindow(outbuf_w, outbuf_h, "LearnOpenGL", NULL, NULL);
         if (m_glWindow == NULL)
         {
@@ -194,6 +1055,8 @@ namespace ESSILOR
         }
 
         glfwMakeContextCurrent(m_glWindow);
+        // only a visible window may wait for vsync
+        glfwSwapInterval(enable_gui ? 1 : 0);
         // glad: load all OpenGL function pointers
         // ---------------------------------------
         if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
@@ -205,7 +1068,18 @@ namespace ESSILOR
         {
             std::cout << "[INIT]Done to initialize GLAD" << std::endl;
         }
+        if (m_gl_debug)
+        {
+            if (nullptr == m_debug)
+            {
+                m_debug = new GassianBlurDebugOutput();
+            }
+            m_debug->install();
+        }
         glViewport(0, 0, outbuf_w, outbuf_h);
+        // rows of rgb frames with odd widths are not 4-byte aligned
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
         return 1;
     }
 
@@ -223,17 +1097,29 @@ namespace ESSILOR
             1, 2, 3  // second triangle
         };
 
-        glGenVertexArrays(1, &m_VAO);
         glGenBuffers(1, &m_VBO);
         glGenBuffers(1, &m_EBO);
 
-        glBindVertexArray(m_VAO);
-
         glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
         glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+        // no VAO is bound yet and the element binding belongs to a VAO, fill
+        // the index buffer through the array target instead
+        glBindBuffer(GL_ARRAY_BUFFER, m_EBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+        m_VAO = createQuadVertexArray(m_VBO, m_EBO);
+    }
+
+    // vertex arrays are not shared between contexts, buffers are. every
+    // context drawing the quad builds its own VAO over the same buffers
+    unsigned int GassianBlurCore::createQuadVertexArray(unsigned int vbo, unsigned int ebo)
+    {
+        unsigned int vao = 0;
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
 
         // position attribute
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void *)0);
@@ -244,6 +1130,7 @@ namespace ESSILOR
         // texture coord attribute
         glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void *)(6 * sizeof(float)));
         glEnableVertexAttribArray(2);
+        return vao;
     }
 
     void GassianBlurCore::initShader(
@@ -252,19 +1139,99 @@ namespace ESSILOR
     {
         if (nullptr == m_shader)
         {
+            // array sizes of the shaders follow the tables filled on the cpu
+            ShaderDefines defines;
+            defines.push_back(std::make_pair(std::string("LUT_MAX_TAPS"), std::to_string(GAUSSIAN_BLUR_LUT_MAX_TAPS)));
+            defines.push_back(std::make_pair(std::string("BATCH_MAX"), std::to_string(GAUSSIAN_BLUR_BATCH_MAX)));
+
+            m_shader_variants = new ShaderVariantCache();
             std::cout << "[shader] loading shader from: " << vertexShaderFile << ", " << fragmentShaderFile << std::endl;
-            m_shader = new Shader(vertexShaderFile, fragmentShaderFile);
-            m_shader->use();
+            m_shader = m_shader_variants->get(vertexShaderFile, fragmentShaderFile, defines);
+
+            // the copy pass of the zone early out sits next to the blur shader
+            std::string copyShaderFile = fragmentShaderFile;
+            size_t dir_end = copyShaderFile.find_last_of("/\\");
+            copyShaderFile.erase((dir_end == std::string::npos) ? 0 : dir_end + 1);
+            copyShaderFile += "gauss_blur_copy.fs";
+            std::cout << "[shader] loading copy shader from: " << copyShaderFile << std::endl;
+            m_copy_shader = m_shader_variants->get(vertexShaderFile, copyShaderFile, defines);
+            initShaderUniforms();
+
+            if (m_shader_reload_enabled)
+            {
+                // the same order as the programs applyShaderReload() adopts
+                m_shader_reload = new GassianBlurShaderReloader();
+                m_shader_reload->addProgram(vertexShaderFile, fragmentShaderFile, defines);
+                m_shader_reload->addProgram(vertexShaderFile, copyShaderFile.c_str(), defines);
+                m_shader_reload->start(m_glWindow);
+            }
+        }
+    }
+
+    void GassianBlurCore::initShaderUniforms()
+    {
+        m_copy_shader->use();
+        m_copy_shader->setInt("imageTexture", 0);
+        m_copy_shader->setInt("filterZones", 1);
+        m_uniforms->copy_pass_through_zone = m_copy_shader->getUniform("passThroughZone");
+
+        m_shader->use();
+        m_shader->setInt("imageTexture", 0);
+        m_shader->setInt("filterZones", 1);
+        // result of the half resolution pass
+        m_shader->setInt("lowResTexture", 2);
+        m_shader->setInt("sigmaLut", 3);
+        // sources are always uploaded textures, the multisample sampler only
+        // needs a unit of its own so it does not clash with imageTexture
+        m_shader->setInt("imageTextureMS", 4);
+
+        // everything set per frame goes through a handle
+        m_uniforms->kernel_pixel_size_x = m_shader->getUniform("kernelPixelSizeX");
+        m_uniforms->kernel_pixel_size_y = m_shader->getUniform("kernelPixelSizeY");
+        m_uniforms->blur_pass = m_shader->getUniform("blurPass");
+        m_uniforms->source_lod = m_shader->getUniform("sourceLod");
+        m_uniforms->low_res_scale = m_shader->getUniform("lowResScale");
+        m_uniforms->low_res_texel_size = m_shader->getUniform("lowResTexelSize");
+        m_uniforms->half_res_zone = m_shader->getUniform("halfResZone");
+        m_uniforms->half_res_blend = m_shader->getUniform("halfResBlend");
+        m_uniforms->upsample_mode = m_shader->getUniform("upsampleMode");
+        m_uniforms->batch_mode = m_shader->getUniform("batchMode");
+        m_uniforms->batch_texel_size = m_shader->getUniform("batchTexelSize");
+        m_uniforms->batch_rects = m_shader->getUniform("batchRects");
+        m_uniforms->source_samples = m_shader->getUniform("sourceSamples");
+
+        m_shader->setInt(m_uniforms->source_samples, 0);
+        set_pixel_size(m_shader_pixel_size_x, m_shader_pixel_size_y);
+    }
+
+    void GassianBlurCore::applyShaderReload()
+    {
+        std::vector<unsigned int> programs;
+        if (nullptr == m_shader_reload || !m_shader_reload->takePrograms(programs))
+        {
+            return;
         }
+        // uniforms are per program, the new ones start from zero
+        m_shader->adopt(programs[0]);
+        m_copy_shader->adopt(programs[1]);
+        initShaderUniforms();
+        std::cout << "[RELOAD] swapped in program " << m_shader->ID << " and copy program " << m_copy_shader->ID << std::endl;
     }
 
     void GassianBlurCore::initFrameBuffer(unsigned int outbuf_w, unsigned int outbuf_h, unsigned int outbuf_channel)
     {
-        if (nullptr == m_frameBuffer)
+        // without a visible window render offscreen, the default framebuffer of
+        // a hidden window has no guaranteed pixels and swapping it costs time
+        m_flags_using_framebuffer = !m_flags_enable_gui;
+        if (m_flags_using_framebuffer && m_targets->frames.empty())
         {
-            std::cout << "[shader] init frame buffer with:w" << outbuf_w << " with:h" << outbuf_h << std::endl;
-            //m_frameBuffer = new FrameBuffer();
-            //m_frameBuffer->init(outbuf_w, outbuf_h);
+            std::cout << "[shader] init " << m_render_target_count << " frame buffers with:w" << outbuf_w << " with:h" << outbuf_h << std::endl;
+            for (unsigned int i = 0; i < m_render_target_count; i++)
+            {
+                // the depth buffer holds the zone early out mask
+                m_targets->frames.push_back(m_target_pool->acquire(FrameBufferDesc(outbuf_w, outbuf_h, GL_RGBA8, true)));
+            }
+            m_render_target_index = 0;
         }
         if (nullptr == m_result_buffer)
         {
@@ -281,14 +1248,14 @@ namespace ESSILOR
         int texture2DCount = 1;
         unsigned int *textureIdxs = createTexture2D(texture2DCount);
         std::cout << "[TEXTURE] texture id: " << textureIdxs[0] << std::endl;
-        glUniform1i(glGetUniformLocation(m_shader->ID, "imageTexture"), 0);
         m_base_textureIdx = textureIdxs[0];
 
         unsigned int zoneTextureIdx = creatFilterZoneTexture2D();
         std::cout << "[TEXTURE] filter zone id: " << zoneTextureIdx << std::endl;
-        // ourShader.setInt("filterZones", zoneTextureIdx);
-        glUniform1i(glGetUniformLocation(m_shader->ID, "filterZones"), 1);
         m_filter_zone_textureIdx = zoneTextureIdx;
+
+        m_kernel_lut_textureIdx = createKernelLutTexture2D();
+        std::cout << "[TEXTURE] kernel lut id: " << m_kernel_lut_textureIdx << std::endl;
     }
 
     unsigned int *GassianBlurCore::createTexture2D(int textureCount)
@@ -304,8 +1271,8 @@ namespace ESSILOR
             // set boarder color
             float borderColor[] = {1.0f, 1.0f, 0.0f, 1.0f};
             glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
-            // set texture filtering parameters
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            // set texture filtering parameters, the blur reads mip levels for wide kernels
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         }
         return pTextureIdxs;
@@ -326,6 +1293,40 @@ namespace ESSILOR
         return textureIdx;
     }
 
+    // stays bound to texture unit 3, the shader only uses texelFetch on it
+    unsigned int GassianBlurCore::createKernelLutTexture2D()
+    {
+        m_kernel_lut->build(m_kernel_lut->profile());
+        m_kernel_lut_dirty = false;
+
+        unsigned int textureIdx = 0;
+        glGenTextures(1, &textureIdx);
+        glActiveTexture(GL_TEXTURE3);
+        glBindTexture(GL_TEXTURE_2D, textureIdx);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RG32F, GAUSSIAN_BLUR_LUT_WIDTH, GAUSSIAN_BLUR_LUT_ROWS, 0,
+                     GL_RG, GL_FLOAT, m_kernel_lut->data());
+        glActiveTexture(GL_TEXTURE0);
+        return textureIdx;
+    }
+
+    // a profile change only rewrites the texels, the texture keeps its storage
+    void GassianBlurCore::refreshKernelLut()
+    {
+        if (!m_kernel_lut_dirty || 0 == m_kernel_lut_textureIdx)
+            return;
+        glActiveTexture(GL_TEXTURE3);
+        glBindTexture(GL_TEXTURE_2D, m_kernel_lut_textureIdx);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, GAUSSIAN_BLUR_LUT_WIDTH, GAUSSIAN_BLUR_LUT_ROWS,
+                        GL_RG, GL_FLOAT, m_kernel_lut->data());
+        glActiveTexture(GL_TEXTURE0);
+        m_kernel_lut_dirty = false;
+        std::cout << "[KERNEL] profile " << m_kernel_lut->profile() << std::endl;
+    }
+
     void GassianBlurCore::updateTexture2DMemData(unsigned int textureIdx, unsigned int textureIDInGL,
                                                  int width, int height, int channel,
                                                  unsigned int texturePixelFmt, unsigned int dataPixelFmt, unsigned char *data)
@@ -8,14 +8,48 @@
  * @Copyright © 2022 Essilor. All rights reserved.
  */
 
+#ifndef _ESSILOR_GAUSSIAN_BLUR_CORE_H_
+#define _ESSILOR_GAUSSIAN_BLUR_CORE_H_
+
+#include "gaussian_blur_defines.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
 class Shader;
+class ShaderVariantCache;
 class FrameBuffer;
 class GLFWwindow;
 
 namespace ESSILOR
 {
+    class GassianBlurIIR;
+    class GassianBlurFixed;
+    class GassianBlurZoneMap;
+    class GassianBlurKernelLut;
+    class GassianBlurDebugOutput;
+    class GassianBlurShaderReloader;
+    class RenderTargetPool;
+
+    // data is only valid inside the callback
+    typedef std::function<void(unsigned long frame_id, const unsigned char* data, unsigned long len)> BlurDoneCallback;
+
+    // one image of doGaussianBlurBatch
+    struct BlurBatchImage
+    {
+        unsigned char *data;
+        unsigned int width;
+        unsigned int height;
+        unsigned int channel;           // 3 or 4, other images are skipped
+        // width * height * output channel bytes, filled by the batch
+        unsigned char *result;
+    };
+
     class GassianBlurCore 
     {
+        friend class GassianBlurContextPool;
+
         public:
             GassianBlurCore();
             virtual ~GassianBlurCore();
@@ -28,6 +62,49 @@ namespace ESSILOR
             unsigned long getOutBufLen();
             void set_enable_gui(bool enable);
             void set_pixel_size(float pixel_size_x, float pixel_size_y);
+            // frames in flight for submitGaussianBlur, 2..4
+            void set_pipeline_depth(unsigned int depth);
+            // offscreen targets rotated through when no gui is shown, set before init
+            void set_render_target_count(unsigned int count);
+            // GaussianBlurEngine, the cpu engines need the zone image and the
+            // base image at the output size, other frames stay on the shader
+            void set_engine(int engine);
+            int get_engine();
+            // set before init, init then times every engine on a synthetic
+            // frame of the output size and keeps the fastest. the winner is
+            // cached per gl vendor, renderer and output size in cache_file
+            void set_auto_engine(bool enable, const char *cache_file = "gaussian_blur_engines.cache");
+            // zones from zone_value on are blurred at 1/scale resolution and
+            // upsampled with GaussianBlurUpsample, the blend_width zone values
+            // below it mix both results. scale 1 turns it off, else 2 or 4.
+            // shader engine only, the context pool keeps full resolution
+            void set_half_res_mode(unsigned int scale, int upsample = GAUSSIAN_BLUR_UPSAMPLE_BILATERAL);
+            void set_half_res_zone(float zone_value, float blend_width);
+            // the zone image is only uploaded when its pointer or size change,
+            // call this after changing its pixels in place
+            void invalidateFilterZone();
+            // preprocessed zones of the last frame, tile statistics for early outs
+            const GassianBlurZoneMap *getZoneMap();
+            // zero radius pixels are copied by a mask pass and depth tested out
+            // of the blur pass, frames without any only run the blur pass and
+            // frames with nothing else only the copy. on by default
+            void set_zone_early_out(bool enable);
+            // GaussianBlurKernelProfile of the shader engine, the kernel table is
+            // refilled on the next draw, the program stays as it is
+            void setKernelProfile(int profile);
+            int getKernelProfile();
+
+            // KHR_debug markers per stage and capture of the driver's
+            // performance warnings, call before init()
+            void set_gl_debug(bool enable);
+            // nullptr before init() or when KHR_debug is missing
+            const GassianBlurDebugOutput *getDebugOutput();
+
+            // rebuild the blur programs in the background whenever their sources
+            // change and swap them in before the next frame, a failed build keeps
+            // the running ones. call before init(), not for use with the
+            // context pool, its workers keep reading the program id
+            void set_shader_reload(bool enable);
 
             unsigned char*  doGaussianBlur(
                 unsigned char *base_image_data,
@@ -39,26 +116,102 @@ namespace ESSILOR
                 unsigned int filter_zone_image_height,
                 unsigned int filter_zone_image_channel);
 
+            // pipelined version of doGaussianBlur, the result of a frame is delivered
+            // through callback once the gpu is done with it, always in submission order.
+            // returns the frame id or -1
+            long submitGaussianBlur(
+                unsigned char *base_image_data,
+                unsigned int base_image_width,
+                unsigned int base_image_height,
+                unsigned int base_image_channel,
+                unsigned char *filter_zone_image_data,
+                unsigned int filter_zone_image_width,
+                unsigned int filter_zone_image_height,
+                unsigned int filter_zone_image_channel,
+                BlurDoneCallback callback);
+            // wait for every submitted frame and run its callback
+            void flushGaussianBlur();
+
+            // small images (GAUSSIAN_BLUR_BATCH_MAX_SIZE per side at most) are
+            // packed into an atlas and blurred GAUSSIAN_BLUR_BATCH_MAX at a time
+            // with one instanced draw and one readback. every image gets the
+            // whole zone map. returns the number of images blurred
+            int doGaussianBlurBatch(
+                BlurBatchImage *images,
+                unsigned int image_count,
+                unsigned char *filter_zone_image_data,
+                unsigned int filter_zone_image_width,
+                unsigned int filter_zone_image_height,
+                unsigned int filter_zone_image_channel);
+
         protected:
             void initGraphicEnv();
+            static unsigned int createQuadVertexArray(unsigned int vbo, unsigned int ebo);
             int  initOpenGL(unsigned int outbuf_w, unsigned int outbuf_h,bool enable_gui = false);
             void initShader(
                 const char* vertexShaderFile = "../resources/features_res/gaussain_bulr/gauss_blur.vs",
                 const char* fragmentShaderFile = "../resources/features_res/gaussain_bulr/gauss_blur.fs");
+            // sampler units and uniform handles of freshly linked programs
+            void initShaderUniforms();
+            // at a frame boundary, adopts the programs of a finished reload
+            void applyShaderReload();
             void initFrameBuffer(unsigned int outbuf_w, unsigned int outbuf_h,unsigned int outbuf_channel);
 
             void initTexture();
 
             unsigned int* createTexture2D(int textureCount = 1);
             unsigned int creatFilterZoneTexture2D();
+            unsigned int createKernelLutTexture2D();
+            void refreshKernelLut();
+            bool uploadFilterZone(unsigned char *filter_zone_image_data,
+                unsigned int filter_zone_image_width,
+                unsigned int filter_zone_image_height,
+                unsigned int filter_zone_image_channel);
 
             void updateTexture2DMemData(unsigned int textureIdx, unsigned int textureIDInGL,
                             int width, int height, int channel,
                             unsigned int texturePixelFmt, unsigned int dataPixelFmt, unsigned char *data);
 
+            void drawBlur();
+            void drawCopyPass(bool mask);
+            void drawLowResPass();
+            int drawBatch(BlurBatchImage **images, unsigned int image_count);
+            void readResult(void *dst);
+            void presentFrame();
+
+            void initPipeline();
+            void unitPipeline();
+            struct BlurPipelineSlot;
+            // leases from m_target_pool
+            struct RenderTargets;
+            // uniform handles of m_shader and m_copy_shader, resolved in initShader()
+            struct ShaderUniforms;
+            void completePipelineSlot(BlurPipelineSlot *slot);
+
+            void calibrateEngine();
+            // median milliseconds of one frame with the current engine, the
+            // shader frames are read back but not presented
+            double timeEngine(unsigned char *base_image_data, unsigned char *filter_zone_image_data);
+
+            bool runCpuEngine(unsigned char *base_image_data,
+                unsigned int base_image_width,
+                unsigned int base_image_height,
+                unsigned int base_image_channel,
+                unsigned char *filter_zone_image_data,
+                unsigned int filter_zone_image_width,
+                unsigned int filter_zone_image_height,
+                unsigned int filter_zone_image_channel);
+
         private:
+            // both owned by m_shader_variants
             Shader *m_shader;
-            FrameBuffer* m_frameBuffer;
+            Shader *m_copy_shader;
+            ShaderVariantCache *m_shader_variants;
+            ShaderUniforms *m_uniforms;
+            RenderTargetPool *m_target_pool;
+            RenderTargets *m_targets;
+            unsigned int m_render_target_count;
+            unsigned int m_render_target_index;
             GLFWwindow* m_glWindow;
 
             unsigned int m_VBO;
@@ -67,6 +220,7 @@ namespace ESSILOR
 
             unsigned int m_base_textureIdx;
             unsigned int m_filter_zone_textureIdx;
+            unsigned int m_kernel_lut_textureIdx;
 
             unsigned char* m_result_buffer;
             unsigned int m_result_w;
@@ -78,5 +232,41 @@ namespace ESSILOR
 
             float m_shader_pixel_size_x;
             float m_shader_pixel_size_y; 
+
+            std::vector<BlurPipelineSlot*> m_pipeline_slots;
+            unsigned int m_pipeline_depth;
+            unsigned int m_pipeline_head;
+            unsigned long m_pipeline_next_id;
+
+            int m_engine;
+            GassianBlurIIR *m_cpu_iir;
+            GassianBlurFixed *m_cpu_fixed;
+            bool m_auto_engine;
+            std::string m_auto_engine_cache;
+
+            unsigned int m_half_res_scale;
+            int m_half_res_upsample;
+            float m_half_res_zone;
+            float m_half_res_blend;
+            GassianBlurZoneMap *m_zone_map;
+            GassianBlurKernelLut *m_kernel_lut;
+            bool m_kernel_lut_dirty;
+            bool m_zone_early_out;
+
+            bool m_gl_debug;
+            GassianBlurDebugOutput *m_debug;
+            unsigned long m_frame_count;
+
+            bool m_shader_reload_enabled;
+            GassianBlurShaderReloader *m_shader_reload;
+
+            unsigned int m_batch_textureIdx;
+            unsigned int m_batch_texture_w;
+            unsigned int m_batch_texture_h;
+            std::vector<unsigned char> m_batch_readback;
+            // one image with its edge repeated up to the cell size
+            std::vector<unsigned char> m_batch_cell;
     };
-}
\ No newline at end of file
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_CORE_H_
\ No newline at end of file
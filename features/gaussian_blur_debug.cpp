@@ -0,0 +1,206 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-20 05:14:37
+ * @LastEditTime: 2026-10-20 05:52:10
+ * @LastEditors: Matt.SHI
+ * @Description: KHR_debug markers and driver message capture
+ * @FilePath: /opengl_demo/features/gaussian_blur_debug.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "gaussian_blur_debug.h"
+
+#include <glad/glad.h>
+
+#include <iostream>
+
+namespace ESSILOR
+{
+    static void APIENTRY onDebugMessage(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                        GLsizei length, const GLchar *message, const void *user_param)
+    {
+        GassianBlurDebugOutput *output = (GassianBlurDebugOutput *)user_param;
+        output->record(source, type, id, severity, message, length);
+    }
+
+    static const char *debugTypeName(unsigned int type)
+    {
+        switch (type)
+        {
+        case GL_DEBUG_TYPE_PERFORMANCE:
+            return "performance";
+        case GL_DEBUG_TYPE_ERROR:
+            return "error";
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+            return "undefined";
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+            return "deprecated";
+        case GL_DEBUG_TYPE_PORTABILITY:
+            return "portability";
+        default:
+            return "other";
+        }
+    }
+
+    GassianBlurDebugOutput::GassianBlurDebugOutput() : m_installed(false),
+                                                       m_log(true),
+                                                       m_frame(0),
+                                                       m_ring_head(0),
+                                                       m_stats()
+    {
+    }
+
+    GassianBlurDebugOutput::~GassianBlurDebugOutput()
+    {
+    }
+
+    bool GassianBlurDebugOutput::install()
+    {
+        // macOS stops at 4.1 without the extension, glad leaves both flags 0
+        if (!(GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug) || nullptr == glDebugMessageCallback ||
+            nullptr == glPushDebugGroup)
+        {
+            std::cout << "[GL_DEBUG] KHR_debug is not available" << std::endl;
+            return false;
+        }
+
+        // synchronous, so a message arrives inside the call and the frame it names
+        glEnable(GL_DEBUG_OUTPUT);
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+
+        // what explains a slow or broken frame. notifications and our own
+        // push / pop group messages stay off
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_FALSE);
+        const GLenum types[] = {GL_DEBUG_TYPE_PERFORMANCE, GL_DEBUG_TYPE_ERROR, GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR,
+                                GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR, GL_DEBUG_TYPE_PORTABILITY};
+        for (GLenum type : types)
+        {
+            glDebugMessageControl(GL_DONT_CARE, type, GL_DONT_CARE, 0, nullptr, GL_TRUE);
+        }
+        glDebugMessageCallback(onDebugMessage, this);
+        m_installed = true;
+        std::cout << "[GL_DEBUG] installed" << std::endl;
+        return true;
+    }
+
+    void GassianBlurDebugOutput::uninstall()
+    {
+        if (!m_installed)
+        {
+            return;
+        }
+        glDebugMessageCallback(nullptr, nullptr);
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        glDisable(GL_DEBUG_OUTPUT);
+        m_installed = false;
+    }
+
+    bool GassianBlurDebugOutput::isInstalled() const
+    {
+        return m_installed;
+    }
+
+    void GassianBlurDebugOutput::set_frame(unsigned long frame)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_frame = frame;
+    }
+
+    void GassianBlurDebugOutput::set_log(bool enable)
+    {
+        m_log = enable;
+    }
+
+    void GassianBlurDebugOutput::pushGroup(const char *name)
+    {
+        if (m_installed)
+        {
+            glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+        }
+    }
+
+    void GassianBlurDebugOutput::popGroup()
+    {
+        if (m_installed)
+        {
+            glPopDebugGroup();
+        }
+    }
+
+    void GassianBlurDebugOutput::record(unsigned int source, unsigned int type, unsigned int id, unsigned int severity,
+                                        const char *message, int length)
+    {
+        GaussianBlurDebugMessage entry;
+        entry.id = id;
+        entry.source = source;
+        entry.type = type;
+        entry.severity = severity;
+        entry.text = (length >= 0) ? std::string(message, length) : std::string(message);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry.frame = m_frame;
+        if (type == GL_DEBUG_TYPE_PERFORMANCE)
+            m_stats.performance++;
+        else if (type == GL_DEBUG_TYPE_ERROR)
+            m_stats.errors++;
+        else
+            m_stats.others++;
+        m_stats.last_frame = m_frame;
+
+        if (m_ring.size() < GAUSSIAN_BLUR_DEBUG_RING_SIZE)
+        {
+            m_ring.push_back(entry);
+        }
+        else
+        {
+            m_ring[m_ring_head] = entry;
+            m_ring_head = (m_ring_head + 1) % GAUSSIAN_BLUR_DEBUG_RING_SIZE;
+            m_stats.overwritten++;
+        }
+
+        if (m_log)
+        {
+            std::cout << "[GL_DEBUG] frame " << entry.frame << " " << debugTypeName(type) << " " << id
+                      << ": " << entry.text << std::endl;
+        }
+    }
+
+    std::vector<GaussianBlurDebugMessage> GassianBlurDebugOutput::getMessages() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // the head is the oldest entry once the ring is full
+        std::vector<GaussianBlurDebugMessage> messages(m_ring.begin() + m_ring_head, m_ring.end());
+        messages.insert(messages.end(), m_ring.begin(), m_ring.begin() + m_ring_head);
+        return messages;
+    }
+
+    GaussianBlurDebugStats GassianBlurDebugOutput::getStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    void GassianBlurDebugOutput::printStats() const
+    {
+        GaussianBlurDebugStats stats = getStats();
+        std::cout << "[GL_DEBUG] performance:" << stats.performance << " errors:" << stats.errors
+                  << " others:" << stats.others << " overwritten:" << stats.overwritten
+                  << " last frame:" << stats.last_frame << std::endl;
+    }
+
+    GassianBlurDebugGroup::GassianBlurDebugGroup(GassianBlurDebugOutput *output, const char *name) : m_output(output)
+    {
+        if (nullptr != m_output)
+        {
+            m_output->pushGroup(name);
+        }
+    }
+
+    GassianBlurDebugGroup::~GassianBlurDebugGroup()
+    {
+        if (nullptr != m_output)
+        {
+            m_output->popGroup();
+        }
+    }
+}
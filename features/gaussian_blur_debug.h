@@ -0,0 +1,101 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-20 05:14:37
+ * @LastEditTime: 2026-10-20 05:52:10
+ * @LastEditors: Matt.SHI
+ * @Description: KHR_debug markers around the blur stages and a ring of the
+ *               driver's performance warnings, stamped with frame numbers
+ * @FilePath: /opengl_demo/features/gaussian_blur_debug.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_DEBUG_H_
+#define _ESSILOR_GAUSSIAN_BLUR_DEBUG_H_
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ESSILOR
+{
+    // driver messages kept for getMessages(), the oldest ones are overwritten
+    constexpr unsigned int GAUSSIAN_BLUR_DEBUG_RING_SIZE = 64;
+
+    struct GaussianBlurDebugMessage
+    {
+        unsigned long frame;        // frame being drawn when it arrived
+        unsigned int id;
+        unsigned int source;        // GL_DEBUG_SOURCE_*
+        unsigned int type;          // GL_DEBUG_TYPE_*
+        unsigned int severity;      // GL_DEBUG_SEVERITY_*
+        std::string text;
+    };
+
+    struct GaussianBlurDebugStats
+    {
+        unsigned long performance;  // shader recompiles, reallocations, stalls
+        unsigned long errors;
+        unsigned long others;       // undefined, deprecated or non portable behaviour
+        unsigned long overwritten;  // fell out of the ring before anybody read them
+        unsigned long last_frame;   // frame of the latest message
+    };
+
+    // one per gl context, the callback and the markers belong to the context
+    // that was current in install()
+    class GassianBlurDebugOutput
+    {
+        public:
+            GassianBlurDebugOutput();
+            virtual ~GassianBlurDebugOutput();
+
+        public:
+            // false without KHR_debug (macOS, contexts older than 4.3 without
+            // the extension). everything else is a no-op then
+            bool install();
+            void uninstall();
+            bool isInstalled() const;
+
+            // stamped onto the messages arriving from now on
+            void set_frame(unsigned long frame);
+            // print every message as it arrives, on by default
+            void set_log(bool enable);
+
+            // markers for capture tools, nested groups are fine
+            void pushGroup(const char *name);
+            void popGroup();
+
+            // oldest first
+            std::vector<GaussianBlurDebugMessage> getMessages() const;
+            GaussianBlurDebugStats getStats() const;
+            void printStats() const;
+
+            // called by the driver, synchronously with the call that caused it
+            void record(unsigned int source, unsigned int type, unsigned int id, unsigned int severity,
+                const char *message, int length);
+
+        private:
+            bool m_installed;
+            bool m_log;
+            unsigned long m_frame;
+
+            mutable std::mutex m_mutex;
+            std::vector<GaussianBlurDebugMessage> m_ring;
+            size_t m_ring_head;
+            GaussianBlurDebugStats m_stats;
+    };
+
+    // debug group for the lifetime of a scope, output may be nullptr
+    class GassianBlurDebugGroup
+    {
+        public:
+            GassianBlurDebugGroup(GassianBlurDebugOutput *output, const char *name);
+            ~GassianBlurDebugGroup();
+            GassianBlurDebugGroup(const GassianBlurDebugGroup &) = delete;
+            GassianBlurDebugGroup &operator=(const GassianBlurDebugGroup &) = delete;
+
+        private:
+            GassianBlurDebugOutput *m_output;
+    };
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_DEBUG_H_
@@ -0,0 +1,61 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 16:05:12
+ * @LastEditTime: 2026-10-19 16:05:12
+ * @LastEditors: Matt.SHI
+ * @Description: values shared by the blur core and its engines
+ * @FilePath: /opengl_demo/features/gaussian_blur_defines.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_DEFINES_H_
+#define _ESSILOR_GAUSSIAN_BLUR_DEFINES_H_
+
+namespace ESSILOR
+{
+    enum GaussianBlurEngine
+    {
+        GAUSSIAN_BLUR_ENGINE_SHADER = 0,    // fragment shader, default
+        GAUSSIAN_BLUR_ENGINE_CPU_IIR,       // recursive gaussian, cost independent of the radius
+        GAUSSIAN_BLUR_ENGINE_CPU_FIXED,     // 16-bit fixed point simd, 8-bit in and out
+    };
+
+    // blurPass values of gauss_blur.fs
+    enum GaussianBlurPass
+    {
+        GAUSSIAN_BLUR_PASS_FULL = 0,
+        GAUSSIAN_BLUR_PASS_LOW_RES,         // heavy zones at 1/scale resolution
+        GAUSSIAN_BLUR_PASS_COMPOSITE,       // full resolution + upsampled heavy zones
+    };
+
+    // upsampleMode values of gauss_blur.fs
+    enum GaussianBlurUpsample
+    {
+        GAUSSIAN_BLUR_UPSAMPLE_BILINEAR = 0,
+        GAUSSIAN_BLUR_UPSAMPLE_BILATERAL,   // joint bilateral, guided by the source image
+    };
+
+    // quality tiers of the shader kernels, GassianBlurCore::setKernelProfile
+    enum GaussianBlurKernelProfile
+    {
+        GAUSSIAN_BLUR_PROFILE_FAST = 0,     // radius 4, bilinear tap pairs
+        GAUSSIAN_BLUR_PROFILE_BALANCED,     // radius 8, bilinear tap pairs
+        GAUSSIAN_BLUR_PROFILE_EXACT,        // radius 16, one fetch per tap
+    };
+
+    // images per batch draw, BATCH_MAX in gauss_blur.vs
+    constexpr unsigned int GAUSSIAN_BLUR_BATCH_MAX = 64;
+    // largest side of a batch image
+    constexpr unsigned int GAUSSIAN_BLUR_BATCH_MAX_SIZE = 256;
+
+    // the filter zone value (0-255) is the blur kernel width in pixels,
+    // the kernel covers +-3 sigma
+    constexpr float GAUSSIAN_BLUR_ZONE_TO_SIGMA = 1.0f / 6.0f;
+
+    inline float zoneValueToSigma(unsigned char zone_value)
+    {
+        return zone_value * GAUSSIAN_BLUR_ZONE_TO_SIGMA;
+    }
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_DEFINES_H_
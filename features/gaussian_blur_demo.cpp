@@ -32,9 +32,13 @@
 #include <learnopengl/shader_m.h>
 
 #include <features/framebuffer/FrameBuffer.h>
+#include <features/gaussian_blur_defines.h>
+#include <features/gaussian_blur_kernel_lut.h>
 
 #include <iostream>
 #include <algorithm>
+#include <string>
+#include <vector>
 
 #include <opencv2/opencv.hpp>
 #include <opencv2/core/core.hpp>
@@ -59,6 +63,8 @@ void *font = GLUT_BITMAP_8_BY_13;
 int g_save_frame = 1;        //'s'
 int g_draw_frame = 1;        //'d'
 int g_using_framebuffer = 0; //'f'
+int g_using_msaa = 0;        //'m'
+const int MSAA_SAMPLES = 4;
 int g_using_opencv = 0;
 int g_using_camera = 0;
 
@@ -82,6 +88,35 @@ void generateFilePath(char *filename, double index, const unsigned char *basePat
     sprintf(filename, "%s_%.4f.png", basePath, index);
 }
 
+// frame buffer readbacks still on the gpu, written once they arrive
+struct PendingSave
+{
+    int ticket;
+    std::string path;
+};
+std::vector<PendingSave> g_pending_saves;
+
+void savePendingFrames(FrameBuffer &fbo, std::vector<unsigned char> &pixels, bool wait)
+{
+    pixels.resize(fbo.getWidth() * fbo.getHeight() * 4);
+    for (size_t i = 0; i < g_pending_saves.size();)
+    {
+        const PendingSave &save = g_pending_saves[i];
+        bool done = wait ? fbo.waitColorBuffer(save.ticket, pixels.data())
+                         : fbo.tryGetColorBuffer(save.ticket, pixels.data());
+        if (!done && !wait)
+        {
+            ++i;
+            continue;
+        }
+        if (done)
+        {
+            saveFrameBuffer2PNG((const char *)pixels.data(), fbo.getWidth(), fbo.getHeight(), 4, save.path.c_str());
+        }
+        g_pending_saves.erase(g_pending_saves.begin() + i);
+    }
+}
+
 #ifdef _USING_CAMERA
 void initCam()
 {
@@ -409,10 +444,51 @@ int main(int argv, const char *argc[])
         zoneTextureIdx,GL_TEXTURE1,
         GL_RGBA,GL_RGBA,GL_UNSIGNED_BYTE);
 
+    //kernel taps per zone value
+    ESSILOR::GassianBlurKernelLut kernelLut;
+    kernelLut.build(ESSILOR::GAUSSIAN_BLUR_PROFILE_BALANCED);
+    unsigned int kernelLutTextureIdx = 0;
+    glGenTextures(1, &kernelLutTextureIdx);
+    glActiveTexture(GL_TEXTURE3);
+    glBindTexture(GL_TEXTURE_2D, kernelLutTextureIdx);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RG32F, ESSILOR::GAUSSIAN_BLUR_LUT_WIDTH, ESSILOR::GAUSSIAN_BLUR_LUT_ROWS, 0,
+                 GL_RG, GL_FLOAT, kernelLut.data());
+    glUniform1i(glGetUniformLocation(ourShader.ID, "sigmaLut"), 3);
+    glActiveTexture(GL_TEXTURE0);
+
     // using framebuffer
     FrameBuffer fbo;
     fbo.init(width, height); // for single-sample FBO
 
+    // multisampled source. the blur shader can only resolve it while it
+    // filters when no kernel of the zone map reads a coarser mip level,
+    // otherwise it is resolved into mipmapped textures first
+    FrameBufferDesc msaaDesc(width, height, GL_RGBA8, false, MSAA_SAMPLES);
+    msaaDesc.msaaTextures = true;
+    msaaDesc.mipmaps = true;
+    FrameBuffer msaaFbo;
+    msaaFbo.init(msaaDesc);
+    int maxZoneValue = 0;
+    if(nullptr != g_zones_buffer)
+    {
+        size_t zoneBytes = (size_t)width_zone * height_zone * nrChannels_zone;
+        for (size_t i = 0; i < zoneBytes; i++)
+            maxZoneValue = std::max(maxZoneValue, (int)g_zones_buffer[i]);
+    }
+    bool msaaResolveInShader = kernelLut.maxLod(maxZoneValue) == 0;
+    std::cout << "[MSAA] " << (msaaResolveInShader ? "resolved by the blur shader" : "resolved into mipmaps, kernels read lod > 0")
+              << std::endl;
+    Shader sceneShader("../resources/features_res/gaussain_bulr/gauss_blur.vs",
+                       "../resources/features_res/gaussain_bulr/gauss_blur_copy.fs");
+    sceneShader.use();
+    sceneShader.setInt("imageTexture", 0);
+    sceneShader.setInt("filterZones", 1);
+    sceneShader.setFloat("passThroughZone", 255.0f); // every pixel is copied
+    ourShader.use();
+    ourShader.setInt("imageTextureMS", 4);
+
     // init buffer 
     frameBufForSaving = new unsigned char[width * height * 4]; // RGBA
 
@@ -426,6 +502,7 @@ int main(int argv, const char *argc[])
     int frameIndex = 0;
     bool bSave = false;
     int opTextureIdx = 0;
+    std::vector<unsigned char> savePixels;
     // render loop
     // -----------
     while (!glfwWindowShouldClose(window))
@@ -488,7 +565,37 @@ int main(int argv, const char *argc[])
                                     GL_RGBA, GL_BGR, g_zones_buffer);
             }
 
+            if (g_using_msaa)
+            {
+                // the source goes into the multisampled target
+                GLint viewport[4];
+                glGetIntegerv(GL_VIEWPORT, viewport);
+                sceneShader.use();
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, opTextureIdx);
+                msaaFbo.bind();
+                glViewport(0, 0, msaaFbo.getWidth(), msaaFbo.getHeight());
+                glBindVertexArray(VAO);
+                glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+                msaaFbo.unbind();
+                glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+                if (msaaResolveInShader)
+                {
+                    glActiveTexture(GL_TEXTURE4);
+                    glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, msaaFbo.getMsaaColorId());
+                    glActiveTexture(GL_TEXTURE0);
+                }
+                else
+                {
+                    msaaFbo.update();
+                    msaaFbo.unbind();
+                    glActiveTexture(GL_TEXTURE0);
+                    glBindTexture(GL_TEXTURE_2D, msaaFbo.getColorId());
+                }
+            }
+
             ourShader.use();
+            ourShader.setInt("sourceSamples", (g_using_msaa && msaaResolveInShader) ? msaaFbo.getMsaa() : 0);
 
             // render
             if (g_using_framebuffer)
@@ -531,9 +638,12 @@ int main(int argv, const char *argc[])
             generateFilePath(save_path, endTime, g_save_base_path);
             if (g_using_framebuffer)
             {
-                fbo.copyColorBuffer();
-                const unsigned char *buffer = fbo.getColorBuffer();
-                saveFrameBuffer2PNG((const char *)(buffer), width, height, 4, save_path);
+                // the png is written by a later frame, the gpu keeps going
+                PendingSave save = {fbo.requestColorReadback(), save_path};
+                if (save.ticket > 0)
+                {
+                    g_pending_saves.push_back(save);
+                }
             }
             else if (frameBufForSaving != nullptr)
             {
@@ -542,6 +652,10 @@ int main(int argv, const char *argc[])
             }
             g_save_frame = 0;
         }
+        if (!g_pending_saves.empty())
+        {
+            savePendingFrames(fbo, savePixels, false);
+        }
 
         // glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
         glfwSwapBuffers(window);
@@ -550,6 +664,8 @@ int main(int argv, const char *argc[])
         glfwPollEvents();
     }
 
+    savePendingFrames(fbo, savePixels, true);
+
     // optional: de-allocate all resources once they've outlived their purpose:
     // ------------------------------------------------------------------------
     glDeleteVertexArrays(1, &VAO);
@@ -584,6 +700,10 @@ void processInput(GLFWwindow *window)
     {
         g_using_framebuffer = g_using_framebuffer ? 0 : 1;
     }
+    else if (glfwGetKey(window, GLFW_KEY_M) == GLFW_PRESS)
+    {
+        g_using_msaa = g_using_msaa ? 0 : 1;
+    }
     else if (glfwGetKey(window, GLFW_KEY_C) == GLFW_PRESS)
     {
         g_using_opencv = g_using_opencv ? 0 : 1;
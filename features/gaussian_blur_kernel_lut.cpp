@@ -0,0 +1,144 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 22:10:37
+ * @LastEditTime: 2026-10-20 01:12:40
+ * @LastEditors: Matt.SHI
+ * @Description: per zone value gaussian taps for the blur shader
+ * @FilePath: /opengl_demo/features/gaussian_blur_kernel_lut.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "gaussian_blur_kernel_lut.h"
+#include "gaussian_blur_defines.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ESSILOR
+{
+    GassianBlurKernelLut::GassianBlurKernelLut() : m_profile(GAUSSIAN_BLUR_PROFILE_BALANCED)
+    {
+    }
+
+    GassianBlurKernelLut::~GassianBlurKernelLut()
+    {
+    }
+
+    GassianBlurKernelLut::ProfileParams GassianBlurKernelLut::profileParams(int profile)
+    {
+        switch (profile)
+        {
+        case GAUSSIAN_BLUR_PROFILE_FAST:
+            return {4, true};
+        case GAUSSIAN_BLUR_PROFILE_EXACT:
+            return {GAUSSIAN_BLUR_LUT_MAX_TAPS - 1, false};
+        default:
+            return {8, true};
+        }
+    }
+
+    void GassianBlurKernelLut::build(int profile)
+    {
+        m_profile = profile;
+        ProfileParams params = profileParams(profile);
+        m_table.assign(GAUSSIAN_BLUR_LUT_ROWS * GAUSSIAN_BLUR_LUT_WIDTH * 2, 0.0f);
+        for (int zone_value = 0; zone_value < GAUSSIAN_BLUR_LUT_ROWS; zone_value++)
+        {
+            buildRow(zoneValueToSigma((unsigned char)zone_value), params,
+                     &m_table[zone_value * GAUSSIAN_BLUR_LUT_WIDTH * 2]);
+        }
+    }
+
+    int GassianBlurKernelLut::profile() const
+    {
+        return m_profile;
+    }
+
+    const float *GassianBlurKernelLut::data() const
+    {
+        return m_table.data();
+    }
+
+    int GassianBlurKernelLut::tapCount(int zone_value) const
+    {
+        return (int)m_table[zone_value * GAUSSIAN_BLUR_LUT_WIDTH * 2];
+    }
+
+    int GassianBlurKernelLut::lod(int zone_value) const
+    {
+        return (int)m_table[zone_value * GAUSSIAN_BLUR_LUT_WIDTH * 2 + 1];
+    }
+
+    int GassianBlurKernelLut::maxLod(int max_zone_value) const
+    {
+        int level = 0;
+        for (int zone_value = 0; zone_value <= max_zone_value && zone_value < GAUSSIAN_BLUR_LUT_ROWS; zone_value++)
+            level = std::max(level, lod(zone_value));
+        return level;
+    }
+
+    int GassianBlurKernelLut::passThroughZone() const
+    {
+        int zone_value = -1;
+        while (zone_value + 1 < GAUSSIAN_BLUR_LUT_ROWS && tapCount(zone_value + 1) == 1)
+            zone_value++;
+        return zone_value;
+    }
+
+    void GassianBlurKernelLut::buildRow(float sigma, const ProfileParams &params, float *row)
+    {
+        float *taps = row + 2;
+        if (sigma < 0.5f)
+        {
+            row[0] = 1.0f;
+            row[1] = 0.0f;
+            taps[0] = 1.0f;
+            taps[1] = 0.0f;
+            return;
+        }
+
+        // a mip level of scale 2^lod box filtered the source with a variance
+        // of (4^lod - 1) / 12 full resolution pixels
+        int lod = 0;
+        while (3.0f * sigma / (float)(1 << lod) > params.max_radius)
+            lod++;
+        float scale = (float)(1 << lod);
+        float variance = sigma * sigma - (scale * scale - 1.0f) / 12.0f;
+        float lod_sigma = std::sqrt(std::max(variance, 0.25f)) / scale;
+        int radius = std::min(params.max_radius, std::max(1, (int)std::ceil(3.0f * lod_sigma)));
+
+        std::vector<double> weights(radius + 1);
+        double sum = 0.0;
+        for (int k = 0; k <= radius; k++)
+        {
+            weights[k] = std::exp(-(double)(k * k) / (2.0 * lod_sigma * lod_sigma));
+            sum += (k == 0) ? weights[k] : 2.0 * weights[k];
+        }
+        for (int k = 0; k <= radius; k++)
+        {
+            weights[k] /= sum;
+        }
+
+        // the centre stays alone. with linear pairs taps k and k + 1 become one
+        // bilinear fetch between them, weighted so it returns their weighted sum
+        int tap_count = 0;
+        taps[2 * tap_count] = (float)weights[0];
+        taps[2 * tap_count + 1] = 0.0f;
+        tap_count++;
+        for (int k = 1; k <= radius; k += (params.linear_pairs ? 2 : 1))
+        {
+            double w = weights[k];
+            double offset = k;
+            if (params.linear_pairs && k + 1 <= radius)
+            {
+                w = weights[k] + weights[k + 1];
+                offset = (k * weights[k] + (k + 1) * weights[k + 1]) / w;
+            }
+            taps[2 * tap_count] = (float)w;
+            taps[2 * tap_count + 1] = (float)offset;
+            tap_count++;
+        }
+        row[0] = (float)tap_count;
+        row[1] = (float)lod;
+    }
+}
@@ -0,0 +1,62 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 22:10:37
+ * @LastEditTime: 2026-10-20 01:12:40
+ * @LastEditors: Matt.SHI
+ * @Description: per zone value gaussian taps for the blur shader
+ * @FilePath: /opengl_demo/features/gaussian_blur_kernel_lut.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_KERNEL_LUT_H_
+#define _ESSILOR_GAUSSIAN_BLUR_KERNEL_LUT_H_
+
+#include <vector>
+
+namespace ESSILOR
+{
+    // taps on one side including the centre, LUT_MAX_TAPS in gauss_blur.fs
+    constexpr int GAUSSIAN_BLUR_LUT_MAX_TAPS = 17;
+    constexpr int GAUSSIAN_BLUR_LUT_ROWS = 256;
+    // rg texels: (tap count, mip level), then (weight, offset) per tap
+    constexpr int GAUSSIAN_BLUR_LUT_WIDTH = GAUSSIAN_BLUR_LUT_MAX_TAPS + 1;
+
+    class GassianBlurKernelLut
+    {
+        public:
+            GassianBlurKernelLut();
+            virtual ~GassianBlurKernelLut();
+
+        public:
+            // GAUSSIAN_BLUR_LUT_ROWS rows of GAUSSIAN_BLUR_LUT_WIDTH rg texels,
+            // row = zone value. profile is a GaussianBlurKernelProfile
+            void build(int profile);
+            int profile() const;
+            const float *data() const;
+
+            int tapCount(int zone_value) const;
+            int lod(int zone_value) const;
+            // coarsest mip level read by the zone values up to max_zone_value
+            int maxLod(int max_zone_value) const;
+            // zone values up to this one only have the centre tap, -1 if none
+            int passThroughZone() const;
+
+        protected:
+            struct ProfileParams
+            {
+                int max_radius;         // discrete taps per side before mip levels take over
+                bool linear_pairs;      // two neighbouring taps per bilinear fetch
+            };
+            static ProfileParams profileParams(int profile);
+
+            // wider kernels than the radius budget read a coarser mip level
+            // with a sigma reduced by the blur the mip reduction already applied
+            static void buildRow(float sigma, const ProfileParams &params, float *row);
+
+        private:
+            int m_profile;
+            std::vector<float> m_table;
+    };
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_KERNEL_LUT_H_
@@ -9,6 +9,8 @@
  */
 
 #include "gaussian_blur_core.h"
+#include "gaussian_blur_context_pool.h"
+#include "gaussian_blur_defines.h"
 
 #include <opencv2/opencv.hpp>
 #include <opencv2/core/core.hpp>
@@ -17,11 +19,15 @@
 #include <opencv2/highgui/highgui.hpp>
 
 #include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 
 #include <stb_image.h>
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include <tools/stb_image_write.h>
+#include <tools/frame_writer.h>
+#include <tools/bounded_queue.h>
 
 #ifdef __APPLE__
 #include <sys/time.h>
@@ -43,6 +49,21 @@ constexpr int WIN_C = 3;
 unsigned char g_save_base_path[] = "./frames/";
 bool g_save_imgs = true;
 
+tools::FrameWriter g_frame_writer;
+tools::FrameWriterFormat g_save_format = tools::FRAME_WRITER_FMT_PNG;
+int g_save_compression_level = 1;
+
+const char* g_video_input_path = nullptr;
+const char* g_video_output_path = nullptr;
+unsigned int g_video_contexts = 1;
+int g_blur_engine = ESSILOR::GAUSSIAN_BLUR_ENGINE_SHADER;
+bool g_auto_engine = false;
+unsigned int g_half_res_scale = 1;
+int g_kernel_profile = ESSILOR::GAUSSIAN_BLUR_PROFILE_BALANCED;
+bool g_gl_debug = false;
+bool g_shader_reload = false;
+constexpr int VIDEO_FRAMES_IN_FLIGHT = 4;
+
 int scanKeyboard()
 {
     int input = 0;
@@ -88,16 +109,241 @@ unsigned char* loadFile(const char* filePath,
     return stbi_load(filePath, &width, &height, &nrChannels, nrChannels);
 }
 
+//the extension is appended by the frame writer
 void generateFilePath(char *filename, double index, const unsigned char *basePath)
 {
-    sprintf(filename, "%s_%.4f.png", basePath, index);
+    sprintf(filename, "%s_%.4f", basePath, index);
 }
 
-void saveFrameBuffer2PNG(const char *buf,
-                         unsigned int w, unsigned int h, unsigned int c,
-                         const char *filename)
+void parseOptions(int argv, const char *argc[])
 {
-    stbi_write_png(filename, w, h, c, buf, w * c);
+    for(int i = 2; i + 1 < argv; i++)
+    {
+        if(0 == strcmp(argc[i], "--video") && i + 2 < argv)
+        {
+            g_video_input_path = argc[i + 1];
+            g_video_output_path = argc[i + 2];
+        }
+        else if(0 == strcmp(argc[i], "--contexts"))
+        {
+            g_video_contexts = (unsigned int)std::max(1, atoi(argc[i + 1]));
+        }
+        else if(0 == strcmp(argc[i], "--engine"))
+        {
+            if(0 == strcmp(argc[i + 1], "iir"))
+            {
+                g_blur_engine = ESSILOR::GAUSSIAN_BLUR_ENGINE_CPU_IIR;
+            }
+            else if(0 == strcmp(argc[i + 1], "fixed"))
+            {
+                g_blur_engine = ESSILOR::GAUSSIAN_BLUR_ENGINE_CPU_FIXED;
+            }
+            else if(0 == strcmp(argc[i + 1], "auto"))
+            {
+                g_auto_engine = true;
+            }
+            else if(0 != strcmp(argc[i + 1], "shader"))
+            {
+                std::cout << "unknown engine " << argc[i + 1] << ", using shader" << std::endl;
+            }
+        }
+        else if(0 == strcmp(argc[i], "--half-res"))
+        {
+            g_half_res_scale = (unsigned int)std::max(1, atoi(argc[i + 1]));
+        }
+        else if(0 == strcmp(argc[i], "--profile"))
+        {
+            if(0 == strcmp(argc[i + 1], "fast"))
+            {
+                g_kernel_profile = ESSILOR::GAUSSIAN_BLUR_PROFILE_FAST;
+            }
+            else if(0 == strcmp(argc[i + 1], "exact"))
+            {
+                g_kernel_profile = ESSILOR::GAUSSIAN_BLUR_PROFILE_EXACT;
+            }
+            else if(0 != strcmp(argc[i + 1], "balanced"))
+            {
+                std::cout << "unknown profile " << argc[i + 1] << ", using balanced" << std::endl;
+            }
+        }
+        else if(0 == strcmp(argc[i], "--save-format"))
+        {
+            if(!tools::FrameWriter::ParseFormat(argc[i + 1], g_save_format))
+            {
+                std::cout << "unknown save format " << argc[i + 1] << ", using png" << std::endl;
+            }
+        }
+        else if(0 == strcmp(argc[i], "--save-level"))
+        {
+            g_save_compression_level = atoi(argc[i + 1]);
+        }
+        else if(0 == strcmp(argc[i], "--gl-debug"))
+        {
+            g_gl_debug = (0 == strcmp(argc[i + 1], "on"));
+        }
+        else if(0 == strcmp(argc[i], "--shader-reload"))
+        {
+            g_shader_reload = (0 == strcmp(argc[i + 1], "on"));
+        }
+    }
+}
+
+struct VideoFrame
+{
+    cv::Mat* mat;
+    long index;
+};
+
+// decode -> upload/blur/readback -> encode, each stage on its own thread so
+// the codec work overlaps the GL work. Frames travel through fixed pools,
+// a slow stage blocks the stage in front of it instead of dropping frames.
+int runVideoMode(const char* inputPath, const char* outputPath,
+                 unsigned char* filterZoneData, int filterZoneW, int filterZoneH, int filterZoneC,
+                 const char* vertexShaderFile, const char* fragmentShaderFile)
+{
+    cv::VideoCapture capture;
+    if(!capture.open(std::string(inputPath)))
+    {
+        std::cout << "[VIDEO] failed to open " << inputPath << std::endl;
+        return -1;
+    }
+    int w = (int)capture.get(cv::CAP_PROP_FRAME_WIDTH);
+    int h = (int)capture.get(cv::CAP_PROP_FRAME_HEIGHT);
+    double fps = capture.get(cv::CAP_PROP_FPS);
+    if(fps <= 0.0)
+        fps = 25.0;
+    if(w <= 0 || h <= 0)
+    {
+        std::cout << "[VIDEO] invalid video size w:" << w << " h:" << h << std::endl;
+        return -1;
+    }
+
+    cv::VideoWriter writer;
+    if(!writer.open(std::string(outputPath), cv::VideoWriter::fourcc('m', 'p', '4', 'v'), fps, cv::Size(w, h), true))
+    {
+        std::cout << "[VIDEO] failed to open " << outputPath << std::endl;
+        return -1;
+    }
+    std::cout << "[VIDEO] " << inputPath << " -> " << outputPath << " w:" << w << " h:" << h << " fps:" << fps << std::endl;
+
+    // headless, the core renders into rotating offscreen targets without vsync
+    g_blur_core.set_enable_gui(false);
+    g_blur_core.set_pipeline_depth(3);
+    g_blur_core.setKernelProfile(g_kernel_profile);
+    g_blur_core.set_auto_engine(g_auto_engine);
+    g_blur_core.set_gl_debug(g_gl_debug);
+    // the pool's workers keep using the program they started with
+    g_blur_core.set_shader_reload(g_shader_reload && g_video_contexts <= 1);
+    g_blur_core.init(w, h, WIN_C, vertexShaderFile, fragmentShaderFile);
+    if(!g_auto_engine)
+    {
+        g_blur_core.set_engine(g_blur_engine);
+    }
+    g_blur_core.set_half_res_mode(g_half_res_scale);
+
+    std::vector<cv::Mat> decodePool(VIDEO_FRAMES_IN_FLIGHT);
+    std::vector<cv::Mat> encodePool(VIDEO_FRAMES_IN_FLIGHT);
+    tools::BoundedQueue<cv::Mat*> decodeFree(VIDEO_FRAMES_IN_FLIGHT);
+    tools::BoundedQueue<cv::Mat*> encodeFree(VIDEO_FRAMES_IN_FLIGHT);
+    tools::BoundedQueue<VideoFrame> decoded(VIDEO_FRAMES_IN_FLIGHT);
+    tools::BoundedQueue<VideoFrame> blurred(VIDEO_FRAMES_IN_FLIGHT);
+    for(int i = 0; i < VIDEO_FRAMES_IN_FLIGHT; i++)
+    {
+        encodePool[i].create(h, w, CV_8UC3);
+        decodeFree.TryPush(&decodePool[i]);
+        encodeFree.TryPush(&encodePool[i]);
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::thread decodeThread([&]() {
+        long index = 0;
+        cv::Mat* mat = nullptr;
+        while(decodeFree.Pop(mat))
+        {
+            if(!capture.read(*mat) || mat->empty())
+                break;
+            VideoFrame frame = {mat, index++};
+            if(!decoded.Push(frame))
+                break;
+        }
+        decoded.Close();
+    });
+
+    std::thread encodeThread([&]() {
+        VideoFrame frame;
+        while(blurred.Pop(frame))
+        {
+            writer.write(*frame.mat);
+            encodeFree.Push(frame.mat);
+        }
+    });
+
+    // GL stays on this thread, the context is current here. upload, blur and
+    // readback of consecutive frames overlap inside the core's pipeline
+    long frameCount = 0;
+    VideoFrame frame;
+    auto onBlurDone = [&](unsigned long frameId, const unsigned char* data, unsigned long len) {
+        cv::Mat* out = nullptr;
+        if(!encodeFree.Pop(out))
+            return;
+        memcpy(out->data, data, len);
+        VideoFrame result = {out, (long)frameId};
+        blurred.Push(result);
+    };
+    // with more than one context the frames are spread over shared contexts
+    ESSILOR::GassianBlurContextPool contextPool;
+    bool usingPool = false;
+    if(g_video_contexts > 1)
+    {
+        usingPool = (0 == contextPool.init(&g_blur_core, g_video_contexts));
+        if(usingPool)
+        {
+            contextPool.updateFilterZone(filterZoneData, filterZoneW, filterZoneH, filterZoneC);
+        }
+    }
+    while(decoded.Pop(frame))
+    {
+        if(usingPool)
+        {
+            contextPool.submit(frame.mat->data, frame.mat->cols, frame.mat->rows, frame.mat->channels(), onBlurDone);
+        }
+        else
+        {
+            g_blur_core.submitGaussianBlur(
+                frame.mat->data, frame.mat->cols, frame.mat->rows, frame.mat->channels(),
+                filterZoneData, filterZoneW, filterZoneH, filterZoneC,
+                onBlurDone);
+        }
+        // the pixels were copied into the pipeline's upload buffer
+        decodeFree.Push(frame.mat);
+
+        frameCount++;
+        if(frameCount % 100 == 0)
+        {
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            printf("[VIDEO] %ld frames, %.2lf fps\r\n", frameCount, frameCount / elapsed);
+            fflush(stdout);
+        }
+    }
+    if(usingPool)
+    {
+        contextPool.flush();
+        contextPool.unit();
+    }
+    g_blur_core.flushGaussianBlur();
+    decodeFree.Close();
+    blurred.Close();
+    decodeThread.join();
+    encodeThread.join();
+    writer.release();
+    capture.release();
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    printf("[VIDEO] done, %ld frames in %.2lf s, sustained %.2lf fps\r\n",
+           frameCount, elapsed, elapsed > 0.0 ? frameCount / elapsed : 0.0);
+    g_blur_core.unit();
+    return 0;
 }
 
 int main(int argv, const char *argc[])
@@ -105,16 +351,40 @@ int main(int argv, const char *argc[])
     if(argv < 2)
     {
         std::cout << "please input the  filter-zone image path" << std::endl;
+        std::cout << "usage: " << argc[0] << " <filter-zone> [--video <input> <output> [--contexts <n>]] [--engine shader|iir|fixed|auto] [--half-res 2|4] [--profile fast|balanced|exact] [--save-format png|ppm|raw|qoi] [--save-level 0-9] [--gl-debug on|off] [--shader-reload on|off]" << std::endl;
         return -1;
     }
 
     const char* filterZoneFile = argc[1];
+    parseOptions(argv, argc);
     //init
     const char* vertexShaderFile = "../resources/features_res/gaussain_bulr/gauss_blur.vs";
     const char* fragmentShaderFile = "../resources/features_res/gaussain_bulr/gauss_blur.fs";
+
+    if(nullptr != g_video_input_path)
+    {
+        int zoneW = 0, zoneH = 0, zoneC = 3;
+        unsigned char* zoneData = loadFile(filterZoneFile, zoneW, zoneH, zoneC);
+        int ret = runVideoMode(g_video_input_path, g_video_output_path,
+                               zoneData, zoneW, zoneH, zoneC,
+                               vertexShaderFile, fragmentShaderFile);
+        stbi_image_free(zoneData);
+        return ret;
+    }
+
     g_blur_core.set_enable_gui(true);
+    g_blur_core.setKernelProfile(g_kernel_profile);
+    g_blur_core.set_auto_engine(g_auto_engine);
+    g_blur_core.set_gl_debug(g_gl_debug);
+    g_blur_core.set_shader_reload(g_shader_reload);
 
     g_blur_core.init(WIN_W,WIN_H,WIN_C,vertexShaderFile,fragmentShaderFile);
+    if(!g_auto_engine)
+    {
+        g_blur_core.set_engine(g_blur_engine);
+    }
+    g_blur_core.set_half_res_mode(g_half_res_scale);
+    g_frame_writer.Start(WIN_W, WIN_H, WIN_C, g_save_format, g_save_compression_level);
 
     //init cam
 #ifdef USING_CAMERA
@@ -156,7 +426,14 @@ int main(int argv, const char *argc[])
         {
             char save_path[256] = {0};
             generateFilePath(save_path, time(nullptr), g_save_base_path);
-            saveFrameBuffer2PNG((const char *)(blurData),WIN_W , WIN_H, WIN_C, save_path); 
+            // copied into the writer pool, dropped when the disk can not keep up
+            g_frame_writer.Submit(blurData, save_path);
         }
     }
+
+    g_frame_writer.Stop();
+    std::cout << "[WRITER] written:" << g_frame_writer.GetWrittenCount()
+              << " dropped:" << g_frame_writer.GetDroppedCount() << std::endl;
+    g_blur_core.unit();
+    return 0;
 }
\ No newline at end of file
@@ -0,0 +1,499 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-20 09:03:18
+ * @LastEditTime: 2026-10-20 10:41:55
+ * @LastEditors: Matt.SHI
+ * @Description: rebuilds the blur programs when their sources change
+ * @FilePath: /opengl_demo/features/gaussian_blur_shader_reload.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "gaussian_blur_shader_reload.h"
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <features/framebuffer/glExtension.h>
+
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// GL_KHR_parallel_shader_compile, same values for the ARB version
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+namespace ESSILOR
+{
+    // editors write a file in several steps, wait for the last one
+    constexpr unsigned int SHADER_RELOAD_SETTLE_MS = 100;
+
+    static std::string directoryOf(const std::string &file)
+    {
+        size_t dir_end = file.find_last_of("/\\");
+        return (dir_end == std::string::npos) ? std::string(".") : file.substr(0, dir_end);
+    }
+
+    static std::string fileNameOf(const std::string &file)
+    {
+        size_t dir_end = file.find_last_of("/\\");
+        return (dir_end == std::string::npos) ? file : file.substr(dir_end + 1);
+    }
+
+    static long long modificationTime(const std::string &file)
+    {
+        struct stat info;
+        if (0 != stat(file.c_str(), &info))
+        {
+            return -1;
+        }
+        return (long long)info.st_mtime;
+    }
+
+    static std::string shaderLog(GLuint shader, const std::string &file)
+    {
+        GLint success = 0;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if (success)
+        {
+            return "";
+        }
+        GLchar info_log[1024];
+        glGetShaderInfoLog(shader, 1024, NULL, info_log);
+        return file + ":\n" + info_log;
+    }
+
+    GassianBlurShaderReloader::GassianBlurShaderReloader() : m_window(nullptr),
+                                                             m_running(false),
+                                                             m_poll_ms(250),
+                                                             m_parallel_compile(false),
+                                                             m_inotify_fd(-1),
+                                                             m_ready_fence(nullptr),
+                                                             m_reload_count(0),
+                                                             m_failed_count(0)
+    {
+    }
+
+    GassianBlurShaderReloader::~GassianBlurShaderReloader()
+    {
+        stop();
+    }
+
+    int GassianBlurShaderReloader::addProgram(const char *vertex_file, const char *fragment_file,
+                                              const ShaderDefines &defines)
+    {
+        ProgramSource source;
+        source.vertex_file = vertex_file;
+        source.fragment_file = fragment_file;
+        source.defines = defines;
+
+        // the includes are watched from the start, later builds update them
+        ShaderPreprocessor preprocessor;
+        const std::string *files[] = {&source.vertex_file, &source.fragment_file};
+        for (const std::string *file : files)
+        {
+            std::string code;
+            std::string error;
+            std::vector<std::string> dependencies;
+            preprocessor.load(*file, defines, code, error, &dependencies);
+            source.dependencies.insert(source.dependencies.end(), dependencies.begin(), dependencies.end());
+        }
+        m_sources.push_back(source);
+        return (int)m_sources.size() - 1;
+    }
+
+    int GassianBlurShaderReloader::start(GLFWwindow *share_window, unsigned int poll_ms)
+    {
+        stop();
+        if (nullptr == share_window || m_sources.empty())
+        {
+            return -1;
+        }
+        m_poll_ms = poll_ms;
+        const glExtension &ext = glExtension::getInstance();
+        m_parallel_compile = ext.isSupported("GL_KHR_parallel_shader_compile") ||
+                             ext.isSupported("GL_ARB_parallel_shader_compile");
+
+        // same as the context pool, the hints of the caller's window still apply
+        glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+        m_window = glfwCreateWindow(16, 16, "shader reload", NULL, share_window);
+        if (nullptr == m_window)
+        {
+            std::cout << "[RELOAD] failed to create the compile context" << std::endl;
+            return -1;
+        }
+
+#ifdef __linux__
+        m_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+        m_mtimes.clear();
+        m_watched_dirs.clear();
+        m_running = true;
+        m_thread = std::thread(&GassianBlurShaderReloader::watchLoop, this);
+        std::cout << "[RELOAD] watching " << watchedFiles().size() << " files"
+                  << (m_inotify_fd >= 0 ? " with inotify" : "")
+                  << (m_parallel_compile ? ", parallel compile" : "") << std::endl;
+        return 0;
+    }
+
+    void GassianBlurShaderReloader::stop()
+    {
+        if (!m_thread.joinable())
+        {
+            return;
+        }
+        m_running = false;
+        m_thread.join();
+
+#ifdef __linux__
+        if (m_inotify_fd >= 0)
+        {
+            close(m_inotify_fd);
+        }
+#endif
+        m_inotify_fd = -1;
+
+        // a rebuild nobody took, the objects are shared with the caller's context
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = 0; i < m_ready_programs.size(); i++)
+        {
+            glDeleteProgram(m_ready_programs[i]);
+        }
+        m_ready_programs.clear();
+        if (nullptr != m_ready_fence)
+        {
+            glDeleteSync((GLsync)m_ready_fence);
+            m_ready_fence = nullptr;
+        }
+        glfwDestroyWindow(m_window);
+        m_window = nullptr;
+    }
+
+    bool GassianBlurShaderReloader::isRunning() const
+    {
+        return m_running;
+    }
+
+    bool GassianBlurShaderReloader::takePrograms(std::vector<unsigned int> &programs)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_ready_programs.empty())
+        {
+            return false;
+        }
+        // linked on the other context, usable here once its commands completed
+        GLenum status = glClientWaitSync((GLsync)m_ready_fence, 0, 0);
+        if (GL_TIMEOUT_EXPIRED == status)
+        {
+            return false;
+        }
+        glDeleteSync((GLsync)m_ready_fence);
+        m_ready_fence = nullptr;
+        programs.swap(m_ready_programs);
+        m_ready_programs.clear();
+        return true;
+    }
+
+    unsigned long GassianBlurShaderReloader::getReloadCount() const
+    {
+        return m_reload_count;
+    }
+
+    unsigned long GassianBlurShaderReloader::getFailedCount() const
+    {
+        return m_failed_count;
+    }
+
+    std::vector<std::string> GassianBlurShaderReloader::watchedFiles() const
+    {
+        std::vector<std::string> files;
+        for (size_t i = 0; i < m_sources.size(); i++)
+        {
+            const std::vector<std::string> &dependencies = m_sources[i].dependencies;
+            for (size_t j = 0; j < dependencies.size(); j++)
+            {
+                if (std::find(files.begin(), files.end(), dependencies[j]) == files.end())
+                {
+                    files.push_back(dependencies[j]);
+                }
+            }
+        }
+        return files;
+    }
+
+    void GassianBlurShaderReloader::watchLoop()
+    {
+        glfwMakeContextCurrent(m_window);
+        setupParallelCompile();
+        while (waitForChange())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(SHADER_RELOAD_SETTLE_MS));
+            // the events of the other steps of the same save
+#ifdef __linux__
+            if (m_inotify_fd >= 0)
+            {
+                char buffer[4096];
+                while (read(m_inotify_fd, buffer, sizeof(buffer)) > 0)
+                {
+                }
+            }
+#endif
+            rebuild();
+        }
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    bool GassianBlurShaderReloader::waitForChange()
+    {
+        std::vector<std::string> files = watchedFiles();
+
+#ifdef __linux__
+        if (m_inotify_fd >= 0)
+        {
+            // the directories, editors often save by renaming a new file over
+            // the old one. adding a watch twice returns the same descriptor
+            for (size_t i = 0; i < files.size(); i++)
+            {
+                std::string dir = directoryOf(files[i]);
+                int wd = inotify_add_watch(m_inotify_fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+                if (wd >= 0)
+                {
+                    m_watched_dirs[wd] = dir;
+                }
+            }
+
+            char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+            while (m_running)
+            {
+                struct pollfd fds = {m_inotify_fd, POLLIN, 0};
+                if (poll(&fds, 1, (int)m_poll_ms) <= 0)
+                {
+                    continue;
+                }
+                ssize_t length = read(m_inotify_fd, buffer, sizeof(buffer));
+                for (ssize_t offset = 0; offset < length;)
+                {
+                    const struct inotify_event *event = (const struct inotify_event *)(buffer + offset);
+                    offset += sizeof(struct inotify_event) + event->len;
+                    if (0 == event->len || m_watched_dirs.find(event->wd) == m_watched_dirs.end())
+                    {
+                        continue;
+                    }
+                    std::string changed = m_watched_dirs[event->wd] + "/" + event->name;
+                    for (size_t i = 0; i < files.size(); i++)
+                    {
+                        if (changed == directoryOf(files[i]) + "/" + fileNameOf(files[i]))
+                        {
+                            std::cout << "[RELOAD] " << files[i] << " changed" << std::endl;
+                            return true;
+                        }
+                    }
+                }
+            }
+            return false;
+        }
+#endif
+
+        // the times the last rebuild saw, so changes made while it ran still count
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            if (m_mtimes.find(files[i]) == m_mtimes.end())
+            {
+                m_mtimes[files[i]] = modificationTime(files[i]);
+            }
+        }
+        while (m_running)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(m_poll_ms));
+            bool changed = false;
+            for (size_t i = 0; i < files.size(); i++)
+            {
+                long long mtime = modificationTime(files[i]);
+                if (mtime != m_mtimes[files[i]])
+                {
+                    std::cout << "[RELOAD] " << files[i] << " changed" << std::endl;
+                    m_mtimes[files[i]] = mtime;
+                    changed = true;
+                }
+            }
+            if (changed)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void GassianBlurShaderReloader::setupParallelCompile()
+    {
+        if (!m_parallel_compile)
+        {
+            return;
+        }
+        PFNGLMAXSHADERCOMPILERTHREADSKHRPROC maxShaderCompilerThreads =
+            (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+        if (nullptr == maxShaderCompilerThreads)
+        {
+            maxShaderCompilerThreads =
+                (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glfwGetProcAddress("glMaxShaderCompilerThreadsARB");
+        }
+        if (nullptr == maxShaderCompilerThreads)
+        {
+            m_parallel_compile = false;
+            return;
+        }
+        // as many as the driver likes
+        maxShaderCompilerThreads(0xFFFFFFFF);
+    }
+
+    unsigned int GassianBlurShaderReloader::compileShader(unsigned int type, const std::string &file,
+                                                          const ShaderDefines &defines, ShaderPreprocessor &preprocessor,
+                                                          std::vector<std::string> &dependencies, std::string &log)
+    {
+        std::string text;
+        std::string error;
+        std::vector<std::string> files;
+        bool loaded = preprocessor.load(file, defines, text, error, &files);
+        // a missing include is still watched, creating it fixes the build
+        dependencies.insert(dependencies.end(), files.begin(), files.end());
+        if (!loaded)
+        {
+            log += error + "\n";
+            return 0;
+        }
+        const char *source = text.c_str();
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source, NULL);
+        glCompileShader(shader);
+        return shader;
+    }
+
+    void GassianBlurShaderReloader::rebuild()
+    {
+        struct Build
+        {
+            GLuint vertex;
+            GLuint fragment;
+            GLuint program;
+        };
+        std::vector<Build> builds;
+        std::string log;
+
+        // queue every compile and link first. with parallel compile the driver
+        // works on all of them at once, without it the status queries below wait.
+        // a fresh preprocessor reads the changed files, the programs of this
+        // build share what it read
+        ShaderPreprocessor preprocessor;
+        for (size_t i = 0; i < m_sources.size(); i++)
+        {
+            ProgramSource &source = m_sources[i];
+            Build build = {0, 0, 0};
+            source.dependencies.clear();
+            build.vertex = compileShader(GL_VERTEX_SHADER, source.vertex_file, source.defines, preprocessor,
+                                         source.dependencies, log);
+            build.fragment = compileShader(GL_FRAGMENT_SHADER, source.fragment_file, source.defines, preprocessor,
+                                           source.dependencies, log);
+            if (0 != build.vertex && 0 != build.fragment)
+            {
+                build.program = glCreateProgram();
+                glAttachShader(build.program, build.vertex);
+                glAttachShader(build.program, build.fragment);
+                glLinkProgram(build.program);
+            }
+            builds.push_back(build);
+        }
+
+        if (m_parallel_compile)
+        {
+            for (size_t i = 0; i < builds.size() && m_running; i++)
+            {
+                GLint done = (0 == builds[i].program) ? GL_TRUE : GL_FALSE;
+                while (!done && m_running)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    glGetProgramiv(builds[i].program, GL_COMPLETION_STATUS_KHR, &done);
+                }
+            }
+        }
+
+        bool linked = m_running;
+        for (size_t i = 0; i < builds.size(); i++)
+        {
+            GLint success = 0;
+            if (0 != builds[i].program)
+            {
+                glGetProgramiv(builds[i].program, GL_LINK_STATUS, &success);
+            }
+            if (!success)
+            {
+                linked = false;
+                if (0 != builds[i].vertex)
+                {
+                    log += shaderLog(builds[i].vertex, m_sources[i].vertex_file);
+                }
+                if (0 != builds[i].fragment)
+                {
+                    log += shaderLog(builds[i].fragment, m_sources[i].fragment_file);
+                }
+                if (0 != builds[i].program)
+                {
+                    GLchar info_log[1024];
+                    glGetProgramInfoLog(builds[i].program, 1024, NULL, info_log);
+                    log += info_log;
+                }
+            }
+            // the program keeps what it needs
+            glDeleteShader(builds[i].vertex);
+            glDeleteShader(builds[i].fragment);
+        }
+
+        if (!linked)
+        {
+            for (size_t i = 0; i < builds.size(); i++)
+            {
+                glDeleteProgram(builds[i].program);
+            }
+            if (m_running)
+            {
+                m_failed_count++;
+                std::cout << "[RELOAD] build failed, keeping the current programs\n" << log << std::endl;
+            }
+            return;
+        }
+
+        // the caller's context may use the programs once this fence passed
+        GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // a rebuild the caller did not take yet is replaced
+        for (size_t i = 0; i < m_ready_programs.size(); i++)
+        {
+            glDeleteProgram(m_ready_programs[i]);
+        }
+        if (nullptr != m_ready_fence)
+        {
+            glDeleteSync((GLsync)m_ready_fence);
+        }
+        m_ready_programs.clear();
+        for (size_t i = 0; i < builds.size(); i++)
+        {
+            m_ready_programs.push_back(builds[i].program);
+        }
+        m_ready_fence = fence;
+        m_reload_count++;
+        std::cout << "[RELOAD] rebuilt " << builds.size() << " programs" << std::endl;
+    }
+}
@@ -0,0 +1,101 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-20 09:03:18
+ * @LastEditTime: 2026-10-20 10:41:55
+ * @LastEditors: Matt.SHI
+ * @Description: rebuilds the blur programs when their sources change
+ * @FilePath: /opengl_demo/features/gaussian_blur_shader_reload.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_SHADER_RELOAD_H_
+#define _ESSILOR_GAUSSIAN_BLUR_SHADER_RELOAD_H_
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <learnopengl/shader_preprocessor.h>
+
+struct GLFWwindow;
+
+namespace ESSILOR
+{
+    // watches the sources of a set of programs and the files they include
+    // (inotify on linux, modification times elsewhere) and relinks all of them on a hidden context sharing
+    // objects with the caller's. the caller swaps the new programs in at a frame
+    // boundary with takePrograms(), a source that fails to build changes nothing
+    class GassianBlurShaderReloader
+    {
+        public:
+            GassianBlurShaderReloader();
+            virtual ~GassianBlurShaderReloader();
+
+        public:
+            // before start(), returns the index of the program in takePrograms().
+            // defines are injected the way Shader does it
+            int addProgram(const char *vertex_file, const char *fragment_file,
+                const ShaderDefines &defines = ShaderDefines());
+            // on the thread owning share_window's context, glfw creates windows
+            // on the main thread only. poll_ms is the modification time polling
+            // interval where inotify is missing
+            int start(GLFWwindow *share_window, unsigned int poll_ms = 250);
+            void stop();
+            bool isRunning() const;
+
+            // on the thread owning share_window's context. true once every program
+            // of a rebuild is linked and visible to that context, programs then
+            // holds them in addProgram() order and the caller owns them
+            bool takePrograms(std::vector<unsigned int> &programs);
+
+            unsigned long getReloadCount() const;
+            unsigned long getFailedCount() const;
+
+        protected:
+            struct ProgramSource
+            {
+                std::string vertex_file;
+                std::string fragment_file;
+                ShaderDefines defines;
+                // both files and their includes as of the last build
+                std::vector<std::string> dependencies;
+            };
+
+            void watchLoop();
+            // blocks until a watched file changed, false once stop() was called
+            bool waitForChange();
+            std::vector<std::string> watchedFiles() const;
+            // on the background context
+            void rebuild();
+            unsigned int compileShader(unsigned int type, const std::string &file, const ShaderDefines &defines,
+                ShaderPreprocessor &preprocessor, std::vector<std::string> &dependencies, std::string &log);
+            void setupParallelCompile();
+
+        private:
+            std::vector<ProgramSource> m_sources;
+            GLFWwindow *m_window;
+            std::thread m_thread;
+            std::atomic<bool> m_running;
+            unsigned int m_poll_ms;
+            bool m_parallel_compile;
+
+            // watch state of the background thread, changes made while a
+            // rebuild runs are still seen by the next waitForChange()
+            int m_inotify_fd;
+            std::map<int, std::string> m_watched_dirs;
+            std::map<std::string, long long> m_mtimes;
+
+            // a finished rebuild waiting for takePrograms()
+            std::mutex m_mutex;
+            std::vector<unsigned int> m_ready_programs;
+            void *m_ready_fence;
+
+            std::atomic<unsigned long> m_reload_count;
+            std::atomic<unsigned long> m_failed_count;
+    };
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_SHADER_RELOAD_H_
@@ -0,0 +1,202 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 23:20:14
+ * @LastEditTime: 2026-10-20 00:05:51
+ * @LastEditors: Matt.SHI
+ * @Description: filter zone preprocessing
+ * @FilePath: /opengl_demo/features/gaussian_blur_zone_map.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "gaussian_blur_zone_map.h"
+
+#include <algorithm>
+#include <string.h>
+
+namespace ESSILOR
+{
+    GassianBlurZoneMap::GassianBlurZoneMap() : m_source(nullptr),
+                                               m_source_w(0),
+                                               m_source_h(0),
+                                               m_source_c(0),
+                                               m_dirty(true),
+                                               m_tile_size(16),
+                                               m_tiles_x(0),
+                                               m_tiles_y(0),
+                                               m_min(0),
+                                               m_max(0)
+    {
+    }
+
+    GassianBlurZoneMap::~GassianBlurZoneMap()
+    {
+    }
+
+    void GassianBlurZoneMap::set_tile_size(unsigned int tile_size)
+    {
+        // histogram counts are 16 bit
+        m_tile_size = std::min(255u, std::max(1u, tile_size));
+        m_dirty = true;
+    }
+
+    void GassianBlurZoneMap::invalidate()
+    {
+        m_dirty = true;
+    }
+
+    bool GassianBlurZoneMap::update(const unsigned char *filter_zone_image_data,
+                                    unsigned int filter_zone_image_width,
+                                    unsigned int filter_zone_image_height,
+                                    unsigned int filter_zone_image_channel)
+    {
+        if (nullptr == filter_zone_image_data || filter_zone_image_width == 0 ||
+            filter_zone_image_height == 0 || filter_zone_image_channel == 0)
+        {
+            return false;
+        }
+        if (!m_dirty && m_source == filter_zone_image_data && m_source_w == filter_zone_image_width &&
+            m_source_h == filter_zone_image_height && m_source_c == filter_zone_image_channel)
+        {
+            return false;
+        }
+
+        m_source = filter_zone_image_data;
+        m_source_w = filter_zone_image_width;
+        m_source_h = filter_zone_image_height;
+        m_source_c = filter_zone_image_channel;
+        m_dirty = false;
+
+        extractLevel0(filter_zone_image_data, filter_zone_image_width, filter_zone_image_height, filter_zone_image_channel);
+        buildMaxChain();
+        buildTileStats();
+        return true;
+    }
+
+    bool GassianBlurZoneMap::empty() const
+    {
+        return m_levels.empty();
+    }
+
+    unsigned int GassianBlurZoneMap::levelCount() const
+    {
+        return (unsigned int)m_levels.size();
+    }
+
+    const ZoneMapLevel &GassianBlurZoneMap::level(unsigned int idx) const
+    {
+        return m_levels[idx];
+    }
+
+    unsigned int GassianBlurZoneMap::tileSize() const
+    {
+        return m_tile_size;
+    }
+
+    unsigned int GassianBlurZoneMap::tilesX() const
+    {
+        return m_tiles_x;
+    }
+
+    unsigned int GassianBlurZoneMap::tilesY() const
+    {
+        return m_tiles_y;
+    }
+
+    const ZoneTileStats &GassianBlurZoneMap::tileStats(unsigned int tile_x, unsigned int tile_y) const
+    {
+        return m_tiles[tile_y * m_tiles_x + tile_x];
+    }
+
+    unsigned char GassianBlurZoneMap::minValue() const
+    {
+        return m_min;
+    }
+
+    unsigned char GassianBlurZoneMap::maxValue() const
+    {
+        return m_max;
+    }
+
+    // the shader only ever reads .x of the zone image
+    void GassianBlurZoneMap::extractLevel0(const unsigned char *data, unsigned int w, unsigned int h, unsigned int c)
+    {
+        m_levels.resize(1);
+        ZoneMapLevel &level0 = m_levels[0];
+        level0.width = w;
+        level0.height = h;
+        level0.data.resize((size_t)w * h);
+        if (c == 1)
+        {
+            memcpy(level0.data.data(), data, level0.data.size());
+            return;
+        }
+        for (size_t i = 0; i < level0.data.size(); i++)
+        {
+            level0.data[i] = data[i * c];
+        }
+    }
+
+    // a texel of level n covers every level 0 texel under it, its value is an
+    // upper bound of the radius anywhere in that footprint
+    void GassianBlurZoneMap::buildMaxChain()
+    {
+        while (m_levels.back().width > 1 || m_levels.back().height > 1)
+        {
+            const ZoneMapLevel &src = m_levels.back();
+            ZoneMapLevel dst;
+            dst.width = (src.width + 1) / 2;
+            dst.height = (src.height + 1) / 2;
+            dst.data.resize((size_t)dst.width * dst.height);
+            for (unsigned int y = 0; y < dst.height; y++)
+            {
+                unsigned int y0 = 2 * y;
+                unsigned int y1 = std::min(y0 + 1, src.height - 1);
+                for (unsigned int x = 0; x < dst.width; x++)
+                {
+                    unsigned int x0 = 2 * x;
+                    unsigned int x1 = std::min(x0 + 1, src.width - 1);
+                    unsigned char v = std::max(
+                        std::max(src.data[(size_t)y0 * src.width + x0], src.data[(size_t)y0 * src.width + x1]),
+                        std::max(src.data[(size_t)y1 * src.width + x0], src.data[(size_t)y1 * src.width + x1]));
+                    dst.data[(size_t)y * dst.width + x] = v;
+                }
+            }
+            m_levels.push_back(std::move(dst));
+        }
+    }
+
+    void GassianBlurZoneMap::buildTileStats()
+    {
+        const ZoneMapLevel &level0 = m_levels[0];
+        m_tiles_x = (level0.width + m_tile_size - 1) / m_tile_size;
+        m_tiles_y = (level0.height + m_tile_size - 1) / m_tile_size;
+        m_tiles.assign((size_t)m_tiles_x * m_tiles_y, ZoneTileStats());
+        for (size_t i = 0; i < m_tiles.size(); i++)
+        {
+            m_tiles[i].min = 255;
+            m_tiles[i].max = 0;
+        }
+
+        for (unsigned int y = 0; y < level0.height; y++)
+        {
+            const unsigned char *row = &level0.data[(size_t)y * level0.width];
+            ZoneTileStats *tile_row = &m_tiles[(size_t)(y / m_tile_size) * m_tiles_x];
+            for (unsigned int x = 0; x < level0.width; x++)
+            {
+                ZoneTileStats &tile = tile_row[x / m_tile_size];
+                unsigned char v = row[x];
+                tile.min = std::min(tile.min, v);
+                tile.max = std::max(tile.max, v);
+                tile.histogram[v >> 4]++;
+            }
+        }
+
+        m_min = 255;
+        m_max = 0;
+        for (size_t i = 0; i < m_tiles.size(); i++)
+        {
+            m_min = std::min(m_min, m_tiles[i].min);
+            m_max = std::max(m_max, m_tiles[i].max);
+        }
+    }
+}
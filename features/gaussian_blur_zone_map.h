@@ -0,0 +1,92 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 23:20:14
+ * @LastEditTime: 2026-10-20 00:05:51
+ * @LastEditors: Matt.SHI
+ * @Description: filter zone preprocessing, single channel map, max mip chain
+ *               and per tile statistics, rebuilt only when the zones change
+ * @FilePath: /opengl_demo/features/gaussian_blur_zone_map.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _ESSILOR_GAUSSIAN_BLUR_ZONE_MAP_H_
+#define _ESSILOR_GAUSSIAN_BLUR_ZONE_MAP_H_
+
+#include <vector>
+
+namespace ESSILOR
+{
+    constexpr int GAUSSIAN_BLUR_ZONE_HISTOGRAM_BINS = 16;
+
+    struct ZoneTileStats
+    {
+        unsigned char min;
+        unsigned char max;
+        // zone value >> 4
+        unsigned short histogram[GAUSSIAN_BLUR_ZONE_HISTOGRAM_BINS];
+    };
+
+    struct ZoneMapLevel
+    {
+        unsigned int width;
+        unsigned int height;
+        std::vector<unsigned char> data;
+    };
+
+    class GassianBlurZoneMap
+    {
+        public:
+            GassianBlurZoneMap();
+            virtual ~GassianBlurZoneMap();
+
+        public:
+            // pixels per tile side 1..255, the next update() rebuilds the statistics
+            void set_tile_size(unsigned int tile_size);
+            // the zone image was changed in place, the next update() rebuilds
+            void invalidate();
+
+            // rebuilds everything when the image pointer, its size or channel
+            // count differ from the last call or after invalidate().
+            // returns true when it rebuilt
+            bool update(const unsigned char *filter_zone_image_data,
+                unsigned int filter_zone_image_width,
+                unsigned int filter_zone_image_height,
+                unsigned int filter_zone_image_channel);
+
+            bool empty() const;
+            // level 0 is the first channel of the zone image, every next level
+            // halves the size (rounding up) keeping the largest value. the
+            // sizes are not those of gl mip levels, the chain is cpu only
+            unsigned int levelCount() const;
+            const ZoneMapLevel &level(unsigned int idx) const;
+
+            unsigned int tileSize() const;
+            unsigned int tilesX() const;
+            unsigned int tilesY() const;
+            const ZoneTileStats &tileStats(unsigned int tile_x, unsigned int tile_y) const;
+            unsigned char minValue() const;
+            unsigned char maxValue() const;
+
+        protected:
+            void extractLevel0(const unsigned char *data, unsigned int w, unsigned int h, unsigned int c);
+            void buildMaxChain();
+            void buildTileStats();
+
+        private:
+            const unsigned char *m_source;
+            unsigned int m_source_w;
+            unsigned int m_source_h;
+            unsigned int m_source_c;
+            bool m_dirty;
+
+            std::vector<ZoneMapLevel> m_levels;
+            unsigned int m_tile_size;
+            unsigned int m_tiles_x;
+            unsigned int m_tiles_y;
+            std::vector<ZoneTileStats> m_tiles;
+            unsigned char m_min;
+            unsigned char m_max;
+    };
+}
+
+#endif //_ESSILOR_GAUSSIAN_BLUR_ZONE_MAP_H_
@@ -59,28 +59,15 @@ public:
     // render the mesh
     void Draw(Shader &shader) 
     {
+        // the sampler names only change with the program, look them up once
+        if(samplerProgram != shader.ID || samplerUniforms.size() != textures.size())
+            resolveSamplers(shader);
         // bind appropriate textures
-        unsigned int diffuseNr  = 1;
-        unsigned int specularNr = 1;
-        unsigned int normalNr   = 1;
-        unsigned int heightNr   = 1;
         for(unsigned int i = 0; i < textures.size(); i++)
         {
             glActiveTexture(GL_TEXTURE0 + i); // active proper texture unit before binding
-            // retrieve texture number (the N in diffuse_textureN)
-            string number;
-            string name = textures[i].type;
-            if(name == "texture_diffuse")
-                number = std::to_string(diffuseNr++);
-            else if(name == "texture_specular")
-                number = std::to_string(specularNr++); // transfer unsigned int to string
-            else if(name == "texture_normal")
-                number = std::to_string(normalNr++); // transfer unsigned int to string
-             else if(name == "texture_height")
-                number = std::to_string(heightNr++); // transfer unsigned int to string
-
             // now set the sampler to the correct texture unit
-            glUniform1i(glGetUniformLocation(shader.ID, (name + number).c_str()), i);
+            shader.setInt(samplerUniforms[i], i);
             // and finally bind the texture
             glBindTexture(GL_TEXTURE_2D, textures[i].id);
         }
@@ -97,6 +84,35 @@ public:
 private:
     // render data 
     unsigned int VBO, EBO;
+    // sampler of every texture, for the program they were resolved with
+    vector<UniformHandle> samplerUniforms;
+    unsigned int samplerProgram = 0;
+
+    // texture_diffuseN, texture_specularN... numbered per type in texture order
+    void resolveSamplers(const Shader &shader)
+    {
+        unsigned int diffuseNr  = 1;
+        unsigned int specularNr = 1;
+        unsigned int normalNr   = 1;
+        unsigned int heightNr   = 1;
+        samplerUniforms.clear();
+        for(unsigned int i = 0; i < textures.size(); i++)
+        {
+            // retrieve texture number (the N in diffuse_textureN)
+            string number;
+            string name = textures[i].type;
+            if(name == "texture_diffuse")
+                number = std::to_string(diffuseNr++);
+            else if(name == "texture_specular")
+                number = std::to_string(specularNr++); // transfer unsigned int to string
+            else if(name == "texture_normal")
+                number = std::to_string(normalNr++); // transfer unsigned int to string
+             else if(name == "texture_height")
+                number = std::to_string(heightNr++); // transfer unsigned int to string
+            samplerUniforms.push_back(shader.getUniform(name + number));
+        }
+        samplerProgram = shader.ID;
+    }
 
     // initializes all the buffer objects/arrays
     void setupMesh()
@@ -2,8 +2,11 @@
 #define SHADER_H
 
 #include <glad/glad.h>
+#include <learnopengl/uniform_table.h>
+#include <learnopengl/shader_preprocessor.h>
 #include <glm/glm.hpp>
 
+#include <map>
 #include <string>
 #include <fstream>
 #include <sstream>
@@ -15,35 +18,18 @@ public:
     unsigned int ID;
     // constructor generates the shader on the fly
     // ------------------------------------------------------------------------
-    Shader(const char* vertexPath, const char* fragmentPath)
+    Shader(const char* vertexPath, const char* fragmentPath, const ShaderDefines &defines = ShaderDefines())
     {
-        // 1. retrieve the vertex/fragment source code from filePath
+        // 1. retrieve the vertex/fragment source code from filePath, includes
+        // expanded and defines injected after #version
         std::string vertexCode;
         std::string fragmentCode;
-        std::ifstream vShaderFile;
-        std::ifstream fShaderFile;
-        // ensure ifstream objects can throw exceptions:
-        vShaderFile.exceptions (std::ifstream::failbit | std::ifstream::badbit);
-        fShaderFile.exceptions (std::ifstream::failbit | std::ifstream::badbit);
-        try 
+        std::string error;
+        ShaderPreprocessor &preprocessor = ShaderPreprocessor::shared();
+        if (!preprocessor.load(vertexPath, defines, vertexCode, error) ||
+            !preprocessor.load(fragmentPath, defines, fragmentCode, error))
         {
-            // open files
-            vShaderFile.open(vertexPath);
-            fShaderFile.open(fragmentPath);
-            std::stringstream vShaderStream, fShaderStream;
-            // read file's buffer contents into streams
-            vShaderStream << vShaderFile.rdbuf();
-            fShaderStream << fShaderFile.rdbuf();		
-            // close file handlers
-            vShaderFile.close();
-            fShaderFile.close();
-            // convert stream into string
-            vertexCode = vShaderStream.str();
-            fragmentCode = fShaderStream.str();			
-        }
-        catch (std::ifstream::failure& e)
-        {
-            std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ: " << e.what() << std::endl;
+            std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ: " << error << std::endl;
         }
         const char* vShaderCode = vertexCode.c_str();
         const char * fShaderCode = fragmentCode.c_str();
@@ -65,11 +51,22 @@ public:
         glAttachShader(ID, fragment);
         glLinkProgram(ID);
         checkCompileErrors(ID, "PROGRAM");
+        // every active uniform once, the setters below only look them up
+        uniforms.build(ID);
         // delete the shaders as they're linked into our program now and no longer necessery
         glDeleteShader(vertex);
         glDeleteShader(fragment);
 
     }
+    // take over a program linked elsewhere, e.g. by a shader hot reload. the
+    // old program is deleted and every handle from getUniform() is stale
+    // ------------------------------------------------------------------------
+    void adopt(unsigned int program)
+    {
+        glDeleteProgram(ID);
+        ID = program;
+        uniforms.build(ID);
+    }
     // activate the shader
     // ------------------------------------------------------------------------
     void use() const
@@ -80,62 +77,138 @@ public:
     // ------------------------------------------------------------------------
     void setBool(const std::string &name, bool value) const
     {         
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value); 
+        glUniform1i(uniforms.location(name), (int)value); 
     }
     // ------------------------------------------------------------------------
     void setInt(const std::string &name, int value) const
     { 
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), value); 
+        glUniform1i(uniforms.location(name), value); 
     }
     // ------------------------------------------------------------------------
     void setFloat(const std::string &name, float value) const
     { 
-        glUniform1f(glGetUniformLocation(ID, name.c_str()), value); 
+        glUniform1f(uniforms.location(name), value); 
     }
     // ------------------------------------------------------------------------
     void setVec2(const std::string &name, const glm::vec2 &value) const
     { 
-        glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]); 
+        glUniform2fv(uniforms.location(name), 1, &value[0]); 
     }
     void setVec2(const std::string &name, float x, float y) const
     { 
-        glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y); 
+        glUniform2f(uniforms.location(name), x, y); 
     }
     // ------------------------------------------------------------------------
     void setVec3(const std::string &name, const glm::vec3 &value) const
     { 
-        glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]); 
+        glUniform3fv(uniforms.location(name), 1, &value[0]); 
     }
     void setVec3(const std::string &name, float x, float y, float z) const
     { 
-        glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z); 
+        glUniform3f(uniforms.location(name), x, y, z); 
     }
     // ------------------------------------------------------------------------
     void setVec4(const std::string &name, const glm::vec4 &value) const
     { 
-        glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]); 
+        glUniform4fv(uniforms.location(name), 1, &value[0]); 
     }
     void setVec4(const std::string &name, float x, float y, float z, float w) const
     { 
-        glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w); 
+        glUniform4f(uniforms.location(name), x, y, z, w); 
     }
     // ------------------------------------------------------------------------
     void setMat2(const std::string &name, const glm::mat2 &mat) const
     {
-        glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        glUniformMatrix2fv(uniforms.location(name), 1, GL_FALSE, &mat[0][0]);
     }
     // ------------------------------------------------------------------------
     void setMat3(const std::string &name, const glm::mat3 &mat) const
     {
-        glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        glUniformMatrix3fv(uniforms.location(name), 1, GL_FALSE, &mat[0][0]);
     }
     // ------------------------------------------------------------------------
     void setMat4(const std::string &name, const glm::mat4 &mat) const
     {
-        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        glUniformMatrix4fv(uniforms.location(name), 1, GL_FALSE, &mat[0][0]);
+    }
+
+    // resolve a uniform once and set it through the handle every frame, no
+    // string is built or hashed then
+    // ------------------------------------------------------------------------
+    UniformHandle getUniform(const std::string &name) const
+    {
+        return uniforms.handle(name);
+    }
+    // ------------------------------------------------------------------------
+    void setBool(UniformHandle uniform, bool value) const
+    {
+        glUniform1i(uniform.location, (int)value);
+    }
+    // ------------------------------------------------------------------------
+    void setInt(UniformHandle uniform, int value) const
+    {
+        glUniform1i(uniform.location, value);
+    }
+    // ------------------------------------------------------------------------
+    void setFloat(UniformHandle uniform, float value) const
+    {
+        glUniform1f(uniform.location, value);
+    }
+    // ------------------------------------------------------------------------
+    void setVec2(UniformHandle uniform, const glm::vec2 &value) const
+    {
+        glUniform2fv(uniform.location, 1, &value[0]);
+    }
+    // ------------------------------------------------------------------------
+    void setVec2(UniformHandle uniform, float x, float y) const
+    {
+        glUniform2f(uniform.location, x, y);
+    }
+    // ------------------------------------------------------------------------
+    void setVec3(UniformHandle uniform, const glm::vec3 &value) const
+    {
+        glUniform3fv(uniform.location, 1, &value[0]);
+    }
+    // ------------------------------------------------------------------------
+    void setVec3(UniformHandle uniform, float x, float y, float z) const
+    {
+        glUniform3f(uniform.location, x, y, z);
+    }
+    // ------------------------------------------------------------------------
+    void setVec4(UniformHandle uniform, const glm::vec4 &value) const
+    {
+        glUniform4fv(uniform.location, 1, &value[0]);
+    }
+    // ------------------------------------------------------------------------
+    void setVec4(UniformHandle uniform, float x, float y, float z, float w) const
+    {
+        glUniform4f(uniform.location, x, y, z, w);
+    }
+    // count vec4 elements of an array uniform, 4 * count floats
+    // ------------------------------------------------------------------------
+    void setVec4Array(UniformHandle uniform, int count, const float *values) const
+    {
+        glUniform4fv(uniform.location, count, values);
+    }
+    // ------------------------------------------------------------------------
+    void setMat2(UniformHandle uniform, const glm::mat2 &mat) const
+    {
+        glUniformMatrix2fv(uniform.location, 1, GL_FALSE, &mat[0][0]);
+    }
+    // ------------------------------------------------------------------------
+    void setMat3(UniformHandle uniform, const glm::mat3 &mat) const
+    {
+        glUniformMatrix3fv(uniform.location, 1, GL_FALSE, &mat[0][0]);
+    }
+    // ------------------------------------------------------------------------
+    void setMat4(UniformHandle uniform, const glm::mat4 &mat) const
+    {
+        glUniformMatrix4fv(uniform.location, 1, GL_FALSE, &mat[0][0]);
     }
 
 private:
+    UniformTable uniforms;
+
     // utility function for checking shader compilation/linking errors.
     // ------------------------------------------------------------------------
     void checkCompileErrors(GLuint shader, std::string type)
@@ -162,4 +235,46 @@ private:
         }
     }
 };
+
+// programs keyed by their sources and define set, each compiled once. the
+// sources are read and expanded once for all variants
+class ShaderVariantCache
+{
+public:
+    ~ShaderVariantCache()
+    {
+        clear();
+    }
+    // the cache keeps the shader, nullptr never comes back
+    // ------------------------------------------------------------------------
+    Shader *get(const std::string &vertexPath, const std::string &fragmentPath, const ShaderDefines &defines = ShaderDefines())
+    {
+        std::string key = vertexPath + "|" + fragmentPath + "|" + ShaderPreprocessor::key(defines);
+        std::map<std::string, Shader*>::iterator it = variants.find(key);
+        if (it != variants.end())
+            return it->second;
+        Shader *shader = new Shader(vertexPath.c_str(), fragmentPath.c_str(), defines);
+        variants[key] = shader;
+        return shader;
+    }
+    // ------------------------------------------------------------------------
+    size_t size() const
+    {
+        return variants.size();
+    }
+    // deletes every program, the context has to be current
+    // ------------------------------------------------------------------------
+    void clear()
+    {
+        for (std::map<std::string, Shader*>::iterator it = variants.begin(); it != variants.end(); ++it)
+        {
+            glDeleteProgram(it->second->ID);
+            delete it->second;
+        }
+        variants.clear();
+    }
+
+private:
+    std::map<std::string, Shader*> variants;
+};
 #endif
@@ -0,0 +1,188 @@
+#ifndef SHADER_PREPROCESSOR_H
+#define SHADER_PREPROCESSOR_H
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// NAME, VALUE pairs injected as #define NAME VALUE right after #version
+typedef std::vector<std::pair<std::string, std::string>> ShaderDefines;
+
+// expands #include "file" (relative to the including file, each file once) and
+// injects define sets. a file is read and expanded once, every variant of it
+// reuses that text and only gets its own define block. the driver's log names
+// files by number, the table is a comment under #version
+class ShaderPreprocessor
+{
+public:
+    // the instance Shader loads through
+    // ------------------------------------------------------------------------
+    static ShaderPreprocessor &shared()
+    {
+        static ShaderPreprocessor preprocessor;
+        return preprocessor;
+    }
+    // the final source of path with defines, false with error set if path or
+    // one of its includes cannot be read. dependencies gets path and every
+    // file it includes
+    // ------------------------------------------------------------------------
+    bool load(const std::string &path, const ShaderDefines &defines, std::string &source,
+              std::string &error, std::vector<std::string> *dependencies = nullptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::map<std::string, Expanded>::iterator it = expanded.find(path);
+        if (it == expanded.end())
+        {
+            it = expanded.insert(std::make_pair(path, expand(path))).first;
+        }
+        const Expanded &file = it->second;
+        if (dependencies)
+            *dependencies = file.files;
+        if (!file.error.empty())
+        {
+            error = file.error;
+            return false;
+        }
+        source = file.header;
+        for (size_t i = 0; i < defines.size(); i++)
+            source += "#define " + defines[i].first + " " + defines[i].second + "\n";
+        source += file.body;
+        return true;
+    }
+    // files changed on disk are read again by the next load()
+    // ------------------------------------------------------------------------
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        expanded.clear();
+    }
+    // canonical text of a define set, the same for any order of the pairs
+    // ------------------------------------------------------------------------
+    static std::string key(const ShaderDefines &defines)
+    {
+        ShaderDefines sorted = defines;
+        std::sort(sorted.begin(), sorted.end());
+        std::string text;
+        for (size_t i = 0; i < sorted.size(); i++)
+            text += sorted[i].first + "=" + sorted[i].second + ";";
+        return text;
+    }
+
+private:
+    struct Expanded
+    {
+        std::string header;                 // #version and the file table
+        std::string body;                   // everything after #version, includes expanded
+        std::vector<std::string> files;     // index = source string number in #line
+        std::string error;
+    };
+    std::mutex mutex;
+    std::map<std::string, Expanded> expanded;
+
+    static std::string directoryOf(const std::string &path)
+    {
+        size_t end = path.find_last_of("/\\");
+        return (end == std::string::npos) ? std::string() : path.substr(0, end + 1);
+    }
+
+    static bool readLines(const std::string &path, std::vector<std::string> &lines)
+    {
+        std::ifstream file(path);
+        if (!file)
+            return false;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            lines.push_back(line);
+        }
+        return true;
+    }
+
+    // "file" of an #include line, empty for any other line
+    static std::string includeOf(const std::string &line)
+    {
+        size_t start = line.find_first_not_of(" \t");
+        if (start == std::string::npos || line.compare(start, 8, "#include") != 0)
+            return "";
+        size_t open = line.find('"', start + 8);
+        size_t close = (open == std::string::npos) ? open : line.find('"', open + 1);
+        if (close == std::string::npos)
+            return "";
+        return line.substr(open + 1, close - open - 1);
+    }
+
+    // since glsl 3.30 #line N numbers the line after it N
+    static std::string lineDirective(size_t nextLine, size_t file)
+    {
+        return "#line " + std::to_string(nextLine) + " " + std::to_string(file) + "\n";
+    }
+
+    Expanded expand(const std::string &path)
+    {
+        Expanded result;
+        std::vector<std::string> lines;
+        result.files.push_back(path);
+        if (!readLines(path, lines))
+        {
+            result.error = "cannot read " + path;
+            return result;
+        }
+
+        // defines have to follow #version, which has to come first
+        size_t first = 0;
+        for (size_t i = 0; i < lines.size(); i++)
+        {
+            if (lines[i].compare(0, 8, "#version") == 0)
+            {
+                result.header = lines[i] + "\n";
+                first = i + 1;
+                break;
+            }
+        }
+        result.body = lineDirective(first + 1, 0);
+        appendLines(lines, first, 0, result);
+        for (size_t i = 0; i < result.files.size(); i++)
+            result.header += "// source " + std::to_string(i) + ": " + result.files[i] + "\n";
+        return result;
+    }
+
+    void appendLines(const std::vector<std::string> &lines, size_t first, size_t fileIndex, Expanded &result)
+    {
+        std::string dir = directoryOf(result.files[fileIndex]);
+        for (size_t i = first; i < lines.size() && result.error.empty(); i++)
+        {
+            std::string name = includeOf(lines[i]);
+            if (name.empty())
+            {
+                result.body += lines[i] + "\n";
+                continue;
+            }
+            std::string included = dir + name;
+            // each file once, which also ends include cycles
+            if (std::find(result.files.begin(), result.files.end(), included) != result.files.end())
+            {
+                result.body += "\n";
+                continue;
+            }
+            std::vector<std::string> includedLines;
+            result.files.push_back(included);
+            if (!readLines(included, includedLines))
+            {
+                result.error = "cannot read " + included + ", included by " + result.files[fileIndex];
+                return;
+            }
+            size_t includedIndex = result.files.size() - 1;
+            result.body += lineDirective(1, includedIndex);
+            appendLines(includedLines, 0, includedIndex, result);
+            result.body += lineDirective(i + 2, fileIndex);
+        }
+    }
+};
+#endif
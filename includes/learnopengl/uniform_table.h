@@ -0,0 +1,153 @@
+#ifndef UNIFORM_TABLE_H
+#define UNIFORM_TABLE_H
+
+#include <glad/glad.h>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// location of one uniform, resolved once. setting through a handle costs no
+// string building, hashing or glGetUniformLocation
+struct UniformHandle
+{
+    GLint location;
+
+    UniformHandle() : location(-1) {}
+    explicit UniformHandle(GLint location) : location(location) {}
+    // false for names the linker dropped, setting them is a silent no-op like
+    // a location of -1 always was
+    bool valid() const { return location >= 0; }
+};
+
+// every active uniform of a linked program, read once after the link and kept
+// in a flat open addressing table. arrays are found by their base name, by
+// "name[0]" and by each "name[i]"
+class UniformTable
+{
+public:
+    // introspect the program, call again after it was relinked
+    // ------------------------------------------------------------------------
+    void build(GLuint program)
+    {
+        entries.clear();
+        GLint count = 0;
+        GLint maxLength = 0;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+        std::vector<GLchar> buffer(maxLength > 0 ? maxLength : 1);
+        for (GLint i = 0; i < count; i++)
+        {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(program, (GLuint)i, (GLsizei)buffer.size(), &length, &size, &type, buffer.data());
+            std::string name(buffer.data(), length);
+            // members of uniform blocks have no location
+            GLint location = glGetUniformLocation(program, name.c_str());
+            if (location < 0)
+                continue;
+            add(name, location, type);
+
+            // only the first element of an array is reported, as "name[0]"
+            if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+            {
+                std::string base = name.substr(0, name.size() - 3);
+                add(base, location, type);
+                for (GLint e = 1; e < size; e++)
+                {
+                    std::string element = base + "[" + std::to_string(e) + "]";
+                    add(element, glGetUniformLocation(program, element.c_str()), type);
+                }
+            }
+        }
+        rehash();
+    }
+    // -1 for names that are not active, the same as glGetUniformLocation
+    // ------------------------------------------------------------------------
+    GLint location(const std::string &name) const
+    {
+        const Entry *entry = find(name);
+        return entry ? entry->location : -1;
+    }
+    // ------------------------------------------------------------------------
+    UniformHandle handle(const std::string &name) const
+    {
+        return UniformHandle(location(name));
+    }
+    // GL_FLOAT_VEC2, GL_SAMPLER_2D... or 0 for names that are not active
+    // ------------------------------------------------------------------------
+    GLenum type(const std::string &name) const
+    {
+        const Entry *entry = find(name);
+        return entry ? entry->type : 0;
+    }
+    // ------------------------------------------------------------------------
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+private:
+    struct Entry
+    {
+        uint32_t hash;
+        std::string name;
+        GLint location;
+        GLenum type;
+    };
+    std::vector<Entry> entries;
+    // indices into entries plus one, 0 is an empty slot. twice the entries
+    // rounded up to a power of two, so probes stay short
+    std::vector<uint32_t> slots;
+
+    // FNV-1a
+    static uint32_t hashName(const char *name, size_t length)
+    {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < length; i++)
+        {
+            hash ^= (unsigned char)name[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    void add(const std::string &name, GLint location, GLenum type)
+    {
+        if (location < 0)
+            return;
+        entries.push_back(Entry{hashName(name.data(), name.size()), name, location, type});
+    }
+
+    void rehash()
+    {
+        size_t capacity = 16;
+        while (capacity < entries.size() * 2)
+            capacity *= 2;
+        slots.assign(capacity, 0);
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            size_t slot = entries[i].hash & (capacity - 1);
+            while (slots[slot] != 0)
+                slot = (slot + 1) & (capacity - 1);
+            slots[slot] = (uint32_t)(i + 1);
+        }
+    }
+
+    const Entry *find(const std::string &name) const
+    {
+        if (slots.empty())
+            return nullptr;
+        uint32_t hash = hashName(name.data(), name.size());
+        size_t mask = slots.size() - 1;
+        for (size_t slot = hash & mask; slots[slot] != 0; slot = (slot + 1) & mask)
+        {
+            const Entry &entry = entries[slots[slot] - 1];
+            if (entry.hash == hash && entry.name == name)
+                return &entry;
+        }
+        return nullptr;
+    }
+};
+#endif
@@ -1,212 +1,198 @@
 #version 330 core
 
-const float kernel1[1]=float[](1.0);
-const float kernel3[9]=float[](0.0625,0.125,0.0625,0.125,0.25,0.125,0.0625,0.125,0.0625);
-const float kernel5[25]=float[](0.00390625,0.015625,0.0234375,0.015625,0.00390625,0.015625,0.0625,0.09375,0.0625,0.015625,0.0234375,0.09375,0.140625,0.09375,0.0234375,0.015625,0.0625,0.09375,0.0625,0.015625,0.00390625,0.015625,0.0234375,0.015625,0.00390625);
-const float kernel7[49]=float[](0.0009765625,0.00341796875,0.0068359375,0.0087890625,0.0068359375,0.00341796875,0.0009765625,0.00341796875,0.011962890625,0.02392578125,0.03076171875,0.02392578125,0.011962890625,0.00341796875,0.0068359375,0.02392578125,0.0478515625,0.0615234375,0.0478515625,0.02392578125,0.0068359375,0.0087890625,0.03076171875,0.0615234375,0.0791015625,0.0615234375,0.03076171875,0.0087890625,0.0068359375,0.02392578125,0.0478515625,0.0615234375,0.0478515625,0.02392578125,0.0068359375,0.00341796875,0.011962890625,0.02392578125,0.03076171875,0.02392578125,0.011962890625,0.00341796875,0.0009765625,0.00341796875,0.0068359375,0.0087890625,0.0068359375,0.00341796875,0.0009765625);
-const float kernel9[81]=float[](0.000244140625,0.00079345703125,0.0018310546875,0.00311279296875,0.003662109375,0.00311279296875,0.0018310546875,0.00079345703125,0.000244140625,0.00079345703125,0.0025787353515625,0.005950927734375,0.0101165771484375,0.01190185546875,0.0101165771484375,0.005950927734375,0.0025787353515625,0.00079345703125,0.0018310546875,0.005950927734375,0.01373291015625,0.023345947265625,0.0274658203125,0.023345947265625,0.01373291015625,0.005950927734375,0.0018310546875,0.00311279296875,0.0101165771484375,0.023345947265625,0.0396881103515625,0.04669189453125,0.0396881103515625,0.023345947265625,0.0101165771484375,0.00311279296875,0.003662109375,0.01190185546875,0.0274658203125,0.04669189453125,0.054931640625,0.04669189453125,0.0274658203125,0.01190185546875,0.003662109375,0.00311279296875,0.0101165771484375,0.023345947265625,0.0396881103515625,0.04669189453125,0.0396881103515625,0.023345947265625,0.0101165771484375,0.00311279296875,0.0018310546875,0.005950927734375,0.01373291015625,0.023345947265625,0.0274658203125,0.023345947265625,0.01373291015625,0.005950927734375,0.0018310546875,0.00079345703125,0.0025787353515625,0.005950927734375,0.0101165771484375,0.01190185546875,0.0101165771484375,0.005950927734375,0.0025787353515625,0.00079345703125,0.000244140625,0.00079345703125,0.0018310546875,0.00311279296875,0.003662109375,0.00311279296875,0.0018310546875,0.00079345703125,0.000244140625);
-const float kernel11[121]=float[](7.765538510469285e-05,0.00023919542560869313,0.0005737999969226389,0.0010719995246253416,0.001559750104804665,0.0017674284184302266,0.001559750104804665,0.0010719995246253416,0.0005737999969226389,0.00023919542560869313,7.765538510469285e-05,0.00023919542560869313,0.0007367737801440158,0.0017674284184302262,0.003301990997783096,0.004804368552920993,0.00544406279370533,0.004804368552920993,0.003301990997783096,0.0017674284184302262,0.0007367737801440158,0.00023919542560869313,0.0005737999969226389,0.0017674284184302262,0.004239840366827612,0.007921064625483636,0.011525081024714627,0.013059627734625216,0.011525081024714627,0.007921064625483636,0.004239840366827612,0.0017674284184302262,0.0005737999969226389,0.0010719995246253416,0.003301990997783096,0.007921064625483636,0.014798496965119184,0.021531686033501918,0.02439859672078329,0.021531686033501918,0.014798496965119184,0.007921064625483636,0.003301990997783096,0.0010719995246253416,0.001559750104804665,0.004804368552920993,0.011525081024714627,0.021531686033501918,0.031328418320999925,0.035499748757471486,0.031328418320999925,0.021531686033501918,0.011525081024714627,0.004804368552920993,0.001559750104804665,0.0017674284184302266,0.00544406279370533,0.013059627734625216,0.02439859672078329,0.035499748757471486,0.0402264853887898,0.035499748757471486,0.02439859672078329,0.013059627734625216,0.00544406279370533,0.0017674284184302266,0.001559750104804665,0.004804368552920993,0.011525081024714627,0.021531686033501918,0.031328418320999925,0.035499748757471486,0.031328418320999925,0.021531686033501918,0.011525081024714627,0.004804368552920993,0.001559750104804665,0.0010719995246253416,0.003301990997783096,0.007921064625483636,0.014798496965119184,0.021531686033501918,0.02439859672078329,0.021531686033501918,0.014798496965119184,0.007921064625483636,0.003301990997783096,0.0010719995246253416,0.0005737999969226389,0.0017674284184302262,0.004239840366827612,0.007921064625483636,0.011525081024714627,0.013059627734625216,0.011525081024714627,0.007921064625483636,0.004239840366827612,0.0017674284184302262,0.0005737999969226389,0.00023919542560869313,0.0007367737801440158,0.0017674284184302262,0.003301990997783096,0.004804368552920993,0.00544406279370533,0.004804368552920993,0.003301990997783096,0.0017674284184302262,0.0007367737801440158,0.00023919542560869313,7.765538510469285e-05,0.00023919542560869313,0.0005737999969226389,0.0010719995246253416,0.001559750104804665,0.0017674284184302266,0.001559750104804665,0.0010719995246253416,0.0005737999969226389,0.00023919542560869313,7.765538510469285e-05);
-const float kernel13[169]=float[](3.362698259707207e-05,9.510926044818354e-05,0.00022266935684181856,0.0004315199205631113,0.0006922197530148502,0.0009191573648779693,0.0010102724248241778,0.0009191573648779693,0.0006922197530148502,0.0004315199205631113,0.00022266935684181856,9.510926044818354e-05,3.362698259707207e-05,9.510926044818354e-05,0.0002690033635009534,0.0006297894196294027,0.0012204942978437188,0.0019578476476982245,0.0025997092351859315,0.002857415556059644,0.0025997092351859315,0.0019578476476982245,0.0012204942978437188,0.0006297894196294027,0.0002690033635009534,9.510926044818354e-05,0.00022266935684181856,0.0006297894196294027,0.0014744600510384852,0.0028574155560596435,0.0045837037787160835,0.006086427132823354,0.006689767968958695,0.006086427132823354,0.0045837037787160835,0.0028574155560596435,0.0014744600510384852,0.0006297894196294027,0.00022266935684181856,0.0004315199205631113,0.0012204942978437188,0.0028574155560596435,0.00553750076460941,0.008882944283534776,0.011795132433668771,0.012964370955638162,0.011795132433668771,0.008882944283534776,0.00553750076460941,0.0028574155560596435,0.0012204942978437188,0.0004315199205631113,0.0006922197530148502,0.0019578476476982245,0.0045837037787160835,0.008882944283534776,0.014249514807958472,0.01892108167186574,0.020796707714429232,0.01892108167186574,0.014249514807958472,0.008882944283534776,0.0045837037787160835,0.0019578476476982245,0.0006922197530148502,0.0009191573648779693,0.0025997092351859315,0.006086427132823354,0.011795132433668771,0.01892108167186574,0.02512417696028945,0.027614709025100624,0.02512417696028945,0.01892108167186574,0.011795132433668771,0.006086427132823354,0.0025997092351859315,0.0009191573648779693,0.0010102724248241778,0.002857415556059644,0.006689767968958695,0.012964370955638162,0.020796707714429232,0.027614709025100624,0.030352124797810225,0.027614709025100624,0.020796707714429232,0.012964370955638162,0.006689767968958695,0.002857415556059644,0.0010102724248241778,0.0009191573648779693,0.0025997092351859315,0.006086427132823354,0.011795132433668771,0.01892108167186574,0.02512417696028945,0.027614709025100624,0.02512417696028945,0.01892108167186574,0.011795132433668771,0.006086427132823354,0.0025997092351859315,0.0009191573648779693,0.0006922197530148502,0.0019578476476982245,0.0045837037787160835,0.008882944283534776,0.014249514807958472,0.01892108167186574,0.020796707714429232,0.01892108167186574,0.014249514807958472,0.008882944283534776,0.0045837037787160835,0.0019578476476982245,0.0006922197530148502,0.0004315199205631113,0.0012204942978437188,0.0028574155560596435,0.00553750076460941,0.008882944283534776,0.011795132433668771,0.012964370955638162,0.011795132433668771,0.008882944283534776,0.00553750076460941,0.0028574155560596435,0.0012204942978437188,0.0004315199205631113,0.00022266935684181856,0.0006297894196294027,0.0014744600510384852,0.0028574155560596435,0.0045837037787160835,0.006086427132823354,0.006689767968958695,0.006086427132823354,0.0045837037787160835,0.0028574155560596435,0.0014744600510384852,0.0006297894196294027,0.00022266935684181856,9.510926044818354e-05,0.0002690033635009534,0.0006297894196294027,0.0012204942978437188,0.0019578476476982245,0.0025997092351859315,0.002857415556059644,0.0025997092351859315,0.0019578476476982245,0.0012204942978437188,0.0006297894196294027,0.0002690033635009534,9.510926044818354e-05,3.362698259707207e-05,9.510926044818354e-05,0.00022266935684181856,0.0004315199205631113,0.0006922197530148502,0.0009191573648779693,0.0010102724248241778,0.0009191573648779693,0.0006922197530148502,0.0004315199205631113,0.00022266935684181856,9.510926044818354e-05,3.362698259707207e-05);
-const float kernel15[225]=float[](1.686952977874248e-05,4.412592527707509e-05,9.954969352894249e-05,0.00019370520186420676,0.0003250857210419367,0.0004705543133193453,0.0005874580745098346,0.0006325563945537594,0.0005874580745098346,0.0004705543133193453,0.0003250857210419367,0.00019370520186420676,9.954969352894249e-05,4.412592527707509e-05,1.686952977874248e-05,4.412592527707509e-05,0.00011542095761386175,0.0002603938814909453,0.0005066780980470158,0.0008503324291478791,0.0012308371804470423,0.001536624401463768,0.0016545888691448692,0.001536624401463768,0.0012308371804470423,0.0008503324291478791,0.0005066780980470158,0.0002603938814909453,0.00011542095761386175,4.412592527707509e-05,9.954969352894249e-05,0.0002603938814909453,0.0005874580745098347,0.001143084231360311,0.0019183809107198775,0.0027768134793354454,0.0034666805800508877,0.0037328127128326907,0.0034666805800508877,0.0027768134793354454,0.0019183809107198775,0.001143084231360311,0.0005874580745098347,0.0002603938814909453,9.954969352894249e-05,0.00019370520186420676,0.0005066780980470158,0.001143084231360311,0.0022242294670557264,0.00373281271283269,0.005403162947935563,0.0067455161111294685,0.007263359779709557,0.0067455161111294685,0.005403162947935563,0.00373281271283269,0.0022242294670557264,0.001143084231360311,0.0005066780980470158,0.00019370520186420676,0.0003250857210419367,0.0008503324291478791,0.0019183809107198775,0.00373281271283269,0.0062645922803684535,0.009067857269357497,0.011320661229964248,0.012189732275900195,0.011320661229964248,0.009067857269357497,0.0062645922803684535,0.00373281271283269,0.0019183809107198775,0.0008503324291478791,0.0003250857210419367,0.0004705543133193453,0.0012308371804470423,0.0027768134793354454,0.005403162947935563,0.009067857269357497,0.013125520668777419,0.016386404036182106,0.01764436494549365,0.016386404036182106,0.013125520668777419,0.009067857269357497,0.005403162947935563,0.0027768134793354454,0.0012308371804470423,0.0004705543133193453,0.0005874580745098346,0.001536624401463768,0.0034666805800508877,0.0067455161111294685,0.011320661229964248,0.016386404036182106,0.02045741605327235,0.02202790275942921,0.02045741605327235,0.016386404036182106,0.011320661229964248,0.0067455161111294685,0.0034666805800508877,0.001536624401463768,0.0005874580745098346,0.0006325563945537594,0.0016545888691448692,0.0037328127128326907,0.007263359779709557,0.012189732275900195,0.01764436494549365,0.02202790275942921,0.023718953494190304,0.02202790275942921,0.01764436494549365,0.012189732275900195,0.007263359779709557,0.0037328127128326907,0.0016545888691448692,0.0006325563945537594,0.0005874580745098346,0.001536624401463768,0.0034666805800508877,0.0067455161111294685,0.011320661229964248,0.016386404036182106,0.02045741605327235,0.02202790275942921,0.02045741605327235,0.016386404036182106,0.011320661229964248,0.0067455161111294685,0.0034666805800508877,0.001536624401463768,0.0005874580745098346,0.0004705543133193453,0.0012308371804470423,0.0027768134793354454,0.005403162947935563,0.009067857269357497,0.013125520668777419,0.016386404036182106,0.01764436494549365,0.016386404036182106,0.013125520668777419,0.009067857269357497,0.005403162947935563,0.0027768134793354454,0.0012308371804470423,0.0004705543133193453,0.0003250857210419367,0.0008503324291478791,0.0019183809107198775,0.00373281271283269,0.0062645922803684535,0.009067857269357497,0.011320661229964248,0.012189732275900195,0.011320661229964248,0.009067857269357497,0.0062645922803684535,0.00373281271283269,0.0019183809107198775,0.0008503324291478791,0.0003250857210419367,0.00019370520186420676,0.0005066780980470158,0.001143084231360311,0.0022242294670557264,0.00373281271283269,0.005403162947935563,0.0067455161111294685,0.007263359779709557,0.0067455161111294685,0.005403162947935563,0.00373281271283269,0.0022242294670557264,0.001143084231360311,0.0005066780980470158,0.00019370520186420676,9.954969352894249e-05,0.0002603938814909453,0.0005874580745098347,0.001143084231360311,0.0019183809107198775,0.0027768134793354454,0.0034666805800508877,0.0037328127128326907,0.0034666805800508877,0.0027768134793354454,0.0019183809107198775,0.001143084231360311,0.0005874580745098347,0.0002603938814909453,9.954969352894249e-05,4.412592527707509e-05,0.00011542095761386175,0.0002603938814909453,0.0005066780980470158,0.0008503324291478791,0.0012308371804470423,0.001536624401463768,0.0016545888691448692,0.001536624401463768,0.0012308371804470423,0.0008503324291478791,0.0005066780980470158,0.0002603938814909453,0.00011542095761386175,4.412592527707509e-05,1.686952977874248e-05,4.412592527707509e-05,9.954969352894249e-05,0.00019370520186420676,0.0003250857210419367,0.0004705543133193453,0.0005874580745098346,0.0006325563945537594,0.0005874580745098346,0.0004705543133193453,0.0003250857210419367,0.00019370520186420676,9.954969352894249e-05,4.412592527707509e-05,1.686952977874248e-05);
-const float kernel17[289]=float[](9.437407289393551e-06,2.3022609906054684e-05,4.986733552996237e-05,9.590417759836376e-05,0.00016376407612818392,0.000248290158607872,0.00033424131000826937,0.00039950341504937817,0.00042397536222480613,0.00039950341504937817,0.00033424131000826937,0.000248290158607872,0.00016376407612818392,9.590417759836376e-05,4.986733552996237e-05,2.3022609906054684e-05,9.437407289393551e-06,2.3022609906054684e-05,5.6163790608260145e-05,0.00012165165471357336,0.00023395879837565022,0.00039950341504937833,0.0006057052842856391,0.0008153836174324492,0.0009745909017994211,0.0010342903590957755,0.0009745909017994211,0.0008153836174324492,0.0006057052842856391,0.00039950341504937833,0.00023395879837565022,0.00012165165471357336,5.6163790608260145e-05,2.3022609906054684e-05,4.986733552996237e-05,0.00012165165471357336,0.0002634993994221952,0.0005067584407846437,0.0008653306868737703,0.0013119671821308,0.0017661337529523546,0.0021109792374885794,0.0022402892019149426,0.0021109792374885794,0.0017661337529523546,0.0013119671821308,0.0008653306868737703,0.0005067584407846437,0.0002634993994221952,0.00012165165471357336,4.986733552996237e-05,9.590417759836376e-05,0.00023395879837565022,0.0005067584407846437,0.0009745909017994217,0.001664192140873318,0.002523157339390979,0.0033966042762368365,0.004059806395248886,0.00430849355011267,0.004059806395248886,0.0033966042762368365,0.002523157339390979,0.001664192140873318,0.0009745909017994217,0.0005067584407846437,0.00023395879837565022,9.590417759836376e-05,0.00016376407612818392,0.00039950341504937833,0.0008653306868737703,0.001664192140873318,0.0028417415724187726,0.00430849355011267,0.005799974257643333,0.0069324450740983114,0.007357098339274833,0.0069324450740983114,0.005799974257643333,0.00430849355011267,0.0028417415724187726,0.001664192140873318,0.0008653306868737703,0.00039950341504937833,0.00016376407612818392,0.000248290158607872,0.0006057052842856391,0.0013119671821308,0.002523157339390979,0.00430849355011267,0.006532302884798325,0.008793604570666887,0.010510595044305942,0.011154431159385905,0.010510595044305942,0.008793604570666887,0.006532302884798325,0.00430849355011267,0.002523157339390979,0.0013119671821308,0.0006057052842856391,0.000248290158607872,0.00033424131000826937,0.0008153836174324492,0.0017661337529523546,0.0033966042762368365,0.005799974257643333,0.008793604570666887,0.011837706044709977,0.014149070894603958,0.015015785176561564,0.014149070894603958,0.011837706044709977,0.008793604570666887,0.005799974257643333,0.0033966042762368365,0.0017661337529523546,0.0008153836174324492,0.00033424131000826937,0.00039950341504937817,0.0009745909017994211,0.0021109792374885794,0.004059806395248886,0.0069324450740983114,0.010510595044305942,0.014149070894603958,0.016911740030070465,0.01794768413735501,0.016911740030070465,0.014149070894603958,0.010510595044305942,0.0069324450740983114,0.004059806395248886,0.0021109792374885794,0.0009745909017994211,0.00039950341504937817,0.00042397536222480613,0.0010342903590957755,0.0022402892019149426,0.00430849355011267,0.007357098339274833,0.011154431159385905,0.015015785176561564,0.01794768413735501,0.019047085948667015,0.01794768413735501,0.015015785176561564,0.011154431159385905,0.007357098339274833,0.00430849355011267,0.0022402892019149426,0.0010342903590957755,0.00042397536222480613,0.00039950341504937817,0.0009745909017994211,0.0021109792374885794,0.004059806395248886,0.0069324450740983114,0.010510595044305942,0.014149070894603958,0.016911740030070465,0.01794768413735501,0.016911740030070465,0.014149070894603958,0.010510595044305942,0.0069324450740983114,0.004059806395248886,0.0021109792374885794,0.0009745909017994211,0.00039950341504937817,0.00033424131000826937,0.0008153836174324492,0.0017661337529523546,0.0033966042762368365,0.005799974257643333,0.008793604570666887,0.011837706044709977,0.014149070894603958,0.015015785176561564,0.014149070894603958,0.011837706044709977,0.008793604570666887,0.005799974257643333,0.0033966042762368365,0.0017661337529523546,0.0008153836174324492,0.00033424131000826937,0.000248290158607872,0.0006057052842856391,0.0013119671821308,0.002523157339390979,0.00430849355011267,0.006532302884798325,0.008793604570666887,0.010510595044305942,0.011154431159385905,0.010510595044305942,0.008793604570666887,0.006532302884798325,0.00430849355011267,0.002523157339390979,0.0013119671821308,0.0006057052842856391,0.000248290158607872,0.00016376407612818392,0.00039950341504937833,0.0008653306868737703,0.001664192140873318,0.0028417415724187726,0.00430849355011267,0.005799974257643333,0.0069324450740983114,0.007357098339274833,0.0069324450740983114,0.005799974257643333,0.00430849355011267,0.0028417415724187726,0.001664192140873318,0.0008653306868737703,0.00039950341504937833,0.00016376407612818392,9.590417759836376e-05,0.00023395879837565022,0.0005067584407846437,0.0009745909017994217,0.001664192140873318,0.002523157339390979,0.0033966042762368365,0.004059806395248886,0.00430849355011267,0.004059806395248886,0.0033966042762368365,0.002523157339390979,0.001664192140873318,0.0009745909017994217,0.0005067584407846437,0.00023395879837565022,9.590417759836376e-05,4.986733552996237e-05,0.00012165165471357336,0.0002634993994221952,0.0005067584407846437,0.0008653306868737703,0.0013119671821308,0.0017661337529523546,0.0021109792374885794,0.0022402892019149426,0.0021109792374885794,0.0017661337529523546,0.0013119671821308,0.0008653306868737703,0.0005067584407846437,0.0002634993994221952,0.00012165165471357336,4.986733552996237e-05,2.3022609906054684e-05,5.6163790608260145e-05,0.00012165165471357336,0.00023395879837565022,0.00039950341504937833,0.0006057052842856391,0.0008153836174324492,0.0009745909017994211,0.0010342903590957755,0.0009745909017994211,0.0008153836174324492,0.0006057052842856391,0.00039950341504937833,0.00023395879837565022,0.00012165165471357336,5.6163790608260145e-05,2.3022609906054684e-05,9.437407289393551e-06,2.3022609906054684e-05,4.986733552996237e-05,9.590417759836376e-05,0.00016376407612818392,0.000248290158607872,0.00033424131000826937,0.00039950341504937817,0.00042397536222480613,0.00039950341504937817,0.00033424131000826937,0.000248290158607872,0.00016376407612818392,9.590417759836376e-05,4.986733552996237e-05,2.3022609906054684e-05,9.437407289393551e-06);
-const float kernel19[361]=float[](5.736980249827806e-06,1.315775222869524e-05,2.7369602042146295e-05,5.163494169867689e-05,8.835015763883022e-05,0.00013710692666572827,0.00019297448595042066,0.00024633652971084056,0.00028519780239355026,0.00029946906039172126,0.00028519780239355026,0.00024633652971084056,0.00019297448595042066,0.00013710692666572827,8.835015763883022e-05,5.163494169867689e-05,2.7369602042146295e-05,1.315775222869524e-05,5.736980249827806e-06,1.315775222869524e-05,3.017727727351526e-05,6.277212515754454e-05,0.0001184246310129282,0.00020263090213928938,0.00031445445013684477,0.00044258658074893605,0.0005649723167356465,0.0006541005645217887,0.0006868316649534758,0.0006541005645217887,0.0005649723167356465,0.00044258658074893605,0.00031445445013684477,0.00020263090213928938,0.0001184246310129282,6.277212515754454e-05,3.017727727351526e-05,1.315775222869524e-05,2.7369602042146295e-05,6.277212515754454e-05,0.00013057306863971556,0.0002463365297108404,0.0004214950286796357,0.0006541005645217885,0.0009206297833968125,0.001175205856222255,0.0013606026193031492,0.001428686983383444,0.0013606026193031492,0.001175205856222255,0.0009206297833968125,0.0006541005645217885,0.0004214950286796357,0.0002463365297108404,0.00013057306863971556,6.277212515754454e-05,2.7369602042146295e-05,5.163494169867689e-05,0.0001184246310129282,0.0002463365297108404,0.0004647335511231341,0.0007951840585274521,0.0012340129923023766,0.001736841665383315,0.002217119773116774,0.0025668855840359117,0.0026953321783438587,0.0025668855840359117,0.002217119773116774,0.001736841665383315,0.0012340129923023766,0.0007951840585274521,0.0004647335511231341,0.0002463365297108404,0.0001184246310129282,5.163494169867689e-05,8.835015763883022e-05,0.00020263090213928938,0.0004214950286796357,0.0007951840585274521,0.0013606026193031494,0.0021114624866725327,0.002971829344279793,0.0037936109737885856,0.004392079055958822,0.004611858075396908,0.004392079055958822,0.0037936109737885856,0.002971829344279793,0.0021114624866725327,0.0013606026193031494,0.0007951840585274521,0.0004214950286796357,0.00020263090213928938,8.835015763883022e-05,0.00013710692666572827,0.00031445445013684477,0.0006541005645217885,0.0012340129923023766,0.0021114624866725327,0.0032766906144196016,0.004611858075396908,0.0058871467293560836,0.006815884398272596,0.007156950296807221,0.006815884398272596,0.0058871467293560836,0.004611858075396908,0.0032766906144196016,0.0021114624866725327,0.0012340129923023766,0.0006541005645217885,0.00031445445013684477,0.00013710692666572827,0.00019297448595042066,0.00044258658074893605,0.0009206297833968125,0.001736841665383315,0.002971829344279793,0.004611858075396908,0.006491072063381571,0.008286008164868056,0.009593182635191554,0.010073224147648484,0.009593182635191554,0.008286008164868056,0.006491072063381571,0.004611858075396908,0.002971829344279793,0.001736841665383315,0.0009206297833968125,0.00044258658074893605,0.00019297448595042066,0.00024633652971084056,0.0005649723167356465,0.001175205856222255,0.002217119773116774,0.0037936109737885856,0.0058871467293560836,0.008286008164868056,0.010577286870004683,0.01224592623007442,0.012858710659650073,0.01224592623007442,0.010577286870004683,0.008286008164868056,0.0058871467293560836,0.0037936109737885856,0.002217119773116774,0.001175205856222255,0.0005649723167356465,0.00024633652971084056,0.00028519780239355026,0.0006541005645217887,0.0013606026193031492,0.0025668855840359117,0.004392079055958822,0.006815884398272596,0.009593182635191554,0.01224592623007442,0.014177804863900634,0.014887260229132527,0.014177804863900634,0.01224592623007442,0.009593182635191554,0.006815884398272596,0.004392079055958822,0.0025668855840359117,0.0013606026193031492,0.0006541005645217887,0.00028519780239355026,0.00029946906039172126,0.0006868316649534758,0.001428686983383444,0.0026953321783438587,0.004611858075396908,0.007156950296807221,0.010073224147648484,0.012858710659650073,0.014887260229132527,0.015632216641253412,0.014887260229132527,0.012858710659650073,0.010073224147648484,0.007156950296807221,0.004611858075396908,0.0026953321783438587,0.001428686983383444,0.0006868316649534758,0.00029946906039172126,0.00028519780239355026,0.0006541005645217887,0.0013606026193031492,0.0025668855840359117,0.004392079055958822,0.006815884398272596,0.009593182635191554,0.01224592623007442,0.014177804863900634,0.014887260229132527,0.014177804863900634,0.01224592623007442,0.009593182635191554,0.006815884398272596,0.004392079055958822,0.0025668855840359117,0.0013606026193031492,0.0006541005645217887,0.00028519780239355026,0.00024633652971084056,0.0005649723167356465,0.001175205856222255,0.002217119773116774,0.0037936109737885856,0.0058871467293560836,0.008286008164868056,0.010577286870004683,0.01224592623007442,0.012858710659650073,0.01224592623007442,0.010577286870004683,0.008286008164868056,0.0058871467293560836,0.0037936109737885856,0.002217119773116774,0.001175205856222255,0.0005649723167356465,0.00024633652971084056,0.00019297448595042066,0.00044258658074893605,0.0009206297833968125,0.001736841665383315,0.002971829344279793,0.004611858075396908,0.006491072063381571,0.008286008164868056,0.009593182635191554,0.010073224147648484,0.009593182635191554,0.008286008164868056,0.006491072063381571,0.004611858075396908,0.002971829344279793,0.001736841665383315,0.0009206297833968125,0.00044258658074893605,0.00019297448595042066,0.00013710692666572827,0.00031445445013684477,0.0006541005645217885,0.0012340129923023766,0.0021114624866725327,0.0032766906144196016,0.004611858075396908,0.0058871467293560836,0.006815884398272596,0.007156950296807221,0.006815884398272596,0.0058871467293560836,0.004611858075396908,0.0032766906144196016,0.0021114624866725327,0.0012340129923023766,0.0006541005645217885,0.00031445445013684477,0.00013710692666572827,8.835015763883022e-05,0.00020263090213928938,0.0004214950286796357,0.0007951840585274521,0.0013606026193031494,0.0021114624866725327,0.002971829344279793,0.0037936109737885856,0.004392079055958822,0.004611858075396908,0.004392079055958822,0.0037936109737885856,0.002971829344279793,0.0021114624866725327,0.0013606026193031494,0.0007951840585274521,0.0004214950286796357,0.00020263090213928938,8.835015763883022e-05,5.163494169867689e-05,0.0001184246310129282,0.0002463365297108404,0.0004647335511231341,0.0007951840585274521,0.0012340129923023766,0.001736841665383315,0.002217119773116774,0.0025668855840359117,0.0026953321783438587,0.0025668855840359117,0.002217119773116774,0.001736841665383315,0.0012340129923023766,0.0007951840585274521,0.0004647335511231341,0.0002463365297108404,0.0001184246310129282,5.163494169867689e-05,2.7369602042146295e-05,6.277212515754454e-05,0.00013057306863971556,0.0002463365297108404,0.0004214950286796357,0.0006541005645217885,0.0009206297833968125,0.001175205856222255,0.0013606026193031492,0.001428686983383444,0.0013606026193031492,0.001175205856222255,0.0009206297833968125,0.0006541005645217885,0.0004214950286796357,0.0002463365297108404,0.00013057306863971556,6.277212515754454e-05,2.7369602042146295e-05,1.315775222869524e-05,3.017727727351526e-05,6.277212515754454e-05,0.0001184246310129282,0.00020263090213928938,0.00031445445013684477,0.00044258658074893605,0.0005649723167356465,0.0006541005645217887,0.0006868316649534758,0.0006541005645217887,0.0005649723167356465,0.00044258658074893605,0.00031445445013684477,0.00020263090213928938,0.0001184246310129282,6.277212515754454e-05,3.017727727351526e-05,1.315775222869524e-05,5.736980249827806e-06,1.315775222869524e-05,2.7369602042146295e-05,5.163494169867689e-05,8.835015763883022e-05,0.00013710692666572827,0.00019297448595042066,0.00024633652971084056,0.00028519780239355026,0.00029946906039172126,0.00028519780239355026,0.00024633652971084056,0.00019297448595042066,0.00013710692666572827,8.835015763883022e-05,5.163494169867689e-05,2.7369602042146295e-05,1.315775222869524e-05,5.736980249827806e-06);
-const float kernel21[441]=float[](3.7212898961849027e-06,8.08152472686297e-06,1.617485877966439e-05,2.983562077005327e-05,5.0719743474050574e-05,7.94632653866538e-05,0.0001147369116843963,0.00015268180787586557,0.0001872487040491382,0.00021163999216157426,0.000220457075616344,0.00021163999216157426,0.0001872487040491382,0.00015268180787586557,0.0001147369116843963,7.94632653866538e-05,5.0719743474050574e-05,2.983562077005327e-05,1.617485877966439e-05,8.08152472686297e-06,3.7212898961849027e-06,8.08152472686297e-06,1.7550646075129756e-05,3.512693846168423e-05,6.479401329138247e-05,0.00011014805953331182,0.00017257036189464564,0.0002491741344343973,0.00033157905998023836,0.00040664798337736554,0.00045961854022723053,0.00047876659908488304,0.00045961854022723053,0.00040664798337736554,0.00033157905998023836,0.0002491741344343973,0.00017257036189464564,0.00011014805953331182,6.479401329138247e-05,3.512693846168423e-05,1.7550646075129756e-05,8.08152472686297e-06,1.617485877966439e-05,3.512693846168423e-05,7.030520702251857e-05,0.00012968270842161087,0.00022045707561634415,0.00034539289645717366,0.0004987123806754673,0.0006636426479828505,0.0008138901910799942,0.0009199087093032669,0.0009582328075885486,0.0009199087093032669,0.0008138901910799942,0.0006636426479828505,0.0004987123806754673,0.00034539289645717366,0.00022045707561634415,0.00012968270842161087,7.030520702251857e-05,3.512693846168423e-05,1.617485877966439e-05,2.983562077005327e-05,6.479401329138247e-05,0.00012968270842161087,0.00023920852488462074,0.00040664798337736565,0.0006371005531326392,0.0009199087093032669,0.0012241337400079062,0.0015012754930545825,0.0016968338189355691,0.0017675252097149104,0.0016968338189355691,0.0015012754930545825,0.0012241337400079062,0.0009199087093032669,0.0006371005531326392,0.00040664798337736565,0.00023920852488462074,0.00012968270842161087,6.479401329138247e-05,2.983562077005327e-05,5.0719743474050574e-05,0.00011014805953331182,0.00022045707561634415,0.00040664798337736565,0.0006912905067435989,0.0010830536046529022,0.0015638197748591158,0.0020809940490143946,0.002552127488094201,0.0028845713208987137,0.003004744761692372,0.0028845713208987137,0.002552127488094201,0.0020809940490143946,0.0015638197748591158,0.0010830536046529022,0.0006912905067435989,0.00040664798337736565,0.00022045707561634415,0.00011014805953331182,5.0719743474050574e-05,7.94632653866538e-05,0.00017257036189464564,0.00034539289645717366,0.0006371005531326392,0.0010830536046529022,0.001696833818935568,0.002450056275424671,0.0032603197701400344,0.00399845050460007,0.004519294473888222,0.004707571727756816,0.004519294473888222,0.00399845050460007,0.0032603197701400344,0.002450056275424671,0.001696833818935568,0.0010830536046529022,0.0006371005531326392,0.00034539289645717366,0.00017257036189464564,7.94632653866538e-05,0.0001147369116843963,0.0002491741344343973,0.0004987123806754673,0.0009199087093032669,0.0015638197748591158,0.002450056275424671,0.0035376332589324394,0.004707571727756818,0.005773357792288516,0.0065254037623953785,0.006797257058936724,0.0065254037623953785,0.005773357792288516,0.004707571727756818,0.0035376332589324394,0.002450056275424671,0.0015638197748591158,0.0009199087093032669,0.0004987123806754673,0.0002491741344343973,0.0001147369116843963,0.00015268180787586557,0.00033157905998023836,0.0006636426479828505,0.0012241337400079062,0.0020809940490143946,0.0032603197701400344,0.004707571727756818,0.006264423118484295,0.007682677634426035,0.008683434379888362,0.009045192877512202,0.008683434379888362,0.007682677634426035,0.006264423118484295,0.004707571727756818,0.0032603197701400344,0.0020809940490143946,0.0012241337400079062,0.0006636426479828505,0.00033157905998023836,0.00015268180787586557,0.0001872487040491382,0.00040664798337736554,0.0008138901910799942,0.0015012754930545825,0.002552127488094201,0.00399845050460007,0.005773357792288516,0.007682677634426035,0.009422022509997859,0.01064934884483277,0.011093008838130077,0.01064934884483277,0.009422022509997859,0.007682677634426035,0.005773357792288516,0.00399845050460007,0.002552127488094201,0.0015012754930545825,0.0008138901910799942,0.00040664798337736554,0.0001872487040491382,0.00021163999216157426,0.00045961854022723053,0.0009199087093032669,0.0016968338189355691,0.0028845713208987137,0.004519294473888222,0.0065254037623953785,0.008683434379888362,0.01064934884483277,0.01203654849036938,0.01253800027867765,0.01203654849036938,0.01064934884483277,0.008683434379888362,0.0065254037623953785,0.004519294473888222,0.0028845713208987137,0.0016968338189355691,0.0009199087093032669,0.00045961854022723053,0.00021163999216157426,0.000220457075616344,0.00047876659908488304,0.0009582328075885486,0.0017675252097149104,0.003004744761692372,0.004707571727756816,0.006797257058936724,0.009045192877512202,0.011093008838130077,0.01253800027867765,0.01306034293085763,0.01253800027867765,0.011093008838130077,0.009045192877512202,0.006797257058936724,0.004707571727756816,0.003004744761692372,0.0017675252097149104,0.0009582328075885486,0.00047876659908488304,0.000220457075616344,0.00021163999216157426,0.00045961854022723053,0.0009199087093032669,0.0016968338189355691,0.0028845713208987137,0.004519294473888222,0.0065254037623953785,0.008683434379888362,0.01064934884483277,0.01203654849036938,0.01253800027867765,0.01203654849036938,0.01064934884483277,0.008683434379888362,0.0065254037623953785,0.004519294473888222,0.0028845713208987137,0.0016968338189355691,0.0009199087093032669,0.00045961854022723053,0.00021163999216157426,0.0001872487040491382,0.00040664798337736554,0.0008138901910799942,0.0015012754930545825,0.002552127488094201,0.00399845050460007,0.005773357792288516,0.007682677634426035,0.009422022509997859,0.01064934884483277,0.011093008838130077,0.01064934884483277,0.009422022509997859,0.007682677634426035,0.005773357792288516,0.00399845050460007,0.002552127488094201,0.0015012754930545825,0.0008138901910799942,0.00040664798337736554,0.0001872487040491382,0.00015268180787586557,0.00033157905998023836,0.0006636426479828505,0.0012241337400079062,0.0020809940490143946,0.0032603197701400344,0.004707571727756818,0.006264423118484295,0.007682677634426035,0.008683434379888362,0.009045192877512202,0.008683434379888362,0.007682677634426035,0.006264423118484295,0.004707571727756818,0.0032603197701400344,0.0020809940490143946,0.0012241337400079062,0.0006636426479828505,0.00033157905998023836,0.00015268180787586557,0.0001147369116843963,0.0002491741344343973,0.0004987123806754673,0.0009199087093032669,0.0015638197748591158,0.002450056275424671,0.0035376332589324394,0.004707571727756818,0.005773357792288516,0.0065254037623953785,0.006797257058936724,0.0065254037623953785,0.005773357792288516,0.004707571727756818,0.0035376332589324394,0.002450056275424671,0.0015638197748591158,0.0009199087093032669,0.0004987123806754673,0.0002491741344343973,0.0001147369116843963,7.94632653866538e-05,0.00017257036189464564,0.00034539289645717366,0.0006371005531326392,0.0010830536046529022,0.001696833818935568,0.002450056275424671,0.0032603197701400344,0.00399845050460007,0.004519294473888222,0.004707571727756816,0.004519294473888222,0.00399845050460007,0.0032603197701400344,0.002450056275424671,0.001696833818935568,0.0010830536046529022,0.0006371005531326392,0.00034539289645717366,0.00017257036189464564,7.94632653866538e-05,5.0719743474050574e-05,0.00011014805953331182,0.00022045707561634415,0.00040664798337736565,0.0006912905067435989,0.0010830536046529022,0.0015638197748591158,0.0020809940490143946,0.002552127488094201,0.0028845713208987137,0.003004744761692372,0.0028845713208987137,0.002552127488094201,0.0020809940490143946,0.0015638197748591158,0.0010830536046529022,0.0006912905067435989,0.00040664798337736565,0.00022045707561634415,0.00011014805953331182,5.0719743474050574e-05,2.983562077005327e-05,6.479401329138247e-05,0.00012968270842161087,0.00023920852488462074,0.00040664798337736565,0.0006371005531326392,0.0009199087093032669,0.0012241337400079062,0.0015012754930545825,0.0016968338189355691,0.0017675252097149104,0.0016968338189355691,0.0015012754930545825,0.0012241337400079062,0.0009199087093032669,0.0006371005531326392,0.00040664798337736565,0.00023920852488462074,0.00012968270842161087,6.479401329138247e-05,2.983562077005327e-05,1.617485877966439e-05,3.512693846168423e-05,7.030520702251857e-05,0.00012968270842161087,0.00022045707561634415,0.00034539289645717366,0.0004987123806754673,0.0006636426479828505,0.0008138901910799942,0.0009199087093032669,0.0009582328075885486,0.0009199087093032669,0.0008138901910799942,0.0006636426479828505,0.0004987123806754673,0.00034539289645717366,0.00022045707561634415,0.00012968270842161087,7.030520702251857e-05,3.512693846168423e-05,1.617485877966439e-05,8.08152472686297e-06,1.7550646075129756e-05,3.512693846168423e-05,6.479401329138247e-05,0.00011014805953331182,0.00017257036189464564,0.0002491741344343973,0.00033157905998023836,0.00040664798337736554,0.00045961854022723053,0.00047876659908488304,0.00045961854022723053,0.00040664798337736554,0.00033157905998023836,0.0002491741344343973,0.00017257036189464564,0.00011014805953331182,6.479401329138247e-05,3.512693846168423e-05,1.7550646075129756e-05,8.08152472686297e-06,3.7212898961849027e-06,8.08152472686297e-06,1.617485877966439e-05,2.983562077005327e-05,5.0719743474050574e-05,7.94632653866538e-05,0.0001147369116843963,0.00015268180787586557,0.0001872487040491382,0.00021163999216157426,0.000220457075616344,0.00021163999216157426,0.0001872487040491382,0.00015268180787586557,0.0001147369116843963,7.94632653866538e-05,5.0719743474050574e-05,2.983562077005327e-05,1.617485877966439e-05,8.08152472686297e-06,3.7212898961849027e-06);
-const float kernel23[529]=float[](2.541985860772973e-06,5.2597969582484765e-06,1.0155212919282732e-05,1.8295037002806384e-05,3.075401032279607e-05,4.823856992163438e-05,7.0601072351487e-05,9.64167250106447e-05,0.00012286202207861382,0.00014608551185666782,0.00016207679469643635,0.00016778716530013108,0.00016207679469643635,0.00014608551185666782,0.00012286202207861382,9.64167250106447e-05,7.0601072351487e-05,4.823856992163438e-05,3.075401032279607e-05,1.8295037002806384e-05,1.0155212919282732e-05,5.2597969582484765e-06,2.541985860772973e-06,5.2597969582484765e-06,1.0883405950018678e-05,2.1012846234701943e-05,3.785551346424211e-05,6.363522804985103e-05,9.981372723564861e-05,0.00014608551185666774,0.00019950244600536792,0.0002542222205031633,0.0003022755329859397,0.00033536419100606296,0.00034717990973026224,0.00033536419100606296,0.0003022755329859397,0.0002542222205031633,0.00019950244600536792,0.00014608551185666774,9.981372723564861e-05,6.363522804985103e-05,3.785551346424211e-05,2.1012846234701943e-05,1.0883405950018678e-05,5.2597969582484765e-06,1.0155212919282732e-05,2.1012846234701943e-05,4.056999333765271e-05,7.308852460460169e-05,0.00012286202207861382,0.00019271269602063923,0.0002820507120527484,0.00038518403527441046,0.0004908327828080597,0.0005836104363207389,0.0006474954817084187,0.0006703083660062484,0.0006474954817084187,0.0005836104363207389,0.0004908327828080597,0.00038518403527441046,0.0002820507120527484,0.00019271269602063923,0.00012286202207861382,7.308852460460169e-05,4.056999333765271e-05,2.1012846234701943e-05,1.0155212919282732e-05,1.8295037002806384e-05,3.785551346424211e-05,7.308852460460169e-05,0.00013167200655957856,0.00022134102534667637,0.0003471799097302624,0.0005081260486301437,0.0006939250052408895,0.0008842556030128149,0.0010513983914052717,0.0011664899486757536,0.0012075883053214373,0.0011664899486757536,0.0010513983914052717,0.0008842556030128149,0.0006939250052408895,0.0005081260486301437,0.0003471799097302624,0.00022134102534667637,0.00013167200655957856,7.308852460460169e-05,3.785551346424211e-05,1.8295037002806384e-05,3.075401032279607e-05,6.363522804985103e-05,0.00012286202207861382,0.00022134102534667637,0.00037207490628883485,0.0005836104363207389,0.0008541613631312092,0.0011664899486757536,0.0014864362361702171,0.001767403748770166,0.0019608729907192326,0.002029959447572937,0.0019608729907192326,0.001767403748770166,0.0014864362361702171,0.0011664899486757536,0.0008541613631312092,0.0005836104363207389,0.00037207490628883485,0.00022134102534667637,0.00012286202207861382,6.363522804985103e-05,3.075401032279607e-05,4.823856992163438e-05,9.981372723564861e-05,0.00019271269602063923,0.0003471799097302624,0.0005836104363207389,0.0009154101381888969,0.0013397772260361675,0.001829673800635024,0.0023315189648420776,0.0027722247739382644,0.0030756869714692286,0.0031840511114495395,0.0030756869714692286,0.0027722247739382644,0.0023315189648420776,0.001829673800635024,0.0013397772260361675,0.0009154101381888969,0.0005836104363207389,0.0003471799097302624,0.00019271269602063923,9.981372723564861e-05,4.823856992163438e-05,7.0601072351487e-05,0.00014608551185666774,0.0002820507120527484,0.0005081260486301437,0.0008541613631312092,0.0013397772260361675,0.001960872990719232,0.0026778764915317134,0.003412367725516985,0.00405737653826303,0.004501518157689773,0.004660117894362841,0.004501518157689773,0.00405737653826303,0.003412367725516985,0.0026778764915317134,0.001960872990719232,0.0013397772260361675,0.0008541613631312092,0.0005081260486301437,0.0002820507120527484,0.00014608551185666774,7.0601072351487e-05,9.64167250106447e-05,0.00019950244600536792,0.00038518403527441046,0.0006939250052408895,0.0011664899486757536,0.001829673800635024,0.0026778764915317134,0.003657056085650874,0.004660117894362842,0.005540977564855765,0.006147521898529031,0.006364114461336553,0.006147521898529031,0.005540977564855765,0.004660117894362842,0.003657056085650874,0.0026778764915317134,0.001829673800635024,0.0011664899486757536,0.0006939250052408895,0.00038518403527441046,0.00019950244600536792,9.64167250106447e-05,0.00012286202207861382,0.0002542222205031633,0.0004908327828080597,0.0008842556030128149,0.0014864362361702171,0.0023315189648420776,0.003412367725516985,0.004660117894362842,0.005938300720781995,0.007060763657293413,0.007833671711442685,0.00810967154685281,0.007833671711442685,0.007060763657293413,0.005938300720781995,0.004660117894362842,0.003412367725516985,0.0023315189648420776,0.0014864362361702171,0.0008842556030128149,0.0004908327828080597,0.0002542222205031633,0.00012286202207861382,0.00014608551185666782,0.0003022755329859397,0.0005836104363207389,0.0010513983914052717,0.001767403748770166,0.0027722247739382644,0.00405737653826303,0.005540977564855765,0.007060763657293413,0.008395395546352574,0.009314399375186607,0.009642568947411665,0.009314399375186607,0.008395395546352574,0.007060763657293413,0.005540977564855765,0.00405737653826303,0.0027722247739382644,0.001767403748770166,0.0010513983914052717,0.0005836104363207389,0.0003022755329859397,0.00014608551185666782,0.00016207679469643635,0.00033536419100606296,0.0006474954817084187,0.0011664899486757536,0.0019608729907192326,0.0030756869714692286,0.004501518157689773,0.006147521898529031,0.007833671711442685,0.009314399375186607,0.010334002161240533,0.010698094888213515,0.010334002161240533,0.009314399375186607,0.007833671711442685,0.006147521898529031,0.004501518157689773,0.0030756869714692286,0.0019608729907192326,0.0011664899486757536,0.0006474954817084187,0.00033536419100606296,0.00016207679469643635,0.00016778716530013108,0.00034717990973026224,0.0006703083660062484,0.0012075883053214373,0.002029959447572937,0.0031840511114495395,0.004660117894362841,0.006364114461336553,0.00810967154685281,0.009642568947411665,0.010698094888213515,0.01107501551204255,0.010698094888213515,0.009642568947411665,0.00810967154685281,0.006364114461336553,0.004660117894362841,0.0031840511114495395,0.002029959447572937,0.0012075883053214373,0.0006703083660062484,0.00034717990973026224,0.00016778716530013108,0.00016207679469643635,0.00033536419100606296,0.0006474954817084187,0.0011664899486757536,0.0019608729907192326,0.0030756869714692286,0.004501518157689773,0.006147521898529031,0.007833671711442685,0.009314399375186607,0.010334002161240533,0.010698094888213515,0.010334002161240533,0.009314399375186607,0.007833671711442685,0.006147521898529031,0.004501518157689773,0.0030756869714692286,0.0019608729907192326,0.0011664899486757536,0.0006474954817084187,0.00033536419100606296,0.00016207679469643635,0.00014608551185666782,0.0003022755329859397,0.0005836104363207389,0.0010513983914052717,0.001767403748770166,0.0027722247739382644,0.00405737653826303,0.005540977564855765,0.007060763657293413,0.008395395546352574,0.009314399375186607,0.009642568947411665,0.009314399375186607,0.008395395546352574,0.007060763657293413,0.005540977564855765,0.00405737653826303,0.0027722247739382644,0.001767403748770166,0.0010513983914052717,0.0005836104363207389,0.0003022755329859397,0.00014608551185666782,0.00012286202207861382,0.0002542222205031633,0.0004908327828080597,0.0008842556030128149,0.0014864362361702171,0.0023315189648420776,0.003412367725516985,0.004660117894362842,0.005938300720781995,0.007060763657293413,0.007833671711442685,0.00810967154685281,0.007833671711442685,0.007060763657293413,0.005938300720781995,0.004660117894362842,0.003412367725516985,0.0023315189648420776,0.0014864362361702171,0.0008842556030128149,0.0004908327828080597,0.0002542222205031633,0.00012286202207861382,9.64167250106447e-05,0.00019950244600536792,0.00038518403527441046,0.0006939250052408895,0.0011664899486757536,0.001829673800635024,0.0026778764915317134,0.003657056085650874,0.004660117894362842,0.005540977564855765,0.006147521898529031,0.006364114461336553,0.006147521898529031,0.005540977564855765,0.004660117894362842,0.003657056085650874,0.0026778764915317134,0.001829673800635024,0.0011664899486757536,0.0006939250052408895,0.00038518403527441046,0.00019950244600536792,9.64167250106447e-05,7.0601072351487e-05,0.00014608551185666774,0.0002820507120527484,0.0005081260486301437,0.0008541613631312092,0.0013397772260361675,0.001960872990719232,0.0026778764915317134,0.003412367725516985,0.00405737653826303,0.004501518157689773,0.004660117894362841,0.004501518157689773,0.00405737653826303,0.003412367725516985,0.0026778764915317134,0.001960872990719232,0.0013397772260361675,0.0008541613631312092,0.0005081260486301437,0.0002820507120527484,0.00014608551185666774,7.0601072351487e-05,4.823856992163438e-05,9.981372723564861e-05,0.00019271269602063923,0.0003471799097302624,0.0005836104363207389,0.0009154101381888969,0.0013397772260361675,0.001829673800635024,0.0023315189648420776,0.0027722247739382644,0.0030756869714692286,0.0031840511114495395,0.0030756869714692286,0.0027722247739382644,0.0023315189648420776,0.001829673800635024,0.0013397772260361675,0.0009154101381888969,0.0005836104363207389,0.0003471799097302624,0.00019271269602063923,9.981372723564861e-05,4.823856992163438e-05,3.075401032279607e-05,6.363522804985103e-05,0.00012286202207861382,0.00022134102534667637,0.00037207490628883485,0.0005836104363207389,0.0008541613631312092,0.0011664899486757536,0.0014864362361702171,0.001767403748770166,0.0019608729907192326,0.002029959447572937,0.0019608729907192326,0.001767403748770166,0.0014864362361702171,0.0011664899486757536,0.0008541613631312092,0.0005836104363207389,0.00037207490628883485,0.00022134102534667637,0.00012286202207861382,6.363522804985103e-05,3.075401032279607e-05,1.8295037002806384e-05,3.785551346424211e-05,7.308852460460169e-05,0.00013167200655957856,0.00022134102534667637,0.0003471799097302624,0.0005081260486301437,0.0006939250052408895,0.0008842556030128149,0.0010513983914052717,0.0011664899486757536,0.0012075883053214373,0.0011664899486757536,0.0010513983914052717,0.0008842556030128149,0.0006939250052408895,0.0005081260486301437,0.0003471799097302624,0.00022134102534667637,0.00013167200655957856,7.308852460460169e-05,3.785551346424211e-05,1.8295037002806384e-05,1.0155212919282732e-05,2.1012846234701943e-05,4.056999333765271e-05,7.308852460460169e-05,0.00012286202207861382,0.00019271269602063923,0.0002820507120527484,0.00038518403527441046,0.0004908327828080597,0.0005836104363207389,0.0006474954817084187,0.0006703083660062484,0.0006474954817084187,0.0005836104363207389,0.0004908327828080597,0.00038518403527441046,0.0002820507120527484,0.00019271269602063923,0.00012286202207861382,7.308852460460169e-05,4.056999333765271e-05,2.1012846234701943e-05,1.0155212919282732e-05,5.2597969582484765e-06,1.0883405950018678e-05,2.1012846234701943e-05,3.785551346424211e-05,6.363522804985103e-05,9.981372723564861e-05,0.00014608551185666774,0.00019950244600536792,0.0002542222205031633,0.0003022755329859397,0.00033536419100606296,0.00034717990973026224,0.00033536419100606296,0.0003022755329859397,0.0002542222205031633,0.00019950244600536792,0.00014608551185666774,9.981372723564861e-05,6.363522804985103e-05,3.785551346424211e-05,2.1012846234701943e-05,1.0883405950018678e-05,5.2597969582484765e-06,2.541985860772973e-06,5.2597969582484765e-06,1.0155212919282732e-05,1.8295037002806384e-05,3.075401032279607e-05,4.823856992163438e-05,7.0601072351487e-05,9.64167250106447e-05,0.00012286202207861382,0.00014608551185666782,0.00016207679469643635,0.00016778716530013108,0.00016207679469643635,0.00014608551185666782,0.00012286202207861382,9.64167250106447e-05,7.0601072351487e-05,4.823856992163438e-05,3.075401032279607e-05,1.8295037002806384e-05,1.0155212919282732e-05,5.2597969582484765e-06,2.541985860772973e-06);
-const float kernel25[625]=float[](1.8108858075258522e-06,3.5892121415923307e-06,6.703038404108532e-06,1.1795294897915937e-05,1.9557368337206604e-05,3.05545958313938e-05,4.497872989989711e-05,6.238818458375983e-05,8.153836997994306e-05,0.00010041213895984251,0.00011651314570724334,0.00012738789271295477,0.0001312338576865138,0.00012738789271295477,0.00011651314570724334,0.00010041213895984251,8.153836997994306e-05,6.238818458375983e-05,4.497872989989711e-05,3.05545958313938e-05,1.9557368337206604e-05,1.1795294897915937e-05,6.703038404108532e-06,3.5892121415923307e-06,1.8108858075258522e-06,3.5892121415923307e-06,7.113890751043337e-06,1.3285557115529252e-05,2.3378512043839938e-05,3.876309792796984e-05,6.055982430461422e-05,8.914874852914104e-05,0.00012365463833739694,0.0001616106914756309,0.00019901888170978884,0.00023093140135595436,0.00025248536893769386,0.00026010814897267393,0.00025248536893769386,0.00023093140135595436,0.00019901888170978884,0.0001616106914756309,0.00012365463833739694,8.914874852914104e-05,6.055982430461422e-05,3.876309792796984e-05,2.3378512043839938e-05,1.3285557115529252e-05,7.113890751043337e-06,3.5892121415923307e-06,6.703038404108532e-06,1.3285557115529252e-05,2.481146169472777e-05,4.366057448787378e-05,7.239208044084281e-05,0.00011309858878383376,0.00016648987618880044,0.0002309314013559543,0.00030181628411495845,0.00037167800470317515,0.00043127627761696714,0.0004715294214161558,0.00048576535546096685,0.0004715294214161558,0.00043127627761696714,0.00037167800470317515,0.00030181628411495845,0.0002309314013559543,0.00016648987618880044,0.00011309858878383376,7.239208044084281e-05,4.366057448787378e-05,2.481146169472777e-05,1.3285557115529252e-05,6.703038404108532e-06,1.1795294897915937e-05,2.3378512043839938e-05,4.366057448787378e-05,7.682924077851634e-05,0.00012738789271295477,0.00019901888170978873,0.0002929711973544314,0.0004063685475101689,0.00053110423385715,0.0006540394681098343,0.0007589141774645906,0.0008297473836996357,0.0008547982681019846,0.0008297473836996357,0.0007589141774645906,0.0006540394681098343,0.00053110423385715,0.0004063685475101689,0.0002929711973544314,0.00019901888170978873,0.00012738789271295477,7.682924077851634e-05,4.366057448787378e-05,2.3378512043839938e-05,1.1795294897915937e-05,1.9557368337206604e-05,3.876309792796984e-05,7.239208044084281e-05,0.00012738789271295477,0.0002112174355155804,0.00032998628769722417,0.0004857653554609669,0.0006737855588261917,0.0008806054631859553,0.0010844401005315064,0.0012583292095245213,0.0013757752858484682,0.0014173112862341884,0.0013757752858484682,0.0012583292095245213,0.0010844401005315064,0.0008806054631859553,0.0006737855588261917,0.0004857653554609669,0.00032998628769722417,0.0002112174355155804,0.00012738789271295477,7.239208044084281e-05,3.876309792796984e-05,1.9557368337206604e-05,3.05545958313938e-05,6.055982430461422e-05,0.00011309858878383376,0.00019901888170978873,0.00032998628769722417,0.0005155395898183931,0.0007589141774645911,0.0010526592878960213,0.0013757752858484682,0.0016942273829378054,0.001965895398447587,0.002149382119778816,0.0022142740665047913,0.002149382119778816,0.001965895398447587,0.0016942273829378054,0.0013757752858484682,0.0010526592878960213,0.0007589141774645911,0.0005155395898183931,0.00032998628769722417,0.00019901888170978873,0.00011309858878383376,6.055982430461422e-05,3.05545958313938e-05,4.497872989989711e-05,8.914874852914104e-05,0.00016648987618880044,0.0002929711973544314,0.0004857653554609669,0.0007589141774645911,0.001117180406958939,0.0015495959445238502,0.0020252477017402327,0.002494033835913872,0.0028939501810517332,0.0031640568361852744,0.0032595828042122268,0.0031640568361852744,0.0028939501810517332,0.002494033835913872,0.0020252477017402327,0.0015495959445238502,0.001117180406958939,0.0007589141774645911,0.0004857653554609669,0.0002929711973544314,0.00016648987618880044,8.914874852914104e-05,4.497872989989711e-05,6.238818458375983e-05,0.00012365463833739694,0.0002309314013559543,0.0004063685475101689,0.0006737855588261917,0.0010526592878960213,0.0015495959445238502,0.002149382119778815,0.0028091395138370515,0.003459373878707348,0.004014081733154358,0.004388735795091573,0.00452123601773173,0.004388735795091573,0.004014081733154358,0.003459373878707348,0.0028091395138370515,0.002149382119778815,0.0015495959445238502,0.0010526592878960213,0.0006737855588261917,0.0004063685475101689,0.0002309314013559543,0.00012365463833739694,6.238818458375983e-05,8.153836997994306e-05,0.0001616106914756309,0.00030181628411495845,0.00053110423385715,0.0008806054631859553,0.0013757752858484682,0.0020252477017402327,0.0028091395138370515,0.0036714108373678694,0.004521236017731731,0.005246212622972691,0.005735867542738977,0.005909038989354051,0.005735867542738977,0.005246212622972691,0.004521236017731731,0.0036714108373678694,0.0028091395138370515,0.0020252477017402327,0.0013757752858484682,0.0008806054631859553,0.00053110423385715,0.00030181628411495845,0.0001616106914756309,8.153836997994306e-05,0.00010041213895984251,0.00019901888170978884,0.00037167800470317515,0.0006540394681098343,0.0010844401005315064,0.0016942273829378054,0.002494033835913872,0.003459373878707348,0.004521236017731731,0.0055677710922403265,0.0064605587656509774,0.007063554605009026,0.007276810221544738,0.007063554605009026,0.0064605587656509774,0.0055677710922403265,0.004521236017731731,0.003459373878707348,0.002494033835913872,0.0016942273829378054,0.0010844401005315064,0.0006540394681098343,0.00037167800470317515,0.00019901888170978884,0.00010041213895984251,0.00011651314570724334,0.00023093140135595436,0.00043127627761696714,0.0007589141774645906,0.0012583292095245213,0.001965895398447587,0.0028939501810517332,0.004014081733154358,0.005246212622972691,0.0064605587656509774,0.007496504233552293,0.00819618997692724,0.008443640962233413,0.00819618997692724,0.007496504233552293,0.0064605587656509774,0.005246212622972691,0.004014081733154358,0.0028939501810517332,0.001965895398447587,0.0012583292095245213,0.0007589141774645906,0.00043127627761696714,0.00023093140135595436,0.00011651314570724334,0.00012738789271295477,0.00025248536893769386,0.0004715294214161558,0.0008297473836996357,0.0013757752858484682,0.002149382119778816,0.0031640568361852744,0.004388735795091573,0.005735867542738977,0.007063554605009026,0.00819618997692724,0.008961180844428044,0.009231727651627827,0.008961180844428044,0.00819618997692724,0.007063554605009026,0.005735867542738977,0.004388735795091573,0.0031640568361852744,0.002149382119778816,0.0013757752858484682,0.0008297473836996357,0.0004715294214161558,0.00025248536893769386,0.00012738789271295477,0.0001312338576865138,0.00026010814897267393,0.00048576535546096685,0.0008547982681019846,0.0014173112862341884,0.0022142740665047913,0.0032595828042122268,0.00452123601773173,0.005909038989354051,0.007276810221544738,0.008443640962233413,0.009231727651627827,0.009510442531334649,0.009231727651627827,0.008443640962233413,0.007276810221544738,0.005909038989354051,0.00452123601773173,0.0032595828042122268,0.0022142740665047913,0.0014173112862341884,0.0008547982681019846,0.00048576535546096685,0.00026010814897267393,0.0001312338576865138,0.00012738789271295477,0.00025248536893769386,0.0004715294214161558,0.0008297473836996357,0.0013757752858484682,0.002149382119778816,0.0031640568361852744,0.004388735795091573,0.005735867542738977,0.007063554605009026,0.00819618997692724,0.008961180844428044,0.009231727651627827,0.008961180844428044,0.00819618997692724,0.007063554605009026,0.005735867542738977,0.004388735795091573,0.0031640568361852744,0.002149382119778816,0.0013757752858484682,0.0008297473836996357,0.0004715294214161558,0.00025248536893769386,0.00012738789271295477,0.00011651314570724334,0.00023093140135595436,0.00043127627761696714,0.0007589141774645906,0.0012583292095245213,0.001965895398447587,0.0028939501810517332,0.004014081733154358,0.005246212622972691,0.0064605587656509774,0.007496504233552293,0.00819618997692724,0.008443640962233413,0.00819618997692724,0.007496504233552293,0.0064605587656509774,0.005246212622972691,0.004014081733154358,0.0028939501810517332,0.001965895398447587,0.0012583292095245213,0.0007589141774645906,0.00043127627761696714,0.00023093140135595436,0.00011651314570724334,0.00010041213895984251,0.00019901888170978884,0.00037167800470317515,0.0006540394681098343,0.0010844401005315064,0.0016942273829378054,0.002494033835913872,0.003459373878707348,0.004521236017731731,0.0055677710922403265,0.0064605587656509774,0.007063554605009026,0.007276810221544738,0.007063554605009026,0.0064605587656509774,0.0055677710922403265,0.004521236017731731,0.003459373878707348,0.002494033835913872,0.0016942273829378054,0.0010844401005315064,0.0006540394681098343,0.00037167800470317515,0.00019901888170978884,0.00010041213895984251,8.153836997994306e-05,0.0001616106914756309,0.00030181628411495845,0.00053110423385715,0.0008806054631859553,0.0013757752858484682,0.0020252477017402327,0.0028091395138370515,0.0036714108373678694,0.004521236017731731,0.005246212622972691,0.005735867542738977,0.005909038989354051,0.005735867542738977,0.005246212622972691,0.004521236017731731,0.0036714108373678694,0.0028091395138370515,0.0020252477017402327,0.0013757752858484682,0.0008806054631859553,0.00053110423385715,0.00030181628411495845,0.0001616106914756309,8.153836997994306e-05,6.238818458375983e-05,0.00012365463833739694,0.0002309314013559543,0.0004063685475101689,0.0006737855588261917,0.0010526592878960213,0.0015495959445238502,0.002149382119778815,0.0028091395138370515,0.003459373878707348,0.004014081733154358,0.004388735795091573,0.00452123601773173,0.004388735795091573,0.004014081733154358,0.003459373878707348,0.0028091395138370515,0.002149382119778815,0.0015495959445238502,0.0010526592878960213,0.0006737855588261917,0.0004063685475101689,0.0002309314013559543,0.00012365463833739694,6.238818458375983e-05,4.497872989989711e-05,8.914874852914104e-05,0.00016648987618880044,0.0002929711973544314,0.0004857653554609669,0.0007589141774645911,0.001117180406958939,0.0015495959445238502,0.0020252477017402327,0.002494033835913872,0.0028939501810517332,0.0031640568361852744,0.0032595828042122268,0.0031640568361852744,0.0028939501810517332,0.002494033835913872,0.0020252477017402327,0.0015495959445238502,0.001117180406958939,0.0007589141774645911,0.0004857653554609669,0.0002929711973544314,0.00016648987618880044,8.914874852914104e-05,4.497872989989711e-05,3.05545958313938e-05,6.055982430461422e-05,0.00011309858878383376,0.00019901888170978873,0.00032998628769722417,0.0005155395898183931,0.0007589141774645911,0.0010526592878960213,0.0013757752858484682,0.0016942273829378054,0.001965895398447587,0.002149382119778816,0.0022142740665047913,0.002149382119778816,0.001965895398447587,0.0016942273829378054,0.0013757752858484682,0.0010526592878960213,0.0007589141774645911,0.0005155395898183931,0.00032998628769722417,0.00019901888170978873,0.00011309858878383376,6.055982430461422e-05,3.05545958313938e-05,1.9557368337206604e-05,3.876309792796984e-05,7.239208044084281e-05,0.00012738789271295477,0.0002112174355155804,0.00032998628769722417,0.0004857653554609669,0.0006737855588261917,0.0008806054631859553,0.0010844401005315064,0.0012583292095245213,0.0013757752858484682,0.0014173112862341884,0.0013757752858484682,0.0012583292095245213,0.0010844401005315064,0.0008806054631859553,0.0006737855588261917,0.0004857653554609669,0.00032998628769722417,0.0002112174355155804,0.00012738789271295477,7.239208044084281e-05,3.876309792796984e-05,1.9557368337206604e-05,1.1795294897915937e-05,2.3378512043839938e-05,4.366057448787378e-05,7.682924077851634e-05,0.00012738789271295477,0.00019901888170978873,0.0002929711973544314,0.0004063685475101689,0.00053110423385715,0.0006540394681098343,0.0007589141774645906,0.0008297473836996357,0.0008547982681019846,0.0008297473836996357,0.0007589141774645906,0.0006540394681098343,0.00053110423385715,0.0004063685475101689,0.0002929711973544314,0.00019901888170978873,0.00012738789271295477,7.682924077851634e-05,4.366057448787378e-05,2.3378512043839938e-05,1.1795294897915937e-05,6.703038404108532e-06,1.3285557115529252e-05,2.481146169472777e-05,4.366057448787378e-05,7.239208044084281e-05,0.00011309858878383376,0.00016648987618880044,0.0002309314013559543,0.00030181628411495845,0.00037167800470317515,0.00043127627761696714,0.0004715294214161558,0.00048576535546096685,0.0004715294214161558,0.00043127627761696714,0.00037167800470317515,0.00030181628411495845,0.0002309314013559543,0.00016648987618880044,0.00011309858878383376,7.239208044084281e-05,4.366057448787378e-05,2.481146169472777e-05,1.3285557115529252e-05,6.703038404108532e-06,3.5892121415923307e-06,7.113890751043337e-06,1.3285557115529252e-05,2.3378512043839938e-05,3.876309792796984e-05,6.055982430461422e-05,8.914874852914104e-05,0.00012365463833739694,0.0001616106914756309,0.00019901888170978884,0.00023093140135595436,0.00025248536893769386,0.00026010814897267393,0.00025248536893769386,0.00023093140135595436,0.00019901888170978884,0.0001616106914756309,0.00012365463833739694,8.914874852914104e-05,6.055982430461422e-05,3.876309792796984e-05,2.3378512043839938e-05,1.3285557115529252e-05,7.113890751043337e-06,3.5892121415923307e-06,1.8108858075258522e-06,3.5892121415923307e-06,6.703038404108532e-06,1.1795294897915937e-05,1.9557368337206604e-05,3.05545958313938e-05,4.497872989989711e-05,6.238818458375983e-05,8.153836997994306e-05,0.00010041213895984251,0.00011651314570724334,0.00012738789271295477,0.0001312338576865138,0.00012738789271295477,0.00011651314570724334,0.00010041213895984251,8.153836997994306e-05,6.238818458375983e-05,4.497872989989711e-05,3.05545958313938e-05,1.9557368337206604e-05,1.1795294897915937e-05,6.703038404108532e-06,3.5892121415923307e-06,1.8108858075258522e-06);
-const float kernel27[729]=float[](1.3354963952433097e-06,2.5471222981862654e-06,4.61343397129475e-06,7.935353066101586e-06,1.2962107936379695e-05,2.0107239289673622e-05,2.96207938047843e-05,4.143891477534969e-05,5.5053823667805533e-05,6.94598810886588e-05,8.322389110754025e-05,9.469551990148674e-05,0.00010232418214113745,0.00010500127320758093,0.00010232418214113745,9.469551990148674e-05,8.322389110754025e-05,6.94598810886588e-05,5.5053823667805533e-05,4.143891477534969e-05,2.96207938047843e-05,2.0107239289673622e-05,1.2962107936379695e-05,7.935353066101586e-06,4.61343397129475e-06,2.5471222981862654e-06,1.3354963952433097e-06,2.5471222981862654e-06,4.857992896892609e-06,8.798960881773103e-06,1.513468311156743e-05,2.4721949287055012e-05,3.83494839313017e-05,5.6494187973003175e-05,7.903427086203681e-05,0.00010500127320758093,0.0001324771916872575,0.00015872856679873047,0.00018060780331456794,0.0001951575510826297,0.0002002634266012013,0.0001951575510826297,0.00018060780331456794,0.00015872856679873047,0.0001324771916872575,0.00010500127320758093,7.903427086203681e-05,5.6494187973003175e-05,3.83494839313017e-05,2.4721949287055012e-05,1.513468311156743e-05,8.798960881773103e-06,4.857992896892609e-06,2.5471222981862654e-06,4.61343397129475e-06,8.798960881773103e-06,1.5936975257517506e-05,2.741244943809923e-05,4.47772298796723e-05,6.945988108865882e-05,0.00010232418214113749,0.00014314954187754026,0.00019018185392589689,0.00023994716586122331,0.0002874945434719133,0.000327122955927818,0.00035347595070735546,0.00036272388496922964,0.00035347595070735546,0.000327122955927818,0.0002874945434719133,0.00023994716586122331,0.00019018185392589689,0.00014314954187754026,0.00010232418214113749,6.945988108865882e-05,4.47772298796723e-05,2.741244943809923e-05,1.5936975257517506e-05,8.798960881773103e-06,4.61343397129475e-06,7.935353066101586e-06,1.513468311156743e-05,2.741244943809923e-05,4.715087851076946e-05,7.701922919631003e-05,0.00011947470881722635,0.0001760030635622455,0.0002462248648440452,0.0003271229559278178,0.0004127219529241193,0.0004945059843106548,0.0005626689722808603,0.0006079975321401602,0.0006239044734677443,0.0006079975321401602,0.0005626689722808603,0.0004945059843106548,0.0004127219529241193,0.0003271229559278178,0.0002462248648440452,0.0001760030635622455,0.00011947470881722635,7.701922919631003e-05,4.715087851076946e-05,2.741244943809923e-05,1.513468311156743e-05,7.935353066101586e-06,1.2962107936379695e-05,2.4721949287055012e-05,4.47772298796723e-05,7.701922919631003e-05,0.00012580808361054927,0.00019515755108262973,0.0002874945434719132,0.0004021992781093678,0.0005343433402248154,0.0006741661595838774,0.0008077573726621043,0.0009190991113315861,0.0009931416499058077,0.0010191250546400723,0.0009931416499058077,0.0009190991113315861,0.0008077573726621043,0.0006741661595838774,0.0005343433402248154,0.0004021992781093678,0.0002874945434719132,0.00019515755108262973,0.00012580808361054927,7.701922919631003e-05,4.47772298796723e-05,2.4721949287055012e-05,1.2962107936379695e-05,2.0107239289673622e-05,3.83494839313017e-05,6.945988108865882e-05,0.00011947470881722635,0.00019515755108262973,0.0003027346785002263,0.00044597079490759,0.0006239044734677446,0.0008288905984642405,0.0010457882589997463,0.0012530192511767736,0.001425736142082472,0.0015405933125391606,0.0015808996067867163,0.0015405933125391606,0.001425736142082472,0.0012530192511767736,0.0010457882589997463,0.0008288905984642405,0.0006239044734677446,0.00044597079490759,0.0003027346785002263,0.00019515755108262973,0.00011947470881722635,6.945988108865882e-05,3.83494839313017e-05,2.0107239289673622e-05,2.96207938047843e-05,5.6494187973003175e-05,0.00010232418214113749,0.0001760030635622455,0.0002874945434719132,0.00044597079490759,0.0006569777565484921,0.0009190991113315862,0.001221072527666331,0.0015405933125391608,0.001845873734222362,0.0021003100264660474,0.002269510806050233,0.0023288876510632107,0.002269510806050233,0.0021003100264660474,0.001845873734222362,0.0015405933125391608,0.001221072527666331,0.0009190991113315862,0.0006569777565484921,0.00044597079490759,0.0002874945434719132,0.0001760030635622455,0.00010232418214113749,5.6494187973003175e-05,2.96207938047843e-05,4.143891477534969e-05,7.903427086203681e-05,0.00014314954187754026,0.0002462248648440452,0.0004021992781093678,0.0006239044734677446,0.0009190991113315862,0.001285801791659533,0.001708256731469266,0.0021552600987848123,0.002582341474796744,0.002938292902011334,0.0031750015037902406,0.0032580685558192286,0.0031750015037902406,0.002938292902011334,0.002582341474796744,0.0021552600987848123,0.001708256731469266,0.001285801791659533,0.0009190991113315862,0.0006239044734677446,0.0004021992781093678,0.0002462248648440452,0.00014314954187754026,7.903427086203681e-05,4.143891477534969e-05,5.5053823667805533e-05,0.00010500127320758093,0.00019018185392589689,0.0003271229559278178,0.0005343433402248154,0.0008288905984642405,0.001221072527666331,0.001708256731469266,0.0022695108060502333,0.002863378784893743,0.003430779328422244,0.0039036799150909108,0.004218160004486031,0.0043285190440458384,0.004218160004486031,0.0039036799150909108,0.003430779328422244,0.002863378784893743,0.0022695108060502333,0.001708256731469266,0.001221072527666331,0.0008288905984642405,0.0005343433402248154,0.0003271229559278178,0.00019018185392589689,0.00010500127320758093,5.5053823667805533e-05,6.94598810886588e-05,0.0001324771916872575,0.00023994716586122331,0.0004127219529241193,0.0006741661595838774,0.0010457882589997463,0.0015405933125391608,0.0021552600987848123,0.002863378784893743,0.003612645528684957,0.004328519044045839,0.004925164587050534,0.005321935386222284,0.005461172322990502,0.005321935386222284,0.004925164587050534,0.004328519044045839,0.003612645528684957,0.002863378784893743,0.0021552600987848123,0.0015405933125391608,0.0010457882589997463,0.0006741661595838774,0.0004127219529241193,0.00023994716586122331,0.0001324771916872575,6.94598810886588e-05,8.322389110754025e-05,0.00015872856679873047,0.0002874945434719133,0.0004945059843106548,0.0008077573726621043,0.0012530192511767736,0.001845873734222362,0.002582341474796744,0.003430779328422244,0.004328519044045839,0.00518624840602273,0.005901123855311824,0.006376517841989883,0.006543345649382109,0.006376517841989883,0.005901123855311824,0.00518624840602273,0.004328519044045839,0.003430779328422244,0.002582341474796744,0.001845873734222362,0.0012530192511767736,0.0008077573726621043,0.0004945059843106548,0.0002874945434719133,0.00015872856679873047,8.322389110754025e-05,9.469551990148674e-05,0.00018060780331456794,0.000327122955927818,0.0005626689722808603,0.0009190991113315861,0.001425736142082472,0.0021003100264660474,0.002938292902011334,0.0039036799150909108,0.004925164587050534,0.005901123855311824,0.00671453814577999,0.007255460711733416,0.007445284159601507,0.007255460711733416,0.00671453814577999,0.005901123855311824,0.004925164587050534,0.0039036799150909108,0.002938292902011334,0.0021003100264660474,0.001425736142082472,0.0009190991113315861,0.0005626689722808603,0.000327122955927818,0.00018060780331456794,9.469551990148674e-05,0.00010232418214113745,0.0001951575510826297,0.00035347595070735546,0.0006079975321401602,0.0009931416499058077,0.0015405933125391606,0.002269510806050233,0.0031750015037902406,0.004218160004486031,0.005321935386222284,0.006376517841989883,0.007255460711733416,0.007839959949083302,0.008045075556184037,0.007839959949083302,0.007255460711733416,0.006376517841989883,0.005321935386222284,0.004218160004486031,0.0031750015037902406,0.002269510806050233,0.0015405933125391606,0.0009931416499058077,0.0006079975321401602,0.00035347595070735546,0.0001951575510826297,0.00010232418214113745,0.00010500127320758093,0.0002002634266012013,0.00036272388496922964,0.0006239044734677443,0.0010191250546400723,0.0015808996067867163,0.0023288876510632107,0.0032580685558192286,0.0043285190440458384,0.005461172322990502,0.006543345649382109,0.007445284159601507,0.008045075556184037,0.008255557569816125,0.008045075556184037,0.007445284159601507,0.006543345649382109,0.005461172322990502,0.0043285190440458384,0.0032580685558192286,0.0023288876510632107,0.0015808996067867163,0.0010191250546400723,0.0006239044734677443,0.00036272388496922964,0.0002002634266012013,0.00010500127320758093,0.00010232418214113745,0.0001951575510826297,0.00035347595070735546,0.0006079975321401602,0.0009931416499058077,0.0015405933125391606,0.002269510806050233,0.0031750015037902406,0.004218160004486031,0.005321935386222284,0.006376517841989883,0.007255460711733416,0.007839959949083302,0.008045075556184037,0.007839959949083302,0.007255460711733416,0.006376517841989883,0.005321935386222284,0.004218160004486031,0.0031750015037902406,0.002269510806050233,0.0015405933125391606,0.0009931416499058077,0.0006079975321401602,0.00035347595070735546,0.0001951575510826297,0.00010232418214113745,9.469551990148674e-05,0.00018060780331456794,0.000327122955927818,0.0005626689722808603,0.0009190991113315861,0.001425736142082472,0.0021003100264660474,0.002938292902011334,0.0039036799150909108,0.004925164587050534,0.005901123855311824,0.00671453814577999,0.007255460711733416,0.007445284159601507,0.007255460711733416,0.00671453814577999,0.005901123855311824,0.004925164587050534,0.0039036799150909108,0.002938292902011334,0.0021003100264660474,0.001425736142082472,0.0009190991113315861,0.0005626689722808603,0.000327122955927818,0.00018060780331456794,9.469551990148674e-05,8.322389110754025e-05,0.00015872856679873047,0.0002874945434719133,0.0004945059843106548,0.0008077573726621043,0.0012530192511767736,0.001845873734222362,0.002582341474796744,0.003430779328422244,0.004328519044045839,0.00518624840602273,0.005901123855311824,0.006376517841989883,0.006543345649382109,0.006376517841989883,0.005901123855311824,0.00518624840602273,0.004328519044045839,0.003430779328422244,0.002582341474796744,0.001845873734222362,0.0012530192511767736,0.0008077573726621043,0.0004945059843106548,0.0002874945434719133,0.00015872856679873047,8.322389110754025e-05,6.94598810886588e-05,0.0001324771916872575,0.00023994716586122331,0.0004127219529241193,0.0006741661595838774,0.0010457882589997463,0.0015405933125391608,0.0021552600987848123,0.002863378784893743,0.003612645528684957,0.004328519044045839,0.004925164587050534,0.005321935386222284,0.005461172322990502,0.005321935386222284,0.004925164587050534,0.004328519044045839,0.003612645528684957,0.002863378784893743,0.0021552600987848123,0.0015405933125391608,0.0010457882589997463,0.0006741661595838774,0.0004127219529241193,0.00023994716586122331,0.0001324771916872575,6.94598810886588e-05,5.5053823667805533e-05,0.00010500127320758093,0.00019018185392589689,0.0003271229559278178,0.0005343433402248154,0.0008288905984642405,0.001221072527666331,0.001708256731469266,0.0022695108060502333,0.002863378784893743,0.003430779328422244,0.0039036799150909108,0.004218160004486031,0.0043285190440458384,0.004218160004486031,0.0039036799150909108,0.003430779328422244,0.002863378784893743,0.0022695108060502333,0.001708256731469266,0.001221072527666331,0.0008288905984642405,0.0005343433402248154,0.0003271229559278178,0.00019018185392589689,0.00010500127320758093,5.5053823667805533e-05,4.143891477534969e-05,7.903427086203681e-05,0.00014314954187754026,0.0002462248648440452,0.0004021992781093678,0.0006239044734677446,0.0009190991113315862,0.001285801791659533,0.001708256731469266,0.0021552600987848123,0.002582341474796744,0.002938292902011334,0.0031750015037902406,0.0032580685558192286,0.0031750015037902406,0.002938292902011334,0.002582341474796744,0.0021552600987848123,0.001708256731469266,0.001285801791659533,0.0009190991113315862,0.0006239044734677446,0.0004021992781093678,0.0002462248648440452,0.00014314954187754026,7.903427086203681e-05,4.143891477534969e-05,2.96207938047843e-05,5.6494187973003175e-05,0.00010232418214113749,0.0001760030635622455,0.0002874945434719132,0.00044597079490759,0.0006569777565484921,0.0009190991113315862,0.001221072527666331,0.0015405933125391608,0.001845873734222362,0.0021003100264660474,0.002269510806050233,0.0023288876510632107,0.002269510806050233,0.0021003100264660474,0.001845873734222362,0.0015405933125391608,0.001221072527666331,0.0009190991113315862,0.0006569777565484921,0.00044597079490759,0.0002874945434719132,0.0001760030635622455,0.00010232418214113749,5.6494187973003175e-05,2.96207938047843e-05,2.0107239289673622e-05,3.83494839313017e-05,6.945988108865882e-05,0.00011947470881722635,0.00019515755108262973,0.0003027346785002263,0.00044597079490759,0.0006239044734677446,0.0008288905984642405,0.0010457882589997463,0.0012530192511767736,0.001425736142082472,0.0015405933125391606,0.0015808996067867163,0.0015405933125391606,0.001425736142082472,0.0012530192511767736,0.0010457882589997463,0.0008288905984642405,0.0006239044734677446,0.00044597079490759,0.0003027346785002263,0.00019515755108262973,0.00011947470881722635,6.945988108865882e-05,3.83494839313017e-05,2.0107239289673622e-05,1.2962107936379695e-05,2.4721949287055012e-05,4.47772298796723e-05,7.701922919631003e-05,0.00012580808361054927,0.00019515755108262973,0.0002874945434719132,0.0004021992781093678,0.0005343433402248154,0.0006741661595838774,0.0008077573726621043,0.0009190991113315861,0.0009931416499058077,0.0010191250546400723,0.0009931416499058077,0.0009190991113315861,0.0008077573726621043,0.0006741661595838774,0.0005343433402248154,0.0004021992781093678,0.0002874945434719132,0.00019515755108262973,0.00012580808361054927,7.701922919631003e-05,4.47772298796723e-05,2.4721949287055012e-05,1.2962107936379695e-05,7.935353066101586e-06,1.513468311156743e-05,2.741244943809923e-05,4.715087851076946e-05,7.701922919631003e-05,0.00011947470881722635,0.0001760030635622455,0.0002462248648440452,0.0003271229559278178,0.0004127219529241193,0.0004945059843106548,0.0005626689722808603,0.0006079975321401602,0.0006239044734677443,0.0006079975321401602,0.0005626689722808603,0.0004945059843106548,0.0004127219529241193,0.0003271229559278178,0.0002462248648440452,0.0001760030635622455,0.00011947470881722635,7.701922919631003e-05,4.715087851076946e-05,2.741244943809923e-05,1.513468311156743e-05,7.935353066101586e-06,4.61343397129475e-06,8.798960881773103e-06,1.5936975257517506e-05,2.741244943809923e-05,4.47772298796723e-05,6.945988108865882e-05,0.00010232418214113749,0.00014314954187754026,0.00019018185392589689,0.00023994716586122331,0.0002874945434719133,0.000327122955927818,0.00035347595070735546,0.00036272388496922964,0.00035347595070735546,0.000327122955927818,0.0002874945434719133,0.00023994716586122331,0.00019018185392589689,0.00014314954187754026,0.00010232418214113749,6.945988108865882e-05,4.47772298796723e-05,2.741244943809923e-05,1.5936975257517506e-05,8.798960881773103e-06,4.61343397129475e-06,2.5471222981862654e-06,4.857992896892609e-06,8.798960881773103e-06,1.513468311156743e-05,2.4721949287055012e-05,3.83494839313017e-05,5.6494187973003175e-05,7.903427086203681e-05,0.00010500127320758093,0.0001324771916872575,0.00015872856679873047,0.00018060780331456794,0.0001951575510826297,0.0002002634266012013,0.0001951575510826297,0.00018060780331456794,0.00015872856679873047,0.0001324771916872575,0.00010500127320758093,7.903427086203681e-05,5.6494187973003175e-05,3.83494839313017e-05,2.4721949287055012e-05,1.513468311156743e-05,8.798960881773103e-06,4.857992896892609e-06,2.5471222981862654e-06,1.3354963952433097e-06,2.5471222981862654e-06,4.61343397129475e-06,7.935353066101586e-06,1.2962107936379695e-05,2.0107239289673622e-05,2.96207938047843e-05,4.143891477534969e-05,5.5053823667805533e-05,6.94598810886588e-05,8.322389110754025e-05,9.469551990148674e-05,0.00010232418214113745,0.00010500127320758093,0.00010232418214113745,9.469551990148674e-05,8.322389110754025e-05,6.94598810886588e-05,5.5053823667805533e-05,4.143891477534969e-05,2.96207938047843e-05,2.0107239289673622e-05,1.2962107936379695e-05,7.935353066101586e-06,4.61343397129475e-06,2.5471222981862654e-06,1.3354963952433097e-06);
-const float kernel29[841]=float[](1.013804400229057e-06,1.867958733205026e-06,3.289426245927362e-06,5.536213103416845e-06,8.905231513007675e-06,1.3690439803155e-05,2.01154316074057e-05,2.8247569176087855e-05,3.791164039025183e-05,4.862995206978259e-05,5.961765325229035e-05,6.985309961280399e-05,7.822332225264308e-05,8.371949542161897e-05,8.563606777440246e-05,8.371949542161897e-05,7.822332225264308e-05,6.985309961280399e-05,5.961765325229035e-05,4.862995206978259e-05,3.791164039025183e-05,2.8247569176087855e-05,2.01154316074057e-05,1.3690439803155e-05,8.905231513007675e-06,5.536213103416845e-06,3.289426245927362e-06,1.867958733205026e-06,1.013804400229057e-06,1.867958733205026e-06,3.4417584182595457e-06,6.060846137504988e-06,1.0200604389836024e-05,1.640810098296763e-05,2.5224961132485843e-05,3.7063161429120174e-05,5.204681842213817e-05,6.985309961280398e-05,8.96018439489593e-05,0.00010984694485508604,0.0001287059983500731,0.00014412833275247386,0.00015425516261026106,0.00015778649277946563,0.00015425516261026106,0.00014412833275247386,0.0001287059983500731,0.00010984694485508604,8.96018439489593e-05,6.985309961280398e-05,5.204681842213817e-05,3.7063161429120174e-05,2.5224961132485843e-05,1.640810098296763e-05,1.0200604389836024e-05,6.060846137504988e-06,3.4417584182595457e-06,1.867958733205026e-06,3.289426245927362e-06,6.060846137504988e-06,1.0672990790877467e-05,1.7962996295253594e-05,2.8894234685042258e-05,4.442049373292507e-05,6.526725338991152e-05,9.16530796379246e-05,0.0001230094729295691,0.00015778649277946557,0.0001934375835066137,0.00022664788116309286,0.0002538062068021622,0.00027163928808500757,0.0002778578677223028,0.00027163928808500757,0.0002538062068021622,0.00022664788116309286,0.0001934375835066137,0.00015778649277946557,0.0001230094729295691,9.16530796379246e-05,6.526725338991152e-05,4.442049373292507e-05,2.8894234685042258e-05,1.7962996295253594e-05,1.0672990790877467e-05,6.060846137504988e-06,3.289426245927362e-06,5.536213103416845e-06,1.0200604389836024e-05,1.7962996295253594e-05,3.0232316529223433e-05,4.862995206978257e-05,7.47611592656746e-05,0.00010984694485508604,0.00015425516261026104,0.00020702900900126104,0.00026555988295812795,0.00032556184709369926,0.00038145587581126346,0.00042716423557644464,0.0004571779008454626,0.0004676439759293043,0.0004571779008454626,0.00042716423557644464,0.00038145587581126346,0.00032556184709369926,0.00026555988295812795,0.00020702900900126104,0.00015425516261026104,0.00010984694485508604,7.47611592656746e-05,4.862995206978257e-05,3.0232316529223433e-05,1.7962996295253594e-05,1.0200604389836024e-05,5.536213103416845e-06,8.905231513007675e-06,1.640810098296763e-05,2.8894234685042258e-05,4.862995206978257e-05,7.8223322252643e-05,0.000120256467553746,0.00017669342864121227,0.0002481259137718547,0.0003330148642448246,0.00042716423557644437,0.0005236799173034838,0.0006135878122176821,0.0006871116304279247,0.0007353898727538142,0.0007522249945081788,0.0007353898727538142,0.0006871116304279247,0.0006135878122176821,0.0005236799173034838,0.00042716423557644437,0.0003330148642448246,0.0002481259137718547,0.00017669342864121227,0.000120256467553746,7.8223322252643e-05,4.862995206978257e-05,2.8894234685042258e-05,1.640810098296763e-05,8.905231513007675e-06,1.3690439803155e-05,2.5224961132485843e-05,4.442049373292507e-05,7.47611592656746e-05,0.000120256467553746,0.00018487603916639498,0.00027163928808500757,0.00038145587581126336,0.0005119597335386733,0.0006567000806972723,0.0008050782703955913,0.000943297992292018,0.001056329686733107,0.0011305501457295163,0.0011564315863883308,0.0011305501457295163,0.001056329686733107,0.000943297992292018,0.0008050782703955913,0.0006567000806972723,0.0005119597335386733,0.00038145587581126336,0.00027163928808500757,0.00018487603916639498,0.000120256467553746,7.47611592656746e-05,4.442049373292507e-05,2.5224961132485843e-05,1.3690439803155e-05,2.01154316074057e-05,3.7063161429120174e-05,6.526725338991152e-05,0.00010984694485508604,0.00017669342864121227,0.00027163928808500757,0.00039912096323590113,0.0005604750242834574,0.0007522249945081791,0.0009648927097871281,0.0011829055252862602,0.0013859924532870296,0.0015520704866950523,0.0016611229779428846,0.0016991507080201561,0.0016611229779428846,0.0015520704866950523,0.0013859924532870296,0.0011829055252862602,0.0009648927097871281,0.0007522249945081791,0.0005604750242834574,0.00039912096323590113,0.00027163928808500757,0.00017669342864121227,0.00010984694485508604,6.526725338991152e-05,3.7063161429120174e-05,2.01154316074057e-05,2.8247569176087855e-05,5.204681842213817e-05,9.16530796379246e-05,0.00015425516261026104,0.0002481259137718547,0.00038145587581126336,0.0005604750242834574,0.0007870602693947541,0.0010563296867331067,0.0013549733408245758,0.0016611229779428843,0.0019463125855747128,0.002179531580269045,0.002332671112667333,0.0023860724493591024,0.002332671112667333,0.002179531580269045,0.0019463125855747128,0.0016611229779428843,0.0013549733408245758,0.0010563296867331067,0.0007870602693947541,0.0005604750242834574,0.00038145587581126336,0.0002481259137718547,0.00015425516261026104,9.16530796379246e-05,5.204681842213817e-05,2.8247569176087855e-05,3.791164039025183e-05,6.985309961280398e-05,0.0001230094729295691,0.00020702900900126104,0.0003330148642448246,0.0005119597335386733,0.0007522249945081791,0.0010563296867331067,0.0014177216796011488,0.0018185374364603584,0.0022294271266734425,0.0026121859325790313,0.0029251939158115234,0.003130725614685277,0.003202396640974184,0.003130725614685277,0.0029251939158115234,0.0026121859325790313,0.0022294271266734425,0.0018185374364603584,0.0014177216796011488,0.0010563296867331067,0.0007522249945081791,0.0005119597335386733,0.0003330148642448246,0.00020702900900126104,0.0001230094729295691,6.985309961280398e-05,3.791164039025183e-05,4.862995206978259e-05,8.96018439489593e-05,0.00015778649277946557,0.00026555988295812795,0.00042716423557644437,0.0006567000806972723,0.0009648927097871281,0.0013549733408245758,0.0018185374364603584,0.0023326711126673326,0.0028597268067851725,0.003350698502915263,0.003752199547590959,0.0040158388035599945,0.004107772535188179,0.0040158388035599945,0.003752199547590959,0.003350698502915263,0.0028597268067851725,0.0023326711126673326,0.0018185374364603584,0.0013549733408245758,0.0009648927097871281,0.0006567000806972723,0.00042716423557644437,0.00026555988295812795,0.00015778649277946557,8.96018439489593e-05,4.862995206978259e-05,5.961765325229035e-05,0.00010984694485508604,0.0001934375835066137,0.00032556184709369926,0.0005236799173034838,0.0008050782703955913,0.0011829055252862602,0.0016611229779428843,0.0022294271266734425,0.0028597268067851725,0.003505868171914901,0.00410777253518818,0.004599990788407096,0.0049231980521835346,0.005035903763398988,0.0049231980521835346,0.004599990788407096,0.00410777253518818,0.003505868171914901,0.0028597268067851725,0.0022294271266734425,0.0016611229779428843,0.0011829055252862602,0.0008050782703955913,0.0005236799173034838,0.00032556184709369926,0.0001934375835066137,0.00010984694485508604,5.961765325229035e-05,6.985309961280399e-05,0.0001287059983500731,0.00022664788116309286,0.00038145587581126346,0.0006135878122176821,0.000943297992292018,0.0013859924532870296,0.0019463125855747128,0.0026121859325790313,0.003350698502915263,0.00410777253518818,0.004813014743686122,0.005389739401529316,0.005768436447798745,0.00590049201931124,0.005768436447798745,0.005389739401529316,0.004813014743686122,0.00410777253518818,0.003350698502915263,0.0026121859325790313,0.0019463125855747128,0.0013859924532870296,0.000943297992292018,0.0006135878122176821,0.00038145587581126346,0.00022664788116309286,0.0001287059983500731,6.985309961280399e-05,7.822332225264308e-05,0.00014412833275247386,0.0002538062068021622,0.00042716423557644464,0.0006871116304279247,0.001056329686733107,0.0015520704866950523,0.002179531580269045,0.0029251939158115234,0.003752199547590959,0.004599990788407096,0.005389739401529316,0.0060355707105417536,0.006459645536865248,0.006607524808979688,0.006459645536865248,0.0060355707105417536,0.005389739401529316,0.004599990788407096,0.003752199547590959,0.0029251939158115234,0.002179531580269045,0.0015520704866950523,0.001056329686733107,0.0006871116304279247,0.00042716423557644464,0.0002538062068021622,0.00014412833275247386,7.822332225264308e-05,8.371949542161897e-05,0.00015425516261026106,0.00027163928808500757,0.0004571779008454626,0.0007353898727538142,0.0011305501457295163,0.0016611229779428846,0.002332671112667333,0.003130725614685277,0.0040158388035599945,0.0049231980521835346,0.005768436447798745,0.006459645536865248,0.00691351695856409,0.00707178661124838,0.00691351695856409,0.006459645536865248,0.005768436447798745,0.0049231980521835346,0.0040158388035599945,0.003130725614685277,0.002332671112667333,0.0016611229779428846,0.0011305501457295163,0.0007353898727538142,0.0004571779008454626,0.00027163928808500757,0.00015425516261026106,8.371949542161897e-05,8.563606777440246e-05,0.00015778649277946563,0.0002778578677223028,0.0004676439759293043,0.0007522249945081788,0.0011564315863883308,0.0016991507080201561,0.0023860724493591024,0.003202396640974184,0.004107772535188179,0.005035903763398988,0.00590049201931124,0.006607524808979688,0.00707178661124838,0.007233679496957329,0.00707178661124838,0.006607524808979688,0.00590049201931124,0.005035903763398988,0.004107772535188179,0.003202396640974184,0.0023860724493591024,0.0016991507080201561,0.0011564315863883308,0.0007522249945081788,0.0004676439759293043,0.0002778578677223028,0.00015778649277946563,8.563606777440246e-05,8.371949542161897e-05,0.00015425516261026106,0.00027163928808500757,0.0004571779008454626,0.0007353898727538142,0.0011305501457295163,0.0016611229779428846,0.002332671112667333,0.003130725614685277,0.0040158388035599945,0.0049231980521835346,0.005768436447798745,0.006459645536865248,0.00691351695856409,0.00707178661124838,0.00691351695856409,0.006459645536865248,0.005768436447798745,0.0049231980521835346,0.0040158388035599945,0.003130725614685277,0.002332671112667333,0.0016611229779428846,0.0011305501457295163,0.0007353898727538142,0.0004571779008454626,0.00027163928808500757,0.00015425516261026106,8.371949542161897e-05,7.822332225264308e-05,0.00014412833275247386,0.0002538062068021622,0.00042716423557644464,0.0006871116304279247,0.001056329686733107,0.0015520704866950523,0.002179531580269045,0.0029251939158115234,0.003752199547590959,0.004599990788407096,0.005389739401529316,0.0060355707105417536,0.006459645536865248,0.006607524808979688,0.006459645536865248,0.0060355707105417536,0.005389739401529316,0.004599990788407096,0.003752199547590959,0.0029251939158115234,0.002179531580269045,0.0015520704866950523,0.001056329686733107,0.0006871116304279247,0.00042716423557644464,0.0002538062068021622,0.00014412833275247386,7.822332225264308e-05,6.985309961280399e-05,0.0001287059983500731,0.00022664788116309286,0.00038145587581126346,0.0006135878122176821,0.000943297992292018,0.0013859924532870296,0.0019463125855747128,0.0026121859325790313,0.003350698502915263,0.00410777253518818,0.004813014743686122,0.005389739401529316,0.005768436447798745,0.00590049201931124,0.005768436447798745,0.005389739401529316,0.004813014743686122,0.00410777253518818,0.003350698502915263,0.0026121859325790313,0.0019463125855747128,0.0013859924532870296,0.000943297992292018,0.0006135878122176821,0.00038145587581126346,0.00022664788116309286,0.0001287059983500731,6.985309961280399e-05,5.961765325229035e-05,0.00010984694485508604,0.0001934375835066137,0.00032556184709369926,0.0005236799173034838,0.0008050782703955913,0.0011829055252862602,0.0016611229779428843,0.0022294271266734425,0.0028597268067851725,0.003505868171914901,0.00410777253518818,0.004599990788407096,0.0049231980521835346,0.005035903763398988,0.0049231980521835346,0.004599990788407096,0.00410777253518818,0.003505868171914901,0.0028597268067851725,0.0022294271266734425,0.0016611229779428843,0.0011829055252862602,0.0008050782703955913,0.0005236799173034838,0.00032556184709369926,0.0001934375835066137,0.00010984694485508604,5.961765325229035e-05,4.862995206978259e-05,8.96018439489593e-05,0.00015778649277946557,0.00026555988295812795,0.00042716423557644437,0.0006567000806972723,0.0009648927097871281,0.0013549733408245758,0.0018185374364603584,0.0023326711126673326,0.0028597268067851725,0.003350698502915263,0.003752199547590959,0.0040158388035599945,0.004107772535188179,0.0040158388035599945,0.003752199547590959,0.003350698502915263,0.0028597268067851725,0.0023326711126673326,0.0018185374364603584,0.0013549733408245758,0.0009648927097871281,0.0006567000806972723,0.00042716423557644437,0.00026555988295812795,0.00015778649277946557,8.96018439489593e-05,4.862995206978259e-05,3.791164039025183e-05,6.985309961280398e-05,0.0001230094729295691,0.00020702900900126104,0.0003330148642448246,0.0005119597335386733,0.0007522249945081791,0.0010563296867331067,0.0014177216796011488,0.0018185374364603584,0.0022294271266734425,0.0026121859325790313,0.0029251939158115234,0.003130725614685277,0.003202396640974184,0.003130725614685277,0.0029251939158115234,0.0026121859325790313,0.0022294271266734425,0.0018185374364603584,0.0014177216796011488,0.0010563296867331067,0.0007522249945081791,0.0005119597335386733,0.0003330148642448246,0.00020702900900126104,0.0001230094729295691,6.985309961280398e-05,3.791164039025183e-05,2.8247569176087855e-05,5.204681842213817e-05,9.16530796379246e-05,0.00015425516261026104,0.0002481259137718547,0.00038145587581126336,0.0005604750242834574,0.0007870602693947541,0.0010563296867331067,0.0013549733408245758,0.0016611229779428843,0.0019463125855747128,0.002179531580269045,0.002332671112667333,0.0023860724493591024,0.002332671112667333,0.002179531580269045,0.0019463125855747128,0.0016611229779428843,0.0013549733408245758,0.0010563296867331067,0.0007870602693947541,0.0005604750242834574,0.00038145587581126336,0.0002481259137718547,0.00015425516261026104,9.16530796379246e-05,5.204681842213817e-05,2.8247569176087855e-05,2.01154316074057e-05,3.7063161429120174e-05,6.526725338991152e-05,0.00010984694485508604,0.00017669342864121227,0.00027163928808500757,0.00039912096323590113,0.0005604750242834574,0.0007522249945081791,0.0009648927097871281,0.0011829055252862602,0.0013859924532870296,0.0015520704866950523,0.0016611229779428846,0.0016991507080201561,0.0016611229779428846,0.0015520704866950523,0.0013859924532870296,0.0011829055252862602,0.0009648927097871281,0.0007522249945081791,0.0005604750242834574,0.00039912096323590113,0.00027163928808500757,0.00017669342864121227,0.00010984694485508604,6.526725338991152e-05,3.7063161429120174e-05,2.01154316074057e-05,1.3690439803155e-05,2.5224961132485843e-05,4.442049373292507e-05,7.47611592656746e-05,0.000120256467553746,0.00018487603916639498,0.00027163928808500757,0.00038145587581126336,0.0005119597335386733,0.0006567000806972723,0.0008050782703955913,0.000943297992292018,0.001056329686733107,0.0011305501457295163,0.0011564315863883308,0.0011305501457295163,0.001056329686733107,0.000943297992292018,0.0008050782703955913,0.0006567000806972723,0.0005119597335386733,0.00038145587581126336,0.00027163928808500757,0.00018487603916639498,0.000120256467553746,7.47611592656746e-05,4.442049373292507e-05,2.5224961132485843e-05,1.3690439803155e-05,8.905231513007675e-06,1.640810098296763e-05,2.8894234685042258e-05,4.862995206978257e-05,7.8223322252643e-05,0.000120256467553746,0.00017669342864121227,0.0002481259137718547,0.0003330148642448246,0.00042716423557644437,0.0005236799173034838,0.0006135878122176821,0.0006871116304279247,0.0007353898727538142,0.0007522249945081788,0.0007353898727538142,0.0006871116304279247,0.0006135878122176821,0.0005236799173034838,0.00042716423557644437,0.0003330148642448246,0.0002481259137718547,0.00017669342864121227,0.000120256467553746,7.8223322252643e-05,4.862995206978257e-05,2.8894234685042258e-05,1.640810098296763e-05,8.905231513007675e-06,5.536213103416845e-06,1.0200604389836024e-05,1.7962996295253594e-05,3.0232316529223433e-05,4.862995206978257e-05,7.47611592656746e-05,0.00010984694485508604,0.00015425516261026104,0.00020702900900126104,0.00026555988295812795,0.00032556184709369926,0.00038145587581126346,0.00042716423557644464,0.0004571779008454626,0.0004676439759293043,0.0004571779008454626,0.00042716423557644464,0.00038145587581126346,0.00032556184709369926,0.00026555988295812795,0.00020702900900126104,0.00015425516261026104,0.00010984694485508604,7.47611592656746e-05,4.862995206978257e-05,3.0232316529223433e-05,1.7962996295253594e-05,1.0200604389836024e-05,5.536213103416845e-06,3.289426245927362e-06,6.060846137504988e-06,1.0672990790877467e-05,1.7962996295253594e-05,2.8894234685042258e-05,4.442049373292507e-05,6.526725338991152e-05,9.16530796379246e-05,0.0001230094729295691,0.00015778649277946557,0.0001934375835066137,0.00022664788116309286,0.0002538062068021622,0.00027163928808500757,0.0002778578677223028,0.00027163928808500757,0.0002538062068021622,0.00022664788116309286,0.0001934375835066137,0.00015778649277946557,0.0001230094729295691,9.16530796379246e-05,6.526725338991152e-05,4.442049373292507e-05,2.8894234685042258e-05,1.7962996295253594e-05,1.0672990790877467e-05,6.060846137504988e-06,3.289426245927362e-06,1.867958733205026e-06,3.4417584182595457e-06,6.060846137504988e-06,1.0200604389836024e-05,1.640810098296763e-05,2.5224961132485843e-05,3.7063161429120174e-05,5.204681842213817e-05,6.985309961280398e-05,8.96018439489593e-05,0.00010984694485508604,0.0001287059983500731,0.00014412833275247386,0.00015425516261026106,0.00015778649277946563,0.00015425516261026106,0.00014412833275247386,0.0001287059983500731,0.00010984694485508604,8.96018439489593e-05,6.985309961280398e-05,5.204681842213817e-05,3.7063161429120174e-05,2.5224961132485843e-05,1.640810098296763e-05,1.0200604389836024e-05,6.060846137504988e-06,3.4417584182595457e-06,1.867958733205026e-06,1.013804400229057e-06,1.867958733205026e-06,3.289426245927362e-06,5.536213103416845e-06,8.905231513007675e-06,1.3690439803155e-05,2.01154316074057e-05,2.8247569176087855e-05,3.791164039025183e-05,4.862995206978259e-05,5.961765325229035e-05,6.985309961280399e-05,7.822332225264308e-05,8.371949542161897e-05,8.563606777440246e-05,8.371949542161897e-05,7.822332225264308e-05,6.985309961280399e-05,5.961765325229035e-05,4.862995206978259e-05,3.791164039025183e-05,2.8247569176087855e-05,2.01154316074057e-05,1.3690439803155e-05,8.905231513007675e-06,5.536213103416845e-06,3.289426245927362e-06,1.867958733205026e-06,1.013804400229057e-06);
-const float kernel31[961]=float[](7.886479196365922e-07,1.4085554928020498e-06,2.417090891416493e-06,3.985109165893906e-06,6.312707757055594e-06,9.607698518094147e-06,1.4049189482939105e-05,1.9738374913426676e-05,2.6644019224126225e-05,3.455543016147052e-05,4.305871743964576e-05,5.15506441524998e-05,5.9297355282833045e-05,6.553371257738644e-05,6.958609104546824e-05,7.099182333181052e-05,6.958609104546824e-05,6.553371257738644e-05,5.9297355282833045e-05,5.15506441524998e-05,4.305871743964576e-05,3.455543016147052e-05,2.6644019224126225e-05,1.9738374913426676e-05,1.4049189482939105e-05,9.607698518094147e-06,6.312707757055594e-06,3.985109165893906e-06,2.417090891416493e-06,1.4085554928020498e-06,7.886479196365922e-07,1.4085554928020498e-06,2.5157342419885704e-06,4.317017222685811e-06,7.11755812102089e-06,1.1274738656195392e-05,1.7159718784376684e-05,2.5092392337419005e-05,3.525349615593321e-05,4.7587242283933215e-05,6.17173262594866e-05,7.690452412601576e-05,9.207143158628623e-05,0.00010590735537698075,0.00011704572917294167,0.00012428343285287988,0.00012679412473963337,0.00012428343285287988,0.00011704572917294167,0.00010590735537698075,9.207143158628623e-05,7.690452412601576e-05,6.17173262594866e-05,4.7587242283933215e-05,3.525349615593321e-05,2.5092392337419005e-05,1.7159718784376684e-05,1.1274738656195392e-05,7.11755812102089e-06,4.317017222685811e-06,2.5157342419885704e-06,1.4085554928020498e-06,2.417090891416493e-06,4.317017222685811e-06,7.408031178299073e-06,1.2213778577671418e-05,1.934752890337219e-05,2.9446195187152816e-05,4.3058717439645785e-05,6.0495241319588935e-05,8.166003431168288e-05,0.00010590735537698077,0.0001319686911333041,0.00015799520841325093,0.00018173774858274948,0.00020085127445019843,0.00021327122363143302,0.00021757958813793383,0.00021327122363143302,0.00020085127445019843,0.00018173774858274948,0.00015799520841325093,0.0001319686911333041,0.00010590735537698077,8.166003431168288e-05,6.0495241319588935e-05,4.3058717439645785e-05,2.9446195187152816e-05,1.934752890337219e-05,1.2213778577671418e-05,7.408031178299073e-06,4.317017222685811e-06,2.417090891416493e-06,3.985109165893906e-06,7.11755812102089e-06,1.2213778577671418e-05,2.0137116536628428e-05,3.1898682438475256e-05,4.8548568346246595e-05,7.099182333181058e-05,9.973979113974359e-05,0.00013463463553577387,0.00017461170953362584,0.0002175795881379339,0.0002604900607796267,0.00029963489177753117,0.0003311477684332714,0.00035162480282938753,0.0003587280950331849,0.00035162480282938753,0.0003311477684332714,0.00029963489177753117,0.0002604900607796267,0.0002175795881379339,0.00017461170953362584,0.00013463463553577387,9.973979113974359e-05,7.099182333181058e-05,4.8548568346246595e-05,3.1898682438475256e-05,2.0137116536628428e-05,1.2213778577671418e-05,7.11755812102089e-06,3.985109165893906e-06,6.312707757055594e-06,1.1274738656195392e-05,1.934752890337219e-05,3.1898682438475256e-05,5.052987300638898e-05,7.690452412601578e-05,0.00011245630048724537,0.00015799520841325087,0.0002132712236314329,0.0002765978665476295,0.0003446621652351149,0.0004126355286306379,0.00047464383706142393,0.0005245625651641219,0.0005569997026408466,0.0005682518430286961,0.0005569997026408466,0.0005245625651641219,0.00047464383706142393,0.0004126355286306379,0.0003446621652351149,0.0002765978665476295,0.0002132712236314329,0.00015799520841325087,0.00011245630048724537,7.690452412601578e-05,5.052987300638898e-05,3.1898682438475256e-05,1.934752890337219e-05,1.1274738656195392e-05,6.312707757055594e-06,9.607698518094147e-06,1.7159718784376684e-05,2.9446195187152816e-05,4.8548568346246595e-05,7.690452412601578e-05,0.00011704572917294173,0.00017115416602868447,0.00024046263317692155,0.00032459060328678515,0.0004209713192516255,0.000524562565164122,0.000628015411058203,0.0007223896726188022,0.000798364057696488,0.0008477321339103793,0.0008648574589991101,0.0008477321339103793,0.000798364057696488,0.0007223896726188022,0.000628015411058203,0.000524562565164122,0.0004209713192516255,0.00032459060328678515,0.00024046263317692155,0.00017115416602868447,0.00011704572917294173,7.690452412601578e-05,4.8548568346246595e-05,2.9446195187152816e-05,1.7159718784376684e-05,9.607698518094147e-06,1.4049189482939105e-05,2.5092392337419005e-05,4.3058717439645785e-05,7.099182333181058e-05,0.00011245630048724537,0.00017115416602868447,0.00025027609940121194,0.0003516248028293872,0.00047464383706142377,0.0006155798727354468,0.0007670597552335817,0.0009183372575176099,0.0010563392858369087,0.0011674354583277502,0.0012396256353853377,0.00126466773435164,0.0012396256353853377,0.0011674354583277502,0.0010563392858369087,0.0009183372575176099,0.0007670597552335817,0.0006155798727354468,0.00047464383706142377,0.0003516248028293872,0.00025027609940121194,0.00017115416602868447,0.00011245630048724537,7.099182333181058e-05,4.3058717439645785e-05,2.5092392337419005e-05,1.4049189482939105e-05,1.9738374913426676e-05,3.525349615593321e-05,6.0495241319588935e-05,9.973979113974359e-05,0.00015799520841325087,0.00024046263317692155,0.0003516248028293872,0.0004940144195175462,0.0006668497152553062,0.0008648574589991097,0.0010776787549337205,0.0012902157172741443,0.0014841013344542321,0.0016401856343160773,0.0017416090496354941,0.0017767918862408557,0.0017416090496354941,0.0016401856343160773,0.0014841013344542321,0.0012902157172741443,0.0010776787549337205,0.0008648574589991097,0.0006668497152553062,0.0004940144195175462,0.0003516248028293872,0.00024046263317692155,0.00015799520841325087,9.973979113974359e-05,6.0495241319588935e-05,3.525349615593321e-05,1.9738374913426676e-05,2.6644019224126225e-05,4.7587242283933215e-05,8.166003431168288e-05,0.00013463463553577387,0.0002132712236314329,0.00032459060328678515,0.00047464383706142377,0.0006668497152553062,0.0009001529614669249,0.0011674354583277502,0.0014547141590848236,0.0017416090496354941,0.0020033272576483446,0.00221401902454119,0.0023509263150045443,0.0023984181768717987,0.0023509263150045443,0.00221401902454119,0.0020033272576483446,0.0017416090496354941,0.0014547141590848236,0.0011674354583277502,0.0009001529614669249,0.0006668497152553062,0.00047464383706142377,0.00032459060328678515,0.0002132712236314329,0.00013463463553577387,8.166003431168288e-05,4.7587242283933215e-05,2.6644019224126225e-05,3.455543016147052e-05,6.17173262594866e-05,0.00010590735537698077,0.00017461170953362584,0.0002765978665476295,0.0004209713192516255,0.0006155798727354468,0.0008648574589991097,0.0011674354583277502,0.0015140821701457043,0.0018866625604158059,0.002258745175681654,0.0025981753938817713,0.0028714278853778736,0.0030489870694636874,0.0031105806939911045,0.0030489870694636874,0.0028714278853778736,0.0025981753938817713,0.002258745175681654,0.0018866625604158059,0.0015140821701457043,0.0011674354583277502,0.0008648574589991097,0.0006155798727354468,0.0004209713192516255,0.0002765978665476295,0.00017461170953362584,0.00010590735537698077,6.17173262594866e-05,3.455543016147052e-05,4.305871743964576e-05,7.690452412601576e-05,0.0001319686911333041,0.0002175795881379339,0.0003446621652351149,0.000524562565164122,0.0007670597552335817,0.0010776787549337205,0.0014547141590848236,0.0018866625604158059,0.0023509263150045443,0.002814569803743415,0.003237525900300778,0.003578019471529098,0.0037992718391205113,0.003876022221396662,0.0037992718391205113,0.003578019471529098,0.003237525900300778,0.002814569803743415,0.0023509263150045443,0.0018866625604158059,0.0014547141590848236,0.0010776787549337205,0.0007670597552335817,0.000524562565164122,0.0003446621652351149,0.0002175795881379339,0.0001319686911333041,7.690452412601576e-05,4.305871743964576e-05,5.15506441524998e-05,9.207143158628623e-05,0.00015799520841325093,0.0002604900607796267,0.0004126355286306379,0.000628015411058203,0.0009183372575176099,0.0012902157172741443,0.0017416090496354941,0.002258745175681654,0.002814569803743415,0.003369651838759962,0.003876022221396662,0.00428366703690256,0.004548554213014809,0.004640441103302053,0.004548554213014809,0.00428366703690256,0.003876022221396662,0.003369651838759962,0.002814569803743415,0.002258745175681654,0.0017416090496354941,0.0012902157172741443,0.0009183372575176099,0.000628015411058203,0.0004126355286306379,0.0002604900607796267,0.00015799520841325093,9.207143158628623e-05,5.15506441524998e-05,5.9297355282833045e-05,0.00010590735537698075,0.00018173774858274948,0.00029963489177753117,0.00047464383706142393,0.0007223896726188022,0.0010563392858369087,0.0014841013344542321,0.0020033272576483446,0.0025981753938817713,0.003237525900300778,0.003876022221396662,0.004458486805060967,0.004927389955577389,0.0052320827339125894,0.005337777816268475,0.0052320827339125894,0.004927389955577389,0.004458486805060967,0.003876022221396662,0.003237525900300778,0.0025981753938817713,0.0020033272576483446,0.0014841013344542321,0.0010563392858369087,0.0007223896726188022,0.00047464383706142393,0.00029963489177753117,0.00018173774858274948,0.00010590735537698075,5.9297355282833045e-05,6.553371257738644e-05,0.00011704572917294167,0.00020085127445019843,0.0003311477684332714,0.0005245625651641219,0.000798364057696488,0.0011674354583277502,0.0016401856343160773,0.00221401902454119,0.0028714278853778736,0.003578019471529098,0.00428366703690256,0.004927389955577389,0.005445608080922186,0.00578234567848592,0.005899156809689255,0.00578234567848592,0.005445608080922186,0.004927389955577389,0.00428366703690256,0.003578019471529098,0.0028714278853778736,0.00221401902454119,0.0016401856343160773,0.0011674354583277502,0.000798364057696488,0.0005245625651641219,0.0003311477684332714,0.00020085127445019843,0.00011704572917294167,6.553371257738644e-05,6.958609104546824e-05,0.00012428343285287988,0.00021327122363143302,0.00035162480282938753,0.0005569997026408466,0.0008477321339103793,0.0012396256353853377,0.0017416090496354941,0.0023509263150045443,0.0030489870694636874,0.0037992718391205113,0.004548554213014809,0.0052320827339125894,0.00578234567848592,0.006139905966174975,0.006263940294329982,0.006139905966174975,0.00578234567848592,0.0052320827339125894,0.004548554213014809,0.0037992718391205113,0.0030489870694636874,0.0023509263150045443,0.0017416090496354941,0.0012396256353853377,0.0008477321339103793,0.0005569997026408466,0.00035162480282938753,0.00021327122363143302,0.00012428343285287988,6.958609104546824e-05,7.099182333181052e-05,0.00012679412473963337,0.00021757958813793383,0.0003587280950331849,0.0005682518430286961,0.0008648574589991101,0.00126466773435164,0.0017767918862408557,0.0023984181768717987,0.0031105806939911045,0.003876022221396662,0.004640441103302053,0.005337777816268475,0.005899156809689255,0.006263940294329982,0.006390480282123038,0.006263940294329982,0.005899156809689255,0.005337777816268475,0.004640441103302053,0.003876022221396662,0.0031105806939911045,0.0023984181768717987,0.0017767918862408557,0.00126466773435164,0.0008648574589991101,0.0005682518430286961,0.0003587280950331849,0.00021757958813793383,0.00012679412473963337,7.099182333181052e-05,6.958609104546824e-05,0.00012428343285287988,0.00021327122363143302,0.00035162480282938753,0.0005569997026408466,0.0008477321339103793,0.0012396256353853377,0.0017416090496354941,0.0023509263150045443,0.0030489870694636874,0.0037992718391205113,0.004548554213014809,0.0052320827339125894,0.00578234567848592,0.006139905966174975,0.006263940294329982,0.006139905966174975,0.00578234567848592,0.0052320827339125894,0.004548554213014809,0.0037992718391205113,0.0030489870694636874,0.0023509263150045443,0.0017416090496354941,0.0012396256353853377,0.0008477321339103793,0.0005569997026408466,0.00035162480282938753,0.00021327122363143302,0.00012428343285287988,6.958609104546824e-05,6.553371257738644e-05,0.00011704572917294167,0.00020085127445019843,0.0003311477684332714,0.0005245625651641219,0.000798364057696488,0.0011674354583277502,0.0016401856343160773,0.00221401902454119,0.0028714278853778736,0.003578019471529098,0.00428366703690256,0.004927389955577389,0.005445608080922186,0.00578234567848592,0.005899156809689255,0.00578234567848592,0.005445608080922186,0.004927389955577389,0.00428366703690256,0.003578019471529098,0.0028714278853778736,0.00221401902454119,0.0016401856343160773,0.0011674354583277502,0.000798364057696488,0.0005245625651641219,0.0003311477684332714,0.00020085127445019843,0.00011704572917294167,6.553371257738644e-05,5.9297355282833045e-05,0.00010590735537698075,0.00018173774858274948,0.00029963489177753117,0.00047464383706142393,0.0007223896726188022,0.0010563392858369087,0.0014841013344542321,0.0020033272576483446,0.0025981753938817713,0.003237525900300778,0.003876022221396662,0.004458486805060967,0.004927389955577389,0.0052320827339125894,0.005337777816268475,0.0052320827339125894,0.004927389955577389,0.004458486805060967,0.003876022221396662,0.003237525900300778,0.0025981753938817713,0.0020033272576483446,0.0014841013344542321,0.0010563392858369087,0.0007223896726188022,0.00047464383706142393,0.00029963489177753117,0.00018173774858274948,0.00010590735537698075,5.9297355282833045e-05,5.15506441524998e-05,9.207143158628623e-05,0.00015799520841325093,0.0002604900607796267,0.0004126355286306379,0.000628015411058203,0.0009183372575176099,0.0012902157172741443,0.0017416090496354941,0.002258745175681654,0.002814569803743415,0.003369651838759962,0.003876022221396662,0.00428366703690256,0.004548554213014809,0.004640441103302053,0.004548554213014809,0.00428366703690256,0.003876022221396662,0.003369651838759962,0.002814569803743415,0.002258745175681654,0.0017416090496354941,0.0012902157172741443,0.0009183372575176099,0.000628015411058203,0.0004126355286306379,0.0002604900607796267,0.00015799520841325093,9.207143158628623e-05,5.15506441524998e-05,4.305871743964576e-05,7.690452412601576e-05,0.0001319686911333041,0.0002175795881379339,0.0003446621652351149,0.000524562565164122,0.0007670597552335817,0.0010776787549337205,0.0014547141590848236,0.0018866625604158059,0.0023509263150045443,0.002814569803743415,0.003237525900300778,0.003578019471529098,0.0037992718391205113,0.003876022221396662,0.0037992718391205113,0.003578019471529098,0.003237525900300778,0.002814569803743415,0.0023509263150045443,0.0018866625604158059,0.0014547141590848236,0.0010776787549337205,0.0007670597552335817,0.000524562565164122,0.0003446621652351149,0.0002175795881379339,0.0001319686911333041,7.690452412601576e-05,4.305871743964576e-05,3.455543016147052e-05,6.17173262594866e-05,0.00010590735537698077,0.00017461170953362584,0.0002765978665476295,0.0004209713192516255,0.0006155798727354468,0.0008648574589991097,0.0011674354583277502,0.0015140821701457043,0.0018866625604158059,0.002258745175681654,0.0025981753938817713,0.0028714278853778736,0.0030489870694636874,0.0031105806939911045,0.0030489870694636874,0.0028714278853778736,0.0025981753938817713,0.002258745175681654,0.0018866625604158059,0.0015140821701457043,0.0011674354583277502,0.0008648574589991097,0.0006155798727354468,0.0004209713192516255,0.0002765978665476295,0.00017461170953362584,0.00010590735537698077,6.17173262594866e-05,3.455543016147052e-05,2.6644019224126225e-05,4.7587242283933215e-05,8.166003431168288e-05,0.00013463463553577387,0.0002132712236314329,0.00032459060328678515,0.00047464383706142377,0.0006668497152553062,0.0009001529614669249,0.0011674354583277502,0.0014547141590848236,0.0017416090496354941,0.0020033272576483446,0.00221401902454119,0.0023509263150045443,0.0023984181768717987,0.0023509263150045443,0.00221401902454119,0.0020033272576483446,0.0017416090496354941,0.0014547141590848236,0.0011674354583277502,0.0009001529614669249,0.0006668497152553062,0.00047464383706142377,0.00032459060328678515,0.0002132712236314329,0.00013463463553577387,8.166003431168288e-05,4.7587242283933215e-05,2.6644019224126225e-05,1.9738374913426676e-05,3.525349615593321e-05,6.0495241319588935e-05,9.973979113974359e-05,0.00015799520841325087,0.00024046263317692155,0.0003516248028293872,0.0004940144195175462,0.0006668497152553062,0.0008648574589991097,0.0010776787549337205,0.0012902157172741443,0.0014841013344542321,0.0016401856343160773,0.0017416090496354941,0.0017767918862408557,0.0017416090496354941,0.0016401856343160773,0.0014841013344542321,0.0012902157172741443,0.0010776787549337205,0.0008648574589991097,0.0006668497152553062,0.0004940144195175462,0.0003516248028293872,0.00024046263317692155,0.00015799520841325087,9.973979113974359e-05,6.0495241319588935e-05,3.525349615593321e-05,1.9738374913426676e-05,1.4049189482939105e-05,2.5092392337419005e-05,4.3058717439645785e-05,7.099182333181058e-05,0.00011245630048724537,0.00017115416602868447,0.00025027609940121194,0.0003516248028293872,0.00047464383706142377,0.0006155798727354468,0.0007670597552335817,0.0009183372575176099,0.0010563392858369087,0.0011674354583277502,0.0012396256353853377,0.00126466773435164,0.0012396256353853377,0.0011674354583277502,0.0010563392858369087,0.0009183372575176099,0.0007670597552335817,0.0006155798727354468,0.00047464383706142377,0.0003516248028293872,0.00025027609940121194,0.00017115416602868447,0.00011245630048724537,7.099182333181058e-05,4.3058717439645785e-05,2.5092392337419005e-05,1.4049189482939105e-05,9.607698518094147e-06,1.7159718784376684e-05,2.9446195187152816e-05,4.8548568346246595e-05,7.690452412601578e-05,0.00011704572917294173,0.00017115416602868447,0.00024046263317692155,0.00032459060328678515,0.0004209713192516255,0.000524562565164122,0.000628015411058203,0.0007223896726188022,0.000798364057696488,0.0008477321339103793,0.0008648574589991101,0.0008477321339103793,0.000798364057696488,0.0007223896726188022,0.000628015411058203,0.000524562565164122,0.0004209713192516255,0.00032459060328678515,0.00024046263317692155,0.00017115416602868447,0.00011704572917294173,7.690452412601578e-05,4.8548568346246595e-05,2.9446195187152816e-05,1.7159718784376684e-05,9.607698518094147e-06,6.312707757055594e-06,1.1274738656195392e-05,1.934752890337219e-05,3.1898682438475256e-05,5.052987300638898e-05,7.690452412601578e-05,0.00011245630048724537,0.00015799520841325087,0.0002132712236314329,0.0002765978665476295,0.0003446621652351149,0.0004126355286306379,0.00047464383706142393,0.0005245625651641219,0.0005569997026408466,0.0005682518430286961,0.0005569997026408466,0.0005245625651641219,0.00047464383706142393,0.0004126355286306379,0.0003446621652351149,0.0002765978665476295,0.0002132712236314329,0.00015799520841325087,0.00011245630048724537,7.690452412601578e-05,5.052987300638898e-05,3.1898682438475256e-05,1.934752890337219e-05,1.1274738656195392e-05,6.312707757055594e-06,3.985109165893906e-06,7.11755812102089e-06,1.2213778577671418e-05,2.0137116536628428e-05,3.1898682438475256e-05,4.8548568346246595e-05,7.099182333181058e-05,9.973979113974359e-05,0.00013463463553577387,0.00017461170953362584,0.0002175795881379339,0.0002604900607796267,0.00029963489177753117,0.0003311477684332714,0.00035162480282938753,0.0003587280950331849,0.00035162480282938753,0.0003311477684332714,0.00029963489177753117,0.0002604900607796267,0.0002175795881379339,0.00017461170953362584,0.00013463463553577387,9.973979113974359e-05,7.099182333181058e-05,4.8548568346246595e-05,3.1898682438475256e-05,2.0137116536628428e-05,1.2213778577671418e-05,7.11755812102089e-06,3.985109165893906e-06,2.417090891416493e-06,4.317017222685811e-06,7.408031178299073e-06,1.2213778577671418e-05,1.934752890337219e-05,2.9446195187152816e-05,4.3058717439645785e-05,6.0495241319588935e-05,8.166003431168288e-05,0.00010590735537698077,0.0001319686911333041,0.00015799520841325093,0.00018173774858274948,0.00020085127445019843,0.00021327122363143302,0.00021757958813793383,0.00021327122363143302,0.00020085127445019843,0.00018173774858274948,0.00015799520841325093,0.0001319686911333041,0.00010590735537698077,8.166003431168288e-05,6.0495241319588935e-05,4.3058717439645785e-05,2.9446195187152816e-05,1.934752890337219e-05,1.2213778577671418e-05,7.408031178299073e-06,4.317017222685811e-06,2.417090891416493e-06,1.4085554928020498e-06,2.5157342419885704e-06,4.317017222685811e-06,7.11755812102089e-06,1.1274738656195392e-05,1.7159718784376684e-05,2.5092392337419005e-05,3.525349615593321e-05,4.7587242283933215e-05,6.17173262594866e-05,7.690452412601576e-05,9.207143158628623e-05,0.00010590735537698075,0.00011704572917294167,0.00012428343285287988,0.00012679412473963337,0.00012428343285287988,0.00011704572917294167,0.00010590735537698075,9.207143158628623e-05,7.690452412601576e-05,6.17173262594866e-05,4.7587242283933215e-05,3.525349615593321e-05,2.5092392337419005e-05,1.7159718784376684e-05,1.1274738656195392e-05,7.11755812102089e-06,4.317017222685811e-06,2.5157342419885704e-06,1.4085554928020498e-06,7.886479196365922e-07,1.4085554928020498e-06,2.417090891416493e-06,3.985109165893906e-06,6.312707757055594e-06,9.607698518094147e-06,1.4049189482939105e-05,1.9738374913426676e-05,2.6644019224126225e-05,3.455543016147052e-05,4.305871743964576e-05,5.15506441524998e-05,5.9297355282833045e-05,6.553371257738644e-05,6.958609104546824e-05,7.099182333181052e-05,6.958609104546824e-05,6.553371257738644e-05,5.9297355282833045e-05,5.15506441524998e-05,4.305871743964576e-05,3.455543016147052e-05,2.6644019224126225e-05,1.9738374913426676e-05,1.4049189482939105e-05,9.607698518094147e-06,6.312707757055594e-06,3.985109165893906e-06,2.417090891416493e-06,1.4085554928020498e-06,7.886479196365922e-07);
-const float kernel33[1089]=float[](6.264435757455311e-07,1.0877389907546813e-06,1.8226639809051938e-06,2.9473228040927085e-06,4.5992601530831015e-06,6.926078753912789e-06,1.0065284465015433e-05,1.41157468018587e-05,1.9103847571431557e-05,2.495037096192143e-05,3.144650237448827e-05,3.824783592344331e-05,4.489320022860944e-05,5.0850290853531536e-05,5.558344951293063e-05,5.863227264473435e-05,5.968526673090538e-05,5.863227264473435e-05,5.558344951293063e-05,5.0850290853531536e-05,4.489320022860944e-05,3.824783592344331e-05,3.144650237448827e-05,2.495037096192143e-05,1.9103847571431557e-05,1.41157468018587e-05,1.0065284465015433e-05,6.926078753912789e-06,4.5992601530831015e-06,2.9473228040927085e-06,1.8226639809051938e-06,1.0877389907546813e-06,6.264435757455311e-07,1.0877389907546813e-06,1.8887193640702815e-06,3.1648224290834998e-06,5.117648350909647e-06,7.98602586223189e-06,1.2026248181574207e-05,1.747707661077848e-05,2.4510185393360122e-05,3.3171383156336043e-05,4.332312179397257e-05,5.4602821514902536e-05,6.641246563412245e-05,7.795128914890755e-05,8.829501361998281e-05,9.651353707938517e-05,0.00010180742774213312,0.00010363581703194138,0.00010180742774213312,9.651353707938517e-05,8.829501361998281e-05,7.795128914890755e-05,6.641246563412245e-05,5.4602821514902536e-05,4.332312179397257e-05,3.3171383156336043e-05,2.4510185393360122e-05,1.747707661077848e-05,1.2026248181574207e-05,7.98602586223189e-06,5.117648350909647e-06,3.1648224290834998e-06,1.8887193640702815e-06,1.0877389907546813e-06,1.8226639809051938e-06,3.1648224290834998e-06,5.303117656423453e-06,8.575359893709623e-06,1.338174122044523e-05,2.0151717987762642e-05,2.9285369285039083e-05,4.107036013372202e-05,5.558344951293063e-05,7.259415568017576e-05,9.149492376103803e-05,0.00011128369031842398,0.00013061865778872577,0.00014795106398366784,0.00016172238855049622,0.0001705930679247333,0.0001736567985898391,0.0001705930679247333,0.00016172238855049622,0.00014795106398366784,0.00013061865778872577,0.00011128369031842398,9.149492376103803e-05,7.259415568017576e-05,5.558344951293063e-05,4.107036013372202e-05,2.9285369285039083e-05,2.0151717987762642e-05,1.338174122044523e-05,8.575359893709623e-06,5.303117656423453e-06,3.1648224290834998e-06,1.8226639809051938e-06,2.9473228040927085e-06,5.117648350909647e-06,8.575359893709623e-06,1.3866710503315229e-05,2.1638827271880514e-05,3.2586158825326246e-05,4.7355649546114266e-05,6.641246563412243e-05,8.988072952329738e-05,0.00011738774273345741,0.0001479510639836679,0.00017995031538187967,0.00021121575494650522,0.00023924297036488447,0.0002615117699700744,0.00027585602424918696,0.00028081020304981263,0.00027585602424918696,0.0002615117699700744,0.00023924297036488447,0.00021121575494650522,0.00017995031538187967,0.0001479510639836679,0.00011738774273345741,8.988072952329738e-05,6.641246563412243e-05,4.7355649546114266e-05,3.2586158825326246e-05,2.1638827271880514e-05,1.3866710503315229e-05,8.575359893709623e-06,5.117648350909647e-06,2.9473228040927085e-06,4.5992601530831015e-06,7.98602586223189e-06,1.338174122044523e-05,2.1638827271880514e-05,3.376711770180349e-05,5.08502908535315e-05,7.389789529615442e-05,0.00010363581703194134,0.00014025774755737903,0.00018318209558337154,0.00023087577385192589,0.0002808102030498126,0.000329599528114081,0.00037333564514090573,0.00040808582674263603,0.0004304698550682755,0.0004382007887540347,0.0004304698550682755,0.00040808582674263603,0.00037333564514090573,0.000329599528114081,0.0002808102030498126,0.00023087577385192589,0.00018318209558337154,0.00014025774755737903,0.00010363581703194134,7.389789529615442e-05,5.08502908535315e-05,3.376711770180349e-05,2.1638827271880514e-05,1.338174122044523e-05,7.98602586223189e-06,4.5992601530831015e-06,6.926078753912789e-06,1.2026248181574207e-05,2.0151717987762642e-05,3.2586158825326246e-05,5.08502908535315e-05,7.657603775138457e-05,0.00011128369031842394,0.00015606636863282317,0.00021121575494650516,0.0002758560242491869,0.00034767848280925566,0.00042287531396141515,0.0004963477196305859,0.0005622104412065927,0.0006145411392918085,0.0006482495049534611,0.0006598916068930419,0.0006482495049534611,0.0006145411392918085,0.0005622104412065927,0.0004963477196305859,0.00042287531396141515,0.00034767848280925566,0.0002758560242491869,0.00021121575494650516,0.00015606636863282317,0.00011128369031842394,7.657603775138457e-05,5.08502908535315e-05,3.2586158825326246e-05,2.0151717987762642e-05,1.2026248181574207e-05,6.926078753912789e-06,1.0065284465015433e-05,1.747707661077848e-05,2.9285369285039083e-05,4.7355649546114266e-05,7.389789529615442e-05,0.00011128369031842394,0.00016172238855049622,0.00022680256051433087,0.0003069480917797161,0.0004008861946433512,0.0005052617731011438,0.0006145411392918087,0.0007213144939799046,0.0008170291186408076,0.0008930784073069192,0.0009420648975404613,0.0009589837158149991,0.0009420648975404613,0.0008930784073069192,0.0008170291186408076,0.0007213144939799046,0.0006145411392918087,0.0005052617731011438,0.0004008861946433512,0.0003069480917797161,0.00022680256051433087,0.00016172238855049622,0.00011128369031842394,7.389789529615442e-05,4.7355649546114266e-05,2.9285369285039083e-05,1.747707661077848e-05,1.0065284465015433e-05,1.41157468018587e-05,2.4510185393360122e-05,4.107036013372202e-05,6.641246563412243e-05,0.00010363581703194134,0.00015606636863282317,0.00022680256051433087,0.0003180722342583709,0.00043046985506827557,0.0005622104412065927,0.0007085887420811201,0.000861844208350017,0.0010115851963172066,0.0011458172104887182,0.0012524701825933318,0.0013211697702951828,0.001344897043556075,0.0013211697702951828,0.0012524701825933318,0.0011458172104887182,0.0010115851963172066,0.000861844208350017,0.0007085887420811201,0.0005622104412065927,0.00043046985506827557,0.0003180722342583709,0.00022680256051433087,0.00015606636863282317,0.00010363581703194134,6.641246563412243e-05,4.107036013372202e-05,2.4510185393360122e-05,1.41157468018587e-05,1.9103847571431557e-05,3.3171383156336043e-05,5.558344951293063e-05,8.988072952329738e-05,0.00014025774755737903,0.00021121575494650516,0.0003069480917797161,0.00043046985506827557,0.0005825855769981451,0.0007608795143919543,0.0009589837158149993,0.0011663952759815618,0.0013690504418381838,0.001550716206599644,0.0016950572854477284,0.0017880333404945317,0.0018201451527864686,0.0017880333404945317,0.0016950572854477284,0.001550716206599644,0.0013690504418381838,0.0011663952759815618,0.0009589837158149993,0.0007608795143919543,0.0005825855769981451,0.00043046985506827557,0.0003069480917797161,0.00021121575494650516,0.00014025774755737903,8.988072952329738e-05,5.558344951293063e-05,3.3171383156336043e-05,1.9103847571431557e-05,2.495037096192143e-05,4.332312179397257e-05,7.259415568017576e-05,0.00011738774273345741,0.00018318209558337154,0.0002758560242491869,0.0004008861946433512,0.0005622104412065927,0.0007608795143919543,0.0009937383592714304,0.0012524701825933325,0.0015233577799004558,0.0017880333404945322,0.002025295923591029,0.0022138110093002155,0.0023352413680444322,0.002377180648911683,0.0023352413680444322,0.0022138110093002155,0.002025295923591029,0.0017880333404945322,0.0015233577799004558,0.0012524701825933325,0.0009937383592714304,0.0007608795143919543,0.0005622104412065927,0.0004008861946433512,0.0002758560242491869,0.00018318209558337154,0.00011738774273345741,7.259415568017576e-05,4.332312179397257e-05,2.495037096192143e-05,3.144650237448827e-05,5.4602821514902536e-05,9.149492376103803e-05,0.0001479510639836679,0.00023087577385192589,0.00034767848280925566,0.0005052617731011438,0.0007085887420811201,0.0009589837158149993,0.0012524701825933325,0.0015785659712637748,0.0019199824369723819,0.0022535694869362144,0.0025526062585380514,0.0027902035311168105,0.002943249755175473,0.0029961084360098826,0.002943249755175473,0.0027902035311168105,0.0025526062585380514,0.0022535694869362144,0.0019199824369723819,0.0015785659712637748,0.0012524701825933325,0.0009589837158149993,0.0007085887420811201,0.0005052617731011438,0.00034767848280925566,0.00023087577385192589,0.0001479510639836679,9.149492376103803e-05,5.4602821514902536e-05,3.144650237448827e-05,3.824783592344331e-05,6.641246563412245e-05,0.00011128369031842398,0.00017995031538187967,0.0002808102030498126,0.00042287531396141515,0.0006145411392918087,0.000861844208350017,0.0011663952759815618,0.0015233577799004558,0.0019199824369723819,0.002335241368044433,0.002740977516416634,0.00310469075991497,0.0033936762053940364,0.0035798236756846343,0.003644114773232078,0.0035798236756846343,0.0033936762053940364,0.00310469075991497,0.002740977516416634,0.002335241368044433,0.0019199824369723819,0.0015233577799004558,0.0011663952759815618,0.000861844208350017,0.0006145411392918087,0.00042287531396141515,0.0002808102030498126,0.00017995031538187967,0.00011128369031842398,6.641246563412245e-05,3.824783592344331e-05,4.489320022860944e-05,7.795128914890755e-05,0.00013061865778872577,0.00021121575494650522,0.000329599528114081,0.0004963477196305859,0.0007213144939799046,0.0010115851963172066,0.0013690504418381838,0.0017880333404945322,0.0022535694869362144,0.002740977516416634,0.0032172082287977646,0.0036441147732320786,0.003983309950000073,0.004201799583571284,0.004277260927865156,0.004201799583571284,0.003983309950000073,0.0036441147732320786,0.0032172082287977646,0.002740977516416634,0.0022535694869362144,0.0017880333404945322,0.0013690504418381838,0.0010115851963172066,0.0007213144939799046,0.0004963477196305859,0.000329599528114081,0.00021121575494650522,0.00013061865778872577,7.795128914890755e-05,4.489320022860944e-05,5.0850290853531536e-05,8.829501361998281e-05,0.00014795106398366784,0.00023924297036488447,0.00037333564514090573,0.0005622104412065927,0.0008170291186408076,0.0011458172104887182,0.001550716206599644,0.002025295923591029,0.0025526062585380514,0.00310469075991497,0.0036441147732320786,0.00412766956195767,0.004511874147661848,0.004759356201937348,0.004844830868167457,0.004759356201937348,0.004511874147661848,0.00412766956195767,0.0036441147732320786,0.00310469075991497,0.0025526062585380514,0.002025295923591029,0.001550716206599644,0.0011458172104887182,0.0008170291186408076,0.0005622104412065927,0.00037333564514090573,0.00023924297036488447,0.00014795106398366784,8.829501361998281e-05,5.0850290853531536e-05,5.558344951293063e-05,9.651353707938517e-05,0.00016172238855049622,0.0002615117699700744,0.00040808582674263603,0.0006145411392918085,0.0008930784073069192,0.0012524701825933318,0.0016950572854477284,0.0022138110093002155,0.0027902035311168105,0.0033936762053940364,0.003983309950000073,0.004511874147661848,0.0049318405988594705,0.005202358348871972,0.005295789019872862,0.005202358348871972,0.0049318405988594705,0.004511874147661848,0.003983309950000073,0.0033936762053940364,0.0027902035311168105,0.0022138110093002155,0.0016950572854477284,0.0012524701825933318,0.0008930784073069192,0.0006145411392918085,0.00040808582674263603,0.0002615117699700744,0.00016172238855049622,9.651353707938517e-05,5.558344951293063e-05,5.863227264473435e-05,0.00010180742774213312,0.0001705930679247333,0.00027585602424918696,0.0004304698550682755,0.0006482495049534611,0.0009420648975404613,0.0013211697702951828,0.0017880333404945317,0.0023352413680444322,0.002943249755175473,0.0035798236756846343,0.004201799583571284,0.004759356201937348,0.005202358348871972,0.005487714342660793,0.005586269805186203,0.005487714342660793,0.005202358348871972,0.004759356201937348,0.004201799583571284,0.0035798236756846343,0.002943249755175473,0.0023352413680444322,0.0017880333404945317,0.0013211697702951828,0.0009420648975404613,0.0006482495049534611,0.0004304698550682755,0.00027585602424918696,0.0001705930679247333,0.00010180742774213312,5.863227264473435e-05,5.968526673090538e-05,0.00010363581703194138,0.0001736567985898391,0.00028081020304981263,0.0004382007887540347,0.0006598916068930419,0.0009589837158149991,0.001344897043556075,0.0018201451527864686,0.002377180648911683,0.0029961084360098826,0.003644114773232078,0.004277260927865156,0.004844830868167457,0.005295789019872862,0.005586269805186203,0.005686595254009567,0.005586269805186203,0.005295789019872862,0.004844830868167457,0.004277260927865156,0.003644114773232078,0.0029961084360098826,0.002377180648911683,0.0018201451527864686,0.001344897043556075,0.0009589837158149991,0.0006598916068930419,0.0004382007887540347,0.00028081020304981263,0.0001736567985898391,0.00010363581703194138,5.968526673090538e-05,5.863227264473435e-05,0.00010180742774213312,0.0001705930679247333,0.00027585602424918696,0.0004304698550682755,0.0006482495049534611,0.0009420648975404613,0.0013211697702951828,0.0017880333404945317,0.0023352413680444322,0.002943249755175473,0.0035798236756846343,0.004201799583571284,0.004759356201937348,0.005202358348871972,0.005487714342660793,0.005586269805186203,0.005487714342660793,0.005202358348871972,0.004759356201937348,0.004201799583571284,0.0035798236756846343,0.002943249755175473,0.0023352413680444322,0.0017880333404945317,0.0013211697702951828,0.0009420648975404613,0.0006482495049534611,0.0004304698550682755,0.00027585602424918696,0.0001705930679247333,0.00010180742774213312,5.863227264473435e-05,5.558344951293063e-05,9.651353707938517e-05,0.00016172238855049622,0.0002615117699700744,0.00040808582674263603,0.0006145411392918085,0.0008930784073069192,0.0012524701825933318,0.0016950572854477284,0.0022138110093002155,0.0027902035311168105,0.0033936762053940364,0.003983309950000073,0.004511874147661848,0.0049318405988594705,0.005202358348871972,0.005295789019872862,0.005202358348871972,0.0049318405988594705,0.004511874147661848,0.003983309950000073,0.0033936762053940364,0.0027902035311168105,0.0022138110093002155,0.0016950572854477284,0.0012524701825933318,0.0008930784073069192,0.0006145411392918085,0.00040808582674263603,0.0002615117699700744,0.00016172238855049622,9.651353707938517e-05,5.558344951293063e-05,5.0850290853531536e-05,8.829501361998281e-05,0.00014795106398366784,0.00023924297036488447,0.00037333564514090573,0.0005622104412065927,0.0008170291186408076,0.0011458172104887182,0.001550716206599644,0.002025295923591029,0.0025526062585380514,0.00310469075991497,0.0036441147732320786,0.00412766956195767,0.004511874147661848,0.004759356201937348,0.004844830868167457,0.004759356201937348,0.004511874147661848,0.00412766956195767,0.0036441147732320786,0.00310469075991497,0.0025526062585380514,0.002025295923591029,0.001550716206599644,0.0011458172104887182,0.0008170291186408076,0.0005622104412065927,0.00037333564514090573,0.00023924297036488447,0.00014795106398366784,8.829501361998281e-05,5.0850290853531536e-05,4.489320022860944e-05,7.795128914890755e-05,0.00013061865778872577,0.00021121575494650522,0.000329599528114081,0.0004963477196305859,0.0007213144939799046,0.0010115851963172066,0.0013690504418381838,0.0017880333404945322,0.0022535694869362144,0.002740977516416634,0.0032172082287977646,0.0036441147732320786,0.003983309950000073,0.004201799583571284,0.004277260927865156,0.004201799583571284,0.003983309950000073,0.0036441147732320786,0.0032172082287977646,0.002740977516416634,0.0022535694869362144,0.0017880333404945322,0.0013690504418381838,0.0010115851963172066,0.0007213144939799046,0.0004963477196305859,0.000329599528114081,0.00021121575494650522,0.00013061865778872577,7.795128914890755e-05,4.489320022860944e-05,3.824783592344331e-05,6.641246563412245e-05,0.00011128369031842398,0.00017995031538187967,0.0002808102030498126,0.00042287531396141515,0.0006145411392918087,0.000861844208350017,0.0011663952759815618,0.0015233577799004558,0.0019199824369723819,0.002335241368044433,0.002740977516416634,0.00310469075991497,0.0033936762053940364,0.0035798236756846343,0.003644114773232078,0.0035798236756846343,0.0033936762053940364,0.00310469075991497,0.002740977516416634,0.002335241368044433,0.0019199824369723819,0.0015233577799004558,0.0011663952759815618,0.000861844208350017,0.0006145411392918087,0.00042287531396141515,0.0002808102030498126,0.00017995031538187967,0.00011128369031842398,6.641246563412245e-05,3.824783592344331e-05,3.144650237448827e-05,5.4602821514902536e-05,9.149492376103803e-05,0.0001479510639836679,0.00023087577385192589,0.00034767848280925566,0.0005052617731011438,0.0007085887420811201,0.0009589837158149993,0.0012524701825933325,0.0015785659712637748,0.0019199824369723819,0.0022535694869362144,0.0025526062585380514,0.0027902035311168105,0.002943249755175473,0.0029961084360098826,0.002943249755175473,0.0027902035311168105,0.0025526062585380514,0.0022535694869362144,0.0019199824369723819,0.0015785659712637748,0.0012524701825933325,0.0009589837158149993,0.0007085887420811201,0.0005052617731011438,0.00034767848280925566,0.00023087577385192589,0.0001479510639836679,9.149492376103803e-05,5.4602821514902536e-05,3.144650237448827e-05,2.495037096192143e-05,4.332312179397257e-05,7.259415568017576e-05,0.00011738774273345741,0.00018318209558337154,0.0002758560242491869,0.0004008861946433512,0.0005622104412065927,0.0007608795143919543,0.0009937383592714304,0.0012524701825933325,0.0015233577799004558,0.0017880333404945322,0.002025295923591029,0.0022138110093002155,0.0023352413680444322,0.002377180648911683,0.0023352413680444322,0.0022138110093002155,0.002025295923591029,0.0017880333404945322,0.0015233577799004558,0.0012524701825933325,0.0009937383592714304,0.0007608795143919543,0.0005622104412065927,0.0004008861946433512,0.0002758560242491869,0.00018318209558337154,0.00011738774273345741,7.259415568017576e-05,4.332312179397257e-05,2.495037096192143e-05,1.9103847571431557e-05,3.3171383156336043e-05,5.558344951293063e-05,8.988072952329738e-05,0.00014025774755737903,0.00021121575494650516,0.0003069480917797161,0.00043046985506827557,0.0005825855769981451,0.0007608795143919543,0.0009589837158149993,0.0011663952759815618,0.0013690504418381838,0.001550716206599644,0.0016950572854477284,0.0017880333404945317,0.0018201451527864686,0.0017880333404945317,0.0016950572854477284,0.001550716206599644,0.0013690504418381838,0.0011663952759815618,0.0009589837158149993,0.0007608795143919543,0.0005825855769981451,0.00043046985506827557,0.0003069480917797161,0.00021121575494650516,0.00014025774755737903,8.988072952329738e-05,5.558344951293063e-05,3.3171383156336043e-05,1.9103847571431557e-05,1.41157468018587e-05,2.4510185393360122e-05,4.107036013372202e-05,6.641246563412243e-05,0.00010363581703194134,0.00015606636863282317,0.00022680256051433087,0.0003180722342583709,0.00043046985506827557,0.0005622104412065927,0.0007085887420811201,0.000861844208350017,0.0010115851963172066,0.0011458172104887182,0.0012524701825933318,0.0013211697702951828,0.001344897043556075,0.0013211697702951828,0.0012524701825933318,0.0011458172104887182,0.0010115851963172066,0.000861844208350017,0.0007085887420811201,0.0005622104412065927,0.00043046985506827557,0.0003180722342583709,0.00022680256051433087,0.00015606636863282317,0.00010363581703194134,6.641246563412243e-05,4.107036013372202e-05,2.4510185393360122e-05,1.41157468018587e-05,1.0065284465015433e-05,1.747707661077848e-05,2.9285369285039083e-05,4.7355649546114266e-05,7.389789529615442e-05,0.00011128369031842394,0.00016172238855049622,0.00022680256051433087,0.0003069480917797161,0.0004008861946433512,0.0005052617731011438,0.0006145411392918087,0.0007213144939799046,0.0008170291186408076,0.0008930784073069192,0.0009420648975404613,0.0009589837158149991,0.0009420648975404613,0.0008930784073069192,0.0008170291186408076,0.0007213144939799046,0.0006145411392918087,0.0005052617731011438,0.0004008861946433512,0.0003069480917797161,0.00022680256051433087,0.00016172238855049622,0.00011128369031842394,7.389789529615442e-05,4.7355649546114266e-05,2.9285369285039083e-05,1.747707661077848e-05,1.0065284465015433e-05,6.926078753912789e-06,1.2026248181574207e-05,2.0151717987762642e-05,3.2586158825326246e-05,5.08502908535315e-05,7.657603775138457e-05,0.00011128369031842394,0.00015606636863282317,0.00021121575494650516,0.0002758560242491869,0.00034767848280925566,0.00042287531396141515,0.0004963477196305859,0.0005622104412065927,0.0006145411392918085,0.0006482495049534611,0.0006598916068930419,0.0006482495049534611,0.0006145411392918085,0.0005622104412065927,0.0004963477196305859,0.00042287531396141515,0.00034767848280925566,0.0002758560242491869,0.00021121575494650516,0.00015606636863282317,0.00011128369031842394,7.657603775138457e-05,5.08502908535315e-05,3.2586158825326246e-05,2.0151717987762642e-05,1.2026248181574207e-05,6.926078753912789e-06,4.5992601530831015e-06,7.98602586223189e-06,1.338174122044523e-05,2.1638827271880514e-05,3.376711770180349e-05,5.08502908535315e-05,7.389789529615442e-05,0.00010363581703194134,0.00014025774755737903,0.00018318209558337154,0.00023087577385192589,0.0002808102030498126,0.000329599528114081,0.00037333564514090573,0.00040808582674263603,0.0004304698550682755,0.0004382007887540347,0.0004304698550682755,0.00040808582674263603,0.00037333564514090573,0.000329599528114081,0.0002808102030498126,0.00023087577385192589,0.00018318209558337154,0.00014025774755737903,0.00010363581703194134,7.389789529615442e-05,5.08502908535315e-05,3.376711770180349e-05,2.1638827271880514e-05,1.338174122044523e-05,7.98602586223189e-06,4.5992601530831015e-06,2.9473228040927085e-06,5.117648350909647e-06,8.575359893709623e-06,1.3866710503315229e-05,2.1638827271880514e-05,3.2586158825326246e-05,4.7355649546114266e-05,6.641246563412243e-05,8.988072952329738e-05,0.00011738774273345741,0.0001479510639836679,0.00017995031538187967,0.00021121575494650522,0.00023924297036488447,0.0002615117699700744,0.00027585602424918696,0.00028081020304981263,0.00027585602424918696,0.0002615117699700744,0.00023924297036488447,0.00021121575494650522,0.00017995031538187967,0.0001479510639836679,0.00011738774273345741,8.988072952329738e-05,6.641246563412243e-05,4.7355649546114266e-05,3.2586158825326246e-05,2.1638827271880514e-05,1.3866710503315229e-05,8.575359893709623e-06,5.117648350909647e-06,2.9473228040927085e-06,1.8226639809051938e-06,3.1648224290834998e-06,5.303117656423453e-06,8.575359893709623e-06,1.338174122044523e-05,2.0151717987762642e-05,2.9285369285039083e-05,4.107036013372202e-05,5.558344951293063e-05,7.259415568017576e-05,9.149492376103803e-05,0.00011128369031842398,0.00013061865778872577,0.00014795106398366784,0.00016172238855049622,0.0001705930679247333,0.0001736567985898391,0.0001705930679247333,0.00016172238855049622,0.00014795106398366784,0.00013061865778872577,0.00011128369031842398,9.149492376103803e-05,7.259415568017576e-05,5.558344951293063e-05,4.107036013372202e-05,2.9285369285039083e-05,2.0151717987762642e-05,1.338174122044523e-05,8.575359893709623e-06,5.303117656423453e-06,3.1648224290834998e-06,1.8226639809051938e-06,1.0877389907546813e-06,1.8887193640702815e-06,3.1648224290834998e-06,5.117648350909647e-06,7.98602586223189e-06,1.2026248181574207e-05,1.747707661077848e-05,2.4510185393360122e-05,3.3171383156336043e-05,4.332312179397257e-05,5.4602821514902536e-05,6.641246563412245e-05,7.795128914890755e-05,8.829501361998281e-05,9.651353707938517e-05,0.00010180742774213312,0.00010363581703194138,0.00010180742774213312,9.651353707938517e-05,8.829501361998281e-05,7.795128914890755e-05,6.641246563412245e-05,5.4602821514902536e-05,4.332312179397257e-05,3.3171383156336043e-05,2.4510185393360122e-05,1.747707661077848e-05,1.2026248181574207e-05,7.98602586223189e-06,5.117648350909647e-06,3.1648224290834998e-06,1.8887193640702815e-06,1.0877389907546813e-06,6.264435757455311e-07,1.0877389907546813e-06,1.8226639809051938e-06,2.9473228040927085e-06,4.5992601530831015e-06,6.926078753912789e-06,1.0065284465015433e-05,1.41157468018587e-05,1.9103847571431557e-05,2.495037096192143e-05,3.144650237448827e-05,3.824783592344331e-05,4.489320022860944e-05,5.0850290853531536e-05,5.558344951293063e-05,5.863227264473435e-05,5.968526673090538e-05,5.863227264473435e-05,5.558344951293063e-05,5.0850290853531536e-05,4.489320022860944e-05,3.824783592344331e-05,3.144650237448827e-05,2.495037096192143e-05,1.9103847571431557e-05,1.41157468018587e-05,1.0065284465015433e-05,6.926078753912789e-06,4.5992601530831015e-06,2.9473228040927085e-06,1.8226639809051938e-06,1.0877389907546813e-06,6.264435757455311e-07);
-const float kernel35[1225]=float[](5.066414984436525e-07,8.574403457637583e-07,1.405589143477729e-06,2.2318458601834947e-06,3.4325851898525407e-06,5.113635583519012e-06,7.378864753962152e-06,1.031337119878507e-05,1.3962496328544801e-05,1.8309514079648114e-05,2.3256367908649373e-05,2.8612663262285904e-05,3.409777197919339e-05,3.9359089616736694e-05,4.4006356311849205e-05,4.7658141353536105e-05,4.999310548026962e-05,5.0796577642698295e-05,4.999310548026962e-05,4.7658141353536105e-05,4.4006356311849205e-05,3.9359089616736694e-05,3.409777197919339e-05,2.8612663262285904e-05,2.3256367908649373e-05,1.8309514079648114e-05,1.3962496328544801e-05,1.031337119878507e-05,7.378864753962152e-06,5.113635583519012e-06,3.4325851898525407e-06,2.2318458601834947e-06,1.405589143477729e-06,8.574403457637583e-07,5.066414984436525e-07,8.574403457637583e-07,1.4511325045459955e-06,2.378819826026094e-06,3.7771771399021767e-06,5.809309030334117e-06,8.654319625043604e-06,1.2487994697270114e-05,1.7454354990345834e-05,2.3630136332000765e-05,3.0987031523170664e-05,3.9359089616736714e-05,4.842408676786469e-05,5.770708772460537e-05,6.66113445376896e-05,7.447638120396032e-05,8.065666418199824e-05,8.460835873193656e-05,8.596815545384094e-05,8.460835873193656e-05,8.065666418199824e-05,7.447638120396032e-05,6.66113445376896e-05,5.770708772460537e-05,4.842408676786469e-05,3.9359089616736714e-05,3.0987031523170664e-05,2.3630136332000765e-05,1.7454354990345834e-05,1.2487994697270114e-05,8.654319625043604e-06,5.809309030334117e-06,3.7771771399021767e-06,2.378819826026094e-06,1.4511325045459955e-06,8.574403457637583e-07,1.405589143477729e-06,2.378819826026094e-06,3.899563786881912e-06,6.191870031622626e-06,9.523113467294812e-06,1.41868968135762e-05,2.0471383061238072e-05,2.8612663262285914e-05,3.873652931222121e-05,5.079657764269831e-05,6.452076734641388e-05,7.938088169049981e-05,9.45983664148343e-05,0.0001091949815251957,0.0001220880185811057,0.000132219264096282,0.00013869721790983367,0.0001409263123524831,0.00013869721790983367,0.000132219264096282,0.0001220880185811057,0.0001091949815251957,9.45983664148343e-05,7.938088169049981e-05,6.452076734641388e-05,5.079657764269831e-05,3.873652931222121e-05,2.8612663262285914e-05,2.0471383061238072e-05,1.41868968135762e-05,9.523113467294812e-06,6.191870031622626e-06,3.899563786881912e-06,2.378819826026094e-06,1.405589143477729e-06,2.2318458601834947e-06,3.7771771399021767e-06,6.191870031622626e-06,9.831677742387292e-06,1.512114793050575e-05,2.2526473734628803e-05,3.250521089285764e-05,4.543223341406593e-05,6.150727827155229e-05,8.065666418199821e-05,0.00010244843464119846,0.00012604386779789105,0.0001502067467173878,0.00017338378615164844,0.0001938558220320828,0.00020994258427442871,0.00022022851631105749,0.0002237679540100966,0.00022022851631105749,0.00020994258427442871,0.0001938558220320828,0.00017338378615164844,0.0001502067467173878,0.00012604386779789105,0.00010244843464119846,8.065666418199821e-05,6.150727827155229e-05,4.543223341406593e-05,3.250521089285764e-05,2.2526473734628803e-05,1.512114793050575e-05,9.831677742387292e-06,6.191870031622626e-06,3.7771771399021767e-06,2.2318458601834947e-06,3.4325851898525407e-06,5.809309030334117e-06,9.523113467294812e-06,1.512114793050575e-05,2.3256367908649396e-05,3.464577975592444e-05,4.9993105480269654e-05,6.987490235827701e-05,9.459836641483434e-05,0.0001240501756296353,0.00015756597968823944,0.00019385582203208286,0.00023101839754993044,0.00026666474917572347,0.00029815079775236277,0.00032289228317968334,0.0003387120754882162,0.00034415574059200993,0.0003387120754882162,0.00032289228317968334,0.00029815079775236277,0.00026666474917572347,0.00023101839754993044,0.00019385582203208286,0.00015756597968823944,0.0001240501756296353,9.459836641483434e-05,6.987490235827701e-05,4.9993105480269654e-05,3.464577975592444e-05,2.3256367908649396e-05,1.512114793050575e-05,9.523113467294812e-06,5.809309030334117e-06,3.4325851898525407e-06,5.113635583519012e-06,8.654319625043604e-06,1.41868968135762e-05,2.2526473734628803e-05,3.464577975592444e-05,5.161296293603966e-05,7.44763812039603e-05,0.00010409495098635895,0.00014092631235248314,0.00018480164574407454,0.00023473124654494837,0.0002887934238445436,0.0003441557405920098,0.00039725928850544605,0.00044416509549368506,0.0004810233038913326,0.0005045905712418828,0.0005127001790272372,0.0005045905712418828,0.0004810233038913326,0.00044416509549368506,0.00039725928850544605,0.0003441557405920098,0.0002887934238445436,0.00023473124654494837,0.00018480164574407454,0.00014092631235248314,0.00010409495098635895,7.44763812039603e-05,5.161296293603966e-05,3.464577975592444e-05,2.2526473734628803e-05,1.41868968135762e-05,8.654319625043604e-06,5.113635583519012e-06,7.378864753962152e-06,1.2487994697270114e-05,2.0471383061238072e-05,3.250521089285764e-05,4.9993105480269654e-05,7.44763812039603e-05,0.00010746779571851528,0.00015020674671738777,0.00020335359885148384,0.00026666474917572336,0.0003387120754882161,0.00041672261966624205,0.0004966092367459138,0.0005732364996020485,0.0006409205573118252,0.0006941061491275863,0.000728113202536055,0.0007398151899144027,0.000728113202536055,0.0006941061491275863,0.0006409205573118252,0.0005732364996020485,0.0004966092367459138,0.00041672261966624205,0.0003387120754882161,0.00026666474917572336,0.00020335359885148384,0.00015020674671738777,0.00010746779571851528,7.44763812039603e-05,4.9993105480269654e-05,3.250521089285764e-05,2.0471383061238072e-05,1.2487994697270114e-05,7.378864753962152e-06,1.031337119878507e-05,1.7454354990345834e-05,2.8612663262285914e-05,4.543223341406593e-05,6.987490235827701e-05,0.00010409495098635895,0.00015020674671738777,0.00020994258427442871,0.0002842254492383861,0.00037271486002008597,0.00047341474339194806,0.0005824493613655586,0.0006941061491275863,0.0008012073675579473,0.0008958087506536453,0.0009701457617133038,0.00101767710655739,0.001034032866368761,0.00101767710655739,0.0009701457617133038,0.0008958087506536453,0.0008012073675579473,0.0006941061491275863,0.0005824493613655586,0.00047341474339194806,0.00037271486002008597,0.0002842254492383861,0.00020994258427442871,0.00015020674671738777,0.00010409495098635895,6.987490235827701e-05,4.543223341406593e-05,2.8612663262285914e-05,1.7454354990345834e-05,1.031337119878507e-05,1.3962496328544801e-05,2.3630136332000765e-05,3.873652931222121e-05,6.150727827155229e-05,9.459836641483434e-05,0.00014092631235248314,0.00020335359885148384,0.0002842254492383861,0.0003847914241598768,0.0005045905712418829,0.0006409205573118253,0.0007885343126782726,0.0009396980261852655,0.0010846942975589508,0.001212767983523492,0.0013134072627649632,0.001377756369869198,0.0013998992009488871,0.001377756369869198,0.0013134072627649632,0.001212767983523492,0.0010846942975589508,0.0009396980261852655,0.0007885343126782726,0.0006409205573118253,0.0005045905712418829,0.0003847914241598768,0.0002842254492383861,0.00020335359885148384,0.00014092631235248314,9.459836641483434e-05,6.150727827155229e-05,3.873652931222121e-05,2.3630136332000765e-05,1.3962496328544801e-05,1.8309514079648114e-05,3.0987031523170664e-05,5.079657764269831e-05,8.065666418199821e-05,0.0001240501756296353,0.00018480164574407454,0.00026666474917572336,0.00037271486002008597,0.0005045905712418829,0.0006616874197290354,0.0008404617406448994,0.0010340328663687609,0.0012322591774568325,0.0014223979040673095,0.0015903454473448085,0.0017223172851078196,0.0018067005397074335,0.0018357372153760955,0.0018067005397074335,0.0017223172851078196,0.0015903454473448085,0.0014223979040673095,0.0012322591774568325,0.0010340328663687609,0.0008404617406448994,0.0006616874197290354,0.0005045905712418829,0.00037271486002008597,0.00026666474917572336,0.00018480164574407454,0.0001240501756296353,8.065666418199821e-05,5.079657764269831e-05,3.0987031523170664e-05,1.8309514079648114e-05,2.3256367908649373e-05,3.9359089616736714e-05,6.452076734641388e-05,0.00010244843464119846,0.00015756597968823944,0.00023473124654494837,0.0003387120754882161,0.00047341474339194806,0.0006409205573118253,0.0008404617406448994,0.0010675372032569682,0.0013134072627649627,0.0015651902429022037,0.001806700539707434,0.002020024052217079,0.002187651964090978,0.0022948338371740658,0.002331715624929708,0.0022948338371740658,0.002187651964090978,0.002020024052217079,0.001806700539707434,0.0015651902429022037,0.0013134072627649627,0.0010675372032569682,0.0008404617406448994,0.0006409205573118253,0.00047341474339194806,0.0003387120754882161,0.00023473124654494837,0.00015756597968823944,0.00010244843464119846,6.452076734641388e-05,3.9359089616736714e-05,2.3256367908649373e-05,2.8612663262285904e-05,4.842408676786469e-05,7.938088169049981e-05,0.00012604386779789105,0.00019385582203208286,0.0002887934238445436,0.00041672261966624205,0.0005824493613655586,0.0007885343126782726,0.0010340328663687609,0.0013134072627649627,0.0016159049376647493,0.0019256773687743533,0.002222811161291144,0.0024852663242530453,0.002691501494536201,0.002823368983664066,0.002868745208262354,0.002823368983664066,0.002691501494536201,0.0024852663242530453,0.002222811161291144,0.0019256773687743533,0.0016159049376647493,0.0013134072627649627,0.0010340328663687609,0.0007885343126782726,0.0005824493613655586,0.00041672261966624205,0.0002887934238445436,0.00019385582203208286,0.00012604386779789105,7.938088169049981e-05,4.842408676786469e-05,2.8612663262285904e-05,3.409777197919339e-05,5.770708772460537e-05,9.45983664148343e-05,0.0001502067467173878,0.00023101839754993044,0.0003441557405920098,0.0004966092367459138,0.0006941061491275863,0.0009396980261852655,0.0012322591774568325,0.0015651902429022037,0.0019256773687743533,0.002294833837174066,0.0026489288129432345,0.0029616971917341985,0.0032074680850600985,0.003364614853766434,0.0034186897976276887,0.003364614853766434,0.0032074680850600985,0.0029616971917341985,0.0026489288129432345,0.002294833837174066,0.0019256773687743533,0.0015651902429022037,0.0012322591774568325,0.0009396980261852655,0.0006941061491275863,0.0004966092367459138,0.0003441557405920098,0.00023101839754993044,0.0001502067467173878,9.45983664148343e-05,5.770708772460537e-05,3.409777197919339e-05,3.9359089616736694e-05,6.66113445376896e-05,0.0001091949815251957,0.00017338378615164844,0.00026666474917572347,0.00039725928850544605,0.0005732364996020485,0.0008012073675579473,0.0010846942975589508,0.0014223979040673095,0.001806700539707434,0.002222811161291144,0.0026489288129432345,0.003057660969772696,0.0034186897976276887,0.003702383366272063,0.003883778026200796,0.003946196783729993,0.003883778026200796,0.003702383366272063,0.0034186897976276887,0.003057660969772696,0.0026489288129432345,0.002222811161291144,0.001806700539707434,0.0014223979040673095,0.0010846942975589508,0.0008012073675579473,0.0005732364996020485,0.00039725928850544605,0.00026666474917572347,0.00017338378615164844,0.0001091949815251957,6.66113445376896e-05,3.9359089616736694e-05,4.4006356311849205e-05,7.447638120396032e-05,0.0001220880185811057,0.0001938558220320828,0.00029815079775236277,0.00044416509549368506,0.0006409205573118252,0.0008958087506536453,0.001212767983523492,0.0015903454473448085,0.002020024052217079,0.0024852663242530453,0.0029616971917341985,0.0034186897976276887,0.003822346574045612,0.004139536844113131,0.004342349412077002,0.004412138172719595,0.004342349412077002,0.004139536844113131,0.003822346574045612,0.0034186897976276887,0.0029616971917341985,0.0024852663242530453,0.002020024052217079,0.0015903454473448085,0.001212767983523492,0.0008958087506536453,0.0006409205573118252,0.00044416509549368506,0.00029815079775236277,0.0001938558220320828,0.0001220880185811057,7.447638120396032e-05,4.4006356311849205e-05,4.7658141353536105e-05,8.065666418199824e-05,0.000132219264096282,0.00020994258427442871,0.00032289228317968334,0.0004810233038913326,0.0006941061491275863,0.0009701457617133038,0.0013134072627649632,0.0017223172851078196,0.002187651964090978,0.002691501494536201,0.0032074680850600985,0.003702383366272063,0.004139536844113131,0.0044830485545515105,0.004702691143540258,0.004778271193749895,0.004702691143540258,0.0044830485545515105,0.004139536844113131,0.003702383366272063,0.0032074680850600985,0.002691501494536201,0.002187651964090978,0.0017223172851078196,0.0013134072627649632,0.0009701457617133038,0.0006941061491275863,0.0004810233038913326,0.00032289228317968334,0.00020994258427442871,0.000132219264096282,8.065666418199824e-05,4.7658141353536105e-05,4.999310548026962e-05,8.460835873193656e-05,0.00013869721790983367,0.00022022851631105749,0.0003387120754882162,0.0005045905712418828,0.000728113202536055,0.00101767710655739,0.001377756369869198,0.0018067005397074335,0.0022948338371740658,0.002823368983664066,0.003364614853766434,0.003883778026200796,0.004342349412077002,0.004702691143540258,0.0049330949068305185,0.005012377927842712,0.0049330949068305185,0.004702691143540258,0.004342349412077002,0.003883778026200796,0.003364614853766434,0.002823368983664066,0.0022948338371740658,0.0018067005397074335,0.001377756369869198,0.00101767710655739,0.000728113202536055,0.0005045905712418828,0.0003387120754882162,0.00022022851631105749,0.00013869721790983367,8.460835873193656e-05,4.999310548026962e-05,5.0796577642698295e-05,8.596815545384094e-05,0.0001409263123524831,0.0002237679540100966,0.00034415574059200993,0.0005127001790272372,0.0007398151899144027,0.001034032866368761,0.0013998992009488871,0.0018357372153760955,0.002331715624929708,0.002868745208262354,0.0034186897976276887,0.003946196783729993,0.004412138172719595,0.004778271193749895,0.005012377927842712,0.005092935158562915,0.005012377927842712,0.004778271193749895,0.004412138172719595,0.003946196783729993,0.0034186897976276887,0.002868745208262354,0.002331715624929708,0.0018357372153760955,0.0013998992009488871,0.001034032866368761,0.0007398151899144027,0.0005127001790272372,0.00034415574059200993,0.0002237679540100966,0.0001409263123524831,8.596815545384094e-05,5.0796577642698295e-05,4.999310548026962e-05,8.460835873193656e-05,0.00013869721790983367,0.00022022851631105749,0.0003387120754882162,0.0005045905712418828,0.000728113202536055,0.00101767710655739,0.001377756369869198,0.0018067005397074335,0.0022948338371740658,0.002823368983664066,0.003364614853766434,0.003883778026200796,0.004342349412077002,0.004702691143540258,0.0049330949068305185,0.005012377927842712,0.0049330949068305185,0.004702691143540258,0.004342349412077002,0.003883778026200796,0.003364614853766434,0.002823368983664066,0.0022948338371740658,0.0018067005397074335,0.001377756369869198,0.00101767710655739,0.000728113202536055,0.0005045905712418828,0.0003387120754882162,0.00022022851631105749,0.00013869721790983367,8.460835873193656e-05,4.999310548026962e-05,4.7658141353536105e-05,8.065666418199824e-05,0.000132219264096282,0.00020994258427442871,0.00032289228317968334,0.0004810233038913326,0.0006941061491275863,0.0009701457617133038,0.0013134072627649632,0.0017223172851078196,0.002187651964090978,0.002691501494536201,0.0032074680850600985,0.003702383366272063,0.004139536844113131,0.0044830485545515105,0.004702691143540258,0.004778271193749895,0.004702691143540258,0.0044830485545515105,0.004139536844113131,0.003702383366272063,0.0032074680850600985,0.002691501494536201,0.002187651964090978,0.0017223172851078196,0.0013134072627649632,0.0009701457617133038,0.0006941061491275863,0.0004810233038913326,0.00032289228317968334,0.00020994258427442871,0.000132219264096282,8.065666418199824e-05,4.7658141353536105e-05,4.4006356311849205e-05,7.447638120396032e-05,0.0001220880185811057,0.0001938558220320828,0.00029815079775236277,0.00044416509549368506,0.0006409205573118252,0.0008958087506536453,0.001212767983523492,0.0015903454473448085,0.002020024052217079,0.0024852663242530453,0.0029616971917341985,0.0034186897976276887,0.003822346574045612,0.004139536844113131,0.004342349412077002,0.004412138172719595,0.004342349412077002,0.004139536844113131,0.003822346574045612,0.0034186897976276887,0.0029616971917341985,0.0024852663242530453,0.002020024052217079,0.0015903454473448085,0.001212767983523492,0.0008958087506536453,0.0006409205573118252,0.00044416509549368506,0.00029815079775236277,0.0001938558220320828,0.0001220880185811057,7.447638120396032e-05,4.4006356311849205e-05,3.9359089616736694e-05,6.66113445376896e-05,0.0001091949815251957,0.00017338378615164844,0.00026666474917572347,0.00039725928850544605,0.0005732364996020485,0.0008012073675579473,0.0010846942975589508,0.0014223979040673095,0.001806700539707434,0.002222811161291144,0.0026489288129432345,0.003057660969772696,0.0034186897976276887,0.003702383366272063,0.003883778026200796,0.003946196783729993,0.003883778026200796,0.003702383366272063,0.0034186897976276887,0.003057660969772696,0.0026489288129432345,0.002222811161291144,0.001806700539707434,0.0014223979040673095,0.0010846942975589508,0.0008012073675579473,0.0005732364996020485,0.00039725928850544605,0.00026666474917572347,0.00017338378615164844,0.0001091949815251957,6.66113445376896e-05,3.9359089616736694e-05,3.409777197919339e-05,5.770708772460537e-05,9.45983664148343e-05,0.0001502067467173878,0.00023101839754993044,0.0003441557405920098,0.0004966092367459138,0.0006941061491275863,0.0009396980261852655,0.0012322591774568325,0.0015651902429022037,0.0019256773687743533,0.002294833837174066,0.0026489288129432345,0.0029616971917341985,0.0032074680850600985,0.003364614853766434,0.0034186897976276887,0.003364614853766434,0.0032074680850600985,0.0029616971917341985,0.0026489288129432345,0.002294833837174066,0.0019256773687743533,0.0015651902429022037,0.0012322591774568325,0.0009396980261852655,0.0006941061491275863,0.0004966092367459138,0.0003441557405920098,0.00023101839754993044,0.0001502067467173878,9.45983664148343e-05,5.770708772460537e-05,3.409777197919339e-05,2.8612663262285904e-05,4.842408676786469e-05,7.938088169049981e-05,0.00012604386779789105,0.00019385582203208286,0.0002887934238445436,0.00041672261966624205,0.0005824493613655586,0.0007885343126782726,0.0010340328663687609,0.0013134072627649627,0.0016159049376647493,0.0019256773687743533,0.002222811161291144,0.0024852663242530453,0.002691501494536201,0.002823368983664066,0.002868745208262354,0.002823368983664066,0.002691501494536201,0.0024852663242530453,0.002222811161291144,0.0019256773687743533,0.0016159049376647493,0.0013134072627649627,0.0010340328663687609,0.0007885343126782726,0.0005824493613655586,0.00041672261966624205,0.0002887934238445436,0.00019385582203208286,0.00012604386779789105,7.938088169049981e-05,4.842408676786469e-05,2.8612663262285904e-05,2.3256367908649373e-05,3.9359089616736714e-05,6.452076734641388e-05,0.00010244843464119846,0.00015756597968823944,0.00023473124654494837,0.0003387120754882161,0.00047341474339194806,0.0006409205573118253,0.0008404617406448994,0.0010675372032569682,0.0013134072627649627,0.0015651902429022037,0.001806700539707434,0.002020024052217079,0.002187651964090978,0.0022948338371740658,0.002331715624929708,0.0022948338371740658,0.002187651964090978,0.002020024052217079,0.001806700539707434,0.0015651902429022037,0.0013134072627649627,0.0010675372032569682,0.0008404617406448994,0.0006409205573118253,0.00047341474339194806,0.0003387120754882161,0.00023473124654494837,0.00015756597968823944,0.00010244843464119846,6.452076734641388e-05,3.9359089616736714e-05,2.3256367908649373e-05,1.8309514079648114e-05,3.0987031523170664e-05,5.079657764269831e-05,8.065666418199821e-05,0.0001240501756296353,0.00018480164574407454,0.00026666474917572336,0.00037271486002008597,0.0005045905712418829,0.0006616874197290354,0.0008404617406448994,0.0010340328663687609,0.0012322591774568325,0.0014223979040673095,0.0015903454473448085,0.0017223172851078196,0.0018067005397074335,0.0018357372153760955,0.0018067005397074335,0.0017223172851078196,0.0015903454473448085,0.0014223979040673095,0.0012322591774568325,0.0010340328663687609,0.0008404617406448994,0.0006616874197290354,0.0005045905712418829,0.00037271486002008597,0.00026666474917572336,0.00018480164574407454,0.0001240501756296353,8.065666418199821e-05,5.079657764269831e-05,3.0987031523170664e-05,1.8309514079648114e-05,1.3962496328544801e-05,2.3630136332000765e-05,3.873652931222121e-05,6.150727827155229e-05,9.459836641483434e-05,0.00014092631235248314,0.00020335359885148384,0.0002842254492383861,0.0003847914241598768,0.0005045905712418829,0.0006409205573118253,0.0007885343126782726,0.0009396980261852655,0.0010846942975589508,0.001212767983523492,0.0013134072627649632,0.001377756369869198,0.0013998992009488871,0.001377756369869198,0.0013134072627649632,0.001212767983523492,0.0010846942975589508,0.0009396980261852655,0.0007885343126782726,0.0006409205573118253,0.0005045905712418829,0.0003847914241598768,0.0002842254492383861,0.00020335359885148384,0.00014092631235248314,9.459836641483434e-05,6.150727827155229e-05,3.873652931222121e-05,2.3630136332000765e-05,1.3962496328544801e-05,1.031337119878507e-05,1.7454354990345834e-05,2.8612663262285914e-05,4.543223341406593e-05,6.987490235827701e-05,0.00010409495098635895,0.00015020674671738777,0.00020994258427442871,0.0002842254492383861,0.00037271486002008597,0.00047341474339194806,0.0005824493613655586,0.0006941061491275863,0.0008012073675579473,0.0008958087506536453,0.0009701457617133038,0.00101767710655739,0.001034032866368761,0.00101767710655739,0.0009701457617133038,0.0008958087506536453,0.0008012073675579473,0.0006941061491275863,0.0005824493613655586,0.00047341474339194806,0.00037271486002008597,0.0002842254492383861,0.00020994258427442871,0.00015020674671738777,0.00010409495098635895,6.987490235827701e-05,4.543223341406593e-05,2.8612663262285914e-05,1.7454354990345834e-05,1.031337119878507e-05,7.378864753962152e-06,1.2487994697270114e-05,2.0471383061238072e-05,3.250521089285764e-05,4.9993105480269654e-05,7.44763812039603e-05,0.00010746779571851528,0.00015020674671738777,0.00020335359885148384,0.00026666474917572336,0.0003387120754882161,0.00041672261966624205,0.0004966092367459138,0.0005732364996020485,0.0006409205573118252,0.0006941061491275863,0.000728113202536055,0.0007398151899144027,0.000728113202536055,0.0006941061491275863,0.0006409205573118252,0.0005732364996020485,0.0004966092367459138,0.00041672261966624205,0.0003387120754882161,0.00026666474917572336,0.00020335359885148384,0.00015020674671738777,0.00010746779571851528,7.44763812039603e-05,4.9993105480269654e-05,3.250521089285764e-05,2.0471383061238072e-05,1.2487994697270114e-05,7.378864753962152e-06,5.113635583519012e-06,8.654319625043604e-06,1.41868968135762e-05,2.2526473734628803e-05,3.464577975592444e-05,5.161296293603966e-05,7.44763812039603e-05,0.00010409495098635895,0.00014092631235248314,0.00018480164574407454,0.00023473124654494837,0.0002887934238445436,0.0003441557405920098,0.00039725928850544605,0.00044416509549368506,0.0004810233038913326,0.0005045905712418828,0.0005127001790272372,0.0005045905712418828,0.0004810233038913326,0.00044416509549368506,0.00039725928850544605,0.0003441557405920098,0.0002887934238445436,0.00023473124654494837,0.00018480164574407454,0.00014092631235248314,0.00010409495098635895,7.44763812039603e-05,5.161296293603966e-05,3.464577975592444e-05,2.2526473734628803e-05,1.41868968135762e-05,8.654319625043604e-06,5.113635583519012e-06,3.4325851898525407e-06,5.809309030334117e-06,9.523113467294812e-06,1.512114793050575e-05,2.3256367908649396e-05,3.464577975592444e-05,4.9993105480269654e-05,6.987490235827701e-05,9.459836641483434e-05,0.0001240501756296353,0.00015756597968823944,0.00019385582203208286,0.00023101839754993044,0.00026666474917572347,0.00029815079775236277,0.00032289228317968334,0.0003387120754882162,0.00034415574059200993,0.0003387120754882162,0.00032289228317968334,0.00029815079775236277,0.00026666474917572347,0.00023101839754993044,0.00019385582203208286,0.00015756597968823944,0.0001240501756296353,9.459836641483434e-05,6.987490235827701e-05,4.9993105480269654e-05,3.464577975592444e-05,2.3256367908649396e-05,1.512114793050575e-05,9.523113467294812e-06,5.809309030334117e-06,3.4325851898525407e-06,2.2318458601834947e-06,3.7771771399021767e-06,6.191870031622626e-06,9.831677742387292e-06,1.512114793050575e-05,2.2526473734628803e-05,3.250521089285764e-05,4.543223341406593e-05,6.150727827155229e-05,8.065666418199821e-05,0.00010244843464119846,0.00012604386779789105,0.0001502067467173878,0.00017338378615164844,0.0001938558220320828,0.00020994258427442871,0.00022022851631105749,0.0002237679540100966,0.00022022851631105749,0.00020994258427442871,0.0001938558220320828,0.00017338378615164844,0.0001502067467173878,0.00012604386779789105,0.00010244843464119846,8.065666418199821e-05,6.150727827155229e-05,4.543223341406593e-05,3.250521089285764e-05,2.2526473734628803e-05,1.512114793050575e-05,9.831677742387292e-06,6.191870031622626e-06,3.7771771399021767e-06,2.2318458601834947e-06,1.405589143477729e-06,2.378819826026094e-06,3.899563786881912e-06,6.191870031622626e-06,9.523113467294812e-06,1.41868968135762e-05,2.0471383061238072e-05,2.8612663262285914e-05,3.873652931222121e-05,5.079657764269831e-05,6.452076734641388e-05,7.938088169049981e-05,9.45983664148343e-05,0.0001091949815251957,0.0001220880185811057,0.000132219264096282,0.00013869721790983367,0.0001409263123524831,0.00013869721790983367,0.000132219264096282,0.0001220880185811057,0.0001091949815251957,9.45983664148343e-05,7.938088169049981e-05,6.452076734641388e-05,5.079657764269831e-05,3.873652931222121e-05,2.8612663262285914e-05,2.0471383061238072e-05,1.41868968135762e-05,9.523113467294812e-06,6.191870031622626e-06,3.899563786881912e-06,2.378819826026094e-06,1.405589143477729e-06,8.574403457637583e-07,1.4511325045459955e-06,2.378819826026094e-06,3.7771771399021767e-06,5.809309030334117e-06,8.654319625043604e-06,1.2487994697270114e-05,1.7454354990345834e-05,2.3630136332000765e-05,3.0987031523170664e-05,3.9359089616736714e-05,4.842408676786469e-05,5.770708772460537e-05,6.66113445376896e-05,7.447638120396032e-05,8.065666418199824e-05,8.460835873193656e-05,8.596815545384094e-05,8.460835873193656e-05,8.065666418199824e-05,7.447638120396032e-05,6.66113445376896e-05,5.770708772460537e-05,4.842408676786469e-05,3.9359089616736714e-05,3.0987031523170664e-05,2.3630136332000765e-05,1.7454354990345834e-05,1.2487994697270114e-05,8.654319625043604e-06,5.809309030334117e-06,3.7771771399021767e-06,2.378819826026094e-06,1.4511325045459955e-06,8.574403457637583e-07,5.066414984436525e-07,8.574403457637583e-07,1.405589143477729e-06,2.2318458601834947e-06,3.4325851898525407e-06,5.113635583519012e-06,7.378864753962152e-06,1.031337119878507e-05,1.3962496328544801e-05,1.8309514079648114e-05,2.3256367908649373e-05,2.8612663262285904e-05,3.409777197919339e-05,3.9359089616736694e-05,4.4006356311849205e-05,4.7658141353536105e-05,4.999310548026962e-05,5.0796577642698295e-05,4.999310548026962e-05,4.7658141353536105e-05,4.4006356311849205e-05,3.9359089616736694e-05,3.409777197919339e-05,2.8612663262285904e-05,2.3256367908649373e-05,1.8309514079648114e-05,1.3962496328544801e-05,1.031337119878507e-05,7.378864753962152e-06,5.113635583519012e-06,3.4325851898525407e-06,2.2318458601834947e-06,1.405589143477729e-06,8.574403457637583e-07,5.066414984436525e-07);
-const float kernel37[1369]=float[](4.162155293463744e-07,6.880987270912464e-07,1.105368508222722e-06,1.7253900095658272e-06,2.616925320113134e-06,3.8567300176639694e-06,5.522948651388188e-06,7.685048833286371e-06,1.039073134378975e-05,1.3651156934472418e-05,1.7426760442853525e-05,2.1616616691078233e-05,2.6054493849223412e-05,3.0514159948259976e-05,3.47251439421294e-05,3.839817198872036e-05,4.1257309495613404e-05,4.3073991210303e-05,4.3697157374931756e-05,4.3073991210303e-05,4.1257309495613404e-05,3.839817198872036e-05,3.47251439421294e-05,3.0514159948259976e-05,2.6054493849223412e-05,2.1616616691078233e-05,1.7426760442853525e-05,1.3651156934472418e-05,1.039073134378975e-05,7.685048833286371e-06,5.522948651388188e-06,3.8567300176639694e-06,2.616925320113134e-06,1.7253900095658272e-06,1.105368508222722e-06,6.880987270912464e-07,4.162155293463744e-07,6.880987270912464e-07,1.1375833548742092e-06,1.827424999420989e-06,2.8524612505031728e-06,4.326371446280553e-06,6.376049975974532e-06,9.130687513698921e-06,1.2705129787259061e-05,1.7178237012052332e-05,2.2568460443281957e-05,2.881038988834175e-05,3.5737173124003936e-05,4.307399121030299e-05,5.0446831360736876e-05,5.74085435547377e-05,6.348089248270472e-05,6.820769564202343e-05,7.121108279908347e-05,7.224131789223527e-05,7.121108279908347e-05,6.820769564202343e-05,6.348089248270472e-05,5.74085435547377e-05,5.0446831360736876e-05,4.307399121030299e-05,3.5737173124003936e-05,2.881038988834175e-05,2.2568460443281957e-05,1.7178237012052332e-05,1.2705129787259061e-05,9.130687513698921e-06,6.376049975974532e-06,4.326371446280553e-06,2.8524612505031728e-06,1.827424999420989e-06,1.1375833548742092e-06,6.880987270912464e-07,1.105368508222722e-06,1.827424999420989e-06,2.9355933472480104e-06,4.582221581139041e-06,6.949925298958387e-06,1.0242548885520458e-05,1.4667625500093163e-05,2.04096444402466e-05,2.7595287525347602e-05,3.6254195031763263e-05,4.628129138795561e-05,5.7408543554737695e-05,6.919447970584243e-05,8.103828205220107e-05,9.222164443842183e-05,0.00010197632499754553,0.00010956950770690073,0.00011439417813675099,0.00011604915784126202,0.00011439417813675099,0.00010956950770690073,0.00010197632499754553,9.222164443842183e-05,8.103828205220107e-05,6.919447970584243e-05,5.7408543554737695e-05,4.628129138795561e-05,3.6254195031763263e-05,2.7595287525347602e-05,2.04096444402466e-05,1.4667625500093163e-05,1.0242548885520458e-05,6.949925298958387e-06,4.582221581139041e-06,2.9355933472480104e-06,1.827424999420989e-06,1.105368508222722e-06,1.7253900095658272e-06,2.8524612505031728e-06,4.582221581139041e-06,7.152473839177998e-06,1.084826606588601e-05,1.5987782706041925e-05,2.2894966080230053e-05,3.1857788922006075e-05,4.307399121030299e-05,5.658983899697962e-05,7.22413178922353e-05,8.961005020156677e-05,0.00010800693444173135,0.00012649414308904156,0.00014395045887061225,0.000159176718944078,0.00017102905731817763,0.00017855997401897621,0.0001811432622409184,0.00017855997401897621,0.00017102905731817763,0.000159176718944078,0.00014395045887061225,0.00012649414308904156,0.00010800693444173135,8.961005020156677e-05,7.22413178922353e-05,5.658983899697962e-05,4.307399121030299e-05,3.1857788922006075e-05,2.2894966080230053e-05,1.5987782706041925e-05,1.084826606588601e-05,7.152473839177998e-06,4.582221581139041e-06,2.8524612505031728e-06,1.7253900095658272e-06,2.616925320113134e-06,4.326371446280553e-06,6.949925298958387e-06,1.084826606588601e-05,1.645373045499722e-05,2.4248913662387676e-05,3.4725143942129406e-05,4.831919392752035e-05,6.533097885789742e-05,8.583067115914677e-05,0.0001095695077069008,0.00013591292867639752,0.0001638157633470304,0.0001918555944224026,0.00021833185457889793,0.00024142575525988482,0.0002594023774854504,0.0002708246336065125,0.00027474274621854254,0.0002708246336065125,0.0002594023774854504,0.00024142575525988482,0.00021833185457889793,0.0001918555944224026,0.0001638157633470304,0.00013591292867639752,0.0001095695077069008,8.583067115914677e-05,6.533097885789742e-05,4.831919392752035e-05,3.4725143942129406e-05,2.4248913662387676e-05,1.645373045499722e-05,1.084826606588601e-05,6.949925298958387e-06,4.326371446280553e-06,2.616925320113134e-06,3.8567300176639694e-06,6.376049975974532e-06,1.0242548885520458e-05,1.5987782706041925e-05,2.4248913662387676e-05,3.5737173124003936e-05,5.117666292575854e-05,7.121108279908345e-05,9.6282436991259e-05,0.00012649414308904148,0.00016147958298466043,0.00020030356532765837,0.00024142575525988482,0.000282749845545327,0.0003217696014841865,0.0003558045581934066,0.0003822978547428651,0.0003991315632606312,0.0004049059361123375,0.0003991315632606312,0.0003822978547428651,0.0003558045581934066,0.0003217696014841865,0.000282749845545327,0.00024142575525988482,0.00020030356532765837,0.00016147958298466043,0.00012649414308904148,9.6282436991259e-05,7.121108279908345e-05,5.117666292575854e-05,3.5737173124003936e-05,2.4248913662387676e-05,1.5987782706041925e-05,1.0242548885520458e-05,6.376049975974532e-06,3.8567300176639694e-06,5.522948651388188e-06,9.130687513698921e-06,1.4667625500093163e-05,2.2894966080230053e-05,3.4725143942129406e-05,5.117666292575854e-05,7.328645774887955e-05,0.00010197632499754555,0.00013787922750561942,0.00018114326224091836,0.0002312434214962366,0.0002868404842775862,0.0003457286466296617,0.00040490593611233766,0.0004607833523310004,0.0005095223922420955,0.0005474615572286263,0.0005715679134760805,0.0005798369819895308,0.0005715679134760805,0.0005474615572286263,0.0005095223922420955,0.0004607833523310004,0.00040490593611233766,0.0003457286466296617,0.0002868404842775862,0.0002312434214962366,0.00018114326224091836,0.00013787922750561942,0.00010197632499754555,7.328645774887955e-05,5.117666292575854e-05,3.4725143942129406e-05,2.2894966080230053e-05,1.4667625500093163e-05,9.130687513698921e-06,5.522948651388188e-06,7.685048833286371e-06,1.2705129787259061e-05,2.04096444402466e-05,3.1857788922006075e-05,4.831919392752035e-05,7.121108279908345e-05,0.00010197632499754555,0.00014189757807149604,0.0001918555944224024,0.00025205644738202575,0.00032176960148418637,0.00039913156326063106,0.00048107301011157113,0.0005634167703385615,0.0006411688371100598,0.0007089880267217744,0.000761779452827522,0.0007953228617288015,0.0008068290696157214,0.0007953228617288015,0.000761779452827522,0.0007089880267217744,0.0006411688371100598,0.0005634167703385615,0.00048107301011157113,0.00039913156326063106,0.00032176960148418637,0.00025205644738202575,0.0001918555944224024,0.00014189757807149604,0.00010197632499754555,7.121108279908345e-05,4.831919392752035e-05,3.1857788922006075e-05,2.04096444402466e-05,1.2705129787259061e-05,7.685048833286371e-06,1.039073134378975e-05,1.7178237012052332e-05,2.7595287525347602e-05,4.307399121030299e-05,6.533097885789742e-05,9.6282436991259e-05,0.00013787922750561942,0.0001918555944224024,0.00025940237748545034,0.00034079820246200274,0.00043505533356392724,0.0005396541953910444,0.0006504448459932534,0.0007617794528275225,0.0008669057642893011,0.0009586021210068569,0.0010299798751135642,0.0010753329441452718,0.0010908901536741086,0.0010753329441452718,0.0010299798751135642,0.0009586021210068569,0.0008669057642893011,0.0007617794528275225,0.0006504448459932534,0.0005396541953910444,0.00043505533356392724,0.00034079820246200274,0.00025940237748545034,0.0001918555944224024,0.00013787922750561942,9.6282436991259e-05,6.533097885789742e-05,4.307399121030299e-05,2.7595287525347602e-05,1.7178237012052332e-05,1.039073134378975e-05,1.3651156934472418e-05,2.2568460443281957e-05,3.6254195031763263e-05,5.658983899697962e-05,8.583067115914677e-05,0.00012649414308904148,0.00018114326224091836,0.00025205644738202575,0.00034079820246200274,0.0004477345810288366,0.0005715679134760804,0.0007089880267217747,0.0008545428012802555,0.0010008122158042642,0.0011389252829431505,0.0012593943158201156,0.0013531691321157183,0.0014127531827785075,0.001433191966316834,0.0014127531827785075,0.0013531691321157183,0.0012593943158201156,0.0011389252829431505,0.0010008122158042642,0.0008545428012802555,0.0007089880267217747,0.0005715679134760804,0.0004477345810288366,0.00034079820246200274,0.00025205644738202575,0.00018114326224091836,0.00012649414308904148,8.583067115914677e-05,5.658983899697962e-05,3.6254195031763263e-05,2.2568460443281957e-05,1.3651156934472418e-05,1.7426760442853525e-05,2.881038988834175e-05,4.628129138795561e-05,7.22413178922353e-05,0.0001095695077069008,0.00016147958298466043,0.0002312434214962366,0.00032176960148418637,0.00043505533356392724,0.0005715679134760804,0.0007296507653367061,0.0009050781965103313,0.001090890153674109,0.0012776144041725778,0.0014539264447278526,0.0016077145072932802,0.0017274253323171535,0.0018034889935950617,0.0018295806857626543,0.0018034889935950617,0.0017274253323171535,0.0016077145072932802,0.0014539264447278526,0.0012776144041725778,0.001090890153674109,0.0009050781965103313,0.0007296507653367061,0.0005715679134760804,0.00043505533356392724,0.00032176960148418637,0.0002312434214962366,0.00016147958298466043,0.0001095695077069008,7.22413178922353e-05,4.628129138795561e-05,2.881038988834175e-05,1.7426760442853525e-05,2.1616616691078233e-05,3.5737173124003936e-05,5.7408543554737695e-05,8.961005020156677e-05,0.00013591292867639752,0.00020030356532765837,0.0002868404842775862,0.00039913156326063106,0.0005396541953910444,0.0007089880267217747,0.0009050781965103313,0.0011226830433329013,0.001353169132115719,0.0015847868537909788,0.0018034889935950617,0.0019942517926271495,0.002142744280763406,0.0022370956672621415,0.0022694604954961667,0.0022370956672621415,0.002142744280763406,0.0019942517926271495,0.0018034889935950617,0.0015847868537909788,0.001353169132115719,0.0011226830433329013,0.0009050781965103313,0.0007089880267217747,0.0005396541953910444,0.00039913156326063106,0.0002868404842775862,0.00020030356532765837,0.00013591292867639752,8.961005020156677e-05,5.7408543554737695e-05,3.5737173124003936e-05,2.1616616691078233e-05,2.6054493849223412e-05,4.307399121030299e-05,6.919447970584243e-05,0.00010800693444173135,0.0001638157633470304,0.00024142575525988482,0.0003457286466296617,0.00048107301011157113,0.0006504448459932534,0.0008545428012802555,0.001090890153674109,0.001353169132115719,0.0016309738630013802,0.0019101425502663896,0.002173744095215339,0.002403670371147943,0.002582648269220159,0.0026963699331756293,0.002735379239312913,0.0026963699331756293,0.002582648269220159,0.002403670371147943,0.002173744095215339,0.0019101425502663896,0.0016309738630013802,0.001353169132115719,0.001090890153674109,0.0008545428012802555,0.0006504448459932534,0.00048107301011157113,0.0003457286466296617,0.00024142575525988482,0.0001638157633470304,0.00010800693444173135,6.919447970584243e-05,4.307399121030299e-05,2.6054493849223412e-05,3.0514159948259976e-05,5.0446831360736876e-05,8.103828205220107e-05,0.00012649414308904156,0.0001918555944224026,0.000282749845545327,0.00040490593611233766,0.0005634167703385615,0.0007617794528275225,0.0010008122158042642,0.0012776144041725778,0.0015847868537909788,0.0019101425502663896,0.0022370956672621424,0.002545817062954135,0.002815099099316716,0.0030247120835713215,0.003157899128524141,0.0032035855354001354,0.003157899128524141,0.0030247120835713215,0.002815099099316716,0.002545817062954135,0.0022370956672621424,0.0019101425502663896,0.0015847868537909788,0.0012776144041725778,0.0010008122158042642,0.0007617794528275225,0.0005634167703385615,0.00040490593611233766,0.000282749845545327,0.0001918555944224026,0.00012649414308904156,8.103828205220107e-05,5.0446831360736876e-05,3.0514159948259976e-05,3.47251439421294e-05,5.74085435547377e-05,9.222164443842183e-05,0.00014395045887061225,0.00021833185457889793,0.0003217696014841865,0.0004607833523310004,0.0006411688371100598,0.0008669057642893011,0.0011389252829431505,0.0014539264447278526,0.0018034889935950617,0.002173744095215339,0.002545817062954135,0.0028971423139719284,0.003203585535400135,0.0034421253170202923,0.003593692304774686,0.0036456834805978972,0.003593692304774686,0.0034421253170202923,0.003203585535400135,0.0028971423139719284,0.002545817062954135,0.002173744095215339,0.0018034889935950617,0.0014539264447278526,0.0011389252829431505,0.0008669057642893011,0.0006411688371100598,0.0004607833523310004,0.0003217696014841865,0.00021833185457889793,0.00014395045887061225,9.222164443842183e-05,5.74085435547377e-05,3.47251439421294e-05,3.839817198872036e-05,6.348089248270472e-05,0.00010197632499754553,0.000159176718944078,0.00024142575525988482,0.0003558045581934066,0.0005095223922420955,0.0007089880267217744,0.0009586021210068569,0.0012593943158201156,0.0016077145072932802,0.0019942517926271495,0.002403670371147943,0.002815099099316716,0.003203585535400135,0.003542442576303627,0.003806213738089657,0.003973812618984277,0.0040313031254162295,0.003973812618984277,0.003806213738089657,0.003542442576303627,0.003203585535400135,0.002815099099316716,0.002403670371147943,0.0019942517926271495,0.0016077145072932802,0.0012593943158201156,0.0009586021210068569,0.0007089880267217744,0.0005095223922420955,0.0003558045581934066,0.00024142575525988482,0.000159176718944078,0.00010197632499754553,6.348089248270472e-05,3.839817198872036e-05,4.1257309495613404e-05,6.820769564202343e-05,0.00010956950770690073,0.00017102905731817763,0.0002594023774854504,0.0003822978547428651,0.0005474615572286263,0.000761779452827522,0.0010299798751135642,0.0013531691321157183,0.0017274253323171535,0.002142744280763406,0.002582648269220159,0.0030247120835713215,0.0034421253170202923,0.003806213738089657,0.004089625366669802,0.004269703702227521,0.00433147496617257,0.004269703702227521,0.004089625366669802,0.003806213738089657,0.0034421253170202923,0.0030247120835713215,0.002582648269220159,0.002142744280763406,0.0017274253323171535,0.0013531691321157183,0.0010299798751135642,0.000761779452827522,0.0005474615572286263,0.0003822978547428651,0.0002594023774854504,0.00017102905731817763,0.00010956950770690073,6.820769564202343e-05,4.1257309495613404e-05,4.3073991210303e-05,7.121108279908347e-05,0.00011439417813675099,0.00017855997401897621,0.0002708246336065125,0.0003991315632606312,0.0005715679134760805,0.0007953228617288015,0.0010753329441452718,0.0014127531827785075,0.0018034889935950617,0.0022370956672621415,0.0026963699331756293,0.003157899128524141,0.003593692304774686,0.003973812618984277,0.004269703702227521,0.004457711421048931,0.004522202656971653,0.004457711421048931,0.004269703702227521,0.003973812618984277,0.003593692304774686,0.003157899128524141,0.0026963699331756293,0.0022370956672621415,0.0018034889935950617,0.0014127531827785075,0.0010753329441452718,0.0007953228617288015,0.0005715679134760805,0.0003991315632606312,0.0002708246336065125,0.00017855997401897621,0.00011439417813675099,7.121108279908347e-05,4.3073991210303e-05,4.3697157374931756e-05,7.224131789223527e-05,0.00011604915784126202,0.0001811432622409184,0.00027474274621854254,0.0004049059361123375,0.0005798369819895308,0.0008068290696157214,0.0010908901536741086,0.001433191966316834,0.0018295806857626543,0.0022694604954961667,0.002735379239312913,0.0032035855354001354,0.0036456834805978972,0.0040313031254162295,0.00433147496617257,0.004522202656971653,0.00458762690966419,0.004522202656971653,0.00433147496617257,0.0040313031254162295,0.0036456834805978972,0.0032035855354001354,0.002735379239312913,0.0022694604954961667,0.0018295806857626543,0.001433191966316834,0.0010908901536741086,0.0008068290696157214,0.0005798369819895308,0.0004049059361123375,0.00027474274621854254,0.0001811432622409184,0.00011604915784126202,7.224131789223527e-05,4.3697157374931756e-05,4.3073991210303e-05,7.121108279908347e-05,0.00011439417813675099,0.00017855997401897621,0.0002708246336065125,0.0003991315632606312,0.0005715679134760805,0.0007953228617288015,0.0010753329441452718,0.0014127531827785075,0.0018034889935950617,0.0022370956672621415,0.0026963699331756293,0.003157899128524141,0.003593692304774686,0.003973812618984277,0.004269703702227521,0.004457711421048931,0.004522202656971653,0.004457711421048931,0.004269703702227521,0.003973812618984277,0.003593692304774686,0.003157899128524141,0.0026963699331756293,0.0022370956672621415,0.0018034889935950617,0.0014127531827785075,0.0010753329441452718,0.0007953228617288015,0.0005715679134760805,0.0003991315632606312,0.0002708246336065125,0.00017855997401897621,0.00011439417813675099,7.121108279908347e-05,4.3073991210303e-05,4.1257309495613404e-05,6.820769564202343e-05,0.00010956950770690073,0.00017102905731817763,0.0002594023774854504,0.0003822978547428651,0.0005474615572286263,0.000761779452827522,0.0010299798751135642,0.0013531691321157183,0.0017274253323171535,0.002142744280763406,0.002582648269220159,0.0030247120835713215,0.0034421253170202923,0.003806213738089657,0.004089625366669802,0.004269703702227521,0.00433147496617257,0.004269703702227521,0.004089625366669802,0.003806213738089657,0.0034421253170202923,0.0030247120835713215,0.002582648269220159,0.002142744280763406,0.0017274253323171535,0.0013531691321157183,0.0010299798751135642,0.000761779452827522,0.0005474615572286263,0.0003822978547428651,0.0002594023774854504,0.00017102905731817763,0.00010956950770690073,6.820769564202343e-05,4.1257309495613404e-05,3.839817198872036e-05,6.348089248270472e-05,0.00010197632499754553,0.000159176718944078,0.00024142575525988482,0.0003558045581934066,0.0005095223922420955,0.0007089880267217744,0.0009586021210068569,0.0012593943158201156,0.0016077145072932802,0.0019942517926271495,0.002403670371147943,0.002815099099316716,0.003203585535400135,0.003542442576303627,0.003806213738089657,0.003973812618984277,0.0040313031254162295,0.003973812618984277,0.003806213738089657,0.003542442576303627,0.003203585535400135,0.002815099099316716,0.002403670371147943,0.0019942517926271495,0.0016077145072932802,0.0012593943158201156,0.0009586021210068569,0.0007089880267217744,0.0005095223922420955,0.0003558045581934066,0.00024142575525988482,0.000159176718944078,0.00010197632499754553,6.348089248270472e-05,3.839817198872036e-05,3.47251439421294e-05,5.74085435547377e-05,9.222164443842183e-05,0.00014395045887061225,0.00021833185457889793,0.0003217696014841865,0.0004607833523310004,0.0006411688371100598,0.0008669057642893011,0.0011389252829431505,0.0014539264447278526,0.0018034889935950617,0.002173744095215339,0.002545817062954135,0.0028971423139719284,0.003203585535400135,0.0034421253170202923,0.003593692304774686,0.0036456834805978972,0.003593692304774686,0.0034421253170202923,0.003203585535400135,0.0028971423139719284,0.002545817062954135,0.002173744095215339,0.0018034889935950617,0.0014539264447278526,0.0011389252829431505,0.0008669057642893011,0.0006411688371100598,0.0004607833523310004,0.0003217696014841865,0.00021833185457889793,0.00014395045887061225,9.222164443842183e-05,5.74085435547377e-05,3.47251439421294e-05,3.0514159948259976e-05,5.0446831360736876e-05,8.103828205220107e-05,0.00012649414308904156,0.0001918555944224026,0.000282749845545327,0.00040490593611233766,0.0005634167703385615,0.0007617794528275225,0.0010008122158042642,0.0012776144041725778,0.0015847868537909788,0.0019101425502663896,0.0022370956672621424,0.002545817062954135,0.002815099099316716,0.0030247120835713215,0.003157899128524141,0.0032035855354001354,0.003157899128524141,0.0030247120835713215,0.002815099099316716,0.002545817062954135,0.0022370956672621424,0.0019101425502663896,0.0015847868537909788,0.0012776144041725778,0.0010008122158042642,0.0007617794528275225,0.0005634167703385615,0.00040490593611233766,0.000282749845545327,0.0001918555944224026,0.00012649414308904156,8.103828205220107e-05,5.0446831360736876e-05,3.0514159948259976e-05,2.6054493849223412e-05,4.307399121030299e-05,6.919447970584243e-05,0.00010800693444173135,0.0001638157633470304,0.00024142575525988482,0.0003457286466296617,0.00048107301011157113,0.0006504448459932534,0.0008545428012802555,0.001090890153674109,0.001353169132115719,0.0016309738630013802,0.0019101425502663896,0.002173744095215339,0.002403670371147943,0.002582648269220159,0.0026963699331756293,0.002735379239312913,0.0026963699331756293,0.002582648269220159,0.002403670371147943,0.002173744095215339,0.0019101425502663896,0.0016309738630013802,0.001353169132115719,0.001090890153674109,0.0008545428012802555,0.0006504448459932534,0.00048107301011157113,0.0003457286466296617,0.00024142575525988482,0.0001638157633470304,0.00010800693444173135,6.919447970584243e-05,4.307399121030299e-05,2.6054493849223412e-05,2.1616616691078233e-05,3.5737173124003936e-05,5.7408543554737695e-05,8.961005020156677e-05,0.00013591292867639752,0.00020030356532765837,0.0002868404842775862,0.00039913156326063106,0.0005396541953910444,0.0007089880267217747,0.0009050781965103313,0.0011226830433329013,0.001353169132115719,0.0015847868537909788,0.0018034889935950617,0.0019942517926271495,0.002142744280763406,0.0022370956672621415,0.0022694604954961667,0.0022370956672621415,0.002142744280763406,0.0019942517926271495,0.0018034889935950617,0.0015847868537909788,0.001353169132115719,0.0011226830433329013,0.0009050781965103313,0.0007089880267217747,0.0005396541953910444,0.00039913156326063106,0.0002868404842775862,0.00020030356532765837,0.00013591292867639752,8.961005020156677e-05,5.7408543554737695e-05,3.5737173124003936e-05,2.1616616691078233e-05,1.7426760442853525e-05,2.881038988834175e-05,4.628129138795561e-05,7.22413178922353e-05,0.0001095695077069008,0.00016147958298466043,0.0002312434214962366,0.00032176960148418637,0.00043505533356392724,0.0005715679134760804,0.0007296507653367061,0.0009050781965103313,0.001090890153674109,0.0012776144041725778,0.0014539264447278526,0.0016077145072932802,0.0017274253323171535,0.0018034889935950617,0.0018295806857626543,0.0018034889935950617,0.0017274253323171535,0.0016077145072932802,0.0014539264447278526,0.0012776144041725778,0.001090890153674109,0.0009050781965103313,0.0007296507653367061,0.0005715679134760804,0.00043505533356392724,0.00032176960148418637,0.0002312434214962366,0.00016147958298466043,0.0001095695077069008,7.22413178922353e-05,4.628129138795561e-05,2.881038988834175e-05,1.7426760442853525e-05,1.3651156934472418e-05,2.2568460443281957e-05,3.6254195031763263e-05,5.658983899697962e-05,8.583067115914677e-05,0.00012649414308904148,0.00018114326224091836,0.00025205644738202575,0.00034079820246200274,0.0004477345810288366,0.0005715679134760804,0.0007089880267217747,0.0008545428012802555,0.0010008122158042642,0.0011389252829431505,0.0012593943158201156,0.0013531691321157183,0.0014127531827785075,0.001433191966316834,0.0014127531827785075,0.0013531691321157183,0.0012593943158201156,0.0011389252829431505,0.0010008122158042642,0.0008545428012802555,0.0007089880267217747,0.0005715679134760804,0.0004477345810288366,0.00034079820246200274,0.00025205644738202575,0.00018114326224091836,0.00012649414308904148,8.583067115914677e-05,5.658983899697962e-05,3.6254195031763263e-05,2.2568460443281957e-05,1.3651156934472418e-05,1.039073134378975e-05,1.7178237012052332e-05,2.7595287525347602e-05,4.307399121030299e-05,6.533097885789742e-05,9.6282436991259e-05,0.00013787922750561942,0.0001918555944224024,0.00025940237748545034,0.00034079820246200274,0.00043505533356392724,0.0005396541953910444,0.0006504448459932534,0.0007617794528275225,0.0008669057642893011,0.0009586021210068569,0.0010299798751135642,0.0010753329441452718,0.0010908901536741086,0.0010753329441452718,0.0010299798751135642,0.0009586021210068569,0.0008669057642893011,0.0007617794528275225,0.0006504448459932534,0.0005396541953910444,0.00043505533356392724,0.00034079820246200274,0.00025940237748545034,0.0001918555944224024,0.00013787922750561942,9.6282436991259e-05,6.533097885789742e-05,4.307399121030299e-05,2.7595287525347602e-05,1.7178237012052332e-05,1.039073134378975e-05,7.685048833286371e-06,1.2705129787259061e-05,2.04096444402466e-05,3.1857788922006075e-05,4.831919392752035e-05,7.121108279908345e-05,0.00010197632499754555,0.00014189757807149604,0.0001918555944224024,0.00025205644738202575,0.00032176960148418637,0.00039913156326063106,0.00048107301011157113,0.0005634167703385615,0.0006411688371100598,0.0007089880267217744,0.000761779452827522,0.0007953228617288015,0.0008068290696157214,0.0007953228617288015,0.000761779452827522,0.0007089880267217744,0.0006411688371100598,0.0005634167703385615,0.00048107301011157113,0.00039913156326063106,0.00032176960148418637,0.00025205644738202575,0.0001918555944224024,0.00014189757807149604,0.00010197632499754555,7.121108279908345e-05,4.831919392752035e-05,3.1857788922006075e-05,2.04096444402466e-05,1.2705129787259061e-05,7.685048833286371e-06,5.522948651388188e-06,9.130687513698921e-06,1.4667625500093163e-05,2.2894966080230053e-05,3.4725143942129406e-05,5.117666292575854e-05,7.328645774887955e-05,0.00010197632499754555,0.00013787922750561942,0.00018114326224091836,0.0002312434214962366,0.0002868404842775862,0.0003457286466296617,0.00040490593611233766,0.0004607833523310004,0.0005095223922420955,0.0005474615572286263,0.0005715679134760805,0.0005798369819895308,0.0005715679134760805,0.0005474615572286263,0.0005095223922420955,0.0004607833523310004,0.00040490593611233766,0.0003457286466296617,0.0002868404842775862,0.0002312434214962366,0.00018114326224091836,0.00013787922750561942,0.00010197632499754555,7.328645774887955e-05,5.117666292575854e-05,3.4725143942129406e-05,2.2894966080230053e-05,1.4667625500093163e-05,9.130687513698921e-06,5.522948651388188e-06,3.8567300176639694e-06,6.376049975974532e-06,1.0242548885520458e-05,1.5987782706041925e-05,2.4248913662387676e-05,3.5737173124003936e-05,5.117666292575854e-05,7.121108279908345e-05,9.6282436991259e-05,0.00012649414308904148,0.00016147958298466043,0.00020030356532765837,0.00024142575525988482,0.000282749845545327,0.0003217696014841865,0.0003558045581934066,0.0003822978547428651,0.0003991315632606312,0.0004049059361123375,0.0003991315632606312,0.0003822978547428651,0.0003558045581934066,0.0003217696014841865,0.000282749845545327,0.00024142575525988482,0.00020030356532765837,0.00016147958298466043,0.00012649414308904148,9.6282436991259e-05,7.121108279908345e-05,5.117666292575854e-05,3.5737173124003936e-05,2.4248913662387676e-05,1.5987782706041925e-05,1.0242548885520458e-05,6.376049975974532e-06,3.8567300176639694e-06,2.616925320113134e-06,4.326371446280553e-06,6.949925298958387e-06,1.084826606588601e-05,1.645373045499722e-05,2.4248913662387676e-05,3.4725143942129406e-05,4.831919392752035e-05,6.533097885789742e-05,8.583067115914677e-05,0.0001095695077069008,0.00013591292867639752,0.0001638157633470304,0.0001918555944224026,0.00021833185457889793,0.00024142575525988482,0.0002594023774854504,0.0002708246336065125,0.00027474274621854254,0.0002708246336065125,0.0002594023774854504,0.00024142575525988482,0.00021833185457889793,0.0001918555944224026,0.0001638157633470304,0.00013591292867639752,0.0001095695077069008,8.583067115914677e-05,6.533097885789742e-05,4.831919392752035e-05,3.4725143942129406e-05,2.4248913662387676e-05,1.645373045499722e-05,1.084826606588601e-05,6.949925298958387e-06,4.326371446280553e-06,2.616925320113134e-06,1.7253900095658272e-06,2.8524612505031728e-06,4.582221581139041e-06,7.152473839177998e-06,1.084826606588601e-05,1.5987782706041925e-05,2.2894966080230053e-05,3.1857788922006075e-05,4.307399121030299e-05,5.658983899697962e-05,7.22413178922353e-05,8.961005020156677e-05,0.00010800693444173135,0.00012649414308904156,0.00014395045887061225,0.000159176718944078,0.00017102905731817763,0.00017855997401897621,0.0001811432622409184,0.00017855997401897621,0.00017102905731817763,0.000159176718944078,0.00014395045887061225,0.00012649414308904156,0.00010800693444173135,8.961005020156677e-05,7.22413178922353e-05,5.658983899697962e-05,4.307399121030299e-05,3.1857788922006075e-05,2.2894966080230053e-05,1.5987782706041925e-05,1.084826606588601e-05,7.152473839177998e-06,4.582221581139041e-06,2.8524612505031728e-06,1.7253900095658272e-06,1.105368508222722e-06,1.827424999420989e-06,2.9355933472480104e-06,4.582221581139041e-06,6.949925298958387e-06,1.0242548885520458e-05,1.4667625500093163e-05,2.04096444402466e-05,2.7595287525347602e-05,3.6254195031763263e-05,4.628129138795561e-05,5.7408543554737695e-05,6.919447970584243e-05,8.103828205220107e-05,9.222164443842183e-05,0.00010197632499754553,0.00010956950770690073,0.00011439417813675099,0.00011604915784126202,0.00011439417813675099,0.00010956950770690073,0.00010197632499754553,9.222164443842183e-05,8.103828205220107e-05,6.919447970584243e-05,5.7408543554737695e-05,4.628129138795561e-05,3.6254195031763263e-05,2.7595287525347602e-05,2.04096444402466e-05,1.4667625500093163e-05,1.0242548885520458e-05,6.949925298958387e-06,4.582221581139041e-06,2.9355933472480104e-06,1.827424999420989e-06,1.105368508222722e-06,6.880987270912464e-07,1.1375833548742092e-06,1.827424999420989e-06,2.8524612505031728e-06,4.326371446280553e-06,6.376049975974532e-06,9.130687513698921e-06,1.2705129787259061e-05,1.7178237012052332e-05,2.2568460443281957e-05,2.881038988834175e-05,3.5737173124003936e-05,4.307399121030299e-05,5.0446831360736876e-05,5.74085435547377e-05,6.348089248270472e-05,6.820769564202343e-05,7.121108279908347e-05,7.224131789223527e-05,7.121108279908347e-05,6.820769564202343e-05,6.348089248270472e-05,5.74085435547377e-05,5.0446831360736876e-05,4.307399121030299e-05,3.5737173124003936e-05,2.881038988834175e-05,2.2568460443281957e-05,1.7178237012052332e-05,1.2705129787259061e-05,9.130687513698921e-06,6.376049975974532e-06,4.326371446280553e-06,2.8524612505031728e-06,1.827424999420989e-06,1.1375833548742092e-06,6.880987270912464e-07,4.162155293463744e-07,6.880987270912464e-07,1.105368508222722e-06,1.7253900095658272e-06,2.616925320113134e-06,3.8567300176639694e-06,5.522948651388188e-06,7.685048833286371e-06,1.039073134378975e-05,1.3651156934472418e-05,1.7426760442853525e-05,2.1616616691078233e-05,2.6054493849223412e-05,3.0514159948259976e-05,3.47251439421294e-05,3.839817198872036e-05,4.1257309495613404e-05,4.3073991210303e-05,4.3697157374931756e-05,4.3073991210303e-05,4.1257309495613404e-05,3.839817198872036e-05,3.47251439421294e-05,3.0514159948259976e-05,2.6054493849223412e-05,2.1616616691078233e-05,1.7426760442853525e-05,1.3651156934472418e-05,1.039073134378975e-05,7.685048833286371e-06,5.522948651388188e-06,3.8567300176639694e-06,2.616925320113134e-06,1.7253900095658272e-06,1.105368508222722e-06,6.880987270912464e-07,4.162155293463744e-07);
-const float kernel39[1521]=float[](3.466498507413424e-07,5.609235971250556e-07,8.843382706140075e-07,1.3584233749515033e-06,2.033077287877134e-06,2.964658322506263e-06,4.212087883219408e-06,5.830720402982427e-06,7.864099967544758e-06,1.0334223533118108e-05,1.3231488192089694e-05,1.6505989042483802e-05,2.0062101715495678e-05,2.3758188298737885e-05,2.741272622697744e-05,3.081719838050432e-05,3.3754843281825624e-05,3.6023097576441356e-05,3.7456572090590194e-05,3.794696277581987e-05,3.7456572090590194e-05,3.6023097576441356e-05,3.3754843281825624e-05,3.081719838050432e-05,2.741272622697744e-05,2.3758188298737885e-05,2.0062101715495678e-05,1.6505989042483802e-05,1.3231488192089694e-05,1.0334223533118108e-05,7.864099967544758e-06,5.830720402982427e-06,4.212087883219408e-06,2.964658322506263e-06,2.033077287877134e-06,1.3584233749515033e-06,8.843382706140075e-07,5.609235971250556e-07,3.466498507413424e-07,5.609235971250556e-07,9.076458020646348e-07,1.4309719238803068e-06,2.1981019875445184e-06,3.289777921757192e-06,4.797194653194232e-06,6.815694516554755e-06,9.434848032609572e-06,1.2725115076532045e-05,1.6722089524326107e-05,2.1410232648744362e-05,2.670879196404212e-05,3.246303506572514e-05,3.8443773776917714e-05,4.435728147396171e-05,4.986615090686186e-05,5.4619634404983285e-05,5.828995866852831e-05,6.0609502955490734e-05,6.1403017525214e-05,6.0609502955490734e-05,5.828995866852831e-05,5.4619634404983285e-05,4.986615090686186e-05,4.435728147396171e-05,3.8443773776917714e-05,3.246303506572514e-05,2.670879196404212e-05,2.1410232648744362e-05,1.6722089524326107e-05,1.2725115076532045e-05,9.434848032609572e-06,6.815694516554755e-06,4.797194653194232e-06,3.289777921757192e-06,2.1981019875445184e-06,1.4309719238803068e-06,9.076458020646348e-07,5.609235971250556e-07,8.843382706140075e-07,1.4309719238803068e-06,2.2560349447723088e-06,3.4654732306884127e-06,5.1865825095289894e-06,7.563138447282576e-06,1.0745455410854513e-05,1.4874748068057743e-05,2.0062101715495674e-05,2.6363632777777826e-05,3.375484328182564e-05,4.210842085576303e-05,5.11804182174651e-05,6.060950295549072e-05,6.993259293934927e-05,7.861774024336465e-05,8.61119647646121e-05,9.189850722503279e-05,9.555544338150479e-05,9.6806478827139e-05,9.555544338150479e-05,9.189850722503279e-05,8.61119647646121e-05,7.861774024336465e-05,6.993259293934927e-05,6.060950295549072e-05,5.11804182174651e-05,4.210842085576303e-05,3.375484328182564e-05,2.6363632777777826e-05,2.0062101715495674e-05,1.4874748068057743e-05,1.0745455410854513e-05,7.563138447282576e-06,5.1865825095289894e-06,3.4654732306884127e-06,2.2560349447723088e-06,1.4309719238803068e-06,8.843382706140075e-07,1.3584233749515033e-06,2.1981019875445184e-06,3.4654732306884127e-06,5.323279561979501e-06,7.96705870499868e-06,1.1617663055167494e-05,1.65059890424838e-05,2.284895513809995e-05,3.081719838050431e-05,4.049691866112005e-05,5.185048488291711e-05,6.468233375566619e-05,7.861774024336465e-05,9.310166516005882e-05,0.00010742277257075181,0.00012076394246547992,0.00013227574751235294,0.00014116439883457509,0.00014678178272570507,0.00014870348604751477,0.00014678178272570507,0.00014116439883457509,0.00013227574751235294,0.00012076394246547992,0.00010742277257075181,9.310166516005882e-05,7.861774024336465e-05,6.468233375566619e-05,5.185048488291711e-05,4.049691866112005e-05,3.081719838050431e-05,2.284895513809995e-05,1.65059890424838e-05,1.1617663055167494e-05,7.96705870499868e-06,5.323279561979501e-06,3.4654732306884127e-06,2.1981019875445184e-06,1.3584233749515033e-06,2.033077287877134e-06,3.289777921757192e-06,5.1865825095289894e-06,7.96705870499868e-06,1.192385702645532e-05,1.7387515064302798e-05,2.470360276112055e-05,3.4196770019989526e-05,4.6122399878200054e-05,6.060950295549075e-05,7.760175886596393e-05,9.680647882713901e-05,0.00011766283256036806,0.0001393401235511094,0.00016077373456723924,0.0001807407271903235,0.00019796981041638508,0.00021127296424625351,0.00021968019266776898,0.0002225562999621895,0.00021968019266776898,0.00021127296424625351,0.00019796981041638508,0.0001807407271903235,0.00016077373456723924,0.0001393401235511094,0.00011766283256036806,9.680647882713901e-05,7.760175886596393e-05,6.060950295549075e-05,4.6122399878200054e-05,3.4196770019989526e-05,2.470360276112055e-05,1.7387515064302798e-05,1.192385702645532e-05,7.96705870499868e-06,5.1865825095289894e-06,3.289777921757192e-06,2.033077287877134e-06,2.964658322506263e-06,4.797194653194232e-06,7.563138447282576e-06,1.1617663055167494e-05,1.7387515064302798e-05,2.535468845698085e-05,3.602309757644135e-05,4.986615090686187e-05,6.725625113624856e-05,8.838152313805331e-05,0.00011315983983241843,0.0001411643988345751,0.00017157739052999402,0.0002031874830376897,0.00023444223840740855,0.00026355835278654146,0.0002886820139871595,0.000308080836625369,0.00032034036057838227,0.0003245343356317006,0.00032034036057838227,0.000308080836625369,0.0002886820139871595,0.00026355835278654146,0.00023444223840740855,0.0002031874830376897,0.00017157739052999402,0.0001411643988345751,0.00011315983983241843,8.838152313805331e-05,6.725625113624856e-05,4.986615090686187e-05,3.602309757644135e-05,2.535468845698085e-05,1.7387515064302798e-05,1.1617663055167494e-05,7.563138447282576e-06,4.797194653194232e-06,2.964658322506263e-06,4.212087883219408e-06,6.815694516554755e-06,1.0745455410854513e-05,1.65059890424838e-05,2.470360276112055e-05,3.602309757644135e-05,5.118041821746509e-05,7.08481677038652e-05,9.555544338150476e-05,0.00012556952680994275,0.00016077373456723922,0.00020056168002874795,0.0002437714465101789,0.00028868201398715953,0.0003330877302838311,0.00037445493663329634,0.00041014979837229504,0.00043771099999975575,0.0004551289236452946,0.0004610875838289992,0.0004551289236452946,0.00043771099999975575,0.00041014979837229504,0.00037445493663329634,0.0003330877302838311,0.00028868201398715953,0.0002437714465101789,0.00020056168002874795,0.00016077373456723922,0.00012556952680994275,9.555544338150476e-05,7.08481677038652e-05,5.118041821746509e-05,3.602309757644135e-05,2.470360276112055e-05,1.65059890424838e-05,1.0745455410854513e-05,6.815694516554755e-06,4.212087883219408e-06,5.830720402982427e-06,9.434848032609572e-06,1.4874748068057743e-05,2.284895513809995e-05,3.4196770019989526e-05,4.986615090686187e-05,7.08481677038652e-05,9.807389313755426e-05,0.00013227574751235302,0.00017382372406816272,0.00022255629996218956,0.00027763406467821284,0.0003374485970470907,0.0003996175188164539,0.0004610875838289994,0.0005183514920767674,0.0005677632717911401,0.0006059157664957661,0.0006300270969317325,0.0006382755671609459,0.0006300270969317325,0.0006059157664957661,0.0005677632717911401,0.0005183514920767674,0.0004610875838289994,0.0003996175188164539,0.0003374485970470907,0.00027763406467821284,0.00022255629996218956,0.00017382372406816272,0.00013227574751235302,9.807389313755426e-05,7.08481677038652e-05,4.986615090686187e-05,3.4196770019989526e-05,2.284895513809995e-05,1.4874748068057743e-05,9.434848032609572e-06,5.830720402982427e-06,7.864099967544758e-06,1.2725115076532045e-05,2.0062101715495674e-05,3.081719838050431e-05,4.6122399878200054e-05,6.725625113624856e-05,9.555544338150476e-05,0.00013227574751235302,0.00017840500484070102,0.0002344422384074086,0.00030016959661010375,0.0003744549366332964,0.00045512892364529464,0.0005389783593717388,0.0006218852221365645,0.0006991190916876433,0.000765762516237613,0.000817220142676866,0.0008497399515159172,0.0008608649566574211,0.0008497399515159172,0.000817220142676866,0.000765762516237613,0.0006991190916876433,0.0006218852221365645,0.0005389783593717388,0.00045512892364529464,0.0003744549366332964,0.00030016959661010375,0.0002344422384074086,0.00017840500484070102,0.00013227574751235302,9.555544338150476e-05,6.725625113624856e-05,4.6122399878200054e-05,3.081719838050431e-05,2.0062101715495674e-05,1.2725115076532045e-05,7.864099967544758e-06,1.0334223533118108e-05,1.6722089524326107e-05,2.6363632777777826e-05,4.049691866112005e-05,6.060950295549075e-05,8.838152313805331e-05,0.00012556952680994275,0.00017382372406816272,0.0002344422384074086,0.00030808083662536915,0.0003944532396608358,0.0004920716972340595,0.0005980854837487986,0.0007082721313625151,0.0008172201426768663,0.0009187132665642171,0.0010062894735242234,0.001073910004328965,0.0011166443255079912,0.001131263708579654,0.0011166443255079912,0.001073910004328965,0.0010062894735242234,0.0009187132665642171,0.0008172201426768663,0.0007082721313625151,0.0005980854837487986,0.0004920716972340595,0.0003944532396608358,0.00030808083662536915,0.0002344422384074086,0.00017382372406816272,0.00012556952680994275,8.838152313805331e-05,6.060950295549075e-05,4.049691866112005e-05,2.6363632777777826e-05,1.6722089524326107e-05,1.0334223533118108e-05,1.3231488192089694e-05,2.1410232648744362e-05,3.375484328182564e-05,5.185048488291711e-05,7.760175886596393e-05,0.00011315983983241843,0.00016077373456723922,0.00022255629996218956,0.00030016959661010375,0.0003944532396608358,0.0005050406899152009,0.0006300270969317324,0.0007657625162376133,0.0009068406845348827,0.0010463329570445466,0.0011762803174814645,0.0012884090656729308,0.0013749874382055615,0.0014297025954948526,0.0014484206146927574,0.0014297025954948526,0.0013749874382055615,0.0012884090656729308,0.0011762803174814645,0.0010463329570445466,0.0009068406845348827,0.0007657625162376133,0.0006300270969317324,0.0005050406899152009,0.0003944532396608358,0.00030016959661010375,0.00022255629996218956,0.00016077373456723922,0.00011315983983241843,7.760175886596393e-05,5.185048488291711e-05,3.375484328182564e-05,2.1410232648744362e-05,1.3231488192089694e-05,1.6505989042483802e-05,2.670879196404212e-05,4.210842085576303e-05,6.468233375566619e-05,9.680647882713901e-05,0.0001411643988345751,0.00020056168002874795,0.00027763406467821284,0.0003744549366332964,0.0004920716972340595,0.0006300270969317324,0.0007859448769065993,0.0009552718121094922,0.0011312637085796537,0.0013052772351104167,0.001467383694817177,0.001607261829621563,0.001715266435573147,0.0017835223848332417,0.001806872700027743,0.0017835223848332417,0.001715266435573147,0.001607261829621563,0.001467383694817177,0.0013052772351104167,0.0011312637085796537,0.0009552718121094922,0.0007859448769065993,0.0006300270969317324,0.0004920716972340595,0.0003744549366332964,0.00027763406467821284,0.00020056168002874795,0.0001411643988345751,9.680647882713901e-05,6.468233375566619e-05,4.210842085576303e-05,2.670879196404212e-05,1.6505989042483802e-05,2.0062101715495678e-05,3.246303506572514e-05,5.11804182174651e-05,7.861774024336465e-05,0.00011766283256036806,0.00017157739052999402,0.0002437714465101789,0.0003374485970470907,0.00045512892364529464,0.0005980854837487986,0.0007657625162376133,0.0009552718121094922,0.0011610791822991916,0.0013749874382055615,0.0015864910966744234,0.0017835223848332417,0.0019535363937482225,0.002084809920270366,0.0021677711892509294,0.0021961521846166256,0.0021677711892509294,0.002084809920270366,0.0019535363937482225,0.0017835223848332417,0.0015864910966744234,0.0013749874382055615,0.0011610791822991916,0.0009552718121094922,0.0007657625162376133,0.0005980854837487986,0.00045512892364529464,0.0003374485970470907,0.0002437714465101789,0.00017157739052999402,0.00011766283256036806,7.861774024336465e-05,5.11804182174651e-05,3.246303506572514e-05,2.0062101715495678e-05,2.3758188298737885e-05,3.8443773776917714e-05,6.060950295549072e-05,9.310166516005882e-05,0.0001393401235511094,0.0002031874830376897,0.00028868201398715953,0.0003996175188164539,0.0005389783593717388,0.0007082721313625151,0.0009068406845348827,0.0011312637085796537,0.0013749874382055615,0.0016283044981301867,0.001878773956167775,0.0021121047662296375,0.0023134408423051353,0.002468899188892199,0.0025671446009578793,0.0026007542915858065,0.0025671446009578793,0.002468899188892199,0.0023134408423051353,0.0021121047662296375,0.001878773956167775,0.0016283044981301867,0.0013749874382055615,0.0011312637085796537,0.0009068406845348827,0.0007082721313625151,0.0005389783593717388,0.0003996175188164539,0.00028868201398715953,0.0002031874830376897,0.0001393401235511094,9.310166516005882e-05,6.060950295549072e-05,3.8443773776917714e-05,2.3758188298737885e-05,2.741272622697744e-05,4.435728147396171e-05,6.993259293934927e-05,0.00010742277257075181,0.00016077373456723924,0.00023444223840740855,0.0003330877302838311,0.0004610875838289994,0.0006218852221365645,0.0008172201426768663,0.0010463329570445466,0.0013052772351104167,0.0015864910966744234,0.001878773956167775,0.0021677711892509294,0.0024369934690021385,0.002669299512866801,0.002848670811768247,0.0029620285539558597,0.003000808162744705,0.0029620285539558597,0.002848670811768247,0.002669299512866801,0.0024369934690021385,0.0021677711892509294,0.001878773956167775,0.0015864910966744234,0.0013052772351104167,0.0010463329570445466,0.0008172201426768663,0.0006218852221365645,0.0004610875838289994,0.0003330877302838311,0.00023444223840740855,0.00016077373456723924,0.00010742277257075181,6.993259293934927e-05,4.435728147396171e-05,2.741272622697744e-05,3.081719838050432e-05,4.986615090686186e-05,7.861774024336465e-05,0.00012076394246547992,0.0001807407271903235,0.00026355835278654146,0.00037445493663329634,0.0005183514920767674,0.0006991190916876433,0.0009187132665642171,0.0011762803174814645,0.001467383694817177,0.0017835223848332417,0.0021121047662296375,0.0024369934690021385,0.002739651305178232,0.0030008081627447046,0.0032024561439139266,0.003329892138423799,0.0033734879080407625,0.003329892138423799,0.0032024561439139266,0.0030008081627447046,0.002739651305178232,0.0024369934690021385,0.0021121047662296375,0.0017835223848332417,0.001467383694817177,0.0011762803174814645,0.0009187132665642171,0.0006991190916876433,0.0005183514920767674,0.00037445493663329634,0.00026355835278654146,0.0001807407271903235,0.00012076394246547992,7.861774024336465e-05,4.986615090686186e-05,3.081719838050432e-05,3.3754843281825624e-05,5.4619634404983285e-05,8.61119647646121e-05,0.00013227574751235294,0.00019796981041638508,0.0002886820139871595,0.00041014979837229504,0.0005677632717911401,0.000765762516237613,0.0010062894735242234,0.0012884090656729308,0.001607261829621563,0.0019535363937482225,0.0023134408423051353,0.002669299512866801,0.0030008081627447046,0.003286859759333287,0.003507729804637912,0.0036473136165740944,0.0036950651465153146,0.0036473136165740944,0.003507729804637912,0.003286859759333287,0.0030008081627447046,0.002669299512866801,0.0023134408423051353,0.0019535363937482225,0.001607261829621563,0.0012884090656729308,0.0010062894735242234,0.000765762516237613,0.0005677632717911401,0.00041014979837229504,0.0002886820139871595,0.00019796981041638508,0.00013227574751235294,8.61119647646121e-05,5.4619634404983285e-05,3.3754843281825624e-05,3.6023097576441356e-05,5.828995866852831e-05,9.189850722503279e-05,0.00014116439883457509,0.00021127296424625351,0.000308080836625369,0.00043771099999975575,0.0006059157664957661,0.000817220142676866,0.001073910004328965,0.0013749874382055615,0.001715266435573147,0.002084809920270366,0.002468899188892199,0.002848670811768247,0.0032024561439139266,0.003507729804637912,0.0037434418512705047,0.003892405401048739,0.003943365733115311,0.003892405401048739,0.0037434418512705047,0.003507729804637912,0.0032024561439139266,0.002848670811768247,0.002468899188892199,0.002084809920270366,0.001715266435573147,0.0013749874382055615,0.001073910004328965,0.000817220142676866,0.0006059157664957661,0.00043771099999975575,0.000308080836625369,0.00021127296424625351,0.00014116439883457509,9.189850722503279e-05,5.828995866852831e-05,3.6023097576441356e-05,3.7456572090590194e-05,6.0609502955490734e-05,9.555544338150479e-05,0.00014678178272570507,0.00021968019266776898,0.00032034036057838227,0.0004551289236452946,0.0006300270969317325,0.0008497399515159172,0.0011166443255079912,0.0014297025954948526,0.0017835223848332417,0.0021677711892509294,0.0025671446009578793,0.0029620285539558597,0.003329892138423799,0.0036473136165740944,0.003892405401048739,0.004047296687932066,0.004100284894950118,0.004047296687932066,0.003892405401048739,0.0036473136165740944,0.003329892138423799,0.0029620285539558597,0.0025671446009578793,0.0021677711892509294,0.0017835223848332417,0.0014297025954948526,0.0011166443255079912,0.0008497399515159172,0.0006300270969317325,0.0004551289236452946,0.00032034036057838227,0.00021968019266776898,0.00014678178272570507,9.555544338150479e-05,6.0609502955490734e-05,3.7456572090590194e-05,3.794696277581987e-05,6.1403017525214e-05,9.6806478827139e-05,0.00014870348604751477,0.0002225562999621895,0.0003245343356317006,0.0004610875838289992,0.0006382755671609459,0.0008608649566574211,0.001131263708579654,0.0014484206146927574,0.001806872700027743,0.0021961521846166256,0.0026007542915858065,0.003000808162744705,0.0033734879080407625,0.0036950651465153146,0.003943365733115311,0.004100284894950118,0.004153966836650721,0.004100284894950118,0.003943365733115311,0.0036950651465153146,0.0033734879080407625,0.003000808162744705,0.0026007542915858065,0.0021961521846166256,0.001806872700027743,0.0014484206146927574,0.001131263708579654,0.0008608649566574211,0.0006382755671609459,0.0004610875838289992,0.0003245343356317006,0.0002225562999621895,0.00014870348604751477,9.6806478827139e-05,6.1403017525214e-05,3.794696277581987e-05,3.7456572090590194e-05,6.0609502955490734e-05,9.555544338150479e-05,0.00014678178272570507,0.00021968019266776898,0.00032034036057838227,0.0004551289236452946,0.0006300270969317325,0.0008497399515159172,0.0011166443255079912,0.0014297025954948526,0.0017835223848332417,0.0021677711892509294,0.0025671446009578793,0.0029620285539558597,0.003329892138423799,0.0036473136165740944,0.003892405401048739,0.004047296687932066,0.004100284894950118,0.004047296687932066,0.003892405401048739,0.0036473136165740944,0.003329892138423799,0.0029620285539558597,0.0025671446009578793,0.0021677711892509294,0.0017835223848332417,0.0014297025954948526,0.0011166443255079912,0.0008497399515159172,0.0006300270969317325,0.0004551289236452946,0.00032034036057838227,0.00021968019266776898,0.00014678178272570507,9.555544338150479e-05,6.0609502955490734e-05,3.7456572090590194e-05,3.6023097576441356e-05,5.828995866852831e-05,9.189850722503279e-05,0.00014116439883457509,0.00021127296424625351,0.000308080836625369,0.00043771099999975575,0.0006059157664957661,0.000817220142676866,0.001073910004328965,0.0013749874382055615,0.001715266435573147,0.002084809920270366,0.002468899188892199,0.002848670811768247,0.0032024561439139266,0.003507729804637912,0.0037434418512705047,0.003892405401048739,0.003943365733115311,0.003892405401048739,0.0037434418512705047,0.003507729804637912,0.0032024561439139266,0.002848670811768247,0.002468899188892199,0.002084809920270366,0.001715266435573147,0.0013749874382055615,0.001073910004328965,0.000817220142676866,0.0006059157664957661,0.00043771099999975575,0.000308080836625369,0.00021127296424625351,0.00014116439883457509,9.189850722503279e-05,5.828995866852831e-05,3.6023097576441356e-05,3.3754843281825624e-05,5.4619634404983285e-05,8.61119647646121e-05,0.00013227574751235294,0.00019796981041638508,0.0002886820139871595,0.00041014979837229504,0.0005677632717911401,0.000765762516237613,0.0010062894735242234,0.0012884090656729308,0.001607261829621563,0.0019535363937482225,0.0023134408423051353,0.002669299512866801,0.0030008081627447046,0.003286859759333287,0.003507729804637912,0.0036473136165740944,0.0036950651465153146,0.0036473136165740944,0.003507729804637912,0.003286859759333287,0.0030008081627447046,0.002669299512866801,0.0023134408423051353,0.0019535363937482225,0.001607261829621563,0.0012884090656729308,0.0010062894735242234,0.000765762516237613,0.0005677632717911401,0.00041014979837229504,0.0002886820139871595,0.00019796981041638508,0.00013227574751235294,8.61119647646121e-05,5.4619634404983285e-05,3.3754843281825624e-05,3.081719838050432e-05,4.986615090686186e-05,7.861774024336465e-05,0.00012076394246547992,0.0001807407271903235,0.00026355835278654146,0.00037445493663329634,0.0005183514920767674,0.0006991190916876433,0.0009187132665642171,0.0011762803174814645,0.001467383694817177,0.0017835223848332417,0.0021121047662296375,0.0024369934690021385,0.002739651305178232,0.0030008081627447046,0.0032024561439139266,0.003329892138423799,0.0033734879080407625,0.003329892138423799,0.0032024561439139266,0.0030008081627447046,0.002739651305178232,0.0024369934690021385,0.0021121047662296375,0.0017835223848332417,0.001467383694817177,0.0011762803174814645,0.0009187132665642171,0.0006991190916876433,0.0005183514920767674,0.00037445493663329634,0.00026355835278654146,0.0001807407271903235,0.00012076394246547992,7.861774024336465e-05,4.986615090686186e-05,3.081719838050432e-05,2.741272622697744e-05,4.435728147396171e-05,6.993259293934927e-05,0.00010742277257075181,0.00016077373456723924,0.00023444223840740855,0.0003330877302838311,0.0004610875838289994,0.0006218852221365645,0.0008172201426768663,0.0010463329570445466,0.0013052772351104167,0.0015864910966744234,0.001878773956167775,0.0021677711892509294,0.0024369934690021385,0.002669299512866801,0.002848670811768247,0.0029620285539558597,0.003000808162744705,0.0029620285539558597,0.002848670811768247,0.002669299512866801,0.0024369934690021385,0.0021677711892509294,0.001878773956167775,0.0015864910966744234,0.0013052772351104167,0.0010463329570445466,0.0008172201426768663,0.0006218852221365645,0.0004610875838289994,0.0003330877302838311,0.00023444223840740855,0.00016077373456723924,0.00010742277257075181,6.993259293934927e-05,4.435728147396171e-05,2.741272622697744e-05,2.3758188298737885e-05,3.8443773776917714e-05,6.060950295549072e-05,9.310166516005882e-05,0.0001393401235511094,0.0002031874830376897,0.00028868201398715953,0.0003996175188164539,0.0005389783593717388,0.0007082721313625151,0.0009068406845348827,0.0011312637085796537,0.0013749874382055615,0.0016283044981301867,0.001878773956167775,0.0021121047662296375,0.0023134408423051353,0.002468899188892199,0.0025671446009578793,0.0026007542915858065,0.0025671446009578793,0.002468899188892199,0.0023134408423051353,0.0021121047662296375,0.001878773956167775,0.0016283044981301867,0.0013749874382055615,0.0011312637085796537,0.0009068406845348827,0.0007082721313625151,0.0005389783593717388,0.0003996175188164539,0.00028868201398715953,0.0002031874830376897,0.0001393401235511094,9.310166516005882e-05,6.060950295549072e-05,3.8443773776917714e-05,2.3758188298737885e-05,2.0062101715495678e-05,3.246303506572514e-05,5.11804182174651e-05,7.861774024336465e-05,0.00011766283256036806,0.00017157739052999402,0.0002437714465101789,0.0003374485970470907,0.00045512892364529464,0.0005980854837487986,0.0007657625162376133,0.0009552718121094922,0.0011610791822991916,0.0013749874382055615,0.0015864910966744234,0.0017835223848332417,0.0019535363937482225,0.002084809920270366,0.0021677711892509294,0.0021961521846166256,0.0021677711892509294,0.002084809920270366,0.0019535363937482225,0.0017835223848332417,0.0015864910966744234,0.0013749874382055615,0.0011610791822991916,0.0009552718121094922,0.0007657625162376133,0.0005980854837487986,0.00045512892364529464,0.0003374485970470907,0.0002437714465101789,0.00017157739052999402,0.00011766283256036806,7.861774024336465e-05,5.11804182174651e-05,3.246303506572514e-05,2.0062101715495678e-05,1.6505989042483802e-05,2.670879196404212e-05,4.210842085576303e-05,6.468233375566619e-05,9.680647882713901e-05,0.0001411643988345751,0.00020056168002874795,0.00027763406467821284,0.0003744549366332964,0.0004920716972340595,0.0006300270969317324,0.0007859448769065993,0.0009552718121094922,0.0011312637085796537,0.0013052772351104167,0.001467383694817177,0.001607261829621563,0.001715266435573147,0.0017835223848332417,0.001806872700027743,0.0017835223848332417,0.001715266435573147,0.001607261829621563,0.001467383694817177,0.0013052772351104167,0.0011312637085796537,0.0009552718121094922,0.0007859448769065993,0.0006300270969317324,0.0004920716972340595,0.0003744549366332964,0.00027763406467821284,0.00020056168002874795,0.0001411643988345751,9.680647882713901e-05,6.468233375566619e-05,4.210842085576303e-05,2.670879196404212e-05,1.6505989042483802e-05,1.3231488192089694e-05,2.1410232648744362e-05,3.375484328182564e-05,5.185048488291711e-05,7.760175886596393e-05,0.00011315983983241843,0.00016077373456723922,0.00022255629996218956,0.00030016959661010375,0.0003944532396608358,0.0005050406899152009,0.0006300270969317324,0.0007657625162376133,0.0009068406845348827,0.0010463329570445466,0.0011762803174814645,0.0012884090656729308,0.0013749874382055615,0.0014297025954948526,0.0014484206146927574,0.0014297025954948526,0.0013749874382055615,0.0012884090656729308,0.0011762803174814645,0.0010463329570445466,0.0009068406845348827,0.0007657625162376133,0.0006300270969317324,0.0005050406899152009,0.0003944532396608358,0.00030016959661010375,0.00022255629996218956,0.00016077373456723922,0.00011315983983241843,7.760175886596393e-05,5.185048488291711e-05,3.375484328182564e-05,2.1410232648744362e-05,1.3231488192089694e-05,1.0334223533118108e-05,1.6722089524326107e-05,2.6363632777777826e-05,4.049691866112005e-05,6.060950295549075e-05,8.838152313805331e-05,0.00012556952680994275,0.00017382372406816272,0.0002344422384074086,0.00030808083662536915,0.0003944532396608358,0.0004920716972340595,0.0005980854837487986,0.0007082721313625151,0.0008172201426768663,0.0009187132665642171,0.0010062894735242234,0.001073910004328965,0.0011166443255079912,0.001131263708579654,0.0011166443255079912,0.001073910004328965,0.0010062894735242234,0.0009187132665642171,0.0008172201426768663,0.0007082721313625151,0.0005980854837487986,0.0004920716972340595,0.0003944532396608358,0.00030808083662536915,0.0002344422384074086,0.00017382372406816272,0.00012556952680994275,8.838152313805331e-05,6.060950295549075e-05,4.049691866112005e-05,2.6363632777777826e-05,1.6722089524326107e-05,1.0334223533118108e-05,7.864099967544758e-06,1.2725115076532045e-05,2.0062101715495674e-05,3.081719838050431e-05,4.6122399878200054e-05,6.725625113624856e-05,9.555544338150476e-05,0.00013227574751235302,0.00017840500484070102,0.0002344422384074086,0.00030016959661010375,0.0003744549366332964,0.00045512892364529464,0.0005389783593717388,0.0006218852221365645,0.0006991190916876433,0.000765762516237613,0.000817220142676866,0.0008497399515159172,0.0008608649566574211,0.0008497399515159172,0.000817220142676866,0.000765762516237613,0.0006991190916876433,0.0006218852221365645,0.0005389783593717388,0.00045512892364529464,0.0003744549366332964,0.00030016959661010375,0.0002344422384074086,0.00017840500484070102,0.00013227574751235302,9.555544338150476e-05,6.725625113624856e-05,4.6122399878200054e-05,3.081719838050431e-05,2.0062101715495674e-05,1.2725115076532045e-05,7.864099967544758e-06,5.830720402982427e-06,9.434848032609572e-06,1.4874748068057743e-05,2.284895513809995e-05,3.4196770019989526e-05,4.986615090686187e-05,7.08481677038652e-05,9.807389313755426e-05,0.00013227574751235302,0.00017382372406816272,0.00022255629996218956,0.00027763406467821284,0.0003374485970470907,0.0003996175188164539,0.0004610875838289994,0.0005183514920767674,0.0005677632717911401,0.0006059157664957661,0.0006300270969317325,0.0006382755671609459,0.0006300270969317325,0.0006059157664957661,0.0005677632717911401,0.0005183514920767674,0.0004610875838289994,0.0003996175188164539,0.0003374485970470907,0.00027763406467821284,0.00022255629996218956,0.00017382372406816272,0.00013227574751235302,9.807389313755426e-05,7.08481677038652e-05,4.986615090686187e-05,3.4196770019989526e-05,2.284895513809995e-05,1.4874748068057743e-05,9.434848032609572e-06,5.830720402982427e-06,4.212087883219408e-06,6.815694516554755e-06,1.0745455410854513e-05,1.65059890424838e-05,2.470360276112055e-05,3.602309757644135e-05,5.118041821746509e-05,7.08481677038652e-05,9.555544338150476e-05,0.00012556952680994275,0.00016077373456723922,0.00020056168002874795,0.0002437714465101789,0.00028868201398715953,0.0003330877302838311,0.00037445493663329634,0.00041014979837229504,0.00043771099999975575,0.0004551289236452946,0.0004610875838289992,0.0004551289236452946,0.00043771099999975575,0.00041014979837229504,0.00037445493663329634,0.0003330877302838311,0.00028868201398715953,0.0002437714465101789,0.00020056168002874795,0.00016077373456723922,0.00012556952680994275,9.555544338150476e-05,7.08481677038652e-05,5.118041821746509e-05,3.602309757644135e-05,2.470360276112055e-05,1.65059890424838e-05,1.0745455410854513e-05,6.815694516554755e-06,4.212087883219408e-06,2.964658322506263e-06,4.797194653194232e-06,7.563138447282576e-06,1.1617663055167494e-05,1.7387515064302798e-05,2.535468845698085e-05,3.602309757644135e-05,4.986615090686187e-05,6.725625113624856e-05,8.838152313805331e-05,0.00011315983983241843,0.0001411643988345751,0.00017157739052999402,0.0002031874830376897,0.00023444223840740855,0.00026355835278654146,0.0002886820139871595,0.000308080836625369,0.00032034036057838227,0.0003245343356317006,0.00032034036057838227,0.000308080836625369,0.0002886820139871595,0.00026355835278654146,0.00023444223840740855,0.0002031874830376897,0.00017157739052999402,0.0001411643988345751,0.00011315983983241843,8.838152313805331e-05,6.725625113624856e-05,4.986615090686187e-05,3.602309757644135e-05,2.535468845698085e-05,1.7387515064302798e-05,1.1617663055167494e-05,7.563138447282576e-06,4.797194653194232e-06,2.964658322506263e-06,2.033077287877134e-06,3.289777921757192e-06,5.1865825095289894e-06,7.96705870499868e-06,1.192385702645532e-05,1.7387515064302798e-05,2.470360276112055e-05,3.4196770019989526e-05,4.6122399878200054e-05,6.060950295549075e-05,7.760175886596393e-05,9.680647882713901e-05,0.00011766283256036806,0.0001393401235511094,0.00016077373456723924,0.0001807407271903235,0.00019796981041638508,0.00021127296424625351,0.00021968019266776898,0.0002225562999621895,0.00021968019266776898,0.00021127296424625351,0.00019796981041638508,0.0001807407271903235,0.00016077373456723924,0.0001393401235511094,0.00011766283256036806,9.680647882713901e-05,7.760175886596393e-05,6.060950295549075e-05,4.6122399878200054e-05,3.4196770019989526e-05,2.470360276112055e-05,1.7387515064302798e-05,1.192385702645532e-05,7.96705870499868e-06,5.1865825095289894e-06,3.289777921757192e-06,2.033077287877134e-06,1.3584233749515033e-06,2.1981019875445184e-06,3.4654732306884127e-06,5.323279561979501e-06,7.96705870499868e-06,1.1617663055167494e-05,1.65059890424838e-05,2.284895513809995e-05,3.081719838050431e-05,4.049691866112005e-05,5.185048488291711e-05,6.468233375566619e-05,7.861774024336465e-05,9.310166516005882e-05,0.00010742277257075181,0.00012076394246547992,0.00013227574751235294,0.00014116439883457509,0.00014678178272570507,0.00014870348604751477,0.00014678178272570507,0.00014116439883457509,0.00013227574751235294,0.00012076394246547992,0.00010742277257075181,9.310166516005882e-05,7.861774024336465e-05,6.468233375566619e-05,5.185048488291711e-05,4.049691866112005e-05,3.081719838050431e-05,2.284895513809995e-05,1.65059890424838e-05,1.1617663055167494e-05,7.96705870499868e-06,5.323279561979501e-06,3.4654732306884127e-06,2.1981019875445184e-06,1.3584233749515033e-06,8.843382706140075e-07,1.4309719238803068e-06,2.2560349447723088e-06,3.4654732306884127e-06,5.1865825095289894e-06,7.563138447282576e-06,1.0745455410854513e-05,1.4874748068057743e-05,2.0062101715495674e-05,2.6363632777777826e-05,3.375484328182564e-05,4.210842085576303e-05,5.11804182174651e-05,6.060950295549072e-05,6.993259293934927e-05,7.861774024336465e-05,8.61119647646121e-05,9.189850722503279e-05,9.555544338150479e-05,9.6806478827139e-05,9.555544338150479e-05,9.189850722503279e-05,8.61119647646121e-05,7.861774024336465e-05,6.993259293934927e-05,6.060950295549072e-05,5.11804182174651e-05,4.210842085576303e-05,3.375484328182564e-05,2.6363632777777826e-05,2.0062101715495674e-05,1.4874748068057743e-05,1.0745455410854513e-05,7.563138447282576e-06,5.1865825095289894e-06,3.4654732306884127e-06,2.2560349447723088e-06,1.4309719238803068e-06,8.843382706140075e-07,5.609235971250556e-07,9.076458020646348e-07,1.4309719238803068e-06,2.1981019875445184e-06,3.289777921757192e-06,4.797194653194232e-06,6.815694516554755e-06,9.434848032609572e-06,1.2725115076532045e-05,1.6722089524326107e-05,2.1410232648744362e-05,2.670879196404212e-05,3.246303506572514e-05,3.8443773776917714e-05,4.435728147396171e-05,4.986615090686186e-05,5.4619634404983285e-05,5.828995866852831e-05,6.0609502955490734e-05,6.1403017525214e-05,6.0609502955490734e-05,5.828995866852831e-05,5.4619634404983285e-05,4.986615090686186e-05,4.435728147396171e-05,3.8443773776917714e-05,3.246303506572514e-05,2.670879196404212e-05,2.1410232648744362e-05,1.6722089524326107e-05,1.2725115076532045e-05,9.434848032609572e-06,6.815694516554755e-06,4.797194653194232e-06,3.289777921757192e-06,2.1981019875445184e-06,1.4309719238803068e-06,9.076458020646348e-07,5.609235971250556e-07,3.466498507413424e-07,5.609235971250556e-07,8.843382706140075e-07,1.3584233749515033e-06,2.033077287877134e-06,2.964658322506263e-06,4.212087883219408e-06,5.830720402982427e-06,7.864099967544758e-06,1.0334223533118108e-05,1.3231488192089694e-05,1.6505989042483802e-05,2.0062101715495678e-05,2.3758188298737885e-05,2.741272622697744e-05,3.081719838050432e-05,3.3754843281825624e-05,3.6023097576441356e-05,3.7456572090590194e-05,3.794696277581987e-05,3.7456572090590194e-05,3.6023097576441356e-05,3.3754843281825624e-05,3.081719838050432e-05,2.741272622697744e-05,2.3758188298737885e-05,2.0062101715495678e-05,1.6505989042483802e-05,1.3231488192089694e-05,1.0334223533118108e-05,7.864099967544758e-06,5.830720402982427e-06,4.212087883219408e-06,2.964658322506263e-06,2.033077287877134e-06,1.3584233749515033e-06,8.843382706140075e-07,5.609235971250556e-07,3.466498507413424e-07);
-const float kernel41[1681]=float[](2.922237685182569e-07,4.636167777102597e-07,7.183293174897494e-07,1.086948281404461e-06,1.6062569109371735e-06,2.318152373149189e-06,3.26730584197401e-06,4.497368153920312e-06,6.0457186426725146e-06,7.937034432106582e-06,1.017628912194492e-05,1.2742112966569526e-05,1.5581680874323097e-05,1.8608355758897644e-05,2.1703138209490224e-05,2.4720537671842173e-05,2.749882450734993e-05,2.987384938672323e-05,3.169487807448369e-05,3.2840353586467e-05,3.323130558686136e-05,3.2840353586467e-05,3.169487807448369e-05,2.987384938672323e-05,2.749882450734993e-05,2.4720537671842173e-05,2.1703138209490224e-05,1.8608355758897644e-05,1.5581680874323097e-05,1.2742112966569526e-05,1.017628912194492e-05,7.937034432106582e-06,6.0457186426725146e-06,4.497368153920312e-06,3.26730584197401e-06,2.318152373149189e-06,1.6062569109371735e-06,1.086948281404461e-06,7.183293174897494e-07,4.636167777102597e-07,2.922237685182569e-07,4.636167777102597e-07,7.355339973347027e-07,1.1396387268498368e-06,1.7244574673636022e-06,2.548347305900283e-06,3.677778638371347e-06,5.183622858368759e-06,7.1351325810001965e-06,9.591610601255945e-06,1.2592207494438427e-05,1.6144813940654242e-05,2.021552656286413e-05,2.4720537671842176e-05,2.9522396412758918e-05,3.44323086855806e-05,3.921945184951144e-05,4.3627239746998866e-05,4.739524735000791e-05,5.028433284985734e-05,5.210164452338923e-05,5.272189491431829e-05,5.210164452338923e-05,5.028433284985734e-05,4.739524735000791e-05,4.3627239746998866e-05,3.921945184951144e-05,3.44323086855806e-05,2.9522396412758918e-05,2.4720537671842176e-05,2.021552656286413e-05,1.6144813940654242e-05,1.2592207494438427e-05,9.591610601255945e-06,7.1351325810001965e-06,5.183622858368759e-06,3.677778638371347e-06,2.548347305900283e-06,1.7244574673636022e-06,1.1396387268498368e-06,7.355339973347027e-07,4.636167777102597e-07,7.183293174897494e-07,1.1396387268498368e-06,1.7657598866159713e-06,2.6718799127359223e-06,3.948417462402985e-06,5.698361979537148e-06,8.031521827933823e-06,1.10551972308299e-05,1.4861272128364468e-05,1.9510406547068953e-05,2.5014826331925708e-05,3.1322001482166673e-05,3.8302080096186e-05,4.574209538010349e-05,5.3349529151783616e-05,6.07667440736759e-05,6.759618473300528e-05,7.343434775879903e-05,7.791070606818995e-05,8.072645458480243e-05,8.168747252334491e-05,8.072645458480243e-05,7.791070606818995e-05,7.343434775879903e-05,6.759618473300528e-05,6.07667440736759e-05,5.3349529151783616e-05,4.574209538010349e-05,3.8302080096186e-05,3.1322001482166673e-05,2.5014826331925708e-05,1.9510406547068953e-05,1.4861272128364468e-05,1.10551972308299e-05,8.031521827933823e-06,5.698361979537148e-06,3.948417462402985e-06,2.6718799127359223e-06,1.7657598866159713e-06,1.1396387268498368e-06,7.183293174897494e-07,1.086948281404461e-06,1.7244574673636022e-06,2.6718799127359223e-06,4.042985868120098e-06,5.97459336620704e-06,8.622542070429713e-06,1.2152989771379702e-05,1.672829903787046e-05,2.2487505112361348e-05,2.9522396412758928e-05,3.7851472617231315e-05,4.739524735000793e-05,5.7957233710371965e-05,6.9215178540937e-05,8.072645458480246e-05,9.194989878492504e-05,0.00010228394558890748,0.00011111802922288936,0.00011789148236322075,0.00012215216466656106,0.00012360634003051244,0.00012215216466656106,0.00011789148236322075,0.00011111802922288936,0.00010228394558890748,9.194989878492504e-05,8.072645458480246e-05,6.9215178540937e-05,5.7957233710371965e-05,4.739524735000793e-05,3.7851472617231315e-05,2.9522396412758928e-05,2.2487505112361348e-05,1.672829903787046e-05,1.2152989771379702e-05,8.622542070429713e-06,5.97459336620704e-06,4.042985868120098e-06,2.6718799127359223e-06,1.7244574673636022e-06,1.086948281404461e-06,1.6062569109371735e-06,2.548347305900283e-06,3.948417462402985e-06,5.97459336620704e-06,8.829060267807202e-06,1.274211296656953e-05,1.7959294055467197e-05,2.4720537671842183e-05,3.323130558686137e-05,4.362723974699889e-05,5.593567837654382e-05,7.003915908782681e-05,8.564731991277226e-05,0.0001022839455889075,0.00011929493591429183,0.00013588057767791902,0.00015115189682053456,0.00016420661904756225,0.00017421620837550003,0.00018051250647185948,0.00018266143965297037,0.00018051250647185948,0.00017421620837550003,0.00016420661904756225,0.00015115189682053456,0.00013588057767791902,0.00011929493591429183,0.0001022839455889075,8.564731991277226e-05,7.003915908782681e-05,5.593567837654382e-05,4.362723974699889e-05,3.323130558686137e-05,2.4720537671842183e-05,1.7959294055467197e-05,1.274211296656953e-05,8.829060267807202e-06,5.97459336620704e-06,3.948417462402985e-06,2.548347305900283e-06,1.6062569109371735e-06,2.318152373149189e-06,3.677778638371347e-06,5.698361979537148e-06,8.622542070429713e-06,1.274211296656953e-05,1.8389436466395727e-05,2.591888000685701e-05,3.567671689335774e-05,4.795946986094662e-05,6.296289756938507e-05,8.072645458480247e-05,0.00010108061901385951,0.00012360634003051246,0.0001476163430566324,0.00017216662970374148,0.00019610305267117457,0.0002181426432687446,0.00023698323788678166,0.00025142909215630164,0.0002605159189738214,0.0002636172625506872,0.0002605159189738214,0.00025142909215630164,0.00023698323788678166,0.0002181426432687446,0.00019610305267117457,0.00017216662970374148,0.0001476163430566324,0.00012360634003051246,0.00010108061901385951,8.072645458480247e-05,6.296289756938507e-05,4.795946986094662e-05,3.567671689335774e-05,2.591888000685701e-05,1.8389436466395727e-05,1.274211296656953e-05,8.622542070429713e-06,5.698361979537148e-06,3.677778638371347e-06,2.318152373149189e-06,3.26730584197401e-06,5.183622858368759e-06,8.031521827933823e-06,1.2152989771379702e-05,1.7959294055467197e-05,2.591888000685701e-05,3.65312086663154e-05,5.028433284985737e-05,6.759618473300535e-05,8.874267517479686e-05,0.00011377941317483881,0.0001424674671258453,0.0001742162083755001,0.00020805696192634823,0.0002426592149591232,0.00027639626154127284,0.00030745982921190487,0.0003340145913469541,0.0003543752132775084,0.0003671825863776448,0.00037155375632489746,0.0003671825863776448,0.0003543752132775084,0.0003340145913469541,0.00030745982921190487,0.00027639626154127284,0.0002426592149591232,0.00020805696192634823,0.0001742162083755001,0.0001424674671258453,0.00011377941317483881,8.874267517479686e-05,6.759618473300535e-05,5.028433284985737e-05,3.65312086663154e-05,2.591888000685701e-05,1.7959294055467197e-05,1.2152989771379702e-05,8.031521827933823e-06,5.183622858368759e-06,3.26730584197401e-06,4.497368153920312e-06,7.1351325810001965e-06,1.10551972308299e-05,1.672829903787046e-05,2.4720537671842183e-05,3.567671689335774e-05,5.028433284985737e-05,6.921517854093699e-05,9.304452758578054e-05,0.00012215216466656103,0.00015661463423794525,0.00019610305267117457,0.0002398044337873626,0.0002863854196776515,0.0003340145913469539,0.0003804528270813278,0.0004232110831938452,0.0004597630765906266,0.0004877889845078245,0.0005054180265081073,0.0005114348371364843,0.0005054180265081073,0.0004877889845078245,0.0004597630765906266,0.0004232110831938452,0.0003804528270813278,0.0003340145913469539,0.0002863854196776515,0.0002398044337873626,0.00019610305267117457,0.00015661463423794525,0.00012215216466656103,9.304452758578054e-05,6.921517854093699e-05,5.028433284985737e-05,3.567671689335774e-05,2.4720537671842183e-05,1.672829903787046e-05,1.10551972308299e-05,7.1351325810001965e-06,4.497368153920312e-06,6.0457186426725146e-06,9.591610601255945e-06,1.4861272128364468e-05,2.2487505112361348e-05,3.323130558686137e-05,4.795946986094662e-05,6.759618473300535e-05,9.304452758578054e-05,0.00012507782680269713,0.00016420661904756223,0.00021053380144169973,0.00026361726255068714,0.0003223641219320719,0.00038498197422986606,0.00044900888090975295,0.0005114348371364843,0.0005689138731549781,0.0006180499590484878,0.0006557246052357542,0.0006794229604128063,0.0006875112340298328,0.0006794229604128063,0.0006557246052357542,0.0006180499590484878,0.0005689138731549781,0.0005114348371364843,0.00044900888090975295,0.00038498197422986606,0.0003223641219320719,0.00026361726255068714,0.00021053380144169973,0.00016420661904756223,0.00012507782680269713,9.304452758578054e-05,6.759618473300535e-05,4.795946986094662e-05,3.323130558686137e-05,2.2487505112361348e-05,1.4861272128364468e-05,9.591610601255945e-06,6.0457186426725146e-06,7.937034432106582e-06,1.2592207494438427e-05,1.9510406547068953e-05,2.9522396412758928e-05,4.362723974699889e-05,6.296289756938507e-05,8.874267517479686e-05,0.00012215216466656103,0.00016420661904756223,0.00021557628900576478,0.0002763962615412728,0.000346086117040598,0.00042321108319384536,0.0005054180265081074,0.0005894748265240099,0.0006714298418519676,0.0007468903644080437,0.0008113979653478281,0.0008608585806492344,0.0008919706240872014,0.0009025891973270338,0.0008919706240872014,0.0008608585806492344,0.0008113979653478281,0.0007468903644080437,0.0006714298418519676,0.0005894748265240099,0.0005054180265081074,0.00042321108319384536,0.000346086117040598,0.0002763962615412728,0.00021557628900576478,0.00016420661904756223,0.00012215216466656103,8.874267517479686e-05,6.296289756938507e-05,4.362723974699889e-05,2.9522396412758928e-05,1.9510406547068953e-05,1.2592207494438427e-05,7.937034432106582e-06,1.017628912194492e-05,1.6144813940654242e-05,2.5014826331925708e-05,3.7851472617231315e-05,5.593567837654382e-05,8.072645458480247e-05,0.00011377941317483881,0.00015661463423794525,0.00021053380144169973,0.0002763962615412728,0.0003543752132775084,0.00044372648477494986,0.0005426105151781484,0.0006480102876187518,0.0007557818119764077,0.0008608585806492345,0.0009576085823523096,0.0010403155434145993,0.0011037303522782689,0.0011436199548631515,0.0011572343182976823,0.0011436199548631515,0.0011037303522782689,0.0010403155434145993,0.0009576085823523096,0.0008608585806492345,0.0007557818119764077,0.0006480102876187518,0.0005426105151781484,0.00044372648477494986,0.0003543752132775084,0.0002763962615412728,0.00021053380144169973,0.00015661463423794525,0.00011377941317483881,8.072645458480247e-05,5.593567837654382e-05,3.7851472617231315e-05,2.5014826331925708e-05,1.6144813940654242e-05,1.017628912194492e-05,1.2742112966569526e-05,2.021552656286413e-05,3.1322001482166673e-05,4.739524735000793e-05,7.003915908782681e-05,0.00010108061901385951,0.0001424674671258453,0.00019610305267117457,0.00026361726255068714,0.000346086117040598,0.00044372648477494986,0.0005556065602606025,0.0006794229604128063,0.0008113979653478281,0.0009463427297397222,0.0010779132895525274,0.0011990575923964662,0.0013026180777903744,0.0013820221364419488,0.001431969402703483,0.0014490164573588609,0.001431969402703483,0.0013820221364419488,0.0013026180777903744,0.0011990575923964662,0.0010779132895525274,0.0009463427297397222,0.0008113979653478281,0.0006794229604128063,0.0005556065602606025,0.00044372648477494986,0.000346086117040598,0.00026361726255068714,0.00019610305267117457,0.0001424674671258453,0.00010108061901385951,7.003915908782681e-05,4.739524735000793e-05,3.1322001482166673e-05,2.021552656286413e-05,1.2742112966569526e-05,1.5581680874323097e-05,2.4720537671842176e-05,3.8302080096186e-05,5.7957233710371965e-05,8.564731991277226e-05,0.00012360634003051246,0.0001742162083755001,0.0002398044337873626,0.0003223641219320719,0.00042321108319384536,0.0005426105151781484,0.0006794229604128063,0.0008308317290558719,0.0009922172398953944,0.001157234318297682,0.0013181252537993395,0.0014662664507585125,0.0015929052930628831,0.0016900044716120718,0.001751082439251657,0.0017719284140271226,0.001751082439251657,0.0016900044716120718,0.0015929052930628831,0.0014662664507585125,0.0013181252537993395,0.001157234318297682,0.0009922172398953944,0.0008308317290558719,0.0006794229604128063,0.0005426105151781484,0.00042321108319384536,0.0003223641219320719,0.0002398044337873626,0.0001742162083755001,0.00012360634003051246,8.564731991277226e-05,5.7957233710371965e-05,3.8302080096186e-05,2.4720537671842176e-05,1.5581680874323097e-05,1.8608355758897644e-05,2.9522396412758918e-05,4.574209538010349e-05,6.9215178540937e-05,0.0001022839455889075,0.0001476163430566324,0.00020805696192634823,0.0002863854196776515,0.00038498197422986606,0.0005054180265081074,0.0006480102876187518,0.0008113979653478281,0.0009922172398953944,0.0011849511961518132,0.0013820221364419488,0.0015741654482158626,0.0017510824392516565,0.0019023203351822542,0.002018280613981028,0.002091222715673071,0.0021161179319139647,0.002091222715673071,0.002018280613981028,0.0019023203351822542,0.0017510824392516565,0.0015741654482158626,0.0013820221364419488,0.0011849511961518132,0.0009922172398953944,0.0008113979653478281,0.0006480102876187518,0.0005054180265081074,0.00038498197422986606,0.0002863854196776515,0.00020805696192634823,0.0001476163430566324,0.0001022839455889075,6.9215178540937e-05,4.574209538010349e-05,2.9522396412758918e-05,1.8608355758897644e-05,2.1703138209490224e-05,3.44323086855806e-05,5.3349529151783616e-05,8.072645458480246e-05,0.00011929493591429183,0.00017216662970374148,0.0002426592149591232,0.0003340145913469539,0.00044900888090975295,0.0005894748265240099,0.0007557818119764077,0.0009463427297397222,0.001157234318297682,0.0013820221364419488,0.0016118682286817708,0.0018359671714088556,0.002042307482063172,0.0022186979703159994,0.0023539437701163082,0.0024390169778099086,0.0024680525533240386,0.0024390169778099086,0.0023539437701163082,0.0022186979703159994,0.002042307482063172,0.0018359671714088556,0.0016118682286817708,0.0013820221364419488,0.001157234318297682,0.0009463427297397222,0.0007557818119764077,0.0005894748265240099,0.00044900888090975295,0.0003340145913469539,0.0002426592149591232,0.00017216662970374148,0.00011929493591429183,8.072645458480246e-05,5.3349529151783616e-05,3.44323086855806e-05,2.1703138209490224e-05,2.4720537671842173e-05,3.921945184951144e-05,6.07667440736759e-05,9.194989878492504e-05,0.00013588057767791902,0.00019610305267117457,0.00027639626154127284,0.0003804528270813278,0.0005114348371364843,0.0006714298418519676,0.0008608585806492345,0.0010779132895525274,0.0013181252537993395,0.0015741654482158626,0.0018359671714088556,0.0020912227156730705,0.0023262506352998815,0.00252716479194023,0.00268121389104517,0.0027781148744584574,0.002811187282300693,0.0027781148744584574,0.00268121389104517,0.00252716479194023,0.0023262506352998815,0.0020912227156730705,0.0018359671714088556,0.0015741654482158626,0.0013181252537993395,0.0010779132895525274,0.0008608585806492345,0.0006714298418519676,0.0005114348371364843,0.0003804528270813278,0.00027639626154127284,0.00019610305267117457,0.00013588057767791902,9.194989878492504e-05,6.07667440736759e-05,3.921945184951144e-05,2.4720537671842173e-05,2.749882450734993e-05,4.3627239746998866e-05,6.759618473300528e-05,0.00010228394558890748,0.00015115189682053456,0.0002181426432687446,0.00030745982921190487,0.0004232110831938452,0.0005689138731549781,0.0007468903644080437,0.0009576085823523096,0.0011990575923964662,0.0014662664507585125,0.0017510824392516565,0.002042307482063172,0.0023262506352998815,0.0025876928256737125,0.0028111872823006925,0.002982549620694622,0.003090341092419236,0.0031271304354085283,0.003090341092419236,0.002982549620694622,0.0028111872823006925,0.0025876928256737125,0.0023262506352998815,0.002042307482063172,0.0017510824392516565,0.0014662664507585125,0.0011990575923964662,0.0009576085823523096,0.0007468903644080437,0.0005689138731549781,0.0004232110831938452,0.00030745982921190487,0.0002181426432687446,0.00015115189682053456,0.00010228394558890748,6.759618473300528e-05,4.3627239746998866e-05,2.749882450734993e-05,2.987384938672323e-05,4.739524735000791e-05,7.343434775879903e-05,0.00011111802922288936,0.00016420661904756225,0.00023698323788678166,0.0003340145913469541,0.0004597630765906266,0.0006180499590484878,0.0008113979653478281,0.0010403155434145993,0.0013026180777903744,0.0015929052930628831,0.0019023203351822542,0.0022186979703159994,0.00252716479194023,0.0028111872823006925,0.0030539845602082414,0.0032401471609539083,0.0033572483916124644,0.003397215165145089,0.0033572483916124644,0.0032401471609539083,0.0030539845602082414,0.0028111872823006925,0.00252716479194023,0.0022186979703159994,0.0019023203351822542,0.0015929052930628831,0.0013026180777903744,0.0010403155434145993,0.0008113979653478281,0.0006180499590484878,0.0004597630765906266,0.0003340145913469541,0.00023698323788678166,0.00016420661904756225,0.00011111802922288936,7.343434775879903e-05,4.739524735000791e-05,2.987384938672323e-05,3.169487807448369e-05,5.028433284985734e-05,7.791070606818995e-05,0.00011789148236322075,0.00017421620837550003,0.00025142909215630164,0.0003543752132775084,0.0004877889845078245,0.0006557246052357542,0.0008608585806492344,0.0011037303522782689,0.0013820221364419488,0.0016900044716120718,0.002018280613981028,0.0023539437701163082,0.00268121389104517,0.002982549620694622,0.0032401471609539083,0.0034376577280147776,0.003561897131516103,0.003604300170968729,0.003561897131516103,0.0034376577280147776,0.0032401471609539083,0.002982549620694622,0.00268121389104517,0.0023539437701163082,0.002018280613981028,0.0016900044716120718,0.0013820221364419488,0.0011037303522782689,0.0008608585806492344,0.0006557246052357542,0.0004877889845078245,0.0003543752132775084,0.00025142909215630164,0.00017421620837550003,0.00011789148236322075,7.791070606818995e-05,5.028433284985734e-05,3.169487807448369e-05,3.2840353586467e-05,5.210164452338923e-05,8.072645458480243e-05,0.00012215216466656106,0.00018051250647185948,0.0002605159189738214,0.0003671825863776448,0.0005054180265081073,0.0006794229604128063,0.0008919706240872014,0.0011436199548631515,0.001431969402703483,0.001751082439251657,0.002091222715673071,0.0024390169778099086,0.0027781148744584574,0.003090341092419236,0.0033572483916124644,0.003561897131516103,0.003690626635720758,0.0037345621512792234,0.003690626635720758,0.003561897131516103,0.0033572483916124644,0.003090341092419236,0.0027781148744584574,0.0024390169778099086,0.002091222715673071,0.001751082439251657,0.001431969402703483,0.0011436199548631515,0.0008919706240872014,0.0006794229604128063,0.0005054180265081073,0.0003671825863776448,0.0002605159189738214,0.00018051250647185948,0.00012215216466656106,8.072645458480243e-05,5.210164452338923e-05,3.2840353586467e-05,3.323130558686136e-05,5.272189491431829e-05,8.168747252334491e-05,0.00012360634003051244,0.00018266143965297037,0.0002636172625506872,0.00037155375632489746,0.0005114348371364843,0.0006875112340298328,0.0009025891973270338,0.0011572343182976823,0.0014490164573588609,0.0017719284140271226,0.0021161179319139647,0.0024680525533240386,0.002811187282300693,0.0031271304354085283,0.003397215165145089,0.003604300170968729,0.0037345621512792234,0.003779020702548943,0.0037345621512792234,0.003604300170968729,0.003397215165145089,0.0031271304354085283,0.002811187282300693,0.0024680525533240386,0.0021161179319139647,0.0017719284140271226,0.0014490164573588609,0.0011572343182976823,0.0009025891973270338,0.0006875112340298328,0.0005114348371364843,0.00037155375632489746,0.0002636172625506872,0.00018266143965297037,0.00012360634003051244,8.168747252334491e-05,5.272189491431829e-05,3.323130558686136e-05,3.2840353586467e-05,5.210164452338923e-05,8.072645458480243e-05,0.00012215216466656106,0.00018051250647185948,0.0002605159189738214,0.0003671825863776448,0.0005054180265081073,0.0006794229604128063,0.0008919706240872014,0.0011436199548631515,0.001431969402703483,0.001751082439251657,0.002091222715673071,0.0024390169778099086,0.0027781148744584574,0.003090341092419236,0.0033572483916124644,0.003561897131516103,0.003690626635720758,0.0037345621512792234,0.003690626635720758,0.003561897131516103,0.0033572483916124644,0.003090341092419236,0.0027781148744584574,0.0024390169778099086,0.002091222715673071,0.001751082439251657,0.001431969402703483,0.0011436199548631515,0.0008919706240872014,0.0006794229604128063,0.0005054180265081073,0.0003671825863776448,0.0002605159189738214,0.00018051250647185948,0.00012215216466656106,8.072645458480243e-05,5.210164452338923e-05,3.2840353586467e-05,3.169487807448369e-05,5.028433284985734e-05,7.791070606818995e-05,0.00011789148236322075,0.00017421620837550003,0.00025142909215630164,0.0003543752132775084,0.0004877889845078245,0.0006557246052357542,0.0008608585806492344,0.0011037303522782689,0.0013820221364419488,0.0016900044716120718,0.002018280613981028,0.0023539437701163082,0.00268121389104517,0.002982549620694622,0.0032401471609539083,0.0034376577280147776,0.003561897131516103,0.003604300170968729,0.003561897131516103,0.0034376577280147776,0.0032401471609539083,0.002982549620694622,0.00268121389104517,0.0023539437701163082,0.002018280613981028,0.0016900044716120718,0.0013820221364419488,0.0011037303522782689,0.0008608585806492344,0.0006557246052357542,0.0004877889845078245,0.0003543752132775084,0.00025142909215630164,0.00017421620837550003,0.00011789148236322075,7.791070606818995e-05,5.028433284985734e-05,3.169487807448369e-05,2.987384938672323e-05,4.739524735000791e-05,7.343434775879903e-05,0.00011111802922288936,0.00016420661904756225,0.00023698323788678166,0.0003340145913469541,0.0004597630765906266,0.0006180499590484878,0.0008113979653478281,0.0010403155434145993,0.0013026180777903744,0.0015929052930628831,0.0019023203351822542,0.0022186979703159994,0.00252716479194023,0.0028111872823006925,0.0030539845602082414,0.0032401471609539083,0.0033572483916124644,0.003397215165145089,0.0033572483916124644,0.0032401471609539083,0.0030539845602082414,0.0028111872823006925,0.00252716479194023,0.0022186979703159994,0.0019023203351822542,0.0015929052930628831,0.0013026180777903744,0.0010403155434145993,0.0008113979653478281,0.0006180499590484878,0.0004597630765906266,0.0003340145913469541,0.00023698323788678166,0.00016420661904756225,0.00011111802922288936,7.343434775879903e-05,4.739524735000791e-05,2.987384938672323e-05,2.749882450734993e-05,4.3627239746998866e-05,6.759618473300528e-05,0.00010228394558890748,0.00015115189682053456,0.0002181426432687446,0.00030745982921190487,0.0004232110831938452,0.0005689138731549781,0.0007468903644080437,0.0009576085823523096,0.0011990575923964662,0.0014662664507585125,0.0017510824392516565,0.002042307482063172,0.0023262506352998815,0.0025876928256737125,0.0028111872823006925,0.002982549620694622,0.003090341092419236,0.0031271304354085283,0.003090341092419236,0.002982549620694622,0.0028111872823006925,0.0025876928256737125,0.0023262506352998815,0.002042307482063172,0.0017510824392516565,0.0014662664507585125,0.0011990575923964662,0.0009576085823523096,0.0007468903644080437,0.0005689138731549781,0.0004232110831938452,0.00030745982921190487,0.0002181426432687446,0.00015115189682053456,0.00010228394558890748,6.759618473300528e-05,4.3627239746998866e-05,2.749882450734993e-05,2.4720537671842173e-05,3.921945184951144e-05,6.07667440736759e-05,9.194989878492504e-05,0.00013588057767791902,0.00019610305267117457,0.00027639626154127284,0.0003804528270813278,0.0005114348371364843,0.0006714298418519676,0.0008608585806492345,0.0010779132895525274,0.0013181252537993395,0.0015741654482158626,0.0018359671714088556,0.0020912227156730705,0.0023262506352998815,0.00252716479194023,0.00268121389104517,0.0027781148744584574,0.002811187282300693,0.0027781148744584574,0.00268121389104517,0.00252716479194023,0.0023262506352998815,0.0020912227156730705,0.0018359671714088556,0.0015741654482158626,0.0013181252537993395,0.0010779132895525274,0.0008608585806492345,0.0006714298418519676,0.0005114348371364843,0.0003804528270813278,0.00027639626154127284,0.00019610305267117457,0.00013588057767791902,9.194989878492504e-05,6.07667440736759e-05,3.921945184951144e-05,2.4720537671842173e-05,2.1703138209490224e-05,3.44323086855806e-05,5.3349529151783616e-05,8.072645458480246e-05,0.00011929493591429183,0.00017216662970374148,0.0002426592149591232,0.0003340145913469539,0.00044900888090975295,0.0005894748265240099,0.0007557818119764077,0.0009463427297397222,0.001157234318297682,0.0013820221364419488,0.0016118682286817708,0.0018359671714088556,0.002042307482063172,0.0022186979703159994,0.0023539437701163082,0.0024390169778099086,0.0024680525533240386,0.0024390169778099086,0.0023539437701163082,0.0022186979703159994,0.002042307482063172,0.0018359671714088556,0.0016118682286817708,0.0013820221364419488,0.001157234318297682,0.0009463427297397222,0.0007557818119764077,0.0005894748265240099,0.00044900888090975295,0.0003340145913469539,0.0002426592149591232,0.00017216662970374148,0.00011929493591429183,8.072645458480246e-05,5.3349529151783616e-05,3.44323086855806e-05,2.1703138209490224e-05,1.8608355758897644e-05,2.9522396412758918e-05,4.574209538010349e-05,6.9215178540937e-05,0.0001022839455889075,0.0001476163430566324,0.00020805696192634823,0.0002863854196776515,0.00038498197422986606,0.0005054180265081074,0.0006480102876187518,0.0008113979653478281,0.0009922172398953944,0.0011849511961518132,0.0013820221364419488,0.0015741654482158626,0.0017510824392516565,0.0019023203351822542,0.002018280613981028,0.002091222715673071,0.0021161179319139647,0.002091222715673071,0.002018280613981028,0.0019023203351822542,0.0017510824392516565,0.0015741654482158626,0.0013820221364419488,0.0011849511961518132,0.0009922172398953944,0.0008113979653478281,0.0006480102876187518,0.0005054180265081074,0.00038498197422986606,0.0002863854196776515,0.00020805696192634823,0.0001476163430566324,0.0001022839455889075,6.9215178540937e-05,4.574209538010349e-05,2.9522396412758918e-05,1.8608355758897644e-05,1.5581680874323097e-05,2.4720537671842176e-05,3.8302080096186e-05,5.7957233710371965e-05,8.564731991277226e-05,0.00012360634003051246,0.0001742162083755001,0.0002398044337873626,0.0003223641219320719,0.00042321108319384536,0.0005426105151781484,0.0006794229604128063,0.0008308317290558719,0.0009922172398953944,0.001157234318297682,0.0013181252537993395,0.0014662664507585125,0.0015929052930628831,0.0016900044716120718,0.001751082439251657,0.0017719284140271226,0.001751082439251657,0.0016900044716120718,0.0015929052930628831,0.0014662664507585125,0.0013181252537993395,0.001157234318297682,0.0009922172398953944,0.0008308317290558719,0.0006794229604128063,0.0005426105151781484,0.00042321108319384536,0.0003223641219320719,0.0002398044337873626,0.0001742162083755001,0.00012360634003051246,8.564731991277226e-05,5.7957233710371965e-05,3.8302080096186e-05,2.4720537671842176e-05,1.5581680874323097e-05,1.2742112966569526e-05,2.021552656286413e-05,3.1322001482166673e-05,4.739524735000793e-05,7.003915908782681e-05,0.00010108061901385951,0.0001424674671258453,0.00019610305267117457,0.00026361726255068714,0.000346086117040598,0.00044372648477494986,0.0005556065602606025,0.0006794229604128063,0.0008113979653478281,0.0009463427297397222,0.0010779132895525274,0.0011990575923964662,0.0013026180777903744,0.0013820221364419488,0.001431969402703483,0.0014490164573588609,0.001431969402703483,0.0013820221364419488,0.0013026180777903744,0.0011990575923964662,0.0010779132895525274,0.0009463427297397222,0.0008113979653478281,0.0006794229604128063,0.0005556065602606025,0.00044372648477494986,0.000346086117040598,0.00026361726255068714,0.00019610305267117457,0.0001424674671258453,0.00010108061901385951,7.003915908782681e-05,4.739524735000793e-05,3.1322001482166673e-05,2.021552656286413e-05,1.2742112966569526e-05,1.017628912194492e-05,1.6144813940654242e-05,2.5014826331925708e-05,3.7851472617231315e-05,5.593567837654382e-05,8.072645458480247e-05,0.00011377941317483881,0.00015661463423794525,0.00021053380144169973,0.0002763962615412728,0.0003543752132775084,0.00044372648477494986,0.0005426105151781484,0.0006480102876187518,0.0007557818119764077,0.0008608585806492345,0.0009576085823523096,0.0010403155434145993,0.0011037303522782689,0.0011436199548631515,0.0011572343182976823,0.0011436199548631515,0.0011037303522782689,0.0010403155434145993,0.0009576085823523096,0.0008608585806492345,0.0007557818119764077,0.0006480102876187518,0.0005426105151781484,0.00044372648477494986,0.0003543752132775084,0.0002763962615412728,0.00021053380144169973,0.00015661463423794525,0.00011377941317483881,8.072645458480247e-05,5.593567837654382e-05,3.7851472617231315e-05,2.5014826331925708e-05,1.6144813940654242e-05,1.017628912194492e-05,7.937034432106582e-06,1.2592207494438427e-05,1.9510406547068953e-05,2.9522396412758928e-05,4.362723974699889e-05,6.296289756938507e-05,8.874267517479686e-05,0.00012215216466656103,0.00016420661904756223,0.00021557628900576478,0.0002763962615412728,0.000346086117040598,0.00042321108319384536,0.0005054180265081074,0.0005894748265240099,0.0006714298418519676,0.0007468903644080437,0.0008113979653478281,0.0008608585806492344,0.0008919706240872014,0.0009025891973270338,0.0008919706240872014,0.0008608585806492344,0.0008113979653478281,0.0007468903644080437,0.0006714298418519676,0.0005894748265240099,0.0005054180265081074,0.00042321108319384536,0.000346086117040598,0.0002763962615412728,0.00021557628900576478,0.00016420661904756223,0.00012215216466656103,8.874267517479686e-05,6.296289756938507e-05,4.362723974699889e-05,2.9522396412758928e-05,1.9510406547068953e-05,1.2592207494438427e-05,7.937034432106582e-06,6.0457186426725146e-06,9.591610601255945e-06,1.4861272128364468e-05,2.2487505112361348e-05,3.323130558686137e-05,4.795946986094662e-05,6.759618473300535e-05,9.304452758578054e-05,0.00012507782680269713,0.00016420661904756223,0.00021053380144169973,0.00026361726255068714,0.0003223641219320719,0.00038498197422986606,0.00044900888090975295,0.0005114348371364843,0.0005689138731549781,0.0006180499590484878,0.0006557246052357542,0.0006794229604128063,0.0006875112340298328,0.0006794229604128063,0.0006557246052357542,0.0006180499590484878,0.0005689138731549781,0.0005114348371364843,0.00044900888090975295,0.00038498197422986606,0.0003223641219320719,0.00026361726255068714,0.00021053380144169973,0.00016420661904756223,0.00012507782680269713,9.304452758578054e-05,6.759618473300535e-05,4.795946986094662e-05,3.323130558686137e-05,2.2487505112361348e-05,1.4861272128364468e-05,9.591610601255945e-06,6.0457186426725146e-06,4.497368153920312e-06,7.1351325810001965e-06,1.10551972308299e-05,1.672829903787046e-05,2.4720537671842183e-05,3.567671689335774e-05,5.028433284985737e-05,6.921517854093699e-05,9.304452758578054e-05,0.00012215216466656103,0.00015661463423794525,0.00019610305267117457,0.0002398044337873626,0.0002863854196776515,0.0003340145913469539,0.0003804528270813278,0.0004232110831938452,0.0004597630765906266,0.0004877889845078245,0.0005054180265081073,0.0005114348371364843,0.0005054180265081073,0.0004877889845078245,0.0004597630765906266,0.0004232110831938452,0.0003804528270813278,0.0003340145913469539,0.0002863854196776515,0.0002398044337873626,0.00019610305267117457,0.00015661463423794525,0.00012215216466656103,9.304452758578054e-05,6.921517854093699e-05,5.028433284985737e-05,3.567671689335774e-05,2.4720537671842183e-05,1.672829903787046e-05,1.10551972308299e-05,7.1351325810001965e-06,4.497368153920312e-06,3.26730584197401e-06,5.183622858368759e-06,8.031521827933823e-06,1.2152989771379702e-05,1.7959294055467197e-05,2.591888000685701e-05,3.65312086663154e-05,5.028433284985737e-05,6.759618473300535e-05,8.874267517479686e-05,0.00011377941317483881,0.0001424674671258453,0.0001742162083755001,0.00020805696192634823,0.0002426592149591232,0.00027639626154127284,0.00030745982921190487,0.0003340145913469541,0.0003543752132775084,0.0003671825863776448,0.00037155375632489746,0.0003671825863776448,0.0003543752132775084,0.0003340145913469541,0.00030745982921190487,0.00027639626154127284,0.0002426592149591232,0.00020805696192634823,0.0001742162083755001,0.0001424674671258453,0.00011377941317483881,8.874267517479686e-05,6.759618473300535e-05,5.028433284985737e-05,3.65312086663154e-05,2.591888000685701e-05,1.7959294055467197e-05,1.2152989771379702e-05,8.031521827933823e-06,5.183622858368759e-06,3.26730584197401e-06,2.318152373149189e-06,3.677778638371347e-06,5.698361979537148e-06,8.622542070429713e-06,1.274211296656953e-05,1.8389436466395727e-05,2.591888000685701e-05,3.567671689335774e-05,4.795946986094662e-05,6.296289756938507e-05,8.072645458480247e-05,0.00010108061901385951,0.00012360634003051246,0.0001476163430566324,0.00017216662970374148,0.00019610305267117457,0.0002181426432687446,0.00023698323788678166,0.00025142909215630164,0.0002605159189738214,0.0002636172625506872,0.0002605159189738214,0.00025142909215630164,0.00023698323788678166,0.0002181426432687446,0.00019610305267117457,0.00017216662970374148,0.0001476163430566324,0.00012360634003051246,0.00010108061901385951,8.072645458480247e-05,6.296289756938507e-05,4.795946986094662e-05,3.567671689335774e-05,2.591888000685701e-05,1.8389436466395727e-05,1.274211296656953e-05,8.622542070429713e-06,5.698361979537148e-06,3.677778638371347e-06,2.318152373149189e-06,1.6062569109371735e-06,2.548347305900283e-06,3.948417462402985e-06,5.97459336620704e-06,8.829060267807202e-06,1.274211296656953e-05,1.7959294055467197e-05,2.4720537671842183e-05,3.323130558686137e-05,4.362723974699889e-05,5.593567837654382e-05,7.003915908782681e-05,8.564731991277226e-05,0.0001022839455889075,0.00011929493591429183,0.00013588057767791902,0.00015115189682053456,0.00016420661904756225,0.00017421620837550003,0.00018051250647185948,0.00018266143965297037,0.00018051250647185948,0.00017421620837550003,0.00016420661904756225,0.00015115189682053456,0.00013588057767791902,0.00011929493591429183,0.0001022839455889075,8.564731991277226e-05,7.003915908782681e-05,5.593567837654382e-05,4.362723974699889e-05,3.323130558686137e-05,2.4720537671842183e-05,1.7959294055467197e-05,1.274211296656953e-05,8.829060267807202e-06,5.97459336620704e-06,3.948417462402985e-06,2.548347305900283e-06,1.6062569109371735e-06,1.086948281404461e-06,1.7244574673636022e-06,2.6718799127359223e-06,4.042985868120098e-06,5.97459336620704e-06,8.622542070429713e-06,1.2152989771379702e-05,1.672829903787046e-05,2.2487505112361348e-05,2.9522396412758928e-05,3.7851472617231315e-05,4.739524735000793e-05,5.7957233710371965e-05,6.9215178540937e-05,8.072645458480246e-05,9.194989878492504e-05,0.00010228394558890748,0.00011111802922288936,0.00011789148236322075,0.00012215216466656106,0.00012360634003051244,0.00012215216466656106,0.00011789148236322075,0.00011111802922288936,0.00010228394558890748,9.194989878492504e-05,8.072645458480246e-05,6.9215178540937e-05,5.7957233710371965e-05,4.739524735000793e-05,3.7851472617231315e-05,2.9522396412758928e-05,2.2487505112361348e-05,1.672829903787046e-05,1.2152989771379702e-05,8.622542070429713e-06,5.97459336620704e-06,4.042985868120098e-06,2.6718799127359223e-06,1.7244574673636022e-06,1.086948281404461e-06,7.183293174897494e-07,1.1396387268498368e-06,1.7657598866159713e-06,2.6718799127359223e-06,3.948417462402985e-06,5.698361979537148e-06,8.031521827933823e-06,1.10551972308299e-05,1.4861272128364468e-05,1.9510406547068953e-05,2.5014826331925708e-05,3.1322001482166673e-05,3.8302080096186e-05,4.574209538010349e-05,5.3349529151783616e-05,6.07667440736759e-05,6.759618473300528e-05,7.343434775879903e-05,7.791070606818995e-05,8.072645458480243e-05,8.168747252334491e-05,8.072645458480243e-05,7.791070606818995e-05,7.343434775879903e-05,6.759618473300528e-05,6.07667440736759e-05,5.3349529151783616e-05,4.574209538010349e-05,3.8302080096186e-05,3.1322001482166673e-05,2.5014826331925708e-05,1.9510406547068953e-05,1.4861272128364468e-05,1.10551972308299e-05,8.031521827933823e-06,5.698361979537148e-06,3.948417462402985e-06,2.6718799127359223e-06,1.7657598866159713e-06,1.1396387268498368e-06,7.183293174897494e-07,4.636167777102597e-07,7.355339973347027e-07,1.1396387268498368e-06,1.7244574673636022e-06,2.548347305900283e-06,3.677778638371347e-06,5.183622858368759e-06,7.1351325810001965e-06,9.591610601255945e-06,1.2592207494438427e-05,1.6144813940654242e-05,2.021552656286413e-05,2.4720537671842176e-05,2.9522396412758918e-05,3.44323086855806e-05,3.921945184951144e-05,4.3627239746998866e-05,4.739524735000791e-05,5.028433284985734e-05,5.210164452338923e-05,5.272189491431829e-05,5.210164452338923e-05,5.028433284985734e-05,4.739524735000791e-05,4.3627239746998866e-05,3.921945184951144e-05,3.44323086855806e-05,2.9522396412758918e-05,2.4720537671842176e-05,2.021552656286413e-05,1.6144813940654242e-05,1.2592207494438427e-05,9.591610601255945e-06,7.1351325810001965e-06,5.183622858368759e-06,3.677778638371347e-06,2.548347305900283e-06,1.7244574673636022e-06,1.1396387268498368e-06,7.355339973347027e-07,4.636167777102597e-07,2.922237685182569e-07,4.636167777102597e-07,7.183293174897494e-07,1.086948281404461e-06,1.6062569109371735e-06,2.318152373149189e-06,3.26730584197401e-06,4.497368153920312e-06,6.0457186426725146e-06,7.937034432106582e-06,1.017628912194492e-05,1.2742112966569526e-05,1.5581680874323097e-05,1.8608355758897644e-05,2.1703138209490224e-05,2.4720537671842173e-05,2.749882450734993e-05,2.987384938672323e-05,3.169487807448369e-05,3.2840353586467e-05,3.323130558686136e-05,3.2840353586467e-05,3.169487807448369e-05,2.987384938672323e-05,2.749882450734993e-05,2.4720537671842173e-05,2.1703138209490224e-05,1.8608355758897644e-05,1.5581680874323097e-05,1.2742112966569526e-05,1.017628912194492e-05,7.937034432106582e-06,6.0457186426725146e-06,4.497368153920312e-06,3.26730584197401e-06,2.318152373149189e-06,1.6062569109371735e-06,1.086948281404461e-06,7.183293174897494e-07,4.636167777102597e-07,2.922237685182569e-07);
-const float kernel43[1849]=float[](2.490004004255989e-07,3.8791785564129753e-07,5.914081615502821e-07,8.823536266544288e-07,1.2882669190938078e-06,1.8406738944780444e-06,2.5736866470603888e-06,3.5216184782828525e-06,4.715597806155383e-06,6.179296412805052e-06,7.92408486044566e-06,9.944135323168822e-06,1.221216748576616e-05,1.4676628330416065e-05,1.7261067826735246e-05,1.986629317145224e-05,2.2375556196810703e-05,2.4662588527721784e-05,2.6601816486781687e-05,2.8079653697668797e-05,2.900547753721036e-05,2.932081993103596e-05,2.900547753721036e-05,2.8079653697668797e-05,2.6601816486781687e-05,2.4662588527721784e-05,2.2375556196810703e-05,1.986629317145224e-05,1.7261067826735246e-05,1.4676628330416065e-05,1.221216748576616e-05,9.944135323168822e-06,7.92408486044566e-06,6.179296412805052e-06,4.715597806155383e-06,3.5216184782828525e-06,2.5736866470603888e-06,1.8406738944780444e-06,1.2882669190938078e-06,8.823536266544288e-07,5.914081615502821e-07,3.8791785564129753e-07,2.490004004255989e-07,3.8791785564129753e-07,6.043374326633098e-07,9.213550879645969e-07,1.374619182073891e-06,2.0069917152515316e-06,2.8675868346412185e-06,4.009547789938682e-06,5.4863312916255436e-06,7.3464323185985645e-06,9.626729152765106e-06,1.234493599901751e-05,1.5491973684287912e-05,1.902534219107126e-05,2.2864727045611632e-05,2.6891026705103034e-05,3.09497086488172e-05,3.485889084440125e-05,3.8421859723459073e-05,4.144298398748588e-05,4.374530736067876e-05,4.518764881042221e-05,4.567892089270213e-05,4.518764881042221e-05,4.374530736067876e-05,4.144298398748588e-05,3.8421859723459073e-05,3.485889084440125e-05,3.09497086488172e-05,2.6891026705103034e-05,2.2864727045611632e-05,1.902534219107126e-05,1.5491973684287912e-05,1.234493599901751e-05,9.626729152765106e-06,7.3464323185985645e-06,5.4863312916255436e-06,4.009547789938682e-06,2.8675868346412185e-06,2.0069917152515316e-06,1.374619182073891e-06,9.213550879645969e-07,6.043374326633098e-07,3.8791785564129753e-07,5.914081615502821e-07,9.213550879645969e-07,1.404670887879932e-06,2.095704004029674e-06,3.0598005822684105e-06,4.371838607834399e-06,6.112838717298754e-06,8.36429944033394e-06,1.1200154796466694e-05,1.4676628330416063e-05,1.8820726598328802e-05,2.36186077597885e-05,2.9005477537210365e-05,3.4858890844401235e-05,4.099726896967163e-05,4.718501617373145e-05,5.314484045568784e-05,5.8576838090705e-05,6.318275535081482e-05,6.66928098987893e-05,6.889176128170608e-05,6.964074025954105e-05,6.889176128170608e-05,6.66928098987893e-05,6.318275535081482e-05,5.8576838090705e-05,5.314484045568784e-05,4.718501617373145e-05,4.099726896967163e-05,3.4858890844401235e-05,2.9005477537210365e-05,2.36186077597885e-05,1.8820726598328802e-05,1.4676628330416063e-05,1.1200154796466694e-05,8.36429944033394e-06,6.112838717298754e-06,4.371838607834399e-06,3.0598005822684105e-06,2.095704004029674e-06,1.404670887879932e-06,9.213550879645969e-07,5.914081615502821e-07,8.823536266544288e-07,1.374619182073891e-06,2.095704004029674e-06,3.1266934556711793e-06,4.56508096460269e-06,6.5225810219775985e-06,9.120072670663653e-06,1.247914794793508e-05,1.671011299175851e-05,2.1896850730729608e-05,2.8079653697668807e-05,3.523787050680731e-05,4.327483109247756e-05,5.200785304869898e-05,6.116602933495581e-05,7.039786200363432e-05,7.928964421310294e-05,8.739393347531355e-05,9.426574902123853e-05,9.95025880801409e-05,0.00010278332185031294,0.00010390076384781305,0.00010278332185031294,9.95025880801409e-05,9.426574902123853e-05,8.739393347531355e-05,7.928964421310294e-05,7.039786200363432e-05,6.116602933495581e-05,5.200785304869898e-05,4.327483109247756e-05,3.523787050680731e-05,2.8079653697668807e-05,2.1896850730729608e-05,1.671011299175851e-05,1.247914794793508e-05,9.120072670663653e-06,6.5225810219775985e-06,4.56508096460269e-06,3.1266934556711793e-06,2.095704004029674e-06,1.374619182073891e-06,8.823536266544288e-07,1.2882669190938078e-06,2.0069917152515316e-06,3.0598005822684105e-06,4.56508096460269e-06,6.66517665029759e-06,9.523194673753817e-06,1.3315622632952578e-05,1.821998912245469e-05,2.439734493212795e-05,3.1970162049078306e-05,4.099726896967163e-05,5.1448513953930094e-05,6.318275535081483e-05,7.59332705071674e-05,8.93045257413625e-05,0.00010278332185031294,0.00011576563248655808,0.0001275981760879934,0.000137631265287724,0.00014527723207065932,0.00015006721724076827,0.00015169872134059706,0.00015006721724076827,0.00014527723207065932,0.000137631265287724,0.0001275981760879934,0.00011576563248655808,0.00010278332185031294,8.93045257413625e-05,7.59332705071674e-05,6.318275535081483e-05,5.1448513953930094e-05,4.099726896967163e-05,3.1970162049078306e-05,2.439734493212795e-05,1.821998912245469e-05,1.3315622632952578e-05,9.523194673753817e-06,6.66517665029759e-06,4.56508096460269e-06,3.0598005822684105e-06,2.0069917152515316e-06,1.2882669190938078e-06,1.8406738944780444e-06,2.8675868346412185e-06,4.371838607834399e-06,6.5225810219775985e-06,9.523194673753817e-06,1.3606726655949e-05,1.9025342191071263e-05,2.6032693876022917e-05,3.485889084440124e-05,4.5678920892702127e-05,5.857683809070502e-05,7.350956167631962e-05,9.027542866446087e-05,0.0001084933461174323,0.00012759817608799342,0.00014685666030350773,0.00016540576679997053,0.00018231208783455518,0.00019664735104530677,0.00020757189722964492,0.0002144158210523248,0.00021674691172986942,0.0002144158210523248,0.00020757189722964492,0.00019664735104530677,0.00018231208783455518,0.00016540576679997053,0.00014685666030350773,0.00012759817608799342,0.0001084933461174323,9.027542866446087e-05,7.350956167631962e-05,5.857683809070502e-05,4.5678920892702127e-05,3.485889084440124e-05,2.6032693876022917e-05,1.9025342191071263e-05,1.3606726655949e-05,9.523194673753817e-06,6.5225810219775985e-06,4.371838607834399e-06,2.8675868346412185e-06,1.8406738944780444e-06,2.5736866470603888e-06,4.009547789938682e-06,6.112838717298754e-06,9.120072670663653e-06,1.3315622632952578e-05,1.9025342191071263e-05,2.6601816486781714e-05,3.639971035430476e-05,4.874076943597422e-05,6.386966703138493e-05,8.190393011675546e-05,0.00010278332185031298,0.0001262258708663111,0.00015169872134059714,0.0001784116800765797,0.00020533948288661927,0.00023127541203086613,0.00025491434819884234,0.00027495835252697973,0.00029023338778671456,0.00029980277180893133,0.0003030621742309909,0.00029980277180893133,0.00029023338778671456,0.00027495835252697973,0.00025491434819884234,0.00023127541203086613,0.00020533948288661927,0.0001784116800765797,0.00015169872134059714,0.0001262258708663111,0.00010278332185031298,8.190393011675546e-05,6.386966703138493e-05,4.874076943597422e-05,3.639971035430476e-05,2.6601816486781714e-05,1.9025342191071263e-05,1.3315622632952578e-05,9.120072670663653e-06,6.112838717298754e-06,4.009547789938682e-06,2.5736866470603888e-06,3.5216184782828525e-06,5.4863312916255436e-06,8.36429944033394e-06,1.247914794793508e-05,1.821998912245469e-05,2.6032693876022917e-05,3.639971035430476e-05,4.9806332380934784e-05,6.66928098987893e-05,8.739393347531351e-05,0.00011207051723744117,0.0001406401381072491,0.00017271696994965069,0.00020757189722964484,0.0002441236853821348,0.00028096944827394005,0.0003164580138419889,0.0003488035655085747,0.0003762301118215742,0.0003971311980080163,0.00041022514619200144,0.00041468504103226697,0.00041022514619200144,0.0003971311980080163,0.0003762301118215742,0.0003488035655085747,0.0003164580138419889,0.00028096944827394005,0.0002441236853821348,0.00020757189722964484,0.00017271696994965069,0.0001406401381072491,0.00011207051723744117,8.739393347531351e-05,6.66928098987893e-05,4.9806332380934784e-05,3.639971035430476e-05,2.6032693876022917e-05,1.821998912245469e-05,1.247914794793508e-05,8.36429944033394e-06,5.4863312916255436e-06,3.5216184782828525e-06,4.715597806155383e-06,7.3464323185985645e-06,1.1200154796466694e-05,1.671011299175851e-05,2.439734493212795e-05,3.485889084440124e-05,4.874076943597422e-05,6.66928098987893e-05,8.93045257413625e-05,0.00011702421585668921,0.0001500672172407683,0.00018832316186599308,0.000231275412030866,0.00027794765084061606,0.00032689205895463264,0.0003762301118215744,0.0004237508194076763,0.0004670628969136448,0.000503788215803686,0.0005317756644085983,0.0005493090212191351,0.0005552810112158182,0.0005493090212191351,0.0005317756644085983,0.000503788215803686,0.0004670628969136448,0.0004237508194076763,0.0003762301118215744,0.00032689205895463264,0.00027794765084061606,0.000231275412030866,0.00018832316186599308,0.0001500672172407683,0.00011702421585668921,8.93045257413625e-05,6.66928098987893e-05,4.874076943597422e-05,3.485889084440124e-05,2.439734493212795e-05,1.671011299175851e-05,1.1200154796466694e-05,7.3464323185985645e-06,4.715597806155383e-06,6.179296412805052e-06,9.626729152765106e-06,1.4676628330416063e-05,2.1896850730729608e-05,3.1970162049078306e-05,4.5678920892702127e-05,6.386966703138493e-05,8.739393347531351e-05,0.00011702421585668921,0.00015334796286287355,0.00019664735104530672,0.00024677775467781086,0.00030306217423099074,0.00036422124879799725,0.0004283577629619117,0.0004930101072940596,0.0005552810112158182,0.0006120369467653706,0.0006601616258845541,0.0006968362423122219,0.0007198118677360773,0.0007276375343600719,0.0007198118677360773,0.0006968362423122219,0.0006601616258845541,0.0006120369467653706,0.0005552810112158182,0.0004930101072940596,0.0004283577629619117,0.00036422124879799725,0.00030306217423099074,0.00024677775467781086,0.00019664735104530672,0.00015334796286287355,0.00011702421585668921,8.739393347531351e-05,6.386966703138493e-05,4.5678920892702127e-05,3.1970162049078306e-05,2.1896850730729608e-05,1.4676628330416063e-05,9.626729152765106e-06,6.179296412805052e-06,7.92408486044566e-06,1.234493599901751e-05,1.8820726598328802e-05,2.8079653697668807e-05,4.099726896967163e-05,5.857683809070502e-05,8.190393011675546e-05,0.00011207051723744117,0.0001500672172407683,0.00019664735104530672,0.0002521727706791622,0.000316458013841989,0.00038863492316391365,0.00046706289691364494,0.0005493090212191351,0.0006322166256922037,0.0007120703653493826,0.0007848519281008741,0.0008465651096261828,0.000893595184473363,0.000923058216090226,0.0009330935408708252,0.000923058216090226,0.000893595184473363,0.0008465651096261828,0.0007848519281008741,0.0007120703653493826,0.0006322166256922037,0.0005493090212191351,0.00046706289691364494,0.00038863492316391365,0.000316458013841989,0.0002521727706791622,0.00019664735104530672,0.0001500672172407683,0.00011207051723744117,8.190393011675546e-05,5.857683809070502e-05,4.099726896967163e-05,2.8079653697668807e-05,1.8820726598328802e-05,1.234493599901751e-05,7.92408486044566e-06,9.944135323168822e-06,1.5491973684287912e-05,2.36186077597885e-05,3.523787050680731e-05,5.1448513953930094e-05,7.350956167631962e-05,0.00010278332185031298,0.0001406401381072491,0.00018832316186599308,0.00024677775467781086,0.000316458013841989,0.00039713119800801645,0.0004877078344456199,0.0005861290903791912,0.0006893418404069541,0.0007933846986952717,0.0008935951844733632,0.000984930615854878,0.0010623760545545888,0.0011213952898070513,0.0011583691963954785,0.0011709627803092953,0.0011583691963954785,0.0011213952898070513,0.0010623760545545888,0.000984930615854878,0.0008935951844733632,0.0007933846986952717,0.0006893418404069541,0.0005861290903791912,0.0004877078344456199,0.00039713119800801645,0.000316458013841989,0.00024677775467781086,0.00018832316186599308,0.0001406401381072491,0.00010278332185031298,7.350956167631962e-05,5.1448513953930094e-05,3.523787050680731e-05,2.36186077597885e-05,1.5491973684287912e-05,9.944135323168822e-06,1.221216748576616e-05,1.902534219107126e-05,2.9005477537210365e-05,4.327483109247756e-05,6.318275535081483e-05,9.027542866446087e-05,0.0001262258708663111,0.00017271696994965069,0.000231275412030866,0.00030306217423099074,0.00038863492316391365,0.0004877078344456199,0.0005989429512783702,0.0007198118677360775,0.0008465651096261827,0.000974337788679979,0.0010974040178070848,0.0012095709935336706,0.0013046799836744162,0.00137716017047413,0.001422566988179931,0.0014380328835045103,0.001422566988179931,0.00137716017047413,0.0013046799836744162,0.0012095709935336706,0.0010974040178070848,0.000974337788679979,0.0008465651096261827,0.0007198118677360775,0.0005989429512783702,0.0004877078344456199,0.00038863492316391365,0.00030306217423099074,0.000231275412030866,0.00017271696994965069,0.0001262258708663111,9.027542866446087e-05,6.318275535081483e-05,4.327483109247756e-05,2.9005477537210365e-05,1.902534219107126e-05,1.221216748576616e-05,1.4676628330416065e-05,2.2864727045611632e-05,3.4858890844401235e-05,5.200785304869898e-05,7.59332705071674e-05,0.0001084933461174323,0.00015169872134059714,0.00020757189722964484,0.00027794765084061606,0.00036422124879799725,0.00046706289691364494,0.0005861290903791912,0.0007198118677360775,0.0008650725813331928,0.0010174050991327295,0.0011709627803092955,0.0013188642324495122,0.0014536669212928041,0.0015679692595799175,0.0016550762178015757,0.0017096463002960831,0.0017282332708515175,0.0017096463002960831,0.0016550762178015757,0.0015679692595799175,0.0014536669212928041,0.0013188642324495122,0.0011709627803092955,0.0010174050991327295,0.0008650725813331928,0.0007198118677360775,0.0005861290903791912,0.00046706289691364494,0.00036422124879799725,0.00027794765084061606,0.00020757189722964484,0.00015169872134059714,0.0001084933461174323,7.59332705071674e-05,5.200785304869898e-05,3.4858890844401235e-05,2.2864727045611632e-05,1.4676628330416065e-05,1.7261067826735246e-05,2.6891026705103034e-05,4.099726896967163e-05,6.116602933495581e-05,8.93045257413625e-05,0.00012759817608799342,0.0001784116800765797,0.0002441236853821348,0.00032689205895463264,0.0004283577629619117,0.0005493090212191351,0.0006893418404069541,0.0008465651096261827,0.0010174050991327295,0.0011965621822691815,0.00137716017047413,0.0015511059119339837,0.0017096463002960827,0.001844076386655868,0.00194652219915414,0.002010701646506918,0.0020325616372505683,0.002010701646506918,0.00194652219915414,0.001844076386655868,0.0017096463002960827,0.0015511059119339837,0.00137716017047413,0.0011965621822691815,0.0010174050991327295,0.0008465651096261827,0.0006893418404069541,0.0005493090212191351,0.0004283577629619117,0.00032689205895463264,0.0002441236853821348,0.0001784116800765797,0.00012759817608799342,8.93045257413625e-05,6.116602933495581e-05,4.099726896967163e-05,2.6891026705103034e-05,1.7261067826735246e-05,1.986629317145224e-05,3.09497086488172e-05,4.718501617373145e-05,7.039786200363432e-05,0.00010278332185031294,0.00014685666030350773,0.00020533948288661927,0.00028096944827394005,0.0003762301118215744,0.0004930101072940596,0.0006322166256922037,0.0007933846986952717,0.000974337788679979,0.0011709627803092955,0.00137716017047413,0.0015850159425426981,0.0017852154394947181,0.0019676844423590135,0.002122404158050685,0.0022403121904915287,0.002314178287855288,0.0023393376226773168,0.002314178287855288,0.0022403121904915287,0.002122404158050685,0.0019676844423590135,0.0017852154394947181,0.0015850159425426981,0.00137716017047413,0.0011709627803092955,0.000974337788679979,0.0007933846986952717,0.0006322166256922037,0.0004930101072940596,0.0003762301118215744,0.00028096944827394005,0.00020533948288661927,0.00014685666030350773,0.00010278332185031294,7.039786200363432e-05,4.718501617373145e-05,3.09497086488172e-05,1.986629317145224e-05,2.2375556196810703e-05,3.485889084440125e-05,5.314484045568784e-05,7.928964421310294e-05,0.00011576563248655808,0.00016540576679997053,0.00023127541203086613,0.0003164580138419889,0.0004237508194076763,0.0005552810112158182,0.0007120703653493826,0.0008935951844733632,0.0010974040178070848,0.0013188642324495122,0.0015511059119339837,0.0017852154394947181,0.002010701646506919,0.0022162178639778805,0.002390479849509653,0.002523280557883707,0.002606476501804284,0.0026348136508298325,0.002606476501804284,0.002523280557883707,0.002390479849509653,0.0022162178639778805,0.002010701646506919,0.0017852154394947181,0.0015511059119339837,0.0013188642324495122,0.0010974040178070848,0.0008935951844733632,0.0007120703653493826,0.0005552810112158182,0.0004237508194076763,0.0003164580138419889,0.00023127541203086613,0.00016540576679997053,0.00011576563248655808,7.928964421310294e-05,5.314484045568784e-05,3.485889084440125e-05,2.2375556196810703e-05,2.4662588527721784e-05,3.8421859723459073e-05,5.8576838090705e-05,8.739393347531355e-05,0.0001275981760879934,0.00018231208783455518,0.00025491434819884234,0.0003488035655085747,0.0004670628969136448,0.0006120369467653706,0.0007848519281008741,0.000984930615854878,0.0012095709935336706,0.0014536669212928041,0.0017096463002960827,0.0019676844423590135,0.0022162178639778805,0.002442740139566389,0.002634813650829832,0.0027811880782635545,0.002872887579006292,0.002904121101888081,0.002872887579006292,0.0027811880782635545,0.002634813650829832,0.002442740139566389,0.0022162178639778805,0.0019676844423590135,0.0017096463002960827,0.0014536669212928041,0.0012095709935336706,0.000984930615854878,0.0007848519281008741,0.0006120369467653706,0.0004670628969136448,0.0003488035655085747,0.00025491434819884234,0.00018231208783455518,0.0001275981760879934,8.739393347531355e-05,5.8576838090705e-05,3.8421859723459073e-05,2.4662588527721784e-05,2.6601816486781687e-05,4.144298398748588e-05,6.318275535081482e-05,9.426574902123853e-05,0.000137631265287724,0.00019664735104530677,0.00027495835252697973,0.0003762301118215742,0.000503788215803686,0.0006601616258845541,0.0008465651096261828,0.0010623760545545888,0.0013046799836744162,0.0015679692595799175,0.001844076386655868,0.002122404158050685,0.002390479849509653,0.002634813650829832,0.002841989969441263,0.0029998738692830337,0.0030987837338313493,0.003132473159537946,0.0030987837338313493,0.0029998738692830337,0.002841989969441263,0.002634813650829832,0.002390479849509653,0.002122404158050685,0.001844076386655868,0.0015679692595799175,0.0013046799836744162,0.0010623760545545888,0.0008465651096261828,0.0006601616258845541,0.000503788215803686,0.0003762301118215742,0.00027495835252697973,0.00019664735104530677,0.000137631265287724,9.426574902123853e-05,6.318275535081482e-05,4.144298398748588e-05,2.6601816486781687e-05,2.8079653697668797e-05,4.374530736067876e-05,6.66928098987893e-05,9.95025880801409e-05,0.00014527723207065932,0.00020757189722964492,0.00029023338778671456,0.0003971311980080163,0.0005317756644085983,0.0006968362423122219,0.000893595184473363,0.0011213952898070513,0.00137716017047413,0.0016550762178015757,0.00194652219915414,0.0022403121904915287,0.002523280557883707,0.0027811880782635545,0.0029998738692830337,0.0031665288506899335,0.003270933553473297,0.003306494561406144,0.003270933553473297,0.0031665288506899335,0.0029998738692830337,0.0027811880782635545,0.002523280557883707,0.0022403121904915287,0.00194652219915414,0.0016550762178015757,0.00137716017047413,0.0011213952898070513,0.000893595184473363,0.0006968362423122219,0.0005317756644085983,0.0003971311980080163,0.00029023338778671456,0.00020757189722964492,0.00014527723207065932,9.95025880801409e-05,6.66928098987893e-05,4.374530736067876e-05,2.8079653697668797e-05,2.900547753721036e-05,4.518764881042221e-05,6.889176128170608e-05,0.00010278332185031294,0.00015006721724076827,0.0002144158210523248,0.00029980277180893133,0.00041022514619200144,0.0005493090212191351,0.0007198118677360773,0.000923058216090226,0.0011583691963954785,0.001422566988179931,0.0017096463002960831,0.002010701646506918,0.002314178287855288,0.002606476501804284,0.002872887579006292,0.0030987837338313493,0.003270933553473297,0.0033787806193227377,0.0034155141213773723,0.0033787806193227377,0.003270933553473297,0.0030987837338313493,0.002872887579006292,0.002606476501804284,0.002314178287855288,0.002010701646506918,0.0017096463002960831,0.001422566988179931,0.0011583691963954785,0.000923058216090226,0.0007198118677360773,0.0005493090212191351,0.00041022514619200144,0.00029980277180893133,0.0002144158210523248,0.00015006721724076827,0.00010278332185031294,6.889176128170608e-05,4.518764881042221e-05,2.900547753721036e-05,2.932081993103596e-05,4.567892089270213e-05,6.964074025954105e-05,0.00010390076384781305,0.00015169872134059706,0.00021674691172986942,0.0003030621742309909,0.00041468504103226697,0.0005552810112158182,0.0007276375343600719,0.0009330935408708252,0.0011709627803092953,0.0014380328835045103,0.0017282332708515175,0.0020325616372505683,0.0023393376226773168,0.0026348136508298325,0.002904121101888081,0.003132473159537946,0.003306494561406144,0.0034155141213773723,0.003452646983534134,0.0034155141213773723,0.003306494561406144,0.003132473159537946,0.002904121101888081,0.0026348136508298325,0.0023393376226773168,0.0020325616372505683,0.0017282332708515175,0.0014380328835045103,0.0011709627803092953,0.0009330935408708252,0.0007276375343600719,0.0005552810112158182,0.00041468504103226697,0.0003030621742309909,0.00021674691172986942,0.00015169872134059706,0.00010390076384781305,6.964074025954105e-05,4.567892089270213e-05,2.932081993103596e-05,2.900547753721036e-05,4.518764881042221e-05,6.889176128170608e-05,0.00010278332185031294,0.00015006721724076827,0.0002144158210523248,0.00029980277180893133,0.00041022514619200144,0.0005493090212191351,0.0007198118677360773,0.000923058216090226,0.0011583691963954785,0.001422566988179931,0.0017096463002960831,0.002010701646506918,0.002314178287855288,0.002606476501804284,0.002872887579006292,0.0030987837338313493,0.003270933553473297,0.0033787806193227377,0.0034155141213773723,0.0033787806193227377,0.003270933553473297,0.0030987837338313493,0.002872887579006292,0.002606476501804284,0.002314178287855288,0.002010701646506918,0.0017096463002960831,0.001422566988179931,0.0011583691963954785,0.000923058216090226,0.0007198118677360773,0.0005493090212191351,0.00041022514619200144,0.00029980277180893133,0.0002144158210523248,0.00015006721724076827,0.00010278332185031294,6.889176128170608e-05,4.518764881042221e-05,2.900547753721036e-05,2.8079653697668797e-05,4.374530736067876e-05,6.66928098987893e-05,9.95025880801409e-05,0.00014527723207065932,0.00020757189722964492,0.00029023338778671456,0.0003971311980080163,0.0005317756644085983,0.0006968362423122219,0.000893595184473363,0.0011213952898070513,0.00137716017047413,0.0016550762178015757,0.00194652219915414,0.0022403121904915287,0.002523280557883707,0.0027811880782635545,0.0029998738692830337,0.0031665288506899335,0.003270933553473297,0.003306494561406144,0.003270933553473297,0.0031665288506899335,0.0029998738692830337,0.0027811880782635545,0.002523280557883707,0.0022403121904915287,0.00194652219915414,0.0016550762178015757,0.00137716017047413,0.0011213952898070513,0.000893595184473363,0.0006968362423122219,0.0005317756644085983,0.0003971311980080163,0.00029023338778671456,0.00020757189722964492,0.00014527723207065932,9.95025880801409e-05,6.66928098987893e-05,4.374530736067876e-05,2.8079653697668797e-05,2.6601816486781687e-05,4.144298398748588e-05,6.318275535081482e-05,9.426574902123853e-05,0.000137631265287724,0.00019664735104530677,0.00027495835252697973,0.0003762301118215742,0.000503788215803686,0.0006601616258845541,0.0008465651096261828,0.0010623760545545888,0.0013046799836744162,0.0015679692595799175,0.001844076386655868,0.002122404158050685,0.002390479849509653,0.002634813650829832,0.002841989969441263,0.0029998738692830337,0.0030987837338313493,0.003132473159537946,0.0030987837338313493,0.0029998738692830337,0.002841989969441263,0.002634813650829832,0.002390479849509653,0.002122404158050685,0.001844076386655868,0.0015679692595799175,0.0013046799836744162,0.0010623760545545888,0.0008465651096261828,0.0006601616258845541,0.000503788215803686,0.0003762301118215742,0.00027495835252697973,0.00019664735104530677,0.000137631265287724,9.426574902123853e-05,6.318275535081482e-05,4.144298398748588e-05,2.6601816486781687e-05,2.4662588527721784e-05,3.8421859723459073e-05,5.8576838090705e-05,8.739393347531355e-05,0.0001275981760879934,0.00018231208783455518,0.00025491434819884234,0.0003488035655085747,0.0004670628969136448,0.0006120369467653706,0.0007848519281008741,0.000984930615854878,0.0012095709935336706,0.0014536669212928041,0.0017096463002960827,0.0019676844423590135,0.0022162178639778805,0.002442740139566389,0.002634813650829832,0.0027811880782635545,0.002872887579006292,0.002904121101888081,0.002872887579006292,0.0027811880782635545,0.002634813650829832,0.002442740139566389,0.0022162178639778805,0.0019676844423590135,0.0017096463002960827,0.0014536669212928041,0.0012095709935336706,0.000984930615854878,0.0007848519281008741,0.0006120369467653706,0.0004670628969136448,0.0003488035655085747,0.00025491434819884234,0.00018231208783455518,0.0001275981760879934,8.739393347531355e-05,5.8576838090705e-05,3.8421859723459073e-05,2.4662588527721784e-05,2.2375556196810703e-05,3.485889084440125e-05,5.314484045568784e-05,7.928964421310294e-05,0.00011576563248655808,0.00016540576679997053,0.00023127541203086613,0.0003164580138419889,0.0004237508194076763,0.0005552810112158182,0.0007120703653493826,0.0008935951844733632,0.0010974040178070848,0.0013188642324495122,0.0015511059119339837,0.0017852154394947181,0.002010701646506919,0.0022162178639778805,0.002390479849509653,0.002523280557883707,0.002606476501804284,0.0026348136508298325,0.002606476501804284,0.002523280557883707,0.002390479849509653,0.0022162178639778805,0.002010701646506919,0.0017852154394947181,0.0015511059119339837,0.0013188642324495122,0.0010974040178070848,0.0008935951844733632,0.0007120703653493826,0.0005552810112158182,0.0004237508194076763,0.0003164580138419889,0.00023127541203086613,0.00016540576679997053,0.00011576563248655808,7.928964421310294e-05,5.314484045568784e-05,3.485889084440125e-05,2.2375556196810703e-05,1.986629317145224e-05,3.09497086488172e-05,4.718501617373145e-05,7.039786200363432e-05,0.00010278332185031294,0.00014685666030350773,0.00020533948288661927,0.00028096944827394005,0.0003762301118215744,0.0004930101072940596,0.0006322166256922037,0.0007933846986952717,0.000974337788679979,0.0011709627803092955,0.00137716017047413,0.0015850159425426981,0.0017852154394947181,0.0019676844423590135,0.002122404158050685,0.0022403121904915287,0.002314178287855288,0.0023393376226773168,0.002314178287855288,0.0022403121904915287,0.002122404158050685,0.0019676844423590135,0.0017852154394947181,0.0015850159425426981,0.00137716017047413,0.0011709627803092955,0.000974337788679979,0.0007933846986952717,0.0006322166256922037,0.0004930101072940596,0.0003762301118215744,0.00028096944827394005,0.00020533948288661927,0.00014685666030350773,0.00010278332185031294,7.039786200363432e-05,4.718501617373145e-05,3.09497086488172e-05,1.986629317145224e-05,1.7261067826735246e-05,2.6891026705103034e-05,4.099726896967163e-05,6.116602933495581e-05,8.93045257413625e-05,0.00012759817608799342,0.0001784116800765797,0.0002441236853821348,0.00032689205895463264,0.0004283577629619117,0.0005493090212191351,0.0006893418404069541,0.0008465651096261827,0.0010174050991327295,0.0011965621822691815,0.00137716017047413,0.0015511059119339837,0.0017096463002960827,0.001844076386655868,0.00194652219915414,0.002010701646506918,0.0020325616372505683,0.002010701646506918,0.00194652219915414,0.001844076386655868,0.0017096463002960827,0.0015511059119339837,0.00137716017047413,0.0011965621822691815,0.0010174050991327295,0.0008465651096261827,0.0006893418404069541,0.0005493090212191351,0.0004283577629619117,0.00032689205895463264,0.0002441236853821348,0.0001784116800765797,0.00012759817608799342,8.93045257413625e-05,6.116602933495581e-05,4.099726896967163e-05,2.6891026705103034e-05,1.7261067826735246e-05,1.4676628330416065e-05,2.2864727045611632e-05,3.4858890844401235e-05,5.200785304869898e-05,7.59332705071674e-05,0.0001084933461174323,0.00015169872134059714,0.00020757189722964484,0.00027794765084061606,0.00036422124879799725,0.00046706289691364494,0.0005861290903791912,0.0007198118677360775,0.0008650725813331928,0.0010174050991327295,0.0011709627803092955,0.0013188642324495122,0.0014536669212928041,0.0015679692595799175,0.0016550762178015757,0.0017096463002960831,0.0017282332708515175,0.0017096463002960831,0.0016550762178015757,0.0015679692595799175,0.0014536669212928041,0.0013188642324495122,0.0011709627803092955,0.0010174050991327295,0.0008650725813331928,0.0007198118677360775,0.0005861290903791912,0.00046706289691364494,0.00036422124879799725,0.00027794765084061606,0.00020757189722964484,0.00015169872134059714,0.0001084933461174323,7.59332705071674e-05,5.200785304869898e-05,3.4858890844401235e-05,2.2864727045611632e-05,1.4676628330416065e-05,1.221216748576616e-05,1.902534219107126e-05,2.9005477537210365e-05,4.327483109247756e-05,6.318275535081483e-05,9.027542866446087e-05,0.0001262258708663111,0.00017271696994965069,0.000231275412030866,0.00030306217423099074,0.00038863492316391365,0.0004877078344456199,0.0005989429512783702,0.0007198118677360775,0.0008465651096261827,0.000974337788679979,0.0010974040178070848,0.0012095709935336706,0.0013046799836744162,0.00137716017047413,0.001422566988179931,0.0014380328835045103,0.001422566988179931,0.00137716017047413,0.0013046799836744162,0.0012095709935336706,0.0010974040178070848,0.000974337788679979,0.0008465651096261827,0.0007198118677360775,0.0005989429512783702,0.0004877078344456199,0.00038863492316391365,0.00030306217423099074,0.000231275412030866,0.00017271696994965069,0.0001262258708663111,9.027542866446087e-05,6.318275535081483e-05,4.327483109247756e-05,2.9005477537210365e-05,1.902534219107126e-05,1.221216748576616e-05,9.944135323168822e-06,1.5491973684287912e-05,2.36186077597885e-05,3.523787050680731e-05,5.1448513953930094e-05,7.350956167631962e-05,0.00010278332185031298,0.0001406401381072491,0.00018832316186599308,0.00024677775467781086,0.000316458013841989,0.00039713119800801645,0.0004877078344456199,0.0005861290903791912,0.0006893418404069541,0.0007933846986952717,0.0008935951844733632,0.000984930615854878,0.0010623760545545888,0.0011213952898070513,0.0011583691963954785,0.0011709627803092953,0.0011583691963954785,0.0011213952898070513,0.0010623760545545888,0.000984930615854878,0.0008935951844733632,0.0007933846986952717,0.0006893418404069541,0.0005861290903791912,0.0004877078344456199,0.00039713119800801645,0.000316458013841989,0.00024677775467781086,0.00018832316186599308,0.0001406401381072491,0.00010278332185031298,7.350956167631962e-05,5.1448513953930094e-05,3.523787050680731e-05,2.36186077597885e-05,1.5491973684287912e-05,9.944135323168822e-06,7.92408486044566e-06,1.234493599901751e-05,1.8820726598328802e-05,2.8079653697668807e-05,4.099726896967163e-05,5.857683809070502e-05,8.190393011675546e-05,0.00011207051723744117,0.0001500672172407683,0.00019664735104530672,0.0002521727706791622,0.000316458013841989,0.00038863492316391365,0.00046706289691364494,0.0005493090212191351,0.0006322166256922037,0.0007120703653493826,0.0007848519281008741,0.0008465651096261828,0.000893595184473363,0.000923058216090226,0.0009330935408708252,0.000923058216090226,0.000893595184473363,0.0008465651096261828,0.0007848519281008741,0.0007120703653493826,0.0006322166256922037,0.0005493090212191351,0.00046706289691364494,0.00038863492316391365,0.000316458013841989,0.0002521727706791622,0.00019664735104530672,0.0001500672172407683,0.00011207051723744117,8.190393011675546e-05,5.857683809070502e-05,4.099726896967163e-05,2.8079653697668807e-05,1.8820726598328802e-05,1.234493599901751e-05,7.92408486044566e-06,6.179296412805052e-06,9.626729152765106e-06,1.4676628330416063e-05,2.1896850730729608e-05,3.1970162049078306e-05,4.5678920892702127e-05,6.386966703138493e-05,8.739393347531351e-05,0.00011702421585668921,0.00015334796286287355,0.00019664735104530672,0.00024677775467781086,0.00030306217423099074,0.00036422124879799725,0.0004283577629619117,0.0004930101072940596,0.0005552810112158182,0.0006120369467653706,0.0006601616258845541,0.0006968362423122219,0.0007198118677360773,0.0007276375343600719,0.0007198118677360773,0.0006968362423122219,0.0006601616258845541,0.0006120369467653706,0.0005552810112158182,0.0004930101072940596,0.0004283577629619117,0.00036422124879799725,0.00030306217423099074,0.00024677775467781086,0.00019664735104530672,0.00015334796286287355,0.00011702421585668921,8.739393347531351e-05,6.386966703138493e-05,4.5678920892702127e-05,3.1970162049078306e-05,2.1896850730729608e-05,1.4676628330416063e-05,9.626729152765106e-06,6.179296412805052e-06,4.715597806155383e-06,7.3464323185985645e-06,1.1200154796466694e-05,1.671011299175851e-05,2.439734493212795e-05,3.485889084440124e-05,4.874076943597422e-05,6.66928098987893e-05,8.93045257413625e-05,0.00011702421585668921,0.0001500672172407683,0.00018832316186599308,0.000231275412030866,0.00027794765084061606,0.00032689205895463264,0.0003762301118215744,0.0004237508194076763,0.0004670628969136448,0.000503788215803686,0.0005317756644085983,0.0005493090212191351,0.0005552810112158182,0.0005493090212191351,0.0005317756644085983,0.000503788215803686,0.0004670628969136448,0.0004237508194076763,0.0003762301118215744,0.00032689205895463264,0.00027794765084061606,0.000231275412030866,0.00018832316186599308,0.0001500672172407683,0.00011702421585668921,8.93045257413625e-05,6.66928098987893e-05,4.874076943597422e-05,3.485889084440124e-05,2.439734493212795e-05,1.671011299175851e-05,1.1200154796466694e-05,7.3464323185985645e-06,4.715597806155383e-06,3.5216184782828525e-06,5.4863312916255436e-06,8.36429944033394e-06,1.247914794793508e-05,1.821998912245469e-05,2.6032693876022917e-05,3.639971035430476e-05,4.9806332380934784e-05,6.66928098987893e-05,8.739393347531351e-05,0.00011207051723744117,0.0001406401381072491,0.00017271696994965069,0.00020757189722964484,0.0002441236853821348,0.00028096944827394005,0.0003164580138419889,0.0003488035655085747,0.0003762301118215742,0.0003971311980080163,0.00041022514619200144,0.00041468504103226697,0.00041022514619200144,0.0003971311980080163,0.0003762301118215742,0.0003488035655085747,0.0003164580138419889,0.00028096944827394005,0.0002441236853821348,0.00020757189722964484,0.00017271696994965069,0.0001406401381072491,0.00011207051723744117,8.739393347531351e-05,6.66928098987893e-05,4.9806332380934784e-05,3.639971035430476e-05,2.6032693876022917e-05,1.821998912245469e-05,1.247914794793508e-05,8.36429944033394e-06,5.4863312916255436e-06,3.5216184782828525e-06,2.5736866470603888e-06,4.009547789938682e-06,6.112838717298754e-06,9.120072670663653e-06,1.3315622632952578e-05,1.9025342191071263e-05,2.6601816486781714e-05,3.639971035430476e-05,4.874076943597422e-05,6.386966703138493e-05,8.190393011675546e-05,0.00010278332185031298,0.0001262258708663111,0.00015169872134059714,0.0001784116800765797,0.00020533948288661927,0.00023127541203086613,0.00025491434819884234,0.00027495835252697973,0.00029023338778671456,0.00029980277180893133,0.0003030621742309909,0.00029980277180893133,0.00029023338778671456,0.00027495835252697973,0.00025491434819884234,0.00023127541203086613,0.00020533948288661927,0.0001784116800765797,0.00015169872134059714,0.0001262258708663111,0.00010278332185031298,8.190393011675546e-05,6.386966703138493e-05,4.874076943597422e-05,3.639971035430476e-05,2.6601816486781714e-05,1.9025342191071263e-05,1.3315622632952578e-05,9.120072670663653e-06,6.112838717298754e-06,4.009547789938682e-06,2.5736866470603888e-06,1.8406738944780444e-06,2.8675868346412185e-06,4.371838607834399e-06,6.5225810219775985e-06,9.523194673753817e-06,1.3606726655949e-05,1.9025342191071263e-05,2.6032693876022917e-05,3.485889084440124e-05,4.5678920892702127e-05,5.857683809070502e-05,7.350956167631962e-05,9.027542866446087e-05,0.0001084933461174323,0.00012759817608799342,0.00014685666030350773,0.00016540576679997053,0.00018231208783455518,0.00019664735104530677,0.00020757189722964492,0.0002144158210523248,0.00021674691172986942,0.0002144158210523248,0.00020757189722964492,0.00019664735104530677,0.00018231208783455518,0.00016540576679997053,0.00014685666030350773,0.00012759817608799342,0.0001084933461174323,9.027542866446087e-05,7.350956167631962e-05,5.857683809070502e-05,4.5678920892702127e-05,3.485889084440124e-05,2.6032693876022917e-05,1.9025342191071263e-05,1.3606726655949e-05,9.523194673753817e-06,6.5225810219775985e-06,4.371838607834399e-06,2.8675868346412185e-06,1.8406738944780444e-06,1.2882669190938078e-06,2.0069917152515316e-06,3.0598005822684105e-06,4.56508096460269e-06,6.66517665029759e-06,9.523194673753817e-06,1.3315622632952578e-05,1.821998912245469e-05,2.439734493212795e-05,3.1970162049078306e-05,4.099726896967163e-05,5.1448513953930094e-05,6.318275535081483e-05,7.59332705071674e-05,8.93045257413625e-05,0.00010278332185031294,0.00011576563248655808,0.0001275981760879934,0.000137631265287724,0.00014527723207065932,0.00015006721724076827,0.00015169872134059706,0.00015006721724076827,0.00014527723207065932,0.000137631265287724,0.0001275981760879934,0.00011576563248655808,0.00010278332185031294,8.93045257413625e-05,7.59332705071674e-05,6.318275535081483e-05,5.1448513953930094e-05,4.099726896967163e-05,3.1970162049078306e-05,2.439734493212795e-05,1.821998912245469e-05,1.3315622632952578e-05,9.523194673753817e-06,6.66517665029759e-06,4.56508096460269e-06,3.0598005822684105e-06,2.0069917152515316e-06,1.2882669190938078e-06,8.823536266544288e-07,1.374619182073891e-06,2.095704004029674e-06,3.1266934556711793e-06,4.56508096460269e-06,6.5225810219775985e-06,9.120072670663653e-06,1.247914794793508e-05,1.671011299175851e-05,2.1896850730729608e-05,2.8079653697668807e-05,3.523787050680731e-05,4.327483109247756e-05,5.200785304869898e-05,6.116602933495581e-05,7.039786200363432e-05,7.928964421310294e-05,8.739393347531355e-05,9.426574902123853e-05,9.95025880801409e-05,0.00010278332185031294,0.00010390076384781305,0.00010278332185031294,9.95025880801409e-05,9.426574902123853e-05,8.739393347531355e-05,7.928964421310294e-05,7.039786200363432e-05,6.116602933495581e-05,5.200785304869898e-05,4.327483109247756e-05,3.523787050680731e-05,2.8079653697668807e-05,2.1896850730729608e-05,1.671011299175851e-05,1.247914794793508e-05,9.120072670663653e-06,6.5225810219775985e-06,4.56508096460269e-06,3.1266934556711793e-06,2.095704004029674e-06,1.374619182073891e-06,8.823536266544288e-07,5.914081615502821e-07,9.213550879645969e-07,1.404670887879932e-06,2.095704004029674e-06,3.0598005822684105e-06,4.371838607834399e-06,6.112838717298754e-06,8.36429944033394e-06,1.1200154796466694e-05,1.4676628330416063e-05,1.8820726598328802e-05,2.36186077597885e-05,2.9005477537210365e-05,3.4858890844401235e-05,4.099726896967163e-05,4.718501617373145e-05,5.314484045568784e-05,5.8576838090705e-05,6.318275535081482e-05,6.66928098987893e-05,6.889176128170608e-05,6.964074025954105e-05,6.889176128170608e-05,6.66928098987893e-05,6.318275535081482e-05,5.8576838090705e-05,5.314484045568784e-05,4.718501617373145e-05,4.099726896967163e-05,3.4858890844401235e-05,2.9005477537210365e-05,2.36186077597885e-05,1.8820726598328802e-05,1.4676628330416063e-05,1.1200154796466694e-05,8.36429944033394e-06,6.112838717298754e-06,4.371838607834399e-06,3.0598005822684105e-06,2.095704004029674e-06,1.404670887879932e-06,9.213550879645969e-07,5.914081615502821e-07,3.8791785564129753e-07,6.043374326633098e-07,9.213550879645969e-07,1.374619182073891e-06,2.0069917152515316e-06,2.8675868346412185e-06,4.009547789938682e-06,5.4863312916255436e-06,7.3464323185985645e-06,9.626729152765106e-06,1.234493599901751e-05,1.5491973684287912e-05,1.902534219107126e-05,2.2864727045611632e-05,2.6891026705103034e-05,3.09497086488172e-05,3.485889084440125e-05,3.8421859723459073e-05,4.144298398748588e-05,4.374530736067876e-05,4.518764881042221e-05,4.567892089270213e-05,4.518764881042221e-05,4.374530736067876e-05,4.144298398748588e-05,3.8421859723459073e-05,3.485889084440125e-05,3.09497086488172e-05,2.6891026705103034e-05,2.2864727045611632e-05,1.902534219107126e-05,1.5491973684287912e-05,1.234493599901751e-05,9.626729152765106e-06,7.3464323185985645e-06,5.4863312916255436e-06,4.009547789938682e-06,2.8675868346412185e-06,2.0069917152515316e-06,1.374619182073891e-06,9.213550879645969e-07,6.043374326633098e-07,3.8791785564129753e-07,2.490004004255989e-07,3.8791785564129753e-07,5.914081615502821e-07,8.823536266544288e-07,1.2882669190938078e-06,1.8406738944780444e-06,2.5736866470603888e-06,3.5216184782828525e-06,4.715597806155383e-06,6.179296412805052e-06,7.92408486044566e-06,9.944135323168822e-06,1.221216748576616e-05,1.4676628330416065e-05,1.7261067826735246e-05,1.986629317145224e-05,2.2375556196810703e-05,2.4662588527721784e-05,2.6601816486781687e-05,2.8079653697668797e-05,2.900547753721036e-05,2.932081993103596e-05,2.900547753721036e-05,2.8079653697668797e-05,2.6601816486781687e-05,2.4662588527721784e-05,2.2375556196810703e-05,1.986629317145224e-05,1.7261067826735246e-05,1.4676628330416065e-05,1.221216748576616e-05,9.944135323168822e-06,7.92408486044566e-06,6.179296412805052e-06,4.715597806155383e-06,3.5216184782828525e-06,2.5736866470603888e-06,1.8406738944780444e-06,1.2882669190938078e-06,8.823536266544288e-07,5.914081615502821e-07,3.8791785564129753e-07,2.490004004255989e-07);
-const float kernel45[2025]=float[](2.142114465752763e-07,3.2814850771927234e-07,4.928138997733499e-07,7.255715055545077e-07,1.047278636889619e-06,1.481934557856833e-06,2.05579858157929e-06,2.7958692261152996e-06,3.727673798176641e-06,4.872408628071242e-06,6.2435883483561845e-06,7.843494109761422e-06,9.659833556477215e-06,1.1663112570429667e-05,1.3805242722160705e-05,1.601984764646847e-05,1.822457761495816e-05,2.032550370651139e-05,2.222337004972379e-05,2.3821180184143435e-05,2.5032336355312553e-05,2.578839137802167e-05,2.6045450577629476e-05,2.578839137802167e-05,2.5032336355312553e-05,2.3821180184143435e-05,2.222337004972379e-05,2.032550370651139e-05,1.822457761495816e-05,1.601984764646847e-05,1.3805242722160705e-05,1.1663112570429667e-05,9.659833556477215e-06,7.843494109761422e-06,6.2435883483561845e-06,4.872408628071242e-06,3.727673798176641e-06,2.7958692261152996e-06,2.05579858157929e-06,1.481934557856833e-06,1.047278636889619e-06,7.255715055545077e-07,4.928138997733499e-07,3.2814850771927234e-07,2.142114465752763e-07,3.2814850771927234e-07,5.02687624027341e-07,7.549369951017578e-07,1.1114961903199142e-06,1.6043163302239087e-06,2.270161662567598e-06,3.149258583058848e-06,4.282965868518919e-06,5.7103885608934525e-06,7.463997119958867e-06,9.564494484689166e-06,1.2015375128511819e-05,1.479780850674861e-05,1.786661285629967e-05,2.114812196269553e-05,2.45406544940697e-05,2.79180596731604e-05,3.113644866587657e-05,3.4043772332900724e-05,3.649144270538142e-05,3.834680149473757e-05,3.9504995099337844e-05,3.989878167841857e-05,3.9504995099337844e-05,3.834680149473757e-05,3.649144270538142e-05,3.4043772332900724e-05,3.113644866587657e-05,2.79180596731604e-05,2.45406544940697e-05,2.114812196269553e-05,1.786661285629967e-05,1.479780850674861e-05,1.2015375128511819e-05,9.564494484689166e-06,7.463997119958867e-06,5.7103885608934525e-06,4.282965868518919e-06,3.149258583058848e-06,2.270161662567598e-06,1.6043163302239087e-06,1.1114961903199142e-06,7.549369951017578e-07,5.02687624027341e-07,3.2814850771927234e-07,4.928138997733499e-07,7.549369951017578e-07,1.133765462549508e-06,1.669246573576931e-06,2.409364566862785e-06,3.4093320424391e-06,4.729561059103288e-06,6.432164287233778e-06,8.575869734938773e-06,1.1209441585304363e-05,1.4363971541789636e-05,1.8044707609602395e-05,2.2223370049723795e-05,2.6832104825496343e-05,3.1760279910321586e-05,3.6855190134093635e-05,4.192738207849919e-05,4.676076328602533e-05,5.1126986141060376e-05,5.4802901018765174e-05,5.758928151098908e-05,5.932865832834125e-05,5.9920047577873345e-05,5.932865832834125e-05,5.758928151098908e-05,5.4802901018765174e-05,5.1126986141060376e-05,4.676076328602533e-05,4.192738207849919e-05,3.6855190134093635e-05,3.1760279910321586e-05,2.6832104825496343e-05,2.2223370049723795e-05,1.8044707609602395e-05,1.4363971541789636e-05,1.1209441585304363e-05,8.575869734938773e-06,6.432164287233778e-06,4.729561059103288e-06,3.4093320424391e-06,2.409364566862785e-06,1.669246573576931e-06,1.133765462549508e-06,7.549369951017578e-07,4.928138997733499e-07,7.255715055545077e-07,1.1114961903199142e-06,1.669246573576931e-06,2.457637152866307e-06,3.5473152786727704e-06,5.019570641382982e-06,6.963348111414447e-06,9.470096375139881e-06,1.2626280869676383e-05,1.650369726019327e-05,2.1148121962695522e-05,2.6567281632298867e-05,3.271953991737842e-05,3.950499509933783e-05,4.676076328602531e-05,5.426201615942742e-05,6.172982083631734e-05,6.884602368951709e-05,7.527442778276868e-05,8.06864891985143e-05,8.478888624884187e-05,8.73497763874383e-05,8.822048070066708e-05,8.73497763874383e-05,8.478888624884187e-05,8.06864891985143e-05,7.527442778276868e-05,6.884602368951709e-05,6.172982083631734e-05,5.426201615942742e-05,4.676076328602531e-05,3.950499509933783e-05,3.271953991737842e-05,2.6567281632298867e-05,2.1148121962695522e-05,1.650369726019327e-05,1.2626280869676383e-05,9.470096375139881e-06,6.963348111414447e-06,5.019570641382982e-06,3.5473152786727704e-06,2.457637152866307e-06,1.669246573576931e-06,1.1114961903199142e-06,7.255715055545077e-07,1.047278636889619e-06,1.6043163302239087e-06,2.409364566862785e-06,3.5473152786727704e-06,5.120139753596003e-06,7.245170267624026e-06,1.0050788464655576e-05,1.366898995763382e-05,1.8224577614958136e-05,2.382118018414342e-05,3.052487063275852e-05,3.8346801494737545e-05,4.722687550710785e-05,5.7020896081561355e-05,6.749375913912293e-05,7.832095097904659e-05,8.909986421185637e-05,9.937128083568516e-05,0.0001086499394167041,0.0001164616247693605,0.00012238296092707468,0.00012607930996096306,0.00012733607103731663,0.00012607930996096306,0.00012238296092707468,0.0001164616247693605,0.0001086499394167041,9.937128083568516e-05,8.909986421185637e-05,7.832095097904659e-05,6.749375913912293e-05,5.7020896081561355e-05,4.722687550710785e-05,3.8346801494737545e-05,3.052487063275852e-05,2.382118018414342e-05,1.8224577614958136e-05,1.366898995763382e-05,1.0050788464655576e-05,7.245170267624026e-06,5.120139753596003e-06,3.5473152786727704e-06,2.409364566862785e-06,1.6043163302239087e-06,1.047278636889619e-06,1.481934557856833e-06,2.270161662567598e-06,3.4093320424391e-06,5.019570641382982e-06,7.245170267624026e-06,1.0252160045044943e-05,1.422220432541085e-05,1.93420813484526e-05,2.5788391378021657e-05,3.370777258348413e-05,4.319372044019054e-05,5.4262016159427424e-05,6.682762008919129e-05,8.068648919851432e-05,9.550594329412809e-05,0.00011082678455542034,0.00012607930996096312,0.00014061371056537587,0.00015374332508955344,0.00016479712306789,0.0001731760132425864,0.00017840647166909323,0.00018018483093702316,0.00017840647166909323,0.0001731760132425864,0.00016479712306789,0.00015374332508955344,0.00014061371056537587,0.00012607930996096312,0.00011082678455542034,9.550594329412809e-05,8.068648919851432e-05,6.682762008919129e-05,5.4262016159427424e-05,4.319372044019054e-05,3.370777258348413e-05,2.5788391378021657e-05,1.93420813484526e-05,1.422220432541085e-05,1.0252160045044943e-05,7.245170267624026e-06,5.019570641382982e-06,3.4093320424391e-06,2.270161662567598e-06,1.481934557856833e-06,2.05579858157929e-06,3.149258583058848e-06,4.729561059103288e-06,6.963348111414447e-06,1.0050788464655576e-05,1.422220432541085e-05,1.972960771047428e-05,2.683210482549633e-05,3.577468258302825e-05,4.676076328602531e-05,5.9920047577873325e-05,7.527442778276868e-05,9.270593351191122e-05,0.00011193150815431848,0.00013248964450927447,0.00015374332508955342,0.00017490223519659893,0.00019506493400690868,0.00021327885767336436,0.00022861312603524953,0.00024023665586322024,0.00024749255590092017,0.00024995956663440087,0.00024749255590092017,0.00024023665586322024,0.00022861312603524953,0.00021327885767336436,0.00019506493400690868,0.00017490223519659893,0.00015374332508955342,0.00013248964450927447,0.00011193150815431848,9.270593351191122e-05,7.527442778276868e-05,5.9920047577873325e-05,4.676076328602531e-05,3.577468258302825e-05,2.683210482549633e-05,1.972960771047428e-05,1.422220432541085e-05,1.0050788464655576e-05,6.963348111414447e-06,4.729561059103288e-06,3.149258583058848e-06,2.05579858157929e-06,2.7958692261152996e-06,4.282965868518919e-06,6.432164287233778e-06,9.470096375139881e-06,1.366898995763382e-05,1.93420813484526e-05,2.683210482549633e-05,3.649144270538141e-05,4.865327518180018e-05,6.359425491996718e-05,8.149077373214406e-05,0.00010237260499985629,0.00012607930996096312,0.00015222593394384183,0.00018018483093702314,0.00020908966237748324,0.00023786560675087751,0.0002652867119234819,0.00029005749886834705,0.0003109119781943581,0.0003267198835193493,0.0003365878481171212,0.00033994296250042624,0.0003365878481171212,0.0003267198835193493,0.0003109119781943581,0.00029005749886834705,0.0002652867119234819,0.00023786560675087751,0.00020908966237748324,0.00018018483093702314,0.00015222593394384183,0.00012607930996096312,0.00010237260499985629,8.149077373214406e-05,6.359425491996718e-05,4.865327518180018e-05,3.649144270538141e-05,2.683210482549633e-05,1.93420813484526e-05,1.366898995763382e-05,9.470096375139881e-06,6.432164287233778e-06,4.282965868518919e-06,2.7958692261152996e-06,3.727673798176641e-06,5.7103885608934525e-06,8.575869734938773e-06,1.2626280869676383e-05,1.8224577614958136e-05,2.5788391378021657e-05,3.577468258302825e-05,4.865327518180018e-05,6.486839133841343e-05,8.478888624884184e-05,0.0001086499394167041,0.00013649124706711653,0.00016809889956358482,0.00020295964491653452,0.0002402366558632202,0.0002787748613682841,0.0003171412244501269,0.00035370120884216795,0.00038672757952935757,0.0004145324194095838,0.0004356087680218907,0.0004487655182478513,0.00045323882188441275,0.0004487655182478513,0.0004356087680218907,0.0004145324194095838,0.00038672757952935757,0.00035370120884216795,0.0003171412244501269,0.0002787748613682841,0.0002402366558632202,0.00020295964491653452,0.00016809889956358482,0.00013649124706711653,0.0001086499394167041,8.478888624884184e-05,6.486839133841343e-05,4.865327518180018e-05,3.577468258302825e-05,2.5788391378021657e-05,1.8224577614958136e-05,1.2626280869676383e-05,8.575869734938773e-06,5.7103885608934525e-06,3.727673798176641e-06,4.872408628071242e-06,7.463997119958867e-06,1.1209441585304363e-05,1.650369726019327e-05,2.382118018414342e-05,3.370777258348413e-05,4.676076328602531e-05,6.359425491996718e-05,8.478888624884184e-05,0.00011082678455542033,0.0001420153508368441,0.00017840647166909325,0.00021972054770552114,0.00026528671192348197,0.0003140111549941657,0.00036438409403864545,0.00041453241940958406,0.00046231964357095357,0.0005054881132929698,0.0005418315674334102,0.0005693802716352297,0.0005865773405820097,0.0005924243552122666,0.0005865773405820097,0.0005693802716352297,0.0005418315674334102,0.0005054881132929698,0.00046231964357095357,0.00041453241940958406,0.00036438409403864545,0.0003140111549941657,0.00026528671192348197,0.00021972054770552114,0.00017840647166909325,0.0001420153508368441,0.00011082678455542033,8.478888624884184e-05,6.359425491996718e-05,4.676076328602531e-05,3.370777258348413e-05,2.382118018414342e-05,1.650369726019327e-05,1.1209441585304363e-05,7.463997119958867e-06,4.872408628071242e-06,6.2435883483561845e-06,9.564494484689166e-06,1.4363971541789636e-05,2.1148121962695522e-05,3.052487063275852e-05,4.319372044019054e-05,5.9920047577873325e-05,8.149077373214406e-05,0.0001086499394167041,0.0001420153508368441,0.00018198091692560536,0.00022861312603524958,0.0002815536947465919,0.0003399429625004263,0.0004023793031808035,0.0004669280549990739,0.0005311889829868627,0.0005924243552122666,0.0006477411759361968,0.0006943123041258484,0.0007296136882453654,0.0007516503086313072,0.0007591427738994741,0.0007516503086313072,0.0007296136882453654,0.0006943123041258484,0.0006477411759361968,0.0005924243552122666,0.0005311889829868627,0.0004669280549990739,0.0004023793031808035,0.0003399429625004263,0.0002815536947465919,0.00022861312603524958,0.00018198091692560536,0.0001420153508368441,0.0001086499394167041,8.149077373214406e-05,5.9920047577873325e-05,4.319372044019054e-05,3.052487063275852e-05,2.1148121962695522e-05,1.4363971541789636e-05,9.564494484689166e-06,6.2435883483561845e-06,7.843494109761422e-06,1.2015375128511819e-05,1.8044707609602395e-05,2.6567281632298867e-05,3.8346801494737545e-05,5.4262016159427424e-05,7.527442778276868e-05,0.00010237260499985629,0.00013649124706711653,0.00017840647166909325,0.00022861312603524958,0.0002871947360116592,0.0003537012088421682,0.0004270525978428634,0.0005054881132929698,0.0005865773405820098,0.0006673049898180017,0.0007442317912919421,0.0008137234254790528,0.0008722283026842657,0.000916575588725434,0.000944259044544825,0.0009536714375341756,0.000944259044544825,0.000916575588725434,0.0008722283026842657,0.0008137234254790528,0.0007442317912919421,0.0006673049898180017,0.0005865773405820098,0.0005054881132929698,0.0004270525978428634,0.0003537012088421682,0.0002871947360116592,0.00022861312603524958,0.00017840647166909325,0.00013649124706711653,0.00010237260499985629,7.527442778276868e-05,5.4262016159427424e-05,3.8346801494737545e-05,2.6567281632298867e-05,1.8044707609602395e-05,1.2015375128511819e-05,7.843494109761422e-06,9.659833556477215e-06,1.479780850674861e-05,2.2223370049723795e-05,3.271953991737842e-05,4.722687550710785e-05,6.682762008919129e-05,9.270593351191122e-05,0.00012607930996096312,0.00016809889956358482,0.00021972054770552114,0.0002815536947465919,0.0003537012088421682,0.000435608768021891,0.00052594633938582,0.0006225453823074666,0.000722412664398063,0.0008218346368140118,0.0009165755887254341,0.0010021595912657905,0.0010742126033718561,0.0011288295120919164,0.001162923701714702,0.0011745157483680072,0.001162923701714702,0.0011288295120919164,0.0010742126033718561,0.0010021595912657905,0.0009165755887254341,0.0008218346368140118,0.000722412664398063,0.0006225453823074666,0.00052594633938582,0.000435608768021891,0.0003537012088421682,0.0002815536947465919,0.00021972054770552114,0.00016809889956358482,0.00012607930996096312,9.270593351191122e-05,6.682762008919129e-05,4.722687550710785e-05,3.271953991737842e-05,2.2223370049723795e-05,1.479780850674861e-05,9.659833556477215e-06,1.1663112570429667e-05,1.786661285629967e-05,2.6832104825496343e-05,3.950499509933783e-05,5.7020896081561355e-05,8.068648919851432e-05,0.00011193150815431848,0.00015222593394384183,0.00020295964491653452,0.00026528671192348197,0.0003399429625004263,0.0004270525978428634,0.00052594633938582,0.000635018328876803,0.0007516503086313071,0.0008722283026842658,0.0009922686376943695,0.0011066571911525873,0.001209989805531518,0.0012969853408394828,0.0013629288326115344,0.0014040935555069398,0.0014180895880729998,0.0014040935555069398,0.0013629288326115344,0.0012969853408394828,0.001209989805531518,0.0011066571911525873,0.0009922686376943695,0.0008722283026842658,0.0007516503086313071,0.000635018328876803,0.00052594633938582,0.0004270525978428634,0.0003399429625004263,0.00026528671192348197,0.00020295964491653452,0.00015222593394384183,0.00011193150815431848,8.068648919851432e-05,5.7020896081561355e-05,3.950499509933783e-05,2.6832104825496343e-05,1.786661285629967e-05,1.1663112570429667e-05,1.3805242722160705e-05,2.114812196269553e-05,3.1760279910321586e-05,4.676076328602531e-05,6.749375913912293e-05,9.550594329412809e-05,0.00013248964450927447,0.00018018483093702314,0.0002402366558632202,0.0003140111549941657,0.0004023793031808035,0.0005054881132929698,0.0006225453823074666,0.0007516503086313071,0.0008897037467640531,0.0010324279522281028,0.0011745157483680072,0.001309913716585455,0.0014322251333708303,0.0015351988870252126,0.0016132540291978173,0.001661979357683661,0.0016785460010693728,0.001661979357683661,0.0016132540291978173,0.0015351988870252126,0.0014322251333708303,0.001309913716585455,0.0011745157483680072,0.0010324279522281028,0.0008897037467640531,0.0007516503086313071,0.0006225453823074666,0.0005054881132929698,0.0004023793031808035,0.0003140111549941657,0.0002402366558632202,0.00018018483093702314,0.00013248964450927447,9.550594329412809e-05,6.749375913912293e-05,4.676076328602531e-05,3.1760279910321586e-05,2.114812196269553e-05,1.3805242722160705e-05,1.601984764646847e-05,2.45406544940697e-05,3.6855190134093635e-05,5.426201615942742e-05,7.832095097904659e-05,0.00011082678455542034,0.00015374332508955342,0.00020908966237748324,0.0002787748613682841,0.00036438409403864545,0.0004669280549990739,0.0005865773405820098,0.000722412664398063,0.0008722283026842658,0.0010324279522281028,0.0011980476427335867,0.0013629288326115346,0.001520047027933305,0.0016619793576836612,0.001781471921366018,0.0018720484878773278,0.0019285902202160385,0.0019478144459970498,0.0019285902202160385,0.0018720484878773278,0.001781471921366018,0.0016619793576836612,0.001520047027933305,0.0013629288326115346,0.0011980476427335867,0.0010324279522281028,0.0008722283026842658,0.000722412664398063,0.0005865773405820098,0.0004669280549990739,0.00036438409403864545,0.0002787748613682841,0.00020908966237748324,0.00015374332508955342,0.00011082678455542034,7.832095097904659e-05,5.426201615942742e-05,3.6855190134093635e-05,2.45406544940697e-05,1.601984764646847e-05,1.822457761495816e-05,2.79180596731604e-05,4.192738207849919e-05,6.172982083631734e-05,8.909986421185637e-05,0.00012607930996096312,0.00017490223519659893,0.00023786560675087751,0.0003171412244501269,0.00041453241940958406,0.0005311889829868627,0.0006673049898180017,0.0008218346368140118,0.0009922686376943695,0.0011745157483680072,0.0013629288326115346,0.0015505017801507538,0.001729243351765824,0.0018907091045426566,0.0020266468206369486,0.002129688978272304,0.002194012261004533,0.0022158822189819894,0.002194012261004533,0.002129688978272304,0.0020266468206369486,0.0018907091045426566,0.001729243351765824,0.0015505017801507538,0.0013629288326115346,0.0011745157483680072,0.0009922686376943695,0.0008218346368140118,0.0006673049898180017,0.0005311889829868627,0.00041453241940958406,0.0003171412244501269,0.00023786560675087751,0.00017490223519659893,0.00012607930996096312,8.909986421185637e-05,6.172982083631734e-05,4.192738207849919e-05,2.79180596731604e-05,1.822457761495816e-05,2.032550370651139e-05,3.113644866587657e-05,4.676076328602533e-05,6.884602368951709e-05,9.937128083568516e-05,0.00014061371056537587,0.00019506493400690868,0.0002652867119234819,0.00035370120884216795,0.00046231964357095357,0.0005924243552122666,0.0007442317912919421,0.0009165755887254341,0.0011066571911525873,0.001309913716585455,0.001520047027933305,0.001729243351765824,0.0019285902202160383,0.0021086697164808244,0.0022602783084989704,0.002375199147883766,0.002446937607298915,0.002471328730172851,0.002446937607298915,0.002375199147883766,0.0022602783084989704,0.0021086697164808244,0.0019285902202160383,0.001729243351765824,0.001520047027933305,0.001309913716585455,0.0011066571911525873,0.0009165755887254341,0.0007442317912919421,0.0005924243552122666,0.00046231964357095357,0.00035370120884216795,0.0002652867119234819,0.00019506493400690868,0.00014061371056537587,9.937128083568516e-05,6.884602368951709e-05,4.676076328602533e-05,3.113644866587657e-05,2.032550370651139e-05,2.222337004972379e-05,3.4043772332900724e-05,5.1126986141060376e-05,7.527442778276868e-05,0.0001086499394167041,0.00015374332508955344,0.00021327885767336436,0.00029005749886834705,0.00038672757952935757,0.0005054881132929698,0.0006477411759361968,0.0008137234254790528,0.0010021595912657905,0.001209989805531518,0.0014322251333708303,0.0016619793576836612,0.0018907091045426566,0.0021086697164808244,0.0023055638914860985,0.002471328730172851,0.0025969801470799273,0.0026754170878514963,0.0027020856987446237,0.0026754170878514963,0.0025969801470799273,0.002471328730172851,0.0023055638914860985,0.0021086697164808244,0.0018907091045426566,0.0016619793576836612,0.0014322251333708303,0.001209989805531518,0.0010021595912657905,0.0008137234254790528,0.0006477411759361968,0.0005054881132929698,0.00038672757952935757,0.00029005749886834705,0.00021327885767336436,0.00015374332508955344,0.0001086499394167041,7.527442778276868e-05,5.1126986141060376e-05,3.4043772332900724e-05,2.222337004972379e-05,2.3821180184143435e-05,3.649144270538142e-05,5.4802901018765174e-05,8.06864891985143e-05,0.0001164616247693605,0.00016479712306789,0.00022861312603524953,0.0003109119781943581,0.0004145324194095838,0.0005418315674334102,0.0006943123041258484,0.0008722283026842657,0.0010742126033718561,0.0012969853408394828,0.0015351988870252126,0.001781471921366018,0.0020266468206369486,0.0022602783084989704,0.002471328730172851,0.0026490116865254443,0.002783697156633683,0.0028677735363651065,0.0028963595601735836,0.0028677735363651065,0.002783697156633683,0.0026490116865254443,0.002471328730172851,0.0022602783084989704,0.0020266468206369486,0.001781471921366018,0.0015351988870252126,0.0012969853408394828,0.0010742126033718561,0.0008722283026842657,0.0006943123041258484,0.0005418315674334102,0.0004145324194095838,0.0003109119781943581,0.00022861312603524953,0.00016479712306789,0.0001164616247693605,8.06864891985143e-05,5.4802901018765174e-05,3.649144270538142e-05,2.3821180184143435e-05,2.5032336355312553e-05,3.834680149473757e-05,5.758928151098908e-05,8.478888624884187e-05,0.00012238296092707468,0.0001731760132425864,0.00024023665586322024,0.0003267198835193493,0.0004356087680218907,0.0005693802716352297,0.0007296136882453654,0.000916575588725434,0.0011288295120919164,0.0013629288326115344,0.0016132540291978173,0.0018720484878773278,0.002129688978272304,0.002375199147883766,0.0025969801470799273,0.002783697156633683,0.002925230530037535,0.0030135816612873183,0.0030436211033931754,0.0030135816612873183,0.002925230530037535,0.002783697156633683,0.0025969801470799273,0.002375199147883766,0.002129688978272304,0.0018720484878773278,0.0016132540291978173,0.0013629288326115344,0.0011288295120919164,0.000916575588725434,0.0007296136882453654,0.0005693802716352297,0.0004356087680218907,0.0003267198835193493,0.00024023665586322024,0.0001731760132425864,0.00012238296092707468,8.478888624884187e-05,5.758928151098908e-05,3.834680149473757e-05,2.5032336355312553e-05,2.578839137802167e-05,3.9504995099337844e-05,5.932865832834125e-05,8.73497763874383e-05,0.00012607930996096306,0.00017840647166909323,0.00024749255590092017,0.0003365878481171212,0.0004487655182478513,0.0005865773405820097,0.0007516503086313072,0.000944259044544825,0.001162923701714702,0.0014040935555069398,0.001661979357683661,0.0019285902202160385,0.002194012261004533,0.002446937607298915,0.0026754170878514963,0.0028677735363651065,0.0030135816612873183,0.0031046012736407136,0.0031355480010579035,0.0031046012736407136,0.0030135816612873183,0.0028677735363651065,0.0026754170878514963,0.002446937607298915,0.002194012261004533,0.0019285902202160385,0.001661979357683661,0.0014040935555069398,0.001162923701714702,0.000944259044544825,0.0007516503086313072,0.0005865773405820097,0.0004487655182478513,0.0003365878481171212,0.00024749255590092017,0.00017840647166909323,0.00012607930996096306,8.73497763874383e-05,5.932865832834125e-05,3.9504995099337844e-05,2.578839137802167e-05,2.6045450577629476e-05,3.989878167841857e-05,5.9920047577873345e-05,8.822048070066708e-05,0.00012733607103731663,0.00018018483093702316,0.00024995956663440087,0.00033994296250042624,0.00045323882188441275,0.0005924243552122666,0.0007591427738994741,0.0009536714375341756,0.0011745157483680072,0.0014180895880729998,0.0016785460010693728,0.0019478144459970498,0.0022158822189819894,0.002471328730172851,0.0027020856987446237,0.0028963595601735836,0.0030436211033931754,0.0031355480010579035,0.003166803206071223,0.0031355480010579035,0.0030436211033931754,0.0028963595601735836,0.0027020856987446237,0.002471328730172851,0.0022158822189819894,0.0019478144459970498,0.0016785460010693728,0.0014180895880729998,0.0011745157483680072,0.0009536714375341756,0.0007591427738994741,0.0005924243552122666,0.00045323882188441275,0.00033994296250042624,0.00024995956663440087,0.00018018483093702316,0.00012733607103731663,8.822048070066708e-05,5.9920047577873345e-05,3.989878167841857e-05,2.6045450577629476e-05,2.578839137802167e-05,3.9504995099337844e-05,5.932865832834125e-05,8.73497763874383e-05,0.00012607930996096306,0.00017840647166909323,0.00024749255590092017,0.0003365878481171212,0.0004487655182478513,0.0005865773405820097,0.0007516503086313072,0.000944259044544825,0.001162923701714702,0.0014040935555069398,0.001661979357683661,0.0019285902202160385,0.002194012261004533,0.002446937607298915,0.0026754170878514963,0.0028677735363651065,0.0030135816612873183,0.0031046012736407136,0.0031355480010579035,0.0031046012736407136,0.0030135816612873183,0.0028677735363651065,0.0026754170878514963,0.002446937607298915,0.002194012261004533,0.0019285902202160385,0.001661979357683661,0.0014040935555069398,0.001162923701714702,0.000944259044544825,0.0007516503086313072,0.0005865773405820097,0.0004487655182478513,0.0003365878481171212,0.00024749255590092017,0.00017840647166909323,0.00012607930996096306,8.73497763874383e-05,5.932865832834125e-05,3.9504995099337844e-05,2.578839137802167e-05,2.5032336355312553e-05,3.834680149473757e-05,5.758928151098908e-05,8.478888624884187e-05,0.00012238296092707468,0.0001731760132425864,0.00024023665586322024,0.0003267198835193493,0.0004356087680218907,0.0005693802716352297,0.0007296136882453654,0.000916575588725434,0.0011288295120919164,0.0013629288326115344,0.0016132540291978173,0.0018720484878773278,0.002129688978272304,0.002375199147883766,0.0025969801470799273,0.002783697156633683,0.002925230530037535,0.0030135816612873183,0.0030436211033931754,0.0030135816612873183,0.002925230530037535,0.002783697156633683,0.0025969801470799273,0.002375199147883766,0.002129688978272304,0.0018720484878773278,0.0016132540291978173,0.0013629288326115344,0.0011288295120919164,0.000916575588725434,0.0007296136882453654,0.0005693802716352297,0.0004356087680218907,0.0003267198835193493,0.00024023665586322024,0.0001731760132425864,0.00012238296092707468,8.478888624884187e-05,5.758928151098908e-05,3.834680149473757e-05,2.5032336355312553e-05,2.3821180184143435e-05,3.649144270538142e-05,5.4802901018765174e-05,8.06864891985143e-05,0.0001164616247693605,0.00016479712306789,0.00022861312603524953,0.0003109119781943581,0.0004145324194095838,0.0005418315674334102,0.0006943123041258484,0.0008722283026842657,0.0010742126033718561,0.0012969853408394828,0.0015351988870252126,0.001781471921366018,0.0020266468206369486,0.0022602783084989704,0.002471328730172851,0.0026490116865254443,0.002783697156633683,0.0028677735363651065,0.0028963595601735836,0.0028677735363651065,0.002783697156633683,0.0026490116865254443,0.002471328730172851,0.0022602783084989704,0.0020266468206369486,0.001781471921366018,0.0015351988870252126,0.0012969853408394828,0.0010742126033718561,0.0008722283026842657,0.0006943123041258484,0.0005418315674334102,0.0004145324194095838,0.0003109119781943581,0.00022861312603524953,0.00016479712306789,0.0001164616247693605,8.06864891985143e-05,5.4802901018765174e-05,3.649144270538142e-05,2.3821180184143435e-05,2.222337004972379e-05,3.4043772332900724e-05,5.1126986141060376e-05,7.527442778276868e-05,0.0001086499394167041,0.00015374332508955344,0.00021327885767336436,0.00029005749886834705,0.00038672757952935757,0.0005054881132929698,0.0006477411759361968,0.0008137234254790528,0.0010021595912657905,0.001209989805531518,0.0014322251333708303,0.0016619793576836612,0.0018907091045426566,0.0021086697164808244,0.0023055638914860985,0.002471328730172851,0.0025969801470799273,0.0026754170878514963,0.0027020856987446237,0.0026754170878514963,0.0025969801470799273,0.002471328730172851,0.0023055638914860985,0.0021086697164808244,0.0018907091045426566,0.0016619793576836612,0.0014322251333708303,0.001209989805531518,0.0010021595912657905,0.0008137234254790528,0.0006477411759361968,0.0005054881132929698,0.00038672757952935757,0.00029005749886834705,0.00021327885767336436,0.00015374332508955344,0.0001086499394167041,7.527442778276868e-05,5.1126986141060376e-05,3.4043772332900724e-05,2.222337004972379e-05,2.032550370651139e-05,3.113644866587657e-05,4.676076328602533e-05,6.884602368951709e-05,9.937128083568516e-05,0.00014061371056537587,0.00019506493400690868,0.0002652867119234819,0.00035370120884216795,0.00046231964357095357,0.0005924243552122666,0.0007442317912919421,0.0009165755887254341,0.0011066571911525873,0.001309913716585455,0.001520047027933305,0.001729243351765824,0.0019285902202160383,0.0021086697164808244,0.0022602783084989704,0.002375199147883766,0.002446937607298915,0.002471328730172851,0.002446937607298915,0.002375199147883766,0.0022602783084989704,0.0021086697164808244,0.0019285902202160383,0.001729243351765824,0.001520047027933305,0.001309913716585455,0.0011066571911525873,0.0009165755887254341,0.0007442317912919421,0.0005924243552122666,0.00046231964357095357,0.00035370120884216795,0.0002652867119234819,0.00019506493400690868,0.00014061371056537587,9.937128083568516e-05,6.884602368951709e-05,4.676076328602533e-05,3.113644866587657e-05,2.032550370651139e-05,1.822457761495816e-05,2.79180596731604e-05,4.192738207849919e-05,6.172982083631734e-05,8.909986421185637e-05,0.00012607930996096312,0.00017490223519659893,0.00023786560675087751,0.0003171412244501269,0.00041453241940958406,0.0005311889829868627,0.0006673049898180017,0.0008218346368140118,0.0009922686376943695,0.0011745157483680072,0.0013629288326115346,0.0015505017801507538,0.001729243351765824,0.0018907091045426566,0.0020266468206369486,0.002129688978272304,0.002194012261004533,0.0022158822189819894,0.002194012261004533,0.002129688978272304,0.0020266468206369486,0.0018907091045426566,0.001729243351765824,0.0015505017801507538,0.0013629288326115346,0.0011745157483680072,0.0009922686376943695,0.0008218346368140118,0.0006673049898180017,0.0005311889829868627,0.00041453241940958406,0.0003171412244501269,0.00023786560675087751,0.00017490223519659893,0.00012607930996096312,8.909986421185637e-05,6.172982083631734e-05,4.192738207849919e-05,2.79180596731604e-05,1.822457761495816e-05,1.601984764646847e-05,2.45406544940697e-05,3.6855190134093635e-05,5.426201615942742e-05,7.832095097904659e-05,0.00011082678455542034,0.00015374332508955342,0.00020908966237748324,0.0002787748613682841,0.00036438409403864545,0.0004669280549990739,0.0005865773405820098,0.000722412664398063,0.0008722283026842658,0.0010324279522281028,0.0011980476427335867,0.0013629288326115346,0.001520047027933305,0.0016619793576836612,0.001781471921366018,0.0018720484878773278,0.0019285902202160385,0.0019478144459970498,0.0019285902202160385,0.0018720484878773278,0.001781471921366018,0.0016619793576836612,0.001520047027933305,0.0013629288326115346,0.0011980476427335867,0.0010324279522281028,0.0008722283026842658,0.000722412664398063,0.0005865773405820098,0.0004669280549990739,0.00036438409403864545,0.0002787748613682841,0.00020908966237748324,0.00015374332508955342,0.00011082678455542034,7.832095097904659e-05,5.426201615942742e-05,3.6855190134093635e-05,2.45406544940697e-05,1.601984764646847e-05,1.3805242722160705e-05,2.114812196269553e-05,3.1760279910321586e-05,4.676076328602531e-05,6.749375913912293e-05,9.550594329412809e-05,0.00013248964450927447,0.00018018483093702314,0.0002402366558632202,0.0003140111549941657,0.0004023793031808035,0.0005054881132929698,0.0006225453823074666,0.0007516503086313071,0.0008897037467640531,0.0010324279522281028,0.0011745157483680072,0.001309913716585455,0.0014322251333708303,0.0015351988870252126,0.0016132540291978173,0.001661979357683661,0.0016785460010693728,0.001661979357683661,0.0016132540291978173,0.0015351988870252126,0.0014322251333708303,0.001309913716585455,0.0011745157483680072,0.0010324279522281028,0.0008897037467640531,0.0007516503086313071,0.0006225453823074666,0.0005054881132929698,0.0004023793031808035,0.0003140111549941657,0.0002402366558632202,0.00018018483093702314,0.00013248964450927447,9.550594329412809e-05,6.749375913912293e-05,4.676076328602531e-05,3.1760279910321586e-05,2.114812196269553e-05,1.3805242722160705e-05,1.1663112570429667e-05,1.786661285629967e-05,2.6832104825496343e-05,3.950499509933783e-05,5.7020896081561355e-05,8.068648919851432e-05,0.00011193150815431848,0.00015222593394384183,0.00020295964491653452,0.00026528671192348197,0.0003399429625004263,0.0004270525978428634,0.00052594633938582,0.000635018328876803,0.0007516503086313071,0.0008722283026842658,0.0009922686376943695,0.0011066571911525873,0.001209989805531518,0.0012969853408394828,0.0013629288326115344,0.0014040935555069398,0.0014180895880729998,0.0014040935555069398,0.0013629288326115344,0.0012969853408394828,0.001209989805531518,0.0011066571911525873,0.0009922686376943695,0.0008722283026842658,0.0007516503086313071,0.000635018328876803,0.00052594633938582,0.0004270525978428634,0.0003399429625004263,0.00026528671192348197,0.00020295964491653452,0.00015222593394384183,0.00011193150815431848,8.068648919851432e-05,5.7020896081561355e-05,3.950499509933783e-05,2.6832104825496343e-05,1.786661285629967e-05,1.1663112570429667e-05,9.659833556477215e-06,1.479780850674861e-05,2.2223370049723795e-05,3.271953991737842e-05,4.722687550710785e-05,6.682762008919129e-05,9.270593351191122e-05,0.00012607930996096312,0.00016809889956358482,0.00021972054770552114,0.0002815536947465919,0.0003537012088421682,0.000435608768021891,0.00052594633938582,0.0006225453823074666,0.000722412664398063,0.0008218346368140118,0.0009165755887254341,0.0010021595912657905,0.0010742126033718561,0.0011288295120919164,0.001162923701714702,0.0011745157483680072,0.001162923701714702,0.0011288295120919164,0.0010742126033718561,0.0010021595912657905,0.0009165755887254341,0.0008218346368140118,0.000722412664398063,0.0006225453823074666,0.00052594633938582,0.000435608768021891,0.0003537012088421682,0.0002815536947465919,0.00021972054770552114,0.00016809889956358482,0.00012607930996096312,9.270593351191122e-05,6.682762008919129e-05,4.722687550710785e-05,3.271953991737842e-05,2.2223370049723795e-05,1.479780850674861e-05,9.659833556477215e-06,7.843494109761422e-06,1.2015375128511819e-05,1.8044707609602395e-05,2.6567281632298867e-05,3.8346801494737545e-05,5.4262016159427424e-05,7.527442778276868e-05,0.00010237260499985629,0.00013649124706711653,0.00017840647166909325,0.00022861312603524958,0.0002871947360116592,0.0003537012088421682,0.0004270525978428634,0.0005054881132929698,0.0005865773405820098,0.0006673049898180017,0.0007442317912919421,0.0008137234254790528,0.0008722283026842657,0.000916575588725434,0.000944259044544825,0.0009536714375341756,0.000944259044544825,0.000916575588725434,0.0008722283026842657,0.0008137234254790528,0.0007442317912919421,0.0006673049898180017,0.0005865773405820098,0.0005054881132929698,0.0004270525978428634,0.0003537012088421682,0.0002871947360116592,0.00022861312603524958,0.00017840647166909325,0.00013649124706711653,0.00010237260499985629,7.527442778276868e-05,5.4262016159427424e-05,3.8346801494737545e-05,2.6567281632298867e-05,1.8044707609602395e-05,1.2015375128511819e-05,7.843494109761422e-06,6.2435883483561845e-06,9.564494484689166e-06,1.4363971541789636e-05,2.1148121962695522e-05,3.052487063275852e-05,4.319372044019054e-05,5.9920047577873325e-05,8.149077373214406e-05,0.0001086499394167041,0.0001420153508368441,0.00018198091692560536,0.00022861312603524958,0.0002815536947465919,0.0003399429625004263,0.0004023793031808035,0.0004669280549990739,0.0005311889829868627,0.0005924243552122666,0.0006477411759361968,0.0006943123041258484,0.0007296136882453654,0.0007516503086313072,0.0007591427738994741,0.0007516503086313072,0.0007296136882453654,0.0006943123041258484,0.0006477411759361968,0.0005924243552122666,0.0005311889829868627,0.0004669280549990739,0.0004023793031808035,0.0003399429625004263,0.0002815536947465919,0.00022861312603524958,0.00018198091692560536,0.0001420153508368441,0.0001086499394167041,8.149077373214406e-05,5.9920047577873325e-05,4.319372044019054e-05,3.052487063275852e-05,2.1148121962695522e-05,1.4363971541789636e-05,9.564494484689166e-06,6.2435883483561845e-06,4.872408628071242e-06,7.463997119958867e-06,1.1209441585304363e-05,1.650369726019327e-05,2.382118018414342e-05,3.370777258348413e-05,4.676076328602531e-05,6.359425491996718e-05,8.478888624884184e-05,0.00011082678455542033,0.0001420153508368441,0.00017840647166909325,0.00021972054770552114,0.00026528671192348197,0.0003140111549941657,0.00036438409403864545,0.00041453241940958406,0.00046231964357095357,0.0005054881132929698,0.0005418315674334102,0.0005693802716352297,0.0005865773405820097,0.0005924243552122666,0.0005865773405820097,0.0005693802716352297,0.0005418315674334102,0.0005054881132929698,0.00046231964357095357,0.00041453241940958406,0.00036438409403864545,0.0003140111549941657,0.00026528671192348197,0.00021972054770552114,0.00017840647166909325,0.0001420153508368441,0.00011082678455542033,8.478888624884184e-05,6.359425491996718e-05,4.676076328602531e-05,3.370777258348413e-05,2.382118018414342e-05,1.650369726019327e-05,1.1209441585304363e-05,7.463997119958867e-06,4.872408628071242e-06,3.727673798176641e-06,5.7103885608934525e-06,8.575869734938773e-06,1.2626280869676383e-05,1.8224577614958136e-05,2.5788391378021657e-05,3.577468258302825e-05,4.865327518180018e-05,6.486839133841343e-05,8.478888624884184e-05,0.0001086499394167041,0.00013649124706711653,0.00016809889956358482,0.00020295964491653452,0.0002402366558632202,0.0002787748613682841,0.0003171412244501269,0.00035370120884216795,0.00038672757952935757,0.0004145324194095838,0.0004356087680218907,0.0004487655182478513,0.00045323882188441275,0.0004487655182478513,0.0004356087680218907,0.0004145324194095838,0.00038672757952935757,0.00035370120884216795,0.0003171412244501269,0.0002787748613682841,0.0002402366558632202,0.00020295964491653452,0.00016809889956358482,0.00013649124706711653,0.0001086499394167041,8.478888624884184e-05,6.486839133841343e-05,4.865327518180018e-05,3.577468258302825e-05,2.5788391378021657e-05,1.8224577614958136e-05,1.2626280869676383e-05,8.575869734938773e-06,5.7103885608934525e-06,3.727673798176641e-06,2.7958692261152996e-06,4.282965868518919e-06,6.432164287233778e-06,9.470096375139881e-06,1.366898995763382e-05,1.93420813484526e-05,2.683210482549633e-05,3.649144270538141e-05,4.865327518180018e-05,6.359425491996718e-05,8.149077373214406e-05,0.00010237260499985629,0.00012607930996096312,0.00015222593394384183,0.00018018483093702314,0.00020908966237748324,0.00023786560675087751,0.0002652867119234819,0.00029005749886834705,0.0003109119781943581,0.0003267198835193493,0.0003365878481171212,0.00033994296250042624,0.0003365878481171212,0.0003267198835193493,0.0003109119781943581,0.00029005749886834705,0.0002652867119234819,0.00023786560675087751,0.00020908966237748324,0.00018018483093702314,0.00015222593394384183,0.00012607930996096312,0.00010237260499985629,8.149077373214406e-05,6.359425491996718e-05,4.865327518180018e-05,3.649144270538141e-05,2.683210482549633e-05,1.93420813484526e-05,1.366898995763382e-05,9.470096375139881e-06,6.432164287233778e-06,4.282965868518919e-06,2.7958692261152996e-06,2.05579858157929e-06,3.149258583058848e-06,4.729561059103288e-06,6.963348111414447e-06,1.0050788464655576e-05,1.422220432541085e-05,1.972960771047428e-05,2.683210482549633e-05,3.577468258302825e-05,4.676076328602531e-05,5.9920047577873325e-05,7.527442778276868e-05,9.270593351191122e-05,0.00011193150815431848,0.00013248964450927447,0.00015374332508955342,0.00017490223519659893,0.00019506493400690868,0.00021327885767336436,0.00022861312603524953,0.00024023665586322024,0.00024749255590092017,0.00024995956663440087,0.00024749255590092017,0.00024023665586322024,0.00022861312603524953,0.00021327885767336436,0.00019506493400690868,0.00017490223519659893,0.00015374332508955342,0.00013248964450927447,0.00011193150815431848,9.270593351191122e-05,7.527442778276868e-05,5.9920047577873325e-05,4.676076328602531e-05,3.577468258302825e-05,2.683210482549633e-05,1.972960771047428e-05,1.422220432541085e-05,1.0050788464655576e-05,6.963348111414447e-06,4.729561059103288e-06,3.149258583058848e-06,2.05579858157929e-06,1.481934557856833e-06,2.270161662567598e-06,3.4093320424391e-06,5.019570641382982e-06,7.245170267624026e-06,1.0252160045044943e-05,1.422220432541085e-05,1.93420813484526e-05,2.5788391378021657e-05,3.370777258348413e-05,4.319372044019054e-05,5.4262016159427424e-05,6.682762008919129e-05,8.068648919851432e-05,9.550594329412809e-05,0.00011082678455542034,0.00012607930996096312,0.00014061371056537587,0.00015374332508955344,0.00016479712306789,0.0001731760132425864,0.00017840647166909323,0.00018018483093702316,0.00017840647166909323,0.0001731760132425864,0.00016479712306789,0.00015374332508955344,0.00014061371056537587,0.00012607930996096312,0.00011082678455542034,9.550594329412809e-05,8.068648919851432e-05,6.682762008919129e-05,5.4262016159427424e-05,4.319372044019054e-05,3.370777258348413e-05,2.5788391378021657e-05,1.93420813484526e-05,1.422220432541085e-05,1.0252160045044943e-05,7.245170267624026e-06,5.019570641382982e-06,3.4093320424391e-06,2.270161662567598e-06,1.481934557856833e-06,1.047278636889619e-06,1.6043163302239087e-06,2.409364566862785e-06,3.5473152786727704e-06,5.120139753596003e-06,7.245170267624026e-06,1.0050788464655576e-05,1.366898995763382e-05,1.8224577614958136e-05,2.382118018414342e-05,3.052487063275852e-05,3.8346801494737545e-05,4.722687550710785e-05,5.7020896081561355e-05,6.749375913912293e-05,7.832095097904659e-05,8.909986421185637e-05,9.937128083568516e-05,0.0001086499394167041,0.0001164616247693605,0.00012238296092707468,0.00012607930996096306,0.00012733607103731663,0.00012607930996096306,0.00012238296092707468,0.0001164616247693605,0.0001086499394167041,9.937128083568516e-05,8.909986421185637e-05,7.832095097904659e-05,6.749375913912293e-05,5.7020896081561355e-05,4.722687550710785e-05,3.8346801494737545e-05,3.052487063275852e-05,2.382118018414342e-05,1.8224577614958136e-05,1.366898995763382e-05,1.0050788464655576e-05,7.245170267624026e-06,5.120139753596003e-06,3.5473152786727704e-06,2.409364566862785e-06,1.6043163302239087e-06,1.047278636889619e-06,7.255715055545077e-07,1.1114961903199142e-06,1.669246573576931e-06,2.457637152866307e-06,3.5473152786727704e-06,5.019570641382982e-06,6.963348111414447e-06,9.470096375139881e-06,1.2626280869676383e-05,1.650369726019327e-05,2.1148121962695522e-05,2.6567281632298867e-05,3.271953991737842e-05,3.950499509933783e-05,4.676076328602531e-05,5.426201615942742e-05,6.172982083631734e-05,6.884602368951709e-05,7.527442778276868e-05,8.06864891985143e-05,8.478888624884187e-05,8.73497763874383e-05,8.822048070066708e-05,8.73497763874383e-05,8.478888624884187e-05,8.06864891985143e-05,7.527442778276868e-05,6.884602368951709e-05,6.172982083631734e-05,5.426201615942742e-05,4.676076328602531e-05,3.950499509933783e-05,3.271953991737842e-05,2.6567281632298867e-05,2.1148121962695522e-05,1.650369726019327e-05,1.2626280869676383e-05,9.470096375139881e-06,6.963348111414447e-06,5.019570641382982e-06,3.5473152786727704e-06,2.457637152866307e-06,1.669246573576931e-06,1.1114961903199142e-06,7.255715055545077e-07,4.928138997733499e-07,7.549369951017578e-07,1.133765462549508e-06,1.669246573576931e-06,2.409364566862785e-06,3.4093320424391e-06,4.729561059103288e-06,6.432164287233778e-06,8.575869734938773e-06,1.1209441585304363e-05,1.4363971541789636e-05,1.8044707609602395e-05,2.2223370049723795e-05,2.6832104825496343e-05,3.1760279910321586e-05,3.6855190134093635e-05,4.192738207849919e-05,4.676076328602533e-05,5.1126986141060376e-05,5.4802901018765174e-05,5.758928151098908e-05,5.932865832834125e-05,5.9920047577873345e-05,5.932865832834125e-05,5.758928151098908e-05,5.4802901018765174e-05,5.1126986141060376e-05,4.676076328602533e-05,4.192738207849919e-05,3.6855190134093635e-05,3.1760279910321586e-05,2.6832104825496343e-05,2.2223370049723795e-05,1.8044707609602395e-05,1.4363971541789636e-05,1.1209441585304363e-05,8.575869734938773e-06,6.432164287233778e-06,4.729561059103288e-06,3.4093320424391e-06,2.409364566862785e-06,1.669246573576931e-06,1.133765462549508e-06,7.549369951017578e-07,4.928138997733499e-07,3.2814850771927234e-07,5.02687624027341e-07,7.549369951017578e-07,1.1114961903199142e-06,1.6043163302239087e-06,2.270161662567598e-06,3.149258583058848e-06,4.282965868518919e-06,5.7103885608934525e-06,7.463997119958867e-06,9.564494484689166e-06,1.2015375128511819e-05,1.479780850674861e-05,1.786661285629967e-05,2.114812196269553e-05,2.45406544940697e-05,2.79180596731604e-05,3.113644866587657e-05,3.4043772332900724e-05,3.649144270538142e-05,3.834680149473757e-05,3.9504995099337844e-05,3.989878167841857e-05,3.9504995099337844e-05,3.834680149473757e-05,3.649144270538142e-05,3.4043772332900724e-05,3.113644866587657e-05,2.79180596731604e-05,2.45406544940697e-05,2.114812196269553e-05,1.786661285629967e-05,1.479780850674861e-05,1.2015375128511819e-05,9.564494484689166e-06,7.463997119958867e-06,5.7103885608934525e-06,4.282965868518919e-06,3.149258583058848e-06,2.270161662567598e-06,1.6043163302239087e-06,1.1114961903199142e-06,7.549369951017578e-07,5.02687624027341e-07,3.2814850771927234e-07,2.142114465752763e-07,3.2814850771927234e-07,4.928138997733499e-07,7.255715055545077e-07,1.047278636889619e-06,1.481934557856833e-06,2.05579858157929e-06,2.7958692261152996e-06,3.727673798176641e-06,4.872408628071242e-06,6.2435883483561845e-06,7.843494109761422e-06,9.659833556477215e-06,1.1663112570429667e-05,1.3805242722160705e-05,1.601984764646847e-05,1.822457761495816e-05,2.032550370651139e-05,2.222337004972379e-05,2.3821180184143435e-05,2.5032336355312553e-05,2.578839137802167e-05,2.6045450577629476e-05,2.578839137802167e-05,2.5032336355312553e-05,2.3821180184143435e-05,2.222337004972379e-05,2.032550370651139e-05,1.822457761495816e-05,1.601984764646847e-05,1.3805242722160705e-05,1.1663112570429667e-05,9.659833556477215e-06,7.843494109761422e-06,6.2435883483561845e-06,4.872408628071242e-06,3.727673798176641e-06,2.7958692261152996e-06,2.05579858157929e-06,1.481934557856833e-06,1.047278636889619e-06,7.255715055545077e-07,4.928138997733499e-07,3.2814850771927234e-07,2.142114465752763e-07);
-const float kernel47[2209]=float[](1.8587230590938784e-07,2.8032335255145307e-07,4.1511937085648554e-07,6.036091988907752e-07,8.6180265799008e-07,1.2081724769628715e-06,1.6631031110964654e-06,2.247908053428452e-06,2.98336946073534e-06,3.8878067149712654e-06,4.974751831410461e-06,6.250392711301981e-06,7.711028679835817e-06,9.340851359229893e-06,1.1110400983721586e-05,1.2976038774023184e-05,1.4880710413562726e-05,1.6756153299492116e-05,1.8526531282468206e-05,2.0113286155379e-05,2.1440804655500716e-05,2.244234616377317e-05,2.3065589734710556e-05,2.327716035250262e-05,2.3065589734710556e-05,2.244234616377317e-05,2.1440804655500716e-05,2.0113286155379e-05,1.8526531282468206e-05,1.6756153299492116e-05,1.4880710413562726e-05,1.2976038774023184e-05,1.1110400983721586e-05,9.340851359229893e-06,7.711028679835817e-06,6.250392711301981e-06,4.974751831410461e-06,3.8878067149712654e-06,2.98336946073534e-06,2.247908053428452e-06,1.6631031110964654e-06,1.2081724769628715e-06,8.6180265799008e-07,6.036091988907752e-07,4.1511937085648554e-07,2.8032335255145307e-07,1.8587230590938784e-07,2.8032335255145307e-07,4.2276971602210777e-07,6.260623559717866e-07,9.103333250002621e-07,1.2997278381175497e-06,1.8221055446943789e-06,2.5082092647442977e-06,3.3901829467358433e-06,4.4993692042570814e-06,5.863396416591999e-06,7.502672895080425e-06,9.426530924136143e-06,1.1629389330359659e-05,1.4087406705873715e-05,1.6756153299492116e-05,1.9569815278157086e-05,2.2442346163773166e-05,2.5270795699223548e-05,2.7940791581843473e-05,3.033385623704041e-05,3.233595350864584e-05,3.384642851967433e-05,3.478637342650988e-05,3.510545369288246e-05,3.478637342650988e-05,3.384642851967433e-05,3.233595350864584e-05,3.033385623704041e-05,2.7940791581843473e-05,2.5270795699223548e-05,2.2442346163773166e-05,1.9569815278157086e-05,1.6756153299492116e-05,1.4087406705873715e-05,1.1629389330359659e-05,9.426530924136143e-06,7.502672895080425e-06,5.863396416591999e-06,4.4993692042570814e-06,3.3901829467358433e-06,2.5082092647442977e-06,1.8221055446943789e-06,1.2997278381175497e-06,9.103333250002621e-07,6.260623559717866e-07,4.2276971602210777e-07,2.8032335255145307e-07,4.1511937085648554e-07,6.260623559717866e-07,9.271100996847363e-07,1.3480753340891883e-06,1.9247137191147317e-06,2.698281468393931e-06,3.7143043648707388e-06,5.020383065228415e-06,6.6629315621481e-06,8.682863590863635e-06,1.111040098372157e-05,1.3959363538463492e-05,1.722148632400481e-05,2.0861463575955007e-05,2.4813501095608012e-05,2.8980137873297913e-05,3.3233951204043874e-05,3.742248626888464e-05,4.13763738094496e-05,4.492016523832068e-05,4.788498908270512e-05,5.0121789658060325e-05,5.151371557081035e-05,5.198622846787622e-05,5.151371557081035e-05,5.0121789658060325e-05,4.788498908270512e-05,4.492016523832068e-05,4.13763738094496e-05,3.742248626888464e-05,3.3233951204043874e-05,2.8980137873297913e-05,2.4813501095608012e-05,2.0861463575955007e-05,1.722148632400481e-05,1.3959363538463492e-05,1.111040098372157e-05,8.682863590863635e-06,6.6629315621481e-06,5.020383065228415e-06,3.7143043648707388e-06,2.698281468393931e-06,1.9247137191147317e-06,1.3480753340891883e-06,9.271100996847363e-07,6.260623559717866e-07,4.1511937085648554e-07,6.036091988907752e-07,9.103333250002621e-07,1.3480753340891883e-06,1.960184779561405e-06,2.79865259887035e-06,3.923467874213366e-06,5.400827905212915e-06,7.2999469860320875e-06,9.68831392809826e-06,1.2625419828868956e-05,1.6155209098777434e-05,2.0297776577113937e-05,2.50411045437211e-05,3.0333856237040392e-05,3.60803628293544e-05,4.2138909994381134e-05,4.832421725071283e-05,5.441460587747849e-05,6.016380251443747e-05,6.531669408151489e-05,6.962773102943862e-05,7.288017718867928e-05,7.490412341739146e-05,7.559118634744705e-05,7.490412341739146e-05,7.288017718867928e-05,6.962773102943862e-05,6.531669408151489e-05,6.016380251443747e-05,5.441460587747849e-05,4.832421725071283e-05,4.2138909994381134e-05,3.60803628293544e-05,3.0333856237040392e-05,2.50411045437211e-05,2.0297776577113937e-05,1.6155209098777434e-05,1.2625419828868956e-05,9.68831392809826e-06,7.2999469860320875e-06,5.400827905212915e-06,3.923467874213366e-06,2.79865259887035e-06,1.960184779561405e-06,1.3480753340891883e-06,9.103333250002621e-07,6.036091988907752e-07,8.6180265799008e-07,1.2997278381175497e-06,1.9247137191147317e-06,2.79865259887035e-06,3.995774505970957e-06,5.601728815182646e-06,7.711028679835812e-06,1.0422494765338264e-05,1.3832484180195942e-05,1.802593530177264e-05,2.3065589734710542e-05,2.8980137873297936e-05,3.575242142506076e-05,4.330914436063923e-05,5.151371557081038e-05,6.016380251443748e-05,6.899487109952138e-05,7.7690419670326e-05,8.589883159006455e-05,9.325586931745935e-05,9.941094963638339e-05,0.00010405462761570198,0.00010694431558390802,0.00010792526925462155,0.00010694431558390802,0.00010405462761570198,9.941094963638339e-05,9.325586931745935e-05,8.589883159006455e-05,7.7690419670326e-05,6.899487109952138e-05,6.016380251443748e-05,5.151371557081038e-05,4.330914436063923e-05,3.575242142506076e-05,2.8980137873297936e-05,2.3065589734710542e-05,1.802593530177264e-05,1.3832484180195942e-05,1.0422494765338264e-05,7.711028679835812e-06,5.601728815182646e-06,3.995774505970957e-06,2.79865259887035e-06,1.9247137191147317e-06,1.2997278381175497e-06,8.6180265799008e-07,1.2081724769628715e-06,1.8221055446943789e-06,2.698281468393931e-06,3.923467874213366e-06,5.601728815182646e-06,7.853137275879013e-06,1.0810192488587349e-05,1.4611432443407753e-05,1.9391941437629488e-05,2.5270795699223528e-05,3.2335953508645814e-05,4.062763630686193e-05,5.012178965806033e-05,6.0715658895007e-05,7.221775514582275e-05,8.434442576087955e-05,9.672481691858775e-05,0.00010891522078650075,0.00012042270137855554,0.00013073662929674745,0.0001393655173210235,0.00014587555053393553,0.0001499266420893267,0.0001513018539375889,0.0001499266420893267,0.00014587555053393553,0.0001393655173210235,0.00013073662929674745,0.00012042270137855554,0.00010891522078650075,9.672481691858775e-05,8.434442576087955e-05,7.221775514582275e-05,6.0715658895007e-05,5.012178965806033e-05,4.062763630686193e-05,3.2335953508645814e-05,2.5270795699223528e-05,1.9391941437629488e-05,1.4611432443407753e-05,1.0810192488587349e-05,7.853137275879013e-06,5.601728815182646e-06,3.923467874213366e-06,2.698281468393931e-06,1.8221055446943789e-06,1.2081724769628715e-06,1.6631031110964654e-06,2.5082092647442977e-06,3.7143043648707388e-06,5.400827905212915e-06,7.711028679835812e-06,1.0810192488587349e-05,1.4880710413562714e-05,2.0113286155378986e-05,2.6693869253001667e-05,3.4786373426509857e-05,4.4511877158208245e-05,5.592574704920564e-05,6.899487109952137e-05,8.35778029428335e-05,9.941094963638338e-05,0.00011610385070117301,0.00013314600936939141,0.00014992664208932674,0.00016576720056789624,0.00017996478074410545,0.000191842828615674,0.00020080417866807056,0.00020638068624258862,0.00020827372647225098,0.00020638068624258862,0.00020080417866807056,0.000191842828615674,0.00017996478074410545,0.00016576720056789624,0.00014992664208932674,0.00013314600936939141,0.00011610385070117301,9.941094963638338e-05,8.35778029428335e-05,6.899487109952137e-05,5.592574704920564e-05,4.4511877158208245e-05,3.4786373426509857e-05,2.6693869253001667e-05,2.0113286155378986e-05,1.4880710413562714e-05,1.0810192488587349e-05,7.711028679835812e-06,5.400827905212915e-06,3.7143043648707388e-06,2.5082092647442977e-06,1.6631031110964654e-06,2.247908053428452e-06,3.3901829467358433e-06,5.020383065228415e-06,7.2999469860320875e-06,1.0422494765338264e-05,1.4611432443407753e-05,2.0113286155378986e-05,2.7185817660926093e-05,3.608036282935441e-05,4.701847315015055e-05,6.016380251443746e-05,7.559118634744706e-05,9.325586931745935e-05,0.00011296666759235846,0.00013436729977569904,0.00015693000589311215,0.00017996478074410547,0.0002026460680203336,0.00022405671823029244,0.000243246661778805,0.0002593014447272321,0.0002714139173802914,0.00027895131912232735,0.00028151001818874696,0.00027895131912232735,0.0002714139173802914,0.0002593014447272321,0.000243246661778805,0.00022405671823029244,0.0002026460680203336,0.00017996478074410547,0.00015693000589311215,0.00013436729977569904,0.00011296666759235846,9.325586931745935e-05,7.559118634744706e-05,6.016380251443746e-05,4.701847315015055e-05,3.608036282935441e-05,2.7185817660926093e-05,2.0113286155378986e-05,1.4611432443407753e-05,1.0422494765338264e-05,7.2999469860320875e-06,5.020383065228415e-06,3.3901829467358433e-06,2.247908053428452e-06,2.98336946073534e-06,4.4993692042570814e-06,6.6629315621481e-06,9.68831392809826e-06,1.3832484180195942e-05,1.9391941437629488e-05,2.6693869253001667e-05,3.608036282935441e-05,4.788498908270518e-05,6.240178581709434e-05,7.984795053762537e-05,0.00010032280301935651,0.0001237669450633023,0.00014992664208932682,0.00017832904600386052,0.00020827372647225104,0.0002388449252010229,0.0002689469837291111,0.00029736268332743583,0.00032283111449771896,0.0003441386359837602,0.00036021401813829954,0.0003702174763029638,0.00037361332011531453,0.0003702174763029638,0.00036021401813829954,0.0003441386359837602,0.00032283111449771896,0.00029736268332743583,0.0002689469837291111,0.0002388449252010229,0.00020827372647225104,0.00017832904600386052,0.00014992664208932682,0.0001237669450633023,0.00010032280301935651,7.984795053762537e-05,6.240178581709434e-05,4.788498908270518e-05,3.608036282935441e-05,2.6693869253001667e-05,1.9391941437629488e-05,1.3832484180195942e-05,9.68831392809826e-06,6.6629315621481e-06,4.4993692042570814e-06,2.98336946073534e-06,3.8878067149712654e-06,5.863396416591999e-06,8.682863590863635e-06,1.2625419828868956e-05,1.802593530177264e-05,2.5270795699223528e-05,3.4786373426509857e-05,4.701847315015055e-05,6.240178581709434e-05,8.131948963039277e-05,0.00010405462761570194,0.00013073662929674753,0.0001612880893370762,0.00019537835106896506,0.00023239121793428225,0.0002714139173802914,0.0003112530701458845,0.00035048085832975674,0.00038751105159376626,0.00042070048355208784,0.00044846758588490025,0.0004694163753354509,0.0004824524784186841,0.0004868778050670961,0.0004824524784186841,0.0004694163753354509,0.00044846758588490025,0.00042070048355208784,0.00038751105159376626,0.00035048085832975674,0.0003112530701458845,0.0002714139173802914,0.00023239121793428225,0.00019537835106896506,0.0001612880893370762,0.00013073662929674753,0.00010405462761570194,8.131948963039277e-05,6.240178581709434e-05,4.701847315015055e-05,3.4786373426509857e-05,2.5270795699223528e-05,1.802593530177264e-05,1.2625419828868956e-05,8.682863590863635e-06,5.863396416591999e-06,3.8878067149712654e-06,4.974751831410461e-06,7.502672895080425e-06,1.111040098372157e-05,1.6155209098777434e-05,2.3065589734710542e-05,3.2335953508645814e-05,4.4511877158208245e-05,6.016380251443746e-05,7.984795053762537e-05,0.00010405462761570194,0.00013314600936939136,0.00016728771096616418,0.00020638068624258862,0.0002500018342103907,0.00029736268332743567,0.00034729526994190386,0.00039827257223918136,0.00044846758588490025,0.0004958506054800439,0.0005383190715131742,0.0005738492440012222,0.0006006548535197316,0.0006173355638642142,0.0006229981143619027,0.0006173355638642142,0.0006006548535197316,0.0005738492440012222,0.0005383190715131742,0.0004958506054800439,0.00044846758588490025,0.00039827257223918136,0.00034729526994190386,0.00029736268332743567,0.0002500018342103907,0.00020638068624258862,0.00016728771096616418,0.00013314600936939136,0.00010405462761570194,7.984795053762537e-05,6.016380251443746e-05,4.4511877158208245e-05,3.2335953508645814e-05,2.3065589734710542e-05,1.6155209098777434e-05,1.111040098372157e-05,7.502672895080425e-06,4.974751831410461e-06,6.250392711301981e-06,9.426530924136143e-06,1.3959363538463492e-05,2.0297776577113937e-05,2.8980137873297936e-05,4.062763630686193e-05,5.592574704920564e-05,7.559118634744706e-05,0.00010032280301935651,0.00013073662929674753,0.00016728771096616418,0.00021018413073619567,0.00025930144472723223,0.00031410805911854205,0.00037361332011531437,0.0004363497713008682,0.0005003988273178801,0.0005634649978661207,0.0006229981143619029,0.0006763564726377153,0.0007209973991957812,0.0007546765840143323,0.0007756346124526941,0.0007827491712402622,0.0007756346124526941,0.0007546765840143323,0.0007209973991957812,0.0006763564726377153,0.0006229981143619029,0.0005634649978661207,0.0005003988273178801,0.0004363497713008682,0.00037361332011531437,0.00031410805911854205,0.00025930144472723223,0.00021018413073619567,0.00016728771096616418,0.00013073662929674753,0.00010032280301935651,7.559118634744706e-05,5.592574704920564e-05,4.062763630686193e-05,2.8980137873297936e-05,2.0297776577113937e-05,1.3959363538463492e-05,9.426530924136143e-06,6.250392711301981e-06,7.711028679835817e-06,1.1629389330359659e-05,1.722148632400481e-05,2.50411045437211e-05,3.575242142506076e-05,5.012178965806033e-05,6.899487109952137e-05,9.325586931745935e-05,0.0001237669450633023,0.0001612880893370762,0.00020638068624258862,0.00025930144472723223,0.0003198968399856031,0.0003875110515937662,0.0004609219227727145,0.0005383190715131744,0.0006173355638642144,0.0006951394831196498,0.0007685847192675971,0.0008344122360298261,0.0008894851699850408,0.0009310347448749107,0.0009568903936037983,0.000965667532799567,0.0009568903936037983,0.0009310347448749107,0.0008894851699850408,0.0008344122360298261,0.0007685847192675971,0.0006951394831196498,0.0006173355638642144,0.0005383190715131744,0.0004609219227727145,0.0003875110515937662,0.0003198968399856031,0.00025930144472723223,0.00020638068624258862,0.0001612880893370762,0.0001237669450633023,9.325586931745935e-05,6.899487109952137e-05,5.012178965806033e-05,3.575242142506076e-05,2.50411045437211e-05,1.722148632400481e-05,1.1629389330359659e-05,7.711028679835817e-06,9.340851359229893e-06,1.4087406705873715e-05,2.0861463575955007e-05,3.0333856237040392e-05,4.330914436063923e-05,6.0715658895007e-05,8.35778029428335e-05,0.00011296666759235846,0.00014992664208932682,0.00019537835106896506,0.0002500018342103907,0.00031410805911854205,0.0003875110515937662,0.0004694163753354509,0.0005583435553921499,0.0006520995627979265,0.0007478171824079868,0.0008420659363817588,0.0009310347448749107,0.001010775733393227,0.0010774890230659218,0.0011278206220262995,0.0011591411865839898,0.0011697734842956217,0.0011591411865839898,0.0011278206220262995,0.0010774890230659218,0.001010775733393227,0.0009310347448749107,0.0008420659363817588,0.0007478171824079868,0.0006520995627979265,0.0005583435553921499,0.0004694163753354509,0.0003875110515937662,0.00031410805911854205,0.0002500018342103907,0.00019537835106896506,0.00014992664208932682,0.00011296666759235846,8.35778029428335e-05,6.0715658895007e-05,4.330914436063923e-05,3.0333856237040392e-05,2.0861463575955007e-05,1.4087406705873715e-05,9.340851359229893e-06,1.1110400983721586e-05,1.6756153299492116e-05,2.4813501095608012e-05,3.60803628293544e-05,5.151371557081038e-05,7.221775514582275e-05,9.941094963638338e-05,0.00013436729977569904,0.00017832904600386052,0.00023239121793428225,0.00029736268332743567,0.00037361332011531437,0.0004609219227727145,0.0005583435553921499,0.0006641172788767074,0.0007756346124526941,0.0008894851699850409,0.0010015885970275906,0.0011074118351231327,0.0012022591165116113,0.0012816107056442664,0.0013414772237051815,0.0013787312188593415,0.0013913777203838314,0.0013787312188593415,0.0013414772237051815,0.0012816107056442664,0.0012022591165116113,0.0011074118351231327,0.0010015885970275906,0.0008894851699850409,0.0007756346124526941,0.0006641172788767074,0.0005583435553921499,0.0004609219227727145,0.00037361332011531437,0.00029736268332743567,0.00023239121793428225,0.00017832904600386052,0.00013436729977569904,9.941094963638338e-05,7.221775514582275e-05,5.151371557081038e-05,3.60803628293544e-05,2.4813501095608012e-05,1.6756153299492116e-05,1.1110400983721586e-05,1.2976038774023184e-05,1.9569815278157086e-05,2.8980137873297913e-05,4.2138909994381134e-05,6.016380251443748e-05,8.434442576087955e-05,0.00011610385070117301,0.00015693000589311215,0.00020827372647225104,0.0002714139173802914,0.00034729526994190386,0.0004363497713008682,0.0005383190715131744,0.0006520995627979265,0.0007756346124526941,0.0009058777284822444,0.0010388458590788268,0.0011697734842956214,0.0012933663629624073,0.00140414022276376,0.0014968163825958229,0.0015667355745999968,0.0016102451910680181,0.001625015269517748,0.0016102451910680181,0.0015667355745999968,0.0014968163825958229,0.00140414022276376,0.0012933663629624073,0.0011697734842956214,0.0010388458590788268,0.0009058777284822444,0.0007756346124526941,0.0006520995627979265,0.0005383190715131744,0.0004363497713008682,0.00034729526994190386,0.0002714139173802914,0.00020827372647225104,0.00015693000589311215,0.00011610385070117301,8.434442576087955e-05,6.016380251443748e-05,4.2138909994381134e-05,2.8980137873297913e-05,1.9569815278157086e-05,1.2976038774023184e-05,1.4880710413562726e-05,2.2442346163773166e-05,3.3233951204043874e-05,4.832421725071283e-05,6.899487109952138e-05,9.672481691858775e-05,0.00013314600936939141,0.00017996478074410547,0.0002388449252010229,0.0003112530701458845,0.00039827257223918136,0.0005003988273178801,0.0006173355638642144,0.0007478171824079868,0.0008894851699850409,0.0010388458590788268,0.0011913315505983084,0.0013414772237051813,0.0014832115286535327,0.0016102451910680177,0.0017165247052339883,0.001796706898481382,0.0018466030196429455,0.0018635411056045898,0.0018466030196429455,0.001796706898481382,0.0017165247052339883,0.0016102451910680177,0.0014832115286535327,0.0013414772237051813,0.0011913315505983084,0.0010388458590788268,0.0008894851699850409,0.0007478171824079868,0.0006173355638642144,0.0005003988273178801,0.00039827257223918136,0.0003112530701458845,0.0002388449252010229,0.00017996478074410547,0.00013314600936939141,9.672481691858775e-05,6.899487109952138e-05,4.832421725071283e-05,3.3233951204043874e-05,2.2442346163773166e-05,1.4880710413562726e-05,1.6756153299492116e-05,2.5270795699223548e-05,3.742248626888464e-05,5.441460587747849e-05,7.7690419670326e-05,0.00010891522078650075,0.00014992664208932674,0.0002026460680203336,0.0002689469837291111,0.00035048085832975674,0.00044846758588490025,0.0005634649978661207,0.0006951394831196498,0.0008420659363817588,0.0010015885970275906,0.0011697734842956214,0.0013414772237051813,0.0015105460279432612,0.0016701433640588115,0.00181318730903559,0.001932861422869392,0.0020231491231607894,0.002079333742846095,0.0020984065664603905,0.002079333742846095,0.0020231491231607894,0.001932861422869392,0.00181318730903559,0.0016701433640588115,0.0015105460279432612,0.0013414772237051813,0.0011697734842956214,0.0010015885970275906,0.0008420659363817588,0.0006951394831196498,0.0005634649978661207,0.00044846758588490025,0.00035048085832975674,0.0002689469837291111,0.0002026460680203336,0.00014992664208932674,0.00010891522078650075,7.7690419670326e-05,5.441460587747849e-05,3.742248626888464e-05,2.5270795699223548e-05,1.6756153299492116e-05,1.8526531282468206e-05,2.7940791581843473e-05,4.13763738094496e-05,6.016380251443747e-05,8.589883159006455e-05,0.00012042270137855554,0.00016576720056789624,0.00022405671823029244,0.00029736268332743583,0.00038751105159376626,0.0004958506054800439,0.0006229981143619029,0.0007685847192675971,0.0009310347448749107,0.0011074118351231327,0.0012933663629624073,0.0014832115286535327,0.0016701433640588115,0.0018466030196429462,0.0020047603290213626,0.0021370786585338283,0.0022369057413954654,0.0022990265692244246,0.0023201145395371544,0.0022990265692244246,0.0022369057413954654,0.0021370786585338283,0.0020047603290213626,0.0018466030196429462,0.0016701433640588115,0.0014832115286535327,0.0012933663629624073,0.0011074118351231327,0.0009310347448749107,0.0007685847192675971,0.0006229981143619029,0.0004958506054800439,0.00038751105159376626,0.00029736268332743583,0.00022405671823029244,0.00016576720056789624,0.00012042270137855554,8.589883159006455e-05,6.016380251443747e-05,4.13763738094496e-05,2.7940791581843473e-05,1.8526531282468206e-05,2.0113286155379e-05,3.033385623704041e-05,4.492016523832068e-05,6.531669408151489e-05,9.325586931745935e-05,0.00013073662929674745,0.00017996478074410545,0.000243246661778805,0.00032283111449771896,0.00042070048355208784,0.0005383190715131742,0.0006763564726377153,0.0008344122360298261,0.001010775733393227,0.0012022591165116113,0.00140414022276376,0.0016102451910680177,0.00181318730903559,0.0020047603290213626,0.002176463448865667,0.0023201145395371527,0.002428491582872452,0.0024959329169939263,0.002518827023552203,0.0024959329169939263,0.002428491582872452,0.0023201145395371527,0.002176463448865667,0.0020047603290213626,0.00181318730903559,0.0016102451910680177,0.00140414022276376,0.0012022591165116113,0.001010775733393227,0.0008344122360298261,0.0006763564726377153,0.0005383190715131742,0.00042070048355208784,0.00032283111449771896,0.000243246661778805,0.00017996478074410545,0.00013073662929674745,9.325586931745935e-05,6.531669408151489e-05,4.492016523832068e-05,3.033385623704041e-05,2.0113286155379e-05,2.1440804655500716e-05,3.233595350864584e-05,4.788498908270512e-05,6.962773102943862e-05,9.941094963638339e-05,0.0001393655173210235,0.000191842828615674,0.0002593014447272321,0.0003441386359837602,0.00044846758588490025,0.0005738492440012222,0.0007209973991957812,0.0008894851699850408,0.0010774890230659218,0.0012816107056442664,0.0014968163825958229,0.0017165247052339883,0.001932861422869392,0.0021370786585338283,0.0023201145395371527,0.0024732468994033323,0.0025887770518280497,0.00266066965353591,0.0026850748184943448,0.00266066965353591,0.0025887770518280497,0.0024732468994033323,0.0023201145395371527,0.0021370786585338283,0.001932861422869392,0.0017165247052339883,0.0014968163825958229,0.0012816107056442664,0.0010774890230659218,0.0008894851699850408,0.0007209973991957812,0.0005738492440012222,0.00044846758588490025,0.0003441386359837602,0.0002593014447272321,0.000191842828615674,0.0001393655173210235,9.941094963638339e-05,6.962773102943862e-05,4.788498908270512e-05,3.233595350864584e-05,2.1440804655500716e-05,2.244234616377317e-05,3.384642851967433e-05,5.0121789658060325e-05,7.288017718867928e-05,0.00010405462761570198,0.00014587555053393553,0.00020080417866807056,0.0002714139173802914,0.00036021401813829954,0.0004694163753354509,0.0006006548535197316,0.0007546765840143323,0.0009310347448749107,0.0011278206220262995,0.0013414772237051815,0.0015667355745999968,0.001796706898481382,0.0020231491231607894,0.0022369057413954654,0.002428491582872452,0.0025887770518280497,0.0027097038414111915,0.0027849546857738883,0.002810499863251202,0.0027849546857738883,0.0027097038414111915,0.0025887770518280497,0.002428491582872452,0.0022369057413954654,0.0020231491231607894,0.001796706898481382,0.0015667355745999968,0.0013414772237051815,0.0011278206220262995,0.0009310347448749107,0.0007546765840143323,0.0006006548535197316,0.0004694163753354509,0.00036021401813829954,0.0002714139173802914,0.00020080417866807056,0.00014587555053393553,0.00010405462761570198,7.288017718867928e-05,5.0121789658060325e-05,3.384642851967433e-05,2.244234616377317e-05,2.3065589734710556e-05,3.478637342650988e-05,5.151371557081035e-05,7.490412341739146e-05,0.00010694431558390802,0.0001499266420893267,0.00020638068624258862,0.00027895131912232735,0.0003702174763029638,0.0004824524784186841,0.0006173355638642142,0.0007756346124526941,0.0009568903936037983,0.0011591411865839898,0.0013787312188593415,0.0016102451910680181,0.0018466030196429455,0.002079333742846095,0.0022990265692244246,0.0024959329169939263,0.00266066965353591,0.0027849546857738883,0.0028622953118650376,0.002888549901251205,0.0028622953118650376,0.0027849546857738883,0.00266066965353591,0.0024959329169939263,0.0022990265692244246,0.002079333742846095,0.0018466030196429455,0.0016102451910680181,0.0013787312188593415,0.0011591411865839898,0.0009568903936037983,0.0007756346124526941,0.0006173355638642142,0.0004824524784186841,0.0003702174763029638,0.00027895131912232735,0.00020638068624258862,0.0001499266420893267,0.00010694431558390802,7.490412341739146e-05,5.151371557081035e-05,3.478637342650988e-05,2.3065589734710556e-05,2.327716035250262e-05,3.510545369288246e-05,5.198622846787622e-05,7.559118634744705e-05,0.00010792526925462155,0.0001513018539375889,0.00020827372647225098,0.00028151001818874696,0.00037361332011531453,0.0004868778050670961,0.0006229981143619027,0.0007827491712402622,0.000965667532799567,0.0011697734842956217,0.0013913777203838314,0.001625015269517748,0.0018635411056045898,0.0020984065664603905,0.0023201145395371544,0.002518827023552203,0.0026850748184943448,0.002810499863251202,0.002888549901251205,0.002915045312561294,0.002888549901251205,0.002810499863251202,0.0026850748184943448,0.002518827023552203,0.0023201145395371544,0.0020984065664603905,0.0018635411056045898,0.001625015269517748,0.0013913777203838314,0.0011697734842956217,0.000965667532799567,0.0007827491712402622,0.0006229981143619027,0.0004868778050670961,0.00037361332011531453,0.00028151001818874696,0.00020827372647225098,0.0001513018539375889,0.00010792526925462155,7.559118634744705e-05,5.198622846787622e-05,3.510545369288246e-05,2.327716035250262e-05,2.3065589734710556e-05,3.478637342650988e-05,5.151371557081035e-05,7.490412341739146e-05,0.00010694431558390802,0.0001499266420893267,0.00020638068624258862,0.00027895131912232735,0.0003702174763029638,0.0004824524784186841,0.0006173355638642142,0.0007756346124526941,0.0009568903936037983,0.0011591411865839898,0.0013787312188593415,0.0016102451910680181,0.0018466030196429455,0.002079333742846095,0.0022990265692244246,0.0024959329169939263,0.00266066965353591,0.0027849546857738883,0.0028622953118650376,0.002888549901251205,0.0028622953118650376,0.0027849546857738883,0.00266066965353591,0.0024959329169939263,0.0022990265692244246,0.002079333742846095,0.0018466030196429455,0.0016102451910680181,0.0013787312188593415,0.0011591411865839898,0.0009568903936037983,0.0007756346124526941,0.0006173355638642142,0.0004824524784186841,0.0003702174763029638,0.00027895131912232735,0.00020638068624258862,0.0001499266420893267,0.00010694431558390802,7.490412341739146e-05,5.151371557081035e-05,3.478637342650988e-05,2.3065589734710556e-05,2.244234616377317e-05,3.384642851967433e-05,5.0121789658060325e-05,7.288017718867928e-05,0.00010405462761570198,0.00014587555053393553,0.00020080417866807056,0.0002714139173802914,0.00036021401813829954,0.0004694163753354509,0.0006006548535197316,0.0007546765840143323,0.0009310347448749107,0.0011278206220262995,0.0013414772237051815,0.0015667355745999968,0.001796706898481382,0.0020231491231607894,0.0022369057413954654,0.002428491582872452,0.0025887770518280497,0.0027097038414111915,0.0027849546857738883,0.002810499863251202,0.0027849546857738883,0.0027097038414111915,0.0025887770518280497,0.002428491582872452,0.0022369057413954654,0.0020231491231607894,0.001796706898481382,0.0015667355745999968,0.0013414772237051815,0.0011278206220262995,0.0009310347448749107,0.0007546765840143323,0.0006006548535197316,0.0004694163753354509,0.00036021401813829954,0.0002714139173802914,0.00020080417866807056,0.00014587555053393553,0.00010405462761570198,7.288017718867928e-05,5.0121789658060325e-05,3.384642851967433e-05,2.244234616377317e-05,2.1440804655500716e-05,3.233595350864584e-05,4.788498908270512e-05,6.962773102943862e-05,9.941094963638339e-05,0.0001393655173210235,0.000191842828615674,0.0002593014447272321,0.0003441386359837602,0.00044846758588490025,0.0005738492440012222,0.0007209973991957812,0.0008894851699850408,0.0010774890230659218,0.0012816107056442664,0.0014968163825958229,0.0017165247052339883,0.001932861422869392,0.0021370786585338283,0.0023201145395371527,0.0024732468994033323,0.0025887770518280497,0.00266066965353591,0.0026850748184943448,0.00266066965353591,0.0025887770518280497,0.0024732468994033323,0.0023201145395371527,0.0021370786585338283,0.001932861422869392,0.0017165247052339883,0.0014968163825958229,0.0012816107056442664,0.0010774890230659218,0.0008894851699850408,0.0007209973991957812,0.0005738492440012222,0.00044846758588490025,0.0003441386359837602,0.0002593014447272321,0.000191842828615674,0.0001393655173210235,9.941094963638339e-05,6.962773102943862e-05,4.788498908270512e-05,3.233595350864584e-05,2.1440804655500716e-05,2.0113286155379e-05,3.033385623704041e-05,4.492016523832068e-05,6.531669408151489e-05,9.325586931745935e-05,0.00013073662929674745,0.00017996478074410545,0.000243246661778805,0.00032283111449771896,0.00042070048355208784,0.0005383190715131742,0.0006763564726377153,0.0008344122360298261,0.001010775733393227,0.0012022591165116113,0.00140414022276376,0.0016102451910680177,0.00181318730903559,0.0020047603290213626,0.002176463448865667,0.0023201145395371527,0.002428491582872452,0.0024959329169939263,0.002518827023552203,0.0024959329169939263,0.002428491582872452,0.0023201145395371527,0.002176463448865667,0.0020047603290213626,0.00181318730903559,0.0016102451910680177,0.00140414022276376,0.0012022591165116113,0.001010775733393227,0.0008344122360298261,0.0006763564726377153,0.0005383190715131742,0.00042070048355208784,0.00032283111449771896,0.000243246661778805,0.00017996478074410545,0.00013073662929674745,9.325586931745935e-05,6.531669408151489e-05,4.492016523832068e-05,3.033385623704041e-05,2.0113286155379e-05,1.8526531282468206e-05,2.7940791581843473e-05,4.13763738094496e-05,6.016380251443747e-05,8.589883159006455e-05,0.00012042270137855554,0.00016576720056789624,0.00022405671823029244,0.00029736268332743583,0.00038751105159376626,0.0004958506054800439,0.0006229981143619029,0.0007685847192675971,0.0009310347448749107,0.0011074118351231327,0.0012933663629624073,0.0014832115286535327,0.0016701433640588115,0.0018466030196429462,0.0020047603290213626,0.0021370786585338283,0.0022369057413954654,0.0022990265692244246,0.0023201145395371544,0.0022990265692244246,0.0022369057413954654,0.0021370786585338283,0.0020047603290213626,0.0018466030196429462,0.0016701433640588115,0.0014832115286535327,0.0012933663629624073,0.0011074118351231327,0.0009310347448749107,0.0007685847192675971,0.0006229981143619029,0.0004958506054800439,0.00038751105159376626,0.00029736268332743583,0.00022405671823029244,0.00016576720056789624,0.00012042270137855554,8.589883159006455e-05,6.016380251443747e-05,4.13763738094496e-05,2.7940791581843473e-05,1.8526531282468206e-05,1.6756153299492116e-05,2.5270795699223548e-05,3.742248626888464e-05,5.441460587747849e-05,7.7690419670326e-05,0.00010891522078650075,0.00014992664208932674,0.0002026460680203336,0.0002689469837291111,0.00035048085832975674,0.00044846758588490025,0.0005634649978661207,0.0006951394831196498,0.0008420659363817588,0.0010015885970275906,0.0011697734842956214,0.0013414772237051813,0.0015105460279432612,0.0016701433640588115,0.00181318730903559,0.001932861422869392,0.0020231491231607894,0.002079333742846095,0.0020984065664603905,0.002079333742846095,0.0020231491231607894,0.001932861422869392,0.00181318730903559,0.0016701433640588115,0.0015105460279432612,0.0013414772237051813,0.0011697734842956214,0.0010015885970275906,0.0008420659363817588,0.0006951394831196498,0.0005634649978661207,0.00044846758588490025,0.00035048085832975674,0.0002689469837291111,0.0002026460680203336,0.00014992664208932674,0.00010891522078650075,7.7690419670326e-05,5.441460587747849e-05,3.742248626888464e-05,2.5270795699223548e-05,1.6756153299492116e-05,1.4880710413562726e-05,2.2442346163773166e-05,3.3233951204043874e-05,4.832421725071283e-05,6.899487109952138e-05,9.672481691858775e-05,0.00013314600936939141,0.00017996478074410547,0.0002388449252010229,0.0003112530701458845,0.00039827257223918136,0.0005003988273178801,0.0006173355638642144,0.0007478171824079868,0.0008894851699850409,0.0010388458590788268,0.0011913315505983084,0.0013414772237051813,0.0014832115286535327,0.0016102451910680177,0.0017165247052339883,0.001796706898481382,0.0018466030196429455,0.0018635411056045898,0.0018466030196429455,0.001796706898481382,0.0017165247052339883,0.0016102451910680177,0.0014832115286535327,0.0013414772237051813,0.0011913315505983084,0.0010388458590788268,0.0008894851699850409,0.0007478171824079868,0.0006173355638642144,0.0005003988273178801,0.00039827257223918136,0.0003112530701458845,0.0002388449252010229,0.00017996478074410547,0.00013314600936939141,9.672481691858775e-05,6.899487109952138e-05,4.832421725071283e-05,3.3233951204043874e-05,2.2442346163773166e-05,1.4880710413562726e-05,1.2976038774023184e-05,1.9569815278157086e-05,2.8980137873297913e-05,4.2138909994381134e-05,6.016380251443748e-05,8.434442576087955e-05,0.00011610385070117301,0.00015693000589311215,0.00020827372647225104,0.0002714139173802914,0.00034729526994190386,0.0004363497713008682,0.0005383190715131744,0.0006520995627979265,0.0007756346124526941,0.0009058777284822444,0.0010388458590788268,0.0011697734842956214,0.0012933663629624073,0.00140414022276376,0.0014968163825958229,0.0015667355745999968,0.0016102451910680181,0.001625015269517748,0.0016102451910680181,0.0015667355745999968,0.0014968163825958229,0.00140414022276376,0.0012933663629624073,0.0011697734842956214,0.0010388458590788268,0.0009058777284822444,0.0007756346124526941,0.0006520995627979265,0.0005383190715131744,0.0004363497713008682,0.00034729526994190386,0.0002714139173802914,0.00020827372647225104,0.00015693000589311215,0.00011610385070117301,8.434442576087955e-05,6.016380251443748e-05,4.2138909994381134e-05,2.8980137873297913e-05,1.9569815278157086e-05,1.2976038774023184e-05,1.1110400983721586e-05,1.6756153299492116e-05,2.4813501095608012e-05,3.60803628293544e-05,5.151371557081038e-05,7.221775514582275e-05,9.941094963638338e-05,0.00013436729977569904,0.00017832904600386052,0.00023239121793428225,0.00029736268332743567,0.00037361332011531437,0.0004609219227727145,0.0005583435553921499,0.0006641172788767074,0.0007756346124526941,0.0008894851699850409,0.0010015885970275906,0.0011074118351231327,0.0012022591165116113,0.0012816107056442664,0.0013414772237051815,0.0013787312188593415,0.0013913777203838314,0.0013787312188593415,0.0013414772237051815,0.0012816107056442664,0.0012022591165116113,0.0011074118351231327,0.0010015885970275906,0.0008894851699850409,0.0007756346124526941,0.0006641172788767074,0.0005583435553921499,0.0004609219227727145,0.00037361332011531437,0.00029736268332743567,0.00023239121793428225,0.00017832904600386052,0.00013436729977569904,9.941094963638338e-05,7.221775514582275e-05,5.151371557081038e-05,3.60803628293544e-05,2.4813501095608012e-05,1.6756153299492116e-05,1.1110400983721586e-05,9.340851359229893e-06,1.4087406705873715e-05,2.0861463575955007e-05,3.0333856237040392e-05,4.330914436063923e-05,6.0715658895007e-05,8.35778029428335e-05,0.00011296666759235846,0.00014992664208932682,0.00019537835106896506,0.0002500018342103907,0.00031410805911854205,0.0003875110515937662,0.0004694163753354509,0.0005583435553921499,0.0006520995627979265,0.0007478171824079868,0.0008420659363817588,0.0009310347448749107,0.001010775733393227,0.0010774890230659218,0.0011278206220262995,0.0011591411865839898,0.0011697734842956217,0.0011591411865839898,0.0011278206220262995,0.0010774890230659218,0.001010775733393227,0.0009310347448749107,0.0008420659363817588,0.0007478171824079868,0.0006520995627979265,0.0005583435553921499,0.0004694163753354509,0.0003875110515937662,0.00031410805911854205,0.0002500018342103907,0.00019537835106896506,0.00014992664208932682,0.00011296666759235846,8.35778029428335e-05,6.0715658895007e-05,4.330914436063923e-05,3.0333856237040392e-05,2.0861463575955007e-05,1.4087406705873715e-05,9.340851359229893e-06,7.711028679835817e-06,1.1629389330359659e-05,1.722148632400481e-05,2.50411045437211e-05,3.575242142506076e-05,5.012178965806033e-05,6.899487109952137e-05,9.325586931745935e-05,0.0001237669450633023,0.0001612880893370762,0.00020638068624258862,0.00025930144472723223,0.0003198968399856031,0.0003875110515937662,0.0004609219227727145,0.0005383190715131744,0.0006173355638642144,0.0006951394831196498,0.0007685847192675971,0.0008344122360298261,0.0008894851699850408,0.0009310347448749107,0.0009568903936037983,0.000965667532799567,0.0009568903936037983,0.0009310347448749107,0.0008894851699850408,0.0008344122360298261,0.0007685847192675971,0.0006951394831196498,0.0006173355638642144,0.0005383190715131744,0.0004609219227727145,0.0003875110515937662,0.0003198968399856031,0.00025930144472723223,0.00020638068624258862,0.0001612880893370762,0.0001237669450633023,9.325586931745935e-05,6.899487109952137e-05,5.012178965806033e-05,3.575242142506076e-05,2.50411045437211e-05,1.722148632400481e-05,1.1629389330359659e-05,7.711028679835817e-06,6.250392711301981e-06,9.426530924136143e-06,1.3959363538463492e-05,2.0297776577113937e-05,2.8980137873297936e-05,4.062763630686193e-05,5.592574704920564e-05,7.559118634744706e-05,0.00010032280301935651,0.00013073662929674753,0.00016728771096616418,0.00021018413073619567,0.00025930144472723223,0.00031410805911854205,0.00037361332011531437,0.0004363497713008682,0.0005003988273178801,0.0005634649978661207,0.0006229981143619029,0.0006763564726377153,0.0007209973991957812,0.0007546765840143323,0.0007756346124526941,0.0007827491712402622,0.0007756346124526941,0.0007546765840143323,0.0007209973991957812,0.0006763564726377153,0.0006229981143619029,0.0005634649978661207,0.0005003988273178801,0.0004363497713008682,0.00037361332011531437,0.00031410805911854205,0.00025930144472723223,0.00021018413073619567,0.00016728771096616418,0.00013073662929674753,0.00010032280301935651,7.559118634744706e-05,5.592574704920564e-05,4.062763630686193e-05,2.8980137873297936e-05,2.0297776577113937e-05,1.3959363538463492e-05,9.426530924136143e-06,6.250392711301981e-06,4.974751831410461e-06,7.502672895080425e-06,1.111040098372157e-05,1.6155209098777434e-05,2.3065589734710542e-05,3.2335953508645814e-05,4.4511877158208245e-05,6.016380251443746e-05,7.984795053762537e-05,0.00010405462761570194,0.00013314600936939136,0.00016728771096616418,0.00020638068624258862,0.0002500018342103907,0.00029736268332743567,0.00034729526994190386,0.00039827257223918136,0.00044846758588490025,0.0004958506054800439,0.0005383190715131742,0.0005738492440012222,0.0006006548535197316,0.0006173355638642142,0.0006229981143619027,0.0006173355638642142,0.0006006548535197316,0.0005738492440012222,0.0005383190715131742,0.0004958506054800439,0.00044846758588490025,0.00039827257223918136,0.00034729526994190386,0.00029736268332743567,0.0002500018342103907,0.00020638068624258862,0.00016728771096616418,0.00013314600936939136,0.00010405462761570194,7.984795053762537e-05,6.016380251443746e-05,4.4511877158208245e-05,3.2335953508645814e-05,2.3065589734710542e-05,1.6155209098777434e-05,1.111040098372157e-05,7.502672895080425e-06,4.974751831410461e-06,3.8878067149712654e-06,5.863396416591999e-06,8.682863590863635e-06,1.2625419828868956e-05,1.802593530177264e-05,2.5270795699223528e-05,3.4786373426509857e-05,4.701847315015055e-05,6.240178581709434e-05,8.131948963039277e-05,0.00010405462761570194,0.00013073662929674753,0.0001612880893370762,0.00019537835106896506,0.00023239121793428225,0.0002714139173802914,0.0003112530701458845,0.00035048085832975674,0.00038751105159376626,0.00042070048355208784,0.00044846758588490025,0.0004694163753354509,0.0004824524784186841,0.0004868778050670961,0.0004824524784186841,0.0004694163753354509,0.00044846758588490025,0.00042070048355208784,0.00038751105159376626,0.00035048085832975674,0.0003112530701458845,0.0002714139173802914,0.00023239121793428225,0.00019537835106896506,0.0001612880893370762,0.00013073662929674753,0.00010405462761570194,8.131948963039277e-05,6.240178581709434e-05,4.701847315015055e-05,3.4786373426509857e-05,2.5270795699223528e-05,1.802593530177264e-05,1.2625419828868956e-05,8.682863590863635e-06,5.863396416591999e-06,3.8878067149712654e-06,2.98336946073534e-06,4.4993692042570814e-06,6.6629315621481e-06,9.68831392809826e-06,1.3832484180195942e-05,1.9391941437629488e-05,2.6693869253001667e-05,3.608036282935441e-05,4.788498908270518e-05,6.240178581709434e-05,7.984795053762537e-05,0.00010032280301935651,0.0001237669450633023,0.00014992664208932682,0.00017832904600386052,0.00020827372647225104,0.0002388449252010229,0.0002689469837291111,0.00029736268332743583,0.00032283111449771896,0.0003441386359837602,0.00036021401813829954,0.0003702174763029638,0.00037361332011531453,0.0003702174763029638,0.00036021401813829954,0.0003441386359837602,0.00032283111449771896,0.00029736268332743583,0.0002689469837291111,0.0002388449252010229,0.00020827372647225104,0.00017832904600386052,0.00014992664208932682,0.0001237669450633023,0.00010032280301935651,7.984795053762537e-05,6.240178581709434e-05,4.788498908270518e-05,3.608036282935441e-05,2.6693869253001667e-05,1.9391941437629488e-05,1.3832484180195942e-05,9.68831392809826e-06,6.6629315621481e-06,4.4993692042570814e-06,2.98336946073534e-06,2.247908053428452e-06,3.3901829467358433e-06,5.020383065228415e-06,7.2999469860320875e-06,1.0422494765338264e-05,1.4611432443407753e-05,2.0113286155378986e-05,2.7185817660926093e-05,3.608036282935441e-05,4.701847315015055e-05,6.016380251443746e-05,7.559118634744706e-05,9.325586931745935e-05,0.00011296666759235846,0.00013436729977569904,0.00015693000589311215,0.00017996478074410547,0.0002026460680203336,0.00022405671823029244,0.000243246661778805,0.0002593014447272321,0.0002714139173802914,0.00027895131912232735,0.00028151001818874696,0.00027895131912232735,0.0002714139173802914,0.0002593014447272321,0.000243246661778805,0.00022405671823029244,0.0002026460680203336,0.00017996478074410547,0.00015693000589311215,0.00013436729977569904,0.00011296666759235846,9.325586931745935e-05,7.559118634744706e-05,6.016380251443746e-05,4.701847315015055e-05,3.608036282935441e-05,2.7185817660926093e-05,2.0113286155378986e-05,1.4611432443407753e-05,1.0422494765338264e-05,7.2999469860320875e-06,5.020383065228415e-06,3.3901829467358433e-06,2.247908053428452e-06,1.6631031110964654e-06,2.5082092647442977e-06,3.7143043648707388e-06,5.400827905212915e-06,7.711028679835812e-06,1.0810192488587349e-05,1.4880710413562714e-05,2.0113286155378986e-05,2.6693869253001667e-05,3.4786373426509857e-05,4.4511877158208245e-05,5.592574704920564e-05,6.899487109952137e-05,8.35778029428335e-05,9.941094963638338e-05,0.00011610385070117301,0.00013314600936939141,0.00014992664208932674,0.00016576720056789624,0.00017996478074410545,0.000191842828615674,0.00020080417866807056,0.00020638068624258862,0.00020827372647225098,0.00020638068624258862,0.00020080417866807056,0.000191842828615674,0.00017996478074410545,0.00016576720056789624,0.00014992664208932674,0.00013314600936939141,0.00011610385070117301,9.941094963638338e-05,8.35778029428335e-05,6.899487109952137e-05,5.592574704920564e-05,4.4511877158208245e-05,3.4786373426509857e-05,2.6693869253001667e-05,2.0113286155378986e-05,1.4880710413562714e-05,1.0810192488587349e-05,7.711028679835812e-06,5.400827905212915e-06,3.7143043648707388e-06,2.5082092647442977e-06,1.6631031110964654e-06,1.2081724769628715e-06,1.8221055446943789e-06,2.698281468393931e-06,3.923467874213366e-06,5.601728815182646e-06,7.853137275879013e-06,1.0810192488587349e-05,1.4611432443407753e-05,1.9391941437629488e-05,2.5270795699223528e-05,3.2335953508645814e-05,4.062763630686193e-05,5.012178965806033e-05,6.0715658895007e-05,7.221775514582275e-05,8.434442576087955e-05,9.672481691858775e-05,0.00010891522078650075,0.00012042270137855554,0.00013073662929674745,0.0001393655173210235,0.00014587555053393553,0.0001499266420893267,0.0001513018539375889,0.0001499266420893267,0.00014587555053393553,0.0001393655173210235,0.00013073662929674745,0.00012042270137855554,0.00010891522078650075,9.672481691858775e-05,8.434442576087955e-05,7.221775514582275e-05,6.0715658895007e-05,5.012178965806033e-05,4.062763630686193e-05,3.2335953508645814e-05,2.5270795699223528e-05,1.9391941437629488e-05,1.4611432443407753e-05,1.0810192488587349e-05,7.853137275879013e-06,5.601728815182646e-06,3.923467874213366e-06,2.698281468393931e-06,1.8221055446943789e-06,1.2081724769628715e-06,8.6180265799008e-07,1.2997278381175497e-06,1.9247137191147317e-06,2.79865259887035e-06,3.995774505970957e-06,5.601728815182646e-06,7.711028679835812e-06,1.0422494765338264e-05,1.3832484180195942e-05,1.802593530177264e-05,2.3065589734710542e-05,2.8980137873297936e-05,3.575242142506076e-05,4.330914436063923e-05,5.151371557081038e-05,6.016380251443748e-05,6.899487109952138e-05,7.7690419670326e-05,8.589883159006455e-05,9.325586931745935e-05,9.941094963638339e-05,0.00010405462761570198,0.00010694431558390802,0.00010792526925462155,0.00010694431558390802,0.00010405462761570198,9.941094963638339e-05,9.325586931745935e-05,8.589883159006455e-05,7.7690419670326e-05,6.899487109952138e-05,6.016380251443748e-05,5.151371557081038e-05,4.330914436063923e-05,3.575242142506076e-05,2.8980137873297936e-05,2.3065589734710542e-05,1.802593530177264e-05,1.3832484180195942e-05,1.0422494765338264e-05,7.711028679835812e-06,5.601728815182646e-06,3.995774505970957e-06,2.79865259887035e-06,1.9247137191147317e-06,1.2997278381175497e-06,8.6180265799008e-07,6.036091988907752e-07,9.103333250002621e-07,1.3480753340891883e-06,1.960184779561405e-06,2.79865259887035e-06,3.923467874213366e-06,5.400827905212915e-06,7.2999469860320875e-06,9.68831392809826e-06,1.2625419828868956e-05,1.6155209098777434e-05,2.0297776577113937e-05,2.50411045437211e-05,3.0333856237040392e-05,3.60803628293544e-05,4.2138909994381134e-05,4.832421725071283e-05,5.441460587747849e-05,6.016380251443747e-05,6.531669408151489e-05,6.962773102943862e-05,7.288017718867928e-05,7.490412341739146e-05,7.559118634744705e-05,7.490412341739146e-05,7.288017718867928e-05,6.962773102943862e-05,6.531669408151489e-05,6.016380251443747e-05,5.441460587747849e-05,4.832421725071283e-05,4.2138909994381134e-05,3.60803628293544e-05,3.0333856237040392e-05,2.50411045437211e-05,2.0297776577113937e-05,1.6155209098777434e-05,1.2625419828868956e-05,9.68831392809826e-06,7.2999469860320875e-06,5.400827905212915e-06,3.923467874213366e-06,2.79865259887035e-06,1.960184779561405e-06,1.3480753340891883e-06,9.103333250002621e-07,6.036091988907752e-07,4.1511937085648554e-07,6.260623559717866e-07,9.271100996847363e-07,1.3480753340891883e-06,1.9247137191147317e-06,2.698281468393931e-06,3.7143043648707388e-06,5.020383065228415e-06,6.6629315621481e-06,8.682863590863635e-06,1.111040098372157e-05,1.3959363538463492e-05,1.722148632400481e-05,2.0861463575955007e-05,2.4813501095608012e-05,2.8980137873297913e-05,3.3233951204043874e-05,3.742248626888464e-05,4.13763738094496e-05,4.492016523832068e-05,4.788498908270512e-05,5.0121789658060325e-05,5.151371557081035e-05,5.198622846787622e-05,5.151371557081035e-05,5.0121789658060325e-05,4.788498908270512e-05,4.492016523832068e-05,4.13763738094496e-05,3.742248626888464e-05,3.3233951204043874e-05,2.8980137873297913e-05,2.4813501095608012e-05,2.0861463575955007e-05,1.722148632400481e-05,1.3959363538463492e-05,1.111040098372157e-05,8.682863590863635e-06,6.6629315621481e-06,5.020383065228415e-06,3.7143043648707388e-06,2.698281468393931e-06,1.9247137191147317e-06,1.3480753340891883e-06,9.271100996847363e-07,6.260623559717866e-07,4.1511937085648554e-07,2.8032335255145307e-07,4.2276971602210777e-07,6.260623559717866e-07,9.103333250002621e-07,1.2997278381175497e-06,1.8221055446943789e-06,2.5082092647442977e-06,3.3901829467358433e-06,4.4993692042570814e-06,5.863396416591999e-06,7.502672895080425e-06,9.426530924136143e-06,1.1629389330359659e-05,1.4087406705873715e-05,1.6756153299492116e-05,1.9569815278157086e-05,2.2442346163773166e-05,2.5270795699223548e-05,2.7940791581843473e-05,3.033385623704041e-05,3.233595350864584e-05,3.384642851967433e-05,3.478637342650988e-05,3.510545369288246e-05,3.478637342650988e-05,3.384642851967433e-05,3.233595350864584e-05,3.033385623704041e-05,2.7940791581843473e-05,2.5270795699223548e-05,2.2442346163773166e-05,1.9569815278157086e-05,1.6756153299492116e-05,1.4087406705873715e-05,1.1629389330359659e-05,9.426530924136143e-06,7.502672895080425e-06,5.863396416591999e-06,4.4993692042570814e-06,3.3901829467358433e-06,2.5082092647442977e-06,1.8221055446943789e-06,1.2997278381175497e-06,9.103333250002621e-07,6.260623559717866e-07,4.2276971602210777e-07,2.8032335255145307e-07,1.8587230590938784e-07,2.8032335255145307e-07,4.1511937085648554e-07,6.036091988907752e-07,8.6180265799008e-07,1.2081724769628715e-06,1.6631031110964654e-06,2.247908053428452e-06,2.98336946073534e-06,3.8878067149712654e-06,4.974751831410461e-06,6.250392711301981e-06,7.711028679835817e-06,9.340851359229893e-06,1.1110400983721586e-05,1.2976038774023184e-05,1.4880710413562726e-05,1.6756153299492116e-05,1.8526531282468206e-05,2.0113286155379e-05,2.1440804655500716e-05,2.244234616377317e-05,2.3065589734710556e-05,2.327716035250262e-05,2.3065589734710556e-05,2.244234616377317e-05,2.1440804655500716e-05,2.0113286155379e-05,1.8526531282468206e-05,1.6756153299492116e-05,1.4880710413562726e-05,1.2976038774023184e-05,1.1110400983721586e-05,9.340851359229893e-06,7.711028679835817e-06,6.250392711301981e-06,4.974751831410461e-06,3.8878067149712654e-06,2.98336946073534e-06,2.247908053428452e-06,1.6631031110964654e-06,1.2081724769628715e-06,8.6180265799008e-07,6.036091988907752e-07,4.1511937085648554e-07,2.8032335255145307e-07,1.8587230590938784e-07);
-const float kernel49[2401]=float[](1.6253517087735858e-07,2.415922298635335e-07,3.5309669523927864e-07,5.074338371209183e-07,7.17034868255399e-07,9.962680595927835e-07,1.3610911785683023e-06,1.8284088381836022e-06,2.415096480283747e-06,3.136683782276679e-06,4.0057336838254335e-06,5.030005810337511e-06,6.210548840505597e-06,7.539916852410434e-06,9.000739909002472e-06,1.0564889237215249e-05,1.2193454574181872e-05,1.3837692054236558e-05,1.544100767370253e-05,1.6941922723939227e-05,1.8277838455778248e-05,1.9389296555036418e-05,2.022433973497284e-05,2.074253021811188e-05,2.0918194232073078e-05,2.074253021811188e-05,2.022433973497284e-05,1.9389296555036418e-05,1.8277838455778248e-05,1.6941922723939227e-05,1.544100767370253e-05,1.3837692054236558e-05,1.2193454574181872e-05,1.0564889237215249e-05,9.000739909002472e-06,7.539916852410434e-06,6.210548840505597e-06,5.030005810337511e-06,4.0057336838254335e-06,3.136683782276679e-06,2.415096480283747e-06,1.8284088381836022e-06,1.3610911785683023e-06,9.962680595927835e-07,7.17034868255399e-07,5.074338371209183e-07,3.5309669523927864e-07,2.415922298635335e-07,1.6253517087735858e-07,2.415922298635335e-07,3.5910261893086057e-07,5.248428232475868e-07,7.542495052394164e-07,1.0658004158523825e-06,1.4808525487720444e-06,2.023125524788847e-06,2.7177463556627833e-06,3.58979869315534e-06,4.662365845167162e-06,5.954121361493352e-06,7.476599147041903e-06,9.231357957511094e-06,1.1207330176764969e-05,1.3378697135516516e-05,1.5703648233809006e-05,1.812434726843888e-05,2.0568341371914142e-05,2.2951509233927786e-05,2.5182468920161046e-05,2.7168173668386233e-05,2.8820244658007787e-05,3.0061452593399196e-05,3.083169077409478e-05,3.109279771243053e-05,3.083169077409478e-05,3.0061452593399196e-05,2.8820244658007787e-05,2.7168173668386233e-05,2.5182468920161046e-05,2.2951509233927786e-05,2.0568341371914142e-05,1.812434726843888e-05,1.5703648233809006e-05,1.3378697135516516e-05,1.1207330176764969e-05,9.231357957511094e-06,7.476599147041903e-06,5.954121361493352e-06,4.662365845167162e-06,3.58979869315534e-06,2.7177463556627833e-06,2.023125524788847e-06,1.4808525487720444e-06,1.0658004158523825e-06,7.542495052394164e-07,5.248428232475868e-07,3.5910261893086057e-07,2.415922298635335e-07,3.5309669523927864e-07,5.248428232475868e-07,7.670787529609554e-07,1.1023657831890327e-06,1.5577098851014387e-06,2.164325158153594e-06,2.956878775698573e-06,3.972094869214874e-06,5.2466341978110046e-06,6.814233938131727e-06,8.702186229186485e-06,1.092734833376273e-05,1.3491998435583752e-05,1.6379960771530056e-05,1.9553500325016593e-05,2.2951509233927796e-05,2.6489457576800957e-05,3.00614525933992e-05,3.354454762817247e-05,3.680518433352507e-05,3.970737114936475e-05,4.212193889877277e-05,4.393601388098157e-05,4.506174775207647e-05,4.544336597333498e-05,4.506174775207647e-05,4.393601388098157e-05,4.212193889877277e-05,3.970737114936475e-05,3.680518433352507e-05,3.354454762817247e-05,3.00614525933992e-05,2.6489457576800957e-05,2.2951509233927796e-05,1.9553500325016593e-05,1.6379960771530056e-05,1.3491998435583752e-05,1.092734833376273e-05,8.702186229186485e-06,6.814233938131727e-06,5.2466341978110046e-06,3.972094869214874e-06,2.956878775698573e-06,2.164325158153594e-06,1.5577098851014387e-06,1.1023657831890327e-06,7.670787529609554e-07,5.248428232475868e-07,3.5309669523927864e-07,5.074338371209183e-07,7.542495052394164e-07,1.1023657831890327e-06,1.5842054225269671e-06,2.238578595539003e-06,3.1103429587042095e-06,4.249318567077947e-06,5.708281521944424e-06,7.539916852410437e-06,9.792708119011374e-06,1.250587674468186e-05,1.570364823380901e-05,1.938929655503642e-05,2.353957558440216e-05,2.8100256481711055e-05,3.2983521384690155e-05,3.8067892684011265e-05,4.320119232087407e-05,4.8206734152281176e-05,5.289258201538043e-05,5.7063302987451005e-05,6.0533268565124395e-05,6.314026840810926e-05,6.475805601555082e-05,6.53064780227215e-05,6.475805601555082e-05,6.314026840810926e-05,6.0533268565124395e-05,5.7063302987451005e-05,5.289258201538043e-05,4.8206734152281176e-05,4.320119232087407e-05,3.8067892684011265e-05,3.2983521384690155e-05,2.8100256481711055e-05,2.353957558440216e-05,1.938929655503642e-05,1.570364823380901e-05,1.250587674468186e-05,9.792708119011374e-06,7.539916852410437e-06,5.708281521944424e-06,4.249318567077947e-06,3.1103429587042095e-06,2.238578595539003e-06,1.5842054225269671e-06,1.1023657831890327e-06,7.542495052394164e-07,5.074338371209183e-07,7.17034868255399e-07,1.0658004158523825e-06,1.5577098851014387e-06,2.238578595539003e-06,3.1632476806018967e-06,4.395103736631841e-06,6.0045455309159785e-06,8.06614890381621e-06,1.065436100516977e-05,1.3837692054236552e-05,1.767156430662782e-05,2.2190209873164545e-05,2.7398255070625992e-05,3.3262851712286826e-05,3.970737114936476e-05,4.660772140237608e-05,5.3792247222441774e-05,6.104591175872358e-05,6.811904674710753e-05,7.474043471809056e-05,8.063391706784176e-05,8.55371894332692e-05,8.92210387397376e-05,9.15070710046507e-05,9.22820246496247e-05,9.15070710046507e-05,8.92210387397376e-05,8.55371894332692e-05,8.063391706784176e-05,7.474043471809056e-05,6.811904674710753e-05,6.104591175872358e-05,5.3792247222441774e-05,4.660772140237608e-05,3.970737114936476e-05,3.3262851712286826e-05,2.7398255070625992e-05,2.2190209873164545e-05,1.767156430662782e-05,1.3837692054236552e-05,1.065436100516977e-05,8.06614890381621e-06,6.0045455309159785e-06,4.395103736631841e-06,3.1632476806018967e-06,2.238578595539003e-06,1.5577098851014387e-06,1.0658004158523825e-06,7.17034868255399e-07,9.962680595927835e-07,1.4808525487720444e-06,2.164325158153594e-06,3.1103429587042095e-06,4.395103736631841e-06,6.106678580439071e-06,8.34288148270555e-06,1.1207330176764977e-05,1.4803463589780007e-05,1.922647171351548e-05,2.4553359761386507e-05,3.08316907740948e-05,3.806789268401128e-05,4.621632531281433e-05,5.517051869842626e-05,6.475805601555086e-05,7.474043471809062e-05,8.481887666343328e-05,9.464648586640043e-05,0.00010384642528038248,0.00011203499251019757,0.0001188477346255773,0.0001239661766468379,0.00012714245304504542,0.0001282191950534656,0.00012714245304504542,0.0001239661766468379,0.0001188477346255773,0.00011203499251019757,0.00010384642528038248,9.464648586640043e-05,8.481887666343328e-05,7.474043471809062e-05,6.475805601555086e-05,5.517051869842626e-05,4.621632531281433e-05,3.806789268401128e-05,3.08316907740948e-05,2.4553359761386507e-05,1.922647171351548e-05,1.4803463589780007e-05,1.1207330176764977e-05,8.34288148270555e-06,6.106678580439071e-06,4.395103736631841e-06,3.1103429587042095e-06,2.164325158153594e-06,1.4808525487720444e-06,9.962680595927835e-07,1.3610911785683023e-06,2.023125524788847e-06,2.956878775698573e-06,4.249318567077947e-06,6.0045455309159785e-06,8.34288148270555e-06,1.139795889330508e-05,1.5311339244512337e-05,2.0224339734972842e-05,2.6267007952613948e-05,3.354454762817247e-05,4.212193889877278e-05,5.200796353952275e-05,6.314026840810924e-05,7.537339533715339e-05,8.847179023286707e-05,0.00010210961336925119,0.00011587867712015138,0.00012930505575768663,0.0001418739183837273,0.00015306105473151946,0.0001623685529553351,0.00016936131581275193,0.00017370071196689746,0.0001751717458268544,0.00017370071196689746,0.00016936131581275193,0.0001623685529553351,0.00015306105473151946,0.0001418739183837273,0.00012930505575768663,0.00011587867712015138,0.00010210961336925119,8.847179023286707e-05,7.537339533715339e-05,6.314026840810924e-05,5.200796353952275e-05,4.212193889877278e-05,3.354454762817247e-05,2.6267007952613948e-05,2.0224339734972842e-05,1.5311339244512337e-05,1.139795889330508e-05,8.34288148270555e-06,6.0045455309159785e-06,4.249318567077947e-06,2.956878775698573e-06,2.023125524788847e-06,1.3610911785683023e-06,1.8284088381836022e-06,2.7177463556627833e-06,3.972094869214874e-06,5.708281521944424e-06,8.06614890381621e-06,1.1207330176764977e-05,1.5311339244512337e-05,2.0568341371914145e-05,2.7168173668386246e-05,3.5285534319395503e-05,4.5061747752076486e-05,5.6584104413164406e-05,6.986440121639657e-05,8.481887666343324e-05,0.00010125213091405118,0.00011884773462557731,0.0001371679741134113,0.00015566451442758836,0.00017370071196689749,0.0001905849735602622,0.00020561310635132472,0.00021811624521649866,0.00022750990642975537,0.00023333919281817012,0.000235315292107596,0.00023333919281817012,0.00022750990642975537,0.00021811624521649866,0.00020561310635132472,0.0001905849735602622,0.00017370071196689749,0.00015566451442758836,0.0001371679741134113,0.00011884773462557731,0.00010125213091405118,8.481887666343324e-05,6.986440121639657e-05,5.6584104413164406e-05,4.5061747752076486e-05,3.5285534319395503e-05,2.7168173668386246e-05,2.0568341371914145e-05,1.5311339244512337e-05,1.1207330176764977e-05,8.06614890381621e-06,5.708281521944424e-06,3.972094869214874e-06,2.7177463556627833e-06,1.8284088381836022e-06,2.415096480283747e-06,3.58979869315534e-06,5.2466341978110046e-06,7.539916852410437e-06,1.065436100516977e-05,1.4803463589780007e-05,2.0224339734972842e-05,2.7168173668386246e-05,3.588571616588768e-05,4.660772140237608e-05,5.952086104527231e-05,7.47404347180906e-05,9.228202464962473e-05,0.00011203499251019756,0.00013374123986114697,0.00015698280362124687,0.0001811815194560367,0.00020561310635132483,0.000229436638750217,0.00025173860967420055,0.00027158886955644206,0.0002881039322903208,0.00030051176890724055,0.0003082115178612066,0.0003108216947204066,0.0003082115178612066,0.00030051176890724055,0.0002881039322903208,0.00027158886955644206,0.00025173860967420055,0.000229436638750217,0.00020561310635132483,0.0001811815194560367,0.00015698280362124687,0.00013374123986114697,0.00011203499251019756,9.228202464962473e-05,7.47404347180906e-05,5.952086104527231e-05,4.660772140237608e-05,3.588571616588768e-05,2.7168173668386246e-05,2.0224339734972842e-05,1.4803463589780007e-05,1.065436100516977e-05,7.539916852410437e-06,5.2466341978110046e-06,3.58979869315534e-06,2.415096480283747e-06,3.136683782276679e-06,4.662365845167162e-06,6.814233938131727e-06,9.792708119011374e-06,1.3837692054236552e-05,1.922647171351548e-05,2.6267007952613948e-05,3.5285534319395503e-05,4.660772140237608e-05,6.0533268565124395e-05,7.730462160497805e-05,9.707152959495842e-05,0.00011985423045299057,0.00014550902911048013,0.00017370071196689746,0.0002038864361051272,0.000235315292107596,0.00026704659684649817,0.00029798817136420376,0.0003269535692607907,0.00035273472904256845,0.000374184194876974,0.0003902992694535633,0.0004002995646254852,0.00040368961528804284,0.0004002995646254852,0.0003902992694535633,0.000374184194876974,0.00035273472904256845,0.0003269535692607907,0.00029798817136420376,0.00026704659684649817,0.000235315292107596,0.0002038864361051272,0.00017370071196689746,0.00014550902911048013,0.00011985423045299057,9.707152959495842e-05,7.730462160497805e-05,6.0533268565124395e-05,4.660772140237608e-05,3.5285534319395503e-05,2.6267007952613948e-05,1.922647171351548e-05,1.3837692054236552e-05,9.792708119011374e-06,6.814233938131727e-06,4.662365845167162e-06,3.136683782276679e-06,4.0057336838254335e-06,5.954121361493352e-06,8.702186229186485e-06,1.250587674468186e-05,1.767156430662782e-05,2.4553359761386507e-05,3.354454762817247e-05,4.5061747752076486e-05,5.952086104527231e-05,7.730462160497805e-05,9.872264728377565e-05,0.00012396617664683788,0.0001530610547315195,0.00018582377430010643,0.0002218262474406118,0.00026037523112662606,0.0003005117689072405,0.0003410345518994402,0.00038054880194163184,0.00041753935568356775,0.0004504634460013349,0.0004778557028422772,0.0004984356214855103,0.0005112065993713617,0.0005155358977869724,0.0005112065993713617,0.0004984356214855103,0.0004778557028422772,0.0004504634460013349,0.00041753935568356775,0.00038054880194163184,0.0003410345518994402,0.0003005117689072405,0.00026037523112662606,0.0002218262474406118,0.00018582377430010643,0.0001530610547315195,0.00012396617664683788,9.872264728377565e-05,7.730462160497805e-05,5.952086104527231e-05,4.5061747752076486e-05,3.354454762817247e-05,2.4553359761386507e-05,1.767156430662782e-05,1.250587674468186e-05,8.702186229186485e-06,5.954121361493352e-06,4.0057336838254335e-06,5.030005810337511e-06,7.476599147041903e-06,1.092734833376273e-05,1.570364823380901e-05,2.2190209873164545e-05,3.08316907740948e-05,4.212193889877278e-05,5.6584104413164406e-05,7.47404347180906e-05,9.707152959495842e-05,0.00012396617664683788,0.00015566451442758836,0.00019219899658948032,0.00023333919281817012,0.00027854755247884547,0.00032695356926079085,0.00037735308010658465,0.0004282375996453762,0.0004778557028422773,0.0005243047967999794,0.0005656476265210735,0.0006000441246269125,0.0006258863594139436,0.0006419228955493609,0.0006473592020799563,0.0006419228955493609,0.0006258863594139436,0.0006000441246269125,0.0005656476265210735,0.0005243047967999794,0.0004778557028422773,0.0004282375996453762,0.00037735308010658465,0.00032695356926079085,0.00027854755247884547,0.00023333919281817012,0.00019219899658948032,0.00015566451442758836,0.00012396617664683788,9.707152959495842e-05,7.47404347180906e-05,5.6584104413164406e-05,4.212193889877278e-05,3.08316907740948e-05,2.2190209873164545e-05,1.570364823380901e-05,1.092734833376273e-05,7.476599147041903e-06,5.030005810337511e-06,6.210548840505597e-06,9.231357957511094e-06,1.3491998435583752e-05,1.938929655503642e-05,2.7398255070625992e-05,3.806789268401128e-05,5.200796353952275e-05,6.986440121639657e-05,9.228202464962473e-05,0.00011985423045299057,0.0001530610547315195,0.00019219899658948032,0.00023730812655563155,0.00028810393229032074,0.0003439226999535191,0.000403689615288043,0.0004659178980073409,0.0005287450210241474,0.00059000849961582,0.0006473592020799561,0.0006984051994145661,0.0007408745601834233,0.0007727819708990979,0.0007925822841903581,0.0007992944925840016,0.0007925822841903581,0.0007727819708990979,0.0007408745601834233,0.0006984051994145661,0.0006473592020799561,0.00059000849961582,0.0005287450210241474,0.0004659178980073409,0.000403689615288043,0.0003439226999535191,0.00028810393229032074,0.00023730812655563155,0.00019219899658948032,0.0001530610547315195,0.00011985423045299057,9.228202464962473e-05,6.986440121639657e-05,5.200796353952275e-05,3.806789268401128e-05,2.7398255070625992e-05,1.938929655503642e-05,1.3491998435583752e-05,9.231357957511094e-06,6.210548840505597e-06,7.539916852410434e-06,1.1207330176764969e-05,1.6379960771530056e-05,2.353957558440216e-05,3.3262851712286826e-05,4.621632531281433e-05,6.314026840810924e-05,8.481887666343324e-05,0.00011203499251019756,0.00014550902911048013,0.00018582377430010643,0.00023333919281817012,0.00028810393229032074,0.00034977258050911006,0.0004175393556835678,0.0004900993795591192,0.0005656476265210735,0.0006419228955493609,0.000716299822055108,0.0007859264426826843,0.0008478988360146704,0.000899458763678992,0.0009381959558258155,0.0009622345262809872,0.0009703834829165174,0.0009622345262809872,0.0009381959558258155,0.000899458763678992,0.0008478988360146704,0.0007859264426826843,0.000716299822055108,0.0006419228955493609,0.0005656476265210735,0.0004900993795591192,0.0004175393556835678,0.00034977258050911006,0.00028810393229032074,0.00023333919281817012,0.00018582377430010643,0.00014550902911048013,0.00011203499251019756,8.481887666343324e-05,6.314026840810924e-05,4.621632531281433e-05,3.3262851712286826e-05,2.353957558440216e-05,1.6379960771530056e-05,1.1207330176764969e-05,7.539916852410434e-06,9.000739909002472e-06,1.3378697135516516e-05,1.9553500325016593e-05,2.8100256481711055e-05,3.970737114936476e-05,5.517051869842626e-05,7.537339533715339e-05,0.00010125213091405118,0.00013374123986114697,0.00017370071196689746,0.0002218262474406118,0.00027854755247884547,0.0003439226999535191,0.0004175393556835678,0.0004984356214855103,0.0005850538051444004,0.000675239165911111,0.0007662924058143241,0.0008550795083531548,0.0009381959558258154,0.0010121752058411897,0.0010737246244511814,0.0011199669634773932,0.001148662892714605,0.0011583906709702366,0.001148662892714605,0.0011199669634773932,0.0010737246244511814,0.0010121752058411897,0.0009381959558258154,0.0008550795083531548,0.0007662924058143241,0.000675239165911111,0.0005850538051444004,0.0004984356214855103,0.0004175393556835678,0.0003439226999535191,0.00027854755247884547,0.0002218262474406118,0.00017370071196689746,0.00013374123986114697,0.00010125213091405118,7.537339533715339e-05,5.517051869842626e-05,3.970737114936476e-05,2.8100256481711055e-05,1.9553500325016593e-05,1.3378697135516516e-05,9.000739909002472e-06,1.0564889237215249e-05,1.5703648233809006e-05,2.2951509233927796e-05,3.2983521384690155e-05,4.660772140237608e-05,6.475805601555086e-05,8.847179023286707e-05,0.00011884773462557731,0.00015698280362124687,0.0002038864361051272,0.00026037523112662606,0.00032695356926079085,0.000403689615288043,0.0004900993795591192,0.0005850538051444004,0.0006867245039465793,0.0007925822841903584,0.0008994587636789926,0.0010036752962640318,0.0011012357268749857,0.0011880710970963773,0.0012603165787794075,0.0013145949153185006,0.001348277625519568,0.0013596958978876145,0.001348277625519568,0.0013145949153185006,0.0012603165787794075,0.0011880710970963773,0.0011012357268749857,0.0010036752962640318,0.0008994587636789926,0.0007925822841903584,0.0006867245039465793,0.0005850538051444004,0.0004900993795591192,0.000403689615288043,0.00032695356926079085,0.00026037523112662606,0.0002038864361051272,0.00015698280362124687,0.00011884773462557731,8.847179023286707e-05,6.475805601555086e-05,4.660772140237608e-05,3.2983521384690155e-05,2.2951509233927796e-05,1.5703648233809006e-05,1.0564889237215249e-05,1.2193454574181872e-05,1.812434726843888e-05,2.6489457576800957e-05,3.8067892684011265e-05,5.3792247222441774e-05,7.474043471809062e-05,0.00010210961336925119,0.0001371679741134113,0.0001811815194560367,0.000235315292107596,0.0003005117689072405,0.00037735308010658465,0.0004659178980073409,0.0005656476265210735,0.000675239165911111,0.0007925822841903584,0.0009147579176252505,0.0010381092816038324,0.0011583906709702366,0.0012709899280170477,0.001371210869141263,0.0014545929074487574,0.001517238186172573,0.001556113046812409,0.0015692914325303564,0.001556113046812409,0.001517238186172573,0.0014545929074487574,0.001371210869141263,0.0012709899280170477,0.0011583906709702366,0.0010381092816038324,0.0009147579176252505,0.0007925822841903584,0.000675239165911111,0.0005656476265210735,0.0004659178980073409,0.00037735308010658465,0.0003005117689072405,0.000235315292107596,0.0001811815194560367,0.0001371679741134113,0.00010210961336925119,7.474043471809062e-05,5.3792247222441774e-05,3.8067892684011265e-05,2.6489457576800957e-05,1.812434726843888e-05,1.2193454574181872e-05,1.3837692054236558e-05,2.0568341371914142e-05,3.00614525933992e-05,4.320119232087407e-05,6.104591175872358e-05,8.481887666343328e-05,0.00011587867712015138,0.00015566451442758836,0.00020561310635132483,0.00026704659684649817,0.0003410345518994402,0.0004282375996453762,0.0005287450210241474,0.0006419228955493609,0.0007662924058143241,0.0008994587636789926,0.0010381092816038324,0.0011780940725276295,0.0013145949153185003,0.0014423777216651702,0.0015561130468124092,0.0016507388119665044,0.001721831550317083,0.0017659485269222554,0.0017809039640567838,0.0017659485269222554,0.001721831550317083,0.0016507388119665044,0.0015561130468124092,0.0014423777216651702,0.0013145949153185003,0.0011780940725276295,0.0010381092816038324,0.0008994587636789926,0.0007662924058143241,0.0006419228955493609,0.0005287450210241474,0.0004282375996453762,0.0003410345518994402,0.00026704659684649817,0.00020561310635132483,0.00015566451442758836,0.00011587867712015138,8.481887666343328e-05,6.104591175872358e-05,4.320119232087407e-05,3.00614525933992e-05,2.0568341371914142e-05,1.3837692054236558e-05,1.544100767370253e-05,2.2951509233927786e-05,3.354454762817247e-05,4.8206734152281176e-05,6.811904674710753e-05,9.464648586640043e-05,0.00012930505575768663,0.00017370071196689749,0.000229436638750217,0.00029798817136420376,0.00038054880194163184,0.0004778557028422773,0.00059000849961582,0.000716299822055108,0.0008550795083531548,0.0010036752962640318,0.0011583906709702366,0.0013145949153185003,0.0014669115410057589,0.0016095000077553196,0.0017364133702933951,0.0018420030278856827,0.0019213329850861485,0.001970561611625244,0.001987249872836197,0.001970561611625244,0.0019213329850861485,0.0018420030278856827,0.0017364133702933951,0.0016095000077553196,0.0014669115410057589,0.0013145949153185003,0.0011583906709702366,0.0010036752962640318,0.0008550795083531548,0.000716299822055108,0.00059000849961582,0.0004778557028422773,0.00038054880194163184,0.00029798817136420376,0.000229436638750217,0.00017370071196689749,0.00012930505575768663,9.464648586640043e-05,6.811904674710753e-05,4.8206734152281176e-05,3.354454762817247e-05,2.2951509233927786e-05,1.544100767370253e-05,1.6941922723939227e-05,2.5182468920161046e-05,3.680518433352507e-05,5.289258201538043e-05,7.474043471809056e-05,0.00010384642528038248,0.0001418739183837273,0.0001905849735602622,0.00025173860967420055,0.0003269535692607907,0.00041753935568356775,0.0005243047967999794,0.0006473592020799561,0.0007859264426826843,0.0009381959558258154,0.0011012357268749857,0.0012709899280170477,0.0014423777216651702,0.0016095000077553196,0.0017659485269222546,0.0019051982718995381,0.002021051579998231,0.002108092661317856,0.002162106466909796,0.00218041688018123,0.002162106466909796,0.002108092661317856,0.002021051579998231,0.0019051982718995381,0.0017659485269222546,0.0016095000077553196,0.0014423777216651702,0.0012709899280170477,0.0011012357268749857,0.0009381959558258154,0.0007859264426826843,0.0006473592020799561,0.0005243047967999794,0.00041753935568356775,0.0003269535692607907,0.00025173860967420055,0.0001905849735602622,0.0001418739183837273,0.00010384642528038248,7.474043471809056e-05,5.289258201538043e-05,3.680518433352507e-05,2.5182468920161046e-05,1.6941922723939227e-05,1.8277838455778248e-05,2.7168173668386233e-05,3.970737114936475e-05,5.7063302987451005e-05,8.063391706784176e-05,0.00011203499251019757,0.00015306105473151946,0.00020561310635132472,0.00027158886955644206,0.00035273472904256845,0.0004504634460013349,0.0005656476265210735,0.0006984051994145661,0.0008478988360146704,0.0010121752058411897,0.0011880710970963773,0.001371210869141263,0.0015561130468124092,0.0017364133702933951,0.0019051982718995381,0.002055428230161992,0.00218041688018123,0.0022743213825980875,0.002332594320627505,0.0023523485587554423,0.002332594320627505,0.0022743213825980875,0.00218041688018123,0.002055428230161992,0.0019051982718995381,0.0017364133702933951,0.0015561130468124092,0.001371210869141263,0.0011880710970963773,0.0010121752058411897,0.0008478988360146704,0.0006984051994145661,0.0005656476265210735,0.0004504634460013349,0.00035273472904256845,0.00027158886955644206,0.00020561310635132472,0.00015306105473151946,0.00011203499251019757,8.063391706784176e-05,5.7063302987451005e-05,3.970737114936475e-05,2.7168173668386233e-05,1.8277838455778248e-05,1.9389296555036418e-05,2.8820244658007787e-05,4.212193889877277e-05,6.0533268565124395e-05,8.55371894332692e-05,0.0001188477346255773,0.0001623685529553351,0.00021811624521649866,0.0002881039322903208,0.000374184194876974,0.0004778557028422772,0.0006000441246269125,0.0007408745601834233,0.000899458763678992,0.0010737246244511814,0.0012603165787794075,0.0014545929074487574,0.0016507388119665044,0.0018420030278856827,0.002021051579998231,0.00218041688018123,0.002313005971998623,0.0024126207185464015,0.002474437178918303,0.002495392653615602,0.002474437178918303,0.0024126207185464015,0.002313005971998623,0.00218041688018123,0.002021051579998231,0.0018420030278856827,0.0016507388119665044,0.0014545929074487574,0.0012603165787794075,0.0010737246244511814,0.000899458763678992,0.0007408745601834233,0.0006000441246269125,0.0004778557028422772,0.000374184194876974,0.0002881039322903208,0.00021811624521649866,0.0001623685529553351,0.0001188477346255773,8.55371894332692e-05,6.0533268565124395e-05,4.212193889877277e-05,2.8820244658007787e-05,1.9389296555036418e-05,2.022433973497284e-05,3.0061452593399196e-05,4.393601388098157e-05,6.314026840810926e-05,8.92210387397376e-05,0.0001239661766468379,0.00016936131581275193,0.00022750990642975537,0.00030051176890724055,0.0003902992694535633,0.0004984356214855103,0.0006258863594139436,0.0007727819708990979,0.0009381959558258155,0.0011199669634773932,0.0013145949153185006,0.001517238186172573,0.001721831550317083,0.0019213329850861485,0.002108092661317856,0.0022743213825980875,0.0024126207185464015,0.0025165255957077227,0.0025810043194317185,0.0026028622882539923,0.0025810043194317185,0.0025165255957077227,0.0024126207185464015,0.0022743213825980875,0.002108092661317856,0.0019213329850861485,0.001721831550317083,0.001517238186172573,0.0013145949153185006,0.0011199669634773932,0.0009381959558258155,0.0007727819708990979,0.0006258863594139436,0.0004984356214855103,0.0003902992694535633,0.00030051176890724055,0.00022750990642975537,0.00016936131581275193,0.0001239661766468379,8.92210387397376e-05,6.314026840810926e-05,4.393601388098157e-05,3.0061452593399196e-05,2.022433973497284e-05,2.074253021811188e-05,3.083169077409478e-05,4.506174775207647e-05,6.475805601555082e-05,9.15070710046507e-05,0.00012714245304504542,0.00017370071196689746,0.00023333919281817012,0.0003082115178612066,0.0004002995646254852,0.0005112065993713617,0.0006419228955493609,0.0007925822841903581,0.0009622345262809872,0.001148662892714605,0.001348277625519568,0.001556113046812409,0.0017659485269222554,0.001970561611625244,0.002162106466909796,0.002332594320627505,0.002474437178918303,0.0025810043194317185,0.0026471351248274315,0.0026695531411752554,0.0026471351248274315,0.0025810043194317185,0.002474437178918303,0.002332594320627505,0.002162106466909796,0.001970561611625244,0.0017659485269222554,0.001556113046812409,0.001348277625519568,0.001148662892714605,0.0009622345262809872,0.0007925822841903581,0.0006419228955493609,0.0005112065993713617,0.0004002995646254852,0.0003082115178612066,0.00023333919281817012,0.00017370071196689746,0.00012714245304504542,9.15070710046507e-05,6.475805601555082e-05,4.506174775207647e-05,3.083169077409478e-05,2.074253021811188e-05,2.0918194232073078e-05,3.109279771243053e-05,4.544336597333498e-05,6.53064780227215e-05,9.22820246496247e-05,0.0001282191950534656,0.0001751717458268544,0.000235315292107596,0.0003108216947204066,0.00040368961528804284,0.0005155358977869724,0.0006473592020799563,0.0007992944925840016,0.0009703834829165174,0.0011583906709702366,0.0013596958978876145,0.0015692914325303564,0.0017809039640567838,0.001987249872836197,0.00218041688018123,0.0023523485587554423,0.002495392653615602,0.0026028622882539923,0.0026695531411752554,0.002692161010867647,0.0026695531411752554,0.0026028622882539923,0.002495392653615602,0.0023523485587554423,0.00218041688018123,0.001987249872836197,0.0017809039640567838,0.0015692914325303564,0.0013596958978876145,0.0011583906709702366,0.0009703834829165174,0.0007992944925840016,0.0006473592020799563,0.0005155358977869724,0.00040368961528804284,0.0003108216947204066,0.000235315292107596,0.0001751717458268544,0.0001282191950534656,9.22820246496247e-05,6.53064780227215e-05,4.544336597333498e-05,3.109279771243053e-05,2.0918194232073078e-05,2.074253021811188e-05,3.083169077409478e-05,4.506174775207647e-05,6.475805601555082e-05,9.15070710046507e-05,0.00012714245304504542,0.00017370071196689746,0.00023333919281817012,0.0003082115178612066,0.0004002995646254852,0.0005112065993713617,0.0006419228955493609,0.0007925822841903581,0.0009622345262809872,0.001148662892714605,0.001348277625519568,0.001556113046812409,0.0017659485269222554,0.001970561611625244,0.002162106466909796,0.002332594320627505,0.002474437178918303,0.0025810043194317185,0.0026471351248274315,0.0026695531411752554,0.0026471351248274315,0.0025810043194317185,0.002474437178918303,0.002332594320627505,0.002162106466909796,0.001970561611625244,0.0017659485269222554,0.001556113046812409,0.001348277625519568,0.001148662892714605,0.0009622345262809872,0.0007925822841903581,0.0006419228955493609,0.0005112065993713617,0.0004002995646254852,0.0003082115178612066,0.00023333919281817012,0.00017370071196689746,0.00012714245304504542,9.15070710046507e-05,6.475805601555082e-05,4.506174775207647e-05,3.083169077409478e-05,2.074253021811188e-05,2.022433973497284e-05,3.0061452593399196e-05,4.393601388098157e-05,6.314026840810926e-05,8.92210387397376e-05,0.0001239661766468379,0.00016936131581275193,0.00022750990642975537,0.00030051176890724055,0.0003902992694535633,0.0004984356214855103,0.0006258863594139436,0.0007727819708990979,0.0009381959558258155,0.0011199669634773932,0.0013145949153185006,0.001517238186172573,0.001721831550317083,0.0019213329850861485,0.002108092661317856,0.0022743213825980875,0.0024126207185464015,0.0025165255957077227,0.0025810043194317185,0.0026028622882539923,0.0025810043194317185,0.0025165255957077227,0.0024126207185464015,0.0022743213825980875,0.002108092661317856,0.0019213329850861485,0.001721831550317083,0.001517238186172573,0.0013145949153185006,0.0011199669634773932,0.0009381959558258155,0.0007727819708990979,0.0006258863594139436,0.0004984356214855103,0.0003902992694535633,0.00030051176890724055,0.00022750990642975537,0.00016936131581275193,0.0001239661766468379,8.92210387397376e-05,6.314026840810926e-05,4.393601388098157e-05,3.0061452593399196e-05,2.022433973497284e-05,1.9389296555036418e-05,2.8820244658007787e-05,4.212193889877277e-05,6.0533268565124395e-05,8.55371894332692e-05,0.0001188477346255773,0.0001623685529553351,0.00021811624521649866,0.0002881039322903208,0.000374184194876974,0.0004778557028422772,0.0006000441246269125,0.0007408745601834233,0.000899458763678992,0.0010737246244511814,0.0012603165787794075,0.0014545929074487574,0.0016507388119665044,0.0018420030278856827,0.002021051579998231,0.00218041688018123,0.002313005971998623,0.0024126207185464015,0.002474437178918303,0.002495392653615602,0.002474437178918303,0.0024126207185464015,0.002313005971998623,0.00218041688018123,0.002021051579998231,0.0018420030278856827,0.0016507388119665044,0.0014545929074487574,0.0012603165787794075,0.0010737246244511814,0.000899458763678992,0.0007408745601834233,0.0006000441246269125,0.0004778557028422772,0.000374184194876974,0.0002881039322903208,0.00021811624521649866,0.0001623685529553351,0.0001188477346255773,8.55371894332692e-05,6.0533268565124395e-05,4.212193889877277e-05,2.8820244658007787e-05,1.9389296555036418e-05,1.8277838455778248e-05,2.7168173668386233e-05,3.970737114936475e-05,5.7063302987451005e-05,8.063391706784176e-05,0.00011203499251019757,0.00015306105473151946,0.00020561310635132472,0.00027158886955644206,0.00035273472904256845,0.0004504634460013349,0.0005656476265210735,0.0006984051994145661,0.0008478988360146704,0.0010121752058411897,0.0011880710970963773,0.001371210869141263,0.0015561130468124092,0.0017364133702933951,0.0019051982718995381,0.002055428230161992,0.00218041688018123,0.0022743213825980875,0.002332594320627505,0.0023523485587554423,0.002332594320627505,0.0022743213825980875,0.00218041688018123,0.002055428230161992,0.0019051982718995381,0.0017364133702933951,0.0015561130468124092,0.001371210869141263,0.0011880710970963773,0.0010121752058411897,0.0008478988360146704,0.0006984051994145661,0.0005656476265210735,0.0004504634460013349,0.00035273472904256845,0.00027158886955644206,0.00020561310635132472,0.00015306105473151946,0.00011203499251019757,8.063391706784176e-05,5.7063302987451005e-05,3.970737114936475e-05,2.7168173668386233e-05,1.8277838455778248e-05,1.6941922723939227e-05,2.5182468920161046e-05,3.680518433352507e-05,5.289258201538043e-05,7.474043471809056e-05,0.00010384642528038248,0.0001418739183837273,0.0001905849735602622,0.00025173860967420055,0.0003269535692607907,0.00041753935568356775,0.0005243047967999794,0.0006473592020799561,0.0007859264426826843,0.0009381959558258154,0.0011012357268749857,0.0012709899280170477,0.0014423777216651702,0.0016095000077553196,0.0017659485269222546,0.0019051982718995381,0.002021051579998231,0.002108092661317856,0.002162106466909796,0.00218041688018123,0.002162106466909796,0.002108092661317856,0.002021051579998231,0.0019051982718995381,0.0017659485269222546,0.0016095000077553196,0.0014423777216651702,0.0012709899280170477,0.0011012357268749857,0.0009381959558258154,0.0007859264426826843,0.0006473592020799561,0.0005243047967999794,0.00041753935568356775,0.0003269535692607907,0.00025173860967420055,0.0001905849735602622,0.0001418739183837273,0.00010384642528038248,7.474043471809056e-05,5.289258201538043e-05,3.680518433352507e-05,2.5182468920161046e-05,1.6941922723939227e-05,1.544100767370253e-05,2.2951509233927786e-05,3.354454762817247e-05,4.8206734152281176e-05,6.811904674710753e-05,9.464648586640043e-05,0.00012930505575768663,0.00017370071196689749,0.000229436638750217,0.00029798817136420376,0.00038054880194163184,0.0004778557028422773,0.00059000849961582,0.000716299822055108,0.0008550795083531548,0.0010036752962640318,0.0011583906709702366,0.0013145949153185003,0.0014669115410057589,0.0016095000077553196,0.0017364133702933951,0.0018420030278856827,0.0019213329850861485,0.001970561611625244,0.001987249872836197,0.001970561611625244,0.0019213329850861485,0.0018420030278856827,0.0017364133702933951,0.0016095000077553196,0.0014669115410057589,0.0013145949153185003,0.0011583906709702366,0.0010036752962640318,0.0008550795083531548,0.000716299822055108,0.00059000849961582,0.0004778557028422773,0.00038054880194163184,0.00029798817136420376,0.000229436638750217,0.00017370071196689749,0.00012930505575768663,9.464648586640043e-05,6.811904674710753e-05,4.8206734152281176e-05,3.354454762817247e-05,2.2951509233927786e-05,1.544100767370253e-05,1.3837692054236558e-05,2.0568341371914142e-05,3.00614525933992e-05,4.320119232087407e-05,6.104591175872358e-05,8.481887666343328e-05,0.00011587867712015138,0.00015566451442758836,0.00020561310635132483,0.00026704659684649817,0.0003410345518994402,0.0004282375996453762,0.0005287450210241474,0.0006419228955493609,0.0007662924058143241,0.0008994587636789926,0.0010381092816038324,0.0011780940725276295,0.0013145949153185003,0.0014423777216651702,0.0015561130468124092,0.0016507388119665044,0.001721831550317083,0.0017659485269222554,0.0017809039640567838,0.0017659485269222554,0.001721831550317083,0.0016507388119665044,0.0015561130468124092,0.0014423777216651702,0.0013145949153185003,0.0011780940725276295,0.0010381092816038324,0.0008994587636789926,0.0007662924058143241,0.0006419228955493609,0.0005287450210241474,0.0004282375996453762,0.0003410345518994402,0.00026704659684649817,0.00020561310635132483,0.00015566451442758836,0.00011587867712015138,8.481887666343328e-05,6.104591175872358e-05,4.320119232087407e-05,3.00614525933992e-05,2.0568341371914142e-05,1.3837692054236558e-05,1.2193454574181872e-05,1.812434726843888e-05,2.6489457576800957e-05,3.8067892684011265e-05,5.3792247222441774e-05,7.474043471809062e-05,0.00010210961336925119,0.0001371679741134113,0.0001811815194560367,0.000235315292107596,0.0003005117689072405,0.00037735308010658465,0.0004659178980073409,0.0005656476265210735,0.000675239165911111,0.0007925822841903584,0.0009147579176252505,0.0010381092816038324,0.0011583906709702366,0.0012709899280170477,0.001371210869141263,0.0014545929074487574,0.001517238186172573,0.001556113046812409,0.0015692914325303564,0.001556113046812409,0.001517238186172573,0.0014545929074487574,0.001371210869141263,0.0012709899280170477,0.0011583906709702366,0.0010381092816038324,0.0009147579176252505,0.0007925822841903584,0.000675239165911111,0.0005656476265210735,0.0004659178980073409,0.00037735308010658465,0.0003005117689072405,0.000235315292107596,0.0001811815194560367,0.0001371679741134113,0.00010210961336925119,7.474043471809062e-05,5.3792247222441774e-05,3.8067892684011265e-05,2.6489457576800957e-05,1.812434726843888e-05,1.2193454574181872e-05,1.0564889237215249e-05,1.5703648233809006e-05,2.2951509233927796e-05,3.2983521384690155e-05,4.660772140237608e-05,6.475805601555086e-05,8.847179023286707e-05,0.00011884773462557731,0.00015698280362124687,0.0002038864361051272,0.00026037523112662606,0.00032695356926079085,0.000403689615288043,0.0004900993795591192,0.0005850538051444004,0.0006867245039465793,0.0007925822841903584,0.0008994587636789926,0.0010036752962640318,0.0011012357268749857,0.0011880710970963773,0.0012603165787794075,0.0013145949153185006,0.001348277625519568,0.0013596958978876145,0.001348277625519568,0.0013145949153185006,0.0012603165787794075,0.0011880710970963773,0.0011012357268749857,0.0010036752962640318,0.0008994587636789926,0.0007925822841903584,0.0006867245039465793,0.0005850538051444004,0.0004900993795591192,0.000403689615288043,0.00032695356926079085,0.00026037523112662606,0.0002038864361051272,0.00015698280362124687,0.00011884773462557731,8.847179023286707e-05,6.475805601555086e-05,4.660772140237608e-05,3.2983521384690155e-05,2.2951509233927796e-05,1.5703648233809006e-05,1.0564889237215249e-05,9.000739909002472e-06,1.3378697135516516e-05,1.9553500325016593e-05,2.8100256481711055e-05,3.970737114936476e-05,5.517051869842626e-05,7.537339533715339e-05,0.00010125213091405118,0.00013374123986114697,0.00017370071196689746,0.0002218262474406118,0.00027854755247884547,0.0003439226999535191,0.0004175393556835678,0.0004984356214855103,0.0005850538051444004,0.000675239165911111,0.0007662924058143241,0.0008550795083531548,0.0009381959558258154,0.0010121752058411897,0.0010737246244511814,0.0011199669634773932,0.001148662892714605,0.0011583906709702366,0.001148662892714605,0.0011199669634773932,0.0010737246244511814,0.0010121752058411897,0.0009381959558258154,0.0008550795083531548,0.0007662924058143241,0.000675239165911111,0.0005850538051444004,0.0004984356214855103,0.0004175393556835678,0.0003439226999535191,0.00027854755247884547,0.0002218262474406118,0.00017370071196689746,0.00013374123986114697,0.00010125213091405118,7.537339533715339e-05,5.517051869842626e-05,3.970737114936476e-05,2.8100256481711055e-05,1.9553500325016593e-05,1.3378697135516516e-05,9.000739909002472e-06,7.539916852410434e-06,1.1207330176764969e-05,1.6379960771530056e-05,2.353957558440216e-05,3.3262851712286826e-05,4.621632531281433e-05,6.314026840810924e-05,8.481887666343324e-05,0.00011203499251019756,0.00014550902911048013,0.00018582377430010643,0.00023333919281817012,0.00028810393229032074,0.00034977258050911006,0.0004175393556835678,0.0004900993795591192,0.0005656476265210735,0.0006419228955493609,0.000716299822055108,0.0007859264426826843,0.0008478988360146704,0.000899458763678992,0.0009381959558258155,0.0009622345262809872,0.0009703834829165174,0.0009622345262809872,0.0009381959558258155,0.000899458763678992,0.0008478988360146704,0.0007859264426826843,0.000716299822055108,0.0006419228955493609,0.0005656476265210735,0.0004900993795591192,0.0004175393556835678,0.00034977258050911006,0.00028810393229032074,0.00023333919281817012,0.00018582377430010643,0.00014550902911048013,0.00011203499251019756,8.481887666343324e-05,6.314026840810924e-05,4.621632531281433e-05,3.3262851712286826e-05,2.353957558440216e-05,1.6379960771530056e-05,1.1207330176764969e-05,7.539916852410434e-06,6.210548840505597e-06,9.231357957511094e-06,1.3491998435583752e-05,1.938929655503642e-05,2.7398255070625992e-05,3.806789268401128e-05,5.200796353952275e-05,6.986440121639657e-05,9.228202464962473e-05,0.00011985423045299057,0.0001530610547315195,0.00019219899658948032,0.00023730812655563155,0.00028810393229032074,0.0003439226999535191,0.000403689615288043,0.0004659178980073409,0.0005287450210241474,0.00059000849961582,0.0006473592020799561,0.0006984051994145661,0.0007408745601834233,0.0007727819708990979,0.0007925822841903581,0.0007992944925840016,0.0007925822841903581,0.0007727819708990979,0.0007408745601834233,0.0006984051994145661,0.0006473592020799561,0.00059000849961582,0.0005287450210241474,0.0004659178980073409,0.000403689615288043,0.0003439226999535191,0.00028810393229032074,0.00023730812655563155,0.00019219899658948032,0.0001530610547315195,0.00011985423045299057,9.228202464962473e-05,6.986440121639657e-05,5.200796353952275e-05,3.806789268401128e-05,2.7398255070625992e-05,1.938929655503642e-05,1.3491998435583752e-05,9.231357957511094e-06,6.210548840505597e-06,5.030005810337511e-06,7.476599147041903e-06,1.092734833376273e-05,1.570364823380901e-05,2.2190209873164545e-05,3.08316907740948e-05,4.212193889877278e-05,5.6584104413164406e-05,7.47404347180906e-05,9.707152959495842e-05,0.00012396617664683788,0.00015566451442758836,0.00019219899658948032,0.00023333919281817012,0.00027854755247884547,0.00032695356926079085,0.00037735308010658465,0.0004282375996453762,0.0004778557028422773,0.0005243047967999794,0.0005656476265210735,0.0006000441246269125,0.0006258863594139436,0.0006419228955493609,0.0006473592020799563,0.0006419228955493609,0.0006258863594139436,0.0006000441246269125,0.0005656476265210735,0.0005243047967999794,0.0004778557028422773,0.0004282375996453762,0.00037735308010658465,0.00032695356926079085,0.00027854755247884547,0.00023333919281817012,0.00019219899658948032,0.00015566451442758836,0.00012396617664683788,9.707152959495842e-05,7.47404347180906e-05,5.6584104413164406e-05,4.212193889877278e-05,3.08316907740948e-05,2.2190209873164545e-05,1.570364823380901e-05,1.092734833376273e-05,7.476599147041903e-06,5.030005810337511e-06,4.0057336838254335e-06,5.954121361493352e-06,8.702186229186485e-06,1.250587674468186e-05,1.767156430662782e-05,2.4553359761386507e-05,3.354454762817247e-05,4.5061747752076486e-05,5.952086104527231e-05,7.730462160497805e-05,9.872264728377565e-05,0.00012396617664683788,0.0001530610547315195,0.00018582377430010643,0.0002218262474406118,0.00026037523112662606,0.0003005117689072405,0.0003410345518994402,0.00038054880194163184,0.00041753935568356775,0.0004504634460013349,0.0004778557028422772,0.0004984356214855103,0.0005112065993713617,0.0005155358977869724,0.0005112065993713617,0.0004984356214855103,0.0004778557028422772,0.0004504634460013349,0.00041753935568356775,0.00038054880194163184,0.0003410345518994402,0.0003005117689072405,0.00026037523112662606,0.0002218262474406118,0.00018582377430010643,0.0001530610547315195,0.00012396617664683788,9.872264728377565e-05,7.730462160497805e-05,5.952086104527231e-05,4.5061747752076486e-05,3.354454762817247e-05,2.4553359761386507e-05,1.767156430662782e-05,1.250587674468186e-05,8.702186229186485e-06,5.954121361493352e-06,4.0057336838254335e-06,3.136683782276679e-06,4.662365845167162e-06,6.814233938131727e-06,9.792708119011374e-06,1.3837692054236552e-05,1.922647171351548e-05,2.6267007952613948e-05,3.5285534319395503e-05,4.660772140237608e-05,6.0533268565124395e-05,7.730462160497805e-05,9.707152959495842e-05,0.00011985423045299057,0.00014550902911048013,0.00017370071196689746,0.0002038864361051272,0.000235315292107596,0.00026704659684649817,0.00029798817136420376,0.0003269535692607907,0.00035273472904256845,0.000374184194876974,0.0003902992694535633,0.0004002995646254852,0.00040368961528804284,0.0004002995646254852,0.0003902992694535633,0.000374184194876974,0.00035273472904256845,0.0003269535692607907,0.00029798817136420376,0.00026704659684649817,0.000235315292107596,0.0002038864361051272,0.00017370071196689746,0.00014550902911048013,0.00011985423045299057,9.707152959495842e-05,7.730462160497805e-05,6.0533268565124395e-05,4.660772140237608e-05,3.5285534319395503e-05,2.6267007952613948e-05,1.922647171351548e-05,1.3837692054236552e-05,9.792708119011374e-06,6.814233938131727e-06,4.662365845167162e-06,3.136683782276679e-06,2.415096480283747e-06,3.58979869315534e-06,5.2466341978110046e-06,7.539916852410437e-06,1.065436100516977e-05,1.4803463589780007e-05,2.0224339734972842e-05,2.7168173668386246e-05,3.588571616588768e-05,4.660772140237608e-05,5.952086104527231e-05,7.47404347180906e-05,9.228202464962473e-05,0.00011203499251019756,0.00013374123986114697,0.00015698280362124687,0.0001811815194560367,0.00020561310635132483,0.000229436638750217,0.00025173860967420055,0.00027158886955644206,0.0002881039322903208,0.00030051176890724055,0.0003082115178612066,0.0003108216947204066,0.0003082115178612066,0.00030051176890724055,0.0002881039322903208,0.00027158886955644206,0.00025173860967420055,0.000229436638750217,0.00020561310635132483,0.0001811815194560367,0.00015698280362124687,0.00013374123986114697,0.00011203499251019756,9.228202464962473e-05,7.47404347180906e-05,5.952086104527231e-05,4.660772140237608e-05,3.588571616588768e-05,2.7168173668386246e-05,2.0224339734972842e-05,1.4803463589780007e-05,1.065436100516977e-05,7.539916852410437e-06,5.2466341978110046e-06,3.58979869315534e-06,2.415096480283747e-06,1.8284088381836022e-06,2.7177463556627833e-06,3.972094869214874e-06,5.708281521944424e-06,8.06614890381621e-06,1.1207330176764977e-05,1.5311339244512337e-05,2.0568341371914145e-05,2.7168173668386246e-05,3.5285534319395503e-05,4.5061747752076486e-05,5.6584104413164406e-05,6.986440121639657e-05,8.481887666343324e-05,0.00010125213091405118,0.00011884773462557731,0.0001371679741134113,0.00015566451442758836,0.00017370071196689749,0.0001905849735602622,0.00020561310635132472,0.00021811624521649866,0.00022750990642975537,0.00023333919281817012,0.000235315292107596,0.00023333919281817012,0.00022750990642975537,0.00021811624521649866,0.00020561310635132472,0.0001905849735602622,0.00017370071196689749,0.00015566451442758836,0.0001371679741134113,0.00011884773462557731,0.00010125213091405118,8.481887666343324e-05,6.986440121639657e-05,5.6584104413164406e-05,4.5061747752076486e-05,3.5285534319395503e-05,2.7168173668386246e-05,2.0568341371914145e-05,1.5311339244512337e-05,1.1207330176764977e-05,8.06614890381621e-06,5.708281521944424e-06,3.972094869214874e-06,2.7177463556627833e-06,1.8284088381836022e-06,1.3610911785683023e-06,2.023125524788847e-06,2.956878775698573e-06,4.249318567077947e-06,6.0045455309159785e-06,8.34288148270555e-06,1.139795889330508e-05,1.5311339244512337e-05,2.0224339734972842e-05,2.6267007952613948e-05,3.354454762817247e-05,4.212193889877278e-05,5.200796353952275e-05,6.314026840810924e-05,7.537339533715339e-05,8.847179023286707e-05,0.00010210961336925119,0.00011587867712015138,0.00012930505575768663,0.0001418739183837273,0.00015306105473151946,0.0001623685529553351,0.00016936131581275193,0.00017370071196689746,0.0001751717458268544,0.00017370071196689746,0.00016936131581275193,0.0001623685529553351,0.00015306105473151946,0.0001418739183837273,0.00012930505575768663,0.00011587867712015138,0.00010210961336925119,8.847179023286707e-05,7.537339533715339e-05,6.314026840810924e-05,5.200796353952275e-05,4.212193889877278e-05,3.354454762817247e-05,2.6267007952613948e-05,2.0224339734972842e-05,1.5311339244512337e-05,1.139795889330508e-05,8.34288148270555e-06,6.0045455309159785e-06,4.249318567077947e-06,2.956878775698573e-06,2.023125524788847e-06,1.3610911785683023e-06,9.962680595927835e-07,1.4808525487720444e-06,2.164325158153594e-06,3.1103429587042095e-06,4.395103736631841e-06,6.106678580439071e-06,8.34288148270555e-06,1.1207330176764977e-05,1.4803463589780007e-05,1.922647171351548e-05,2.4553359761386507e-05,3.08316907740948e-05,3.806789268401128e-05,4.621632531281433e-05,5.517051869842626e-05,6.475805601555086e-05,7.474043471809062e-05,8.481887666343328e-05,9.464648586640043e-05,0.00010384642528038248,0.00011203499251019757,0.0001188477346255773,0.0001239661766468379,0.00012714245304504542,0.0001282191950534656,0.00012714245304504542,0.0001239661766468379,0.0001188477346255773,0.00011203499251019757,0.00010384642528038248,9.464648586640043e-05,8.481887666343328e-05,7.474043471809062e-05,6.475805601555086e-05,5.517051869842626e-05,4.621632531281433e-05,3.806789268401128e-05,3.08316907740948e-05,2.4553359761386507e-05,1.922647171351548e-05,1.4803463589780007e-05,1.1207330176764977e-05,8.34288148270555e-06,6.106678580439071e-06,4.395103736631841e-06,3.1103429587042095e-06,2.164325158153594e-06,1.4808525487720444e-06,9.962680595927835e-07,7.17034868255399e-07,1.0658004158523825e-06,1.5577098851014387e-06,2.238578595539003e-06,3.1632476806018967e-06,4.395103736631841e-06,6.0045455309159785e-06,8.06614890381621e-06,1.065436100516977e-05,1.3837692054236552e-05,1.767156430662782e-05,2.2190209873164545e-05,2.7398255070625992e-05,3.3262851712286826e-05,3.970737114936476e-05,4.660772140237608e-05,5.3792247222441774e-05,6.104591175872358e-05,6.811904674710753e-05,7.474043471809056e-05,8.063391706784176e-05,8.55371894332692e-05,8.92210387397376e-05,9.15070710046507e-05,9.22820246496247e-05,9.15070710046507e-05,8.92210387397376e-05,8.55371894332692e-05,8.063391706784176e-05,7.474043471809056e-05,6.811904674710753e-05,6.104591175872358e-05,5.3792247222441774e-05,4.660772140237608e-05,3.970737114936476e-05,3.3262851712286826e-05,2.7398255070625992e-05,2.2190209873164545e-05,1.767156430662782e-05,1.3837692054236552e-05,1.065436100516977e-05,8.06614890381621e-06,6.0045455309159785e-06,4.395103736631841e-06,3.1632476806018967e-06,2.238578595539003e-06,1.5577098851014387e-06,1.0658004158523825e-06,7.17034868255399e-07,5.074338371209183e-07,7.542495052394164e-07,1.1023657831890327e-06,1.5842054225269671e-06,2.238578595539003e-06,3.1103429587042095e-06,4.249318567077947e-06,5.708281521944424e-06,7.539916852410437e-06,9.792708119011374e-06,1.250587674468186e-05,1.570364823380901e-05,1.938929655503642e-05,2.353957558440216e-05,2.8100256481711055e-05,3.2983521384690155e-05,3.8067892684011265e-05,4.320119232087407e-05,4.8206734152281176e-05,5.289258201538043e-05,5.7063302987451005e-05,6.0533268565124395e-05,6.314026840810926e-05,6.475805601555082e-05,6.53064780227215e-05,6.475805601555082e-05,6.314026840810926e-05,6.0533268565124395e-05,5.7063302987451005e-05,5.289258201538043e-05,4.8206734152281176e-05,4.320119232087407e-05,3.8067892684011265e-05,3.2983521384690155e-05,2.8100256481711055e-05,2.353957558440216e-05,1.938929655503642e-05,1.570364823380901e-05,1.250587674468186e-05,9.792708119011374e-06,7.539916852410437e-06,5.708281521944424e-06,4.249318567077947e-06,3.1103429587042095e-06,2.238578595539003e-06,1.5842054225269671e-06,1.1023657831890327e-06,7.542495052394164e-07,5.074338371209183e-07,3.5309669523927864e-07,5.248428232475868e-07,7.670787529609554e-07,1.1023657831890327e-06,1.5577098851014387e-06,2.164325158153594e-06,2.956878775698573e-06,3.972094869214874e-06,5.2466341978110046e-06,6.814233938131727e-06,8.702186229186485e-06,1.092734833376273e-05,1.3491998435583752e-05,1.6379960771530056e-05,1.9553500325016593e-05,2.2951509233927796e-05,2.6489457576800957e-05,3.00614525933992e-05,3.354454762817247e-05,3.680518433352507e-05,3.970737114936475e-05,4.212193889877277e-05,4.393601388098157e-05,4.506174775207647e-05,4.544336597333498e-05,4.506174775207647e-05,4.393601388098157e-05,4.212193889877277e-05,3.970737114936475e-05,3.680518433352507e-05,3.354454762817247e-05,3.00614525933992e-05,2.6489457576800957e-05,2.2951509233927796e-05,1.9553500325016593e-05,1.6379960771530056e-05,1.3491998435583752e-05,1.092734833376273e-05,8.702186229186485e-06,6.814233938131727e-06,5.2466341978110046e-06,3.972094869214874e-06,2.956878775698573e-06,2.164325158153594e-06,1.5577098851014387e-06,1.1023657831890327e-06,7.670787529609554e-07,5.248428232475868e-07,3.5309669523927864e-07,2.415922298635335e-07,3.5910261893086057e-07,5.248428232475868e-07,7.542495052394164e-07,1.0658004158523825e-06,1.4808525487720444e-06,2.023125524788847e-06,2.7177463556627833e-06,3.58979869315534e-06,4.662365845167162e-06,5.954121361493352e-06,7.476599147041903e-06,9.231357957511094e-06,1.1207330176764969e-05,1.3378697135516516e-05,1.5703648233809006e-05,1.812434726843888e-05,2.0568341371914142e-05,2.2951509233927786e-05,2.5182468920161046e-05,2.7168173668386233e-05,2.8820244658007787e-05,3.0061452593399196e-05,3.083169077409478e-05,3.109279771243053e-05,3.083169077409478e-05,3.0061452593399196e-05,2.8820244658007787e-05,2.7168173668386233e-05,2.5182468920161046e-05,2.2951509233927786e-05,2.0568341371914142e-05,1.812434726843888e-05,1.5703648233809006e-05,1.3378697135516516e-05,1.1207330176764969e-05,9.231357957511094e-06,7.476599147041903e-06,5.954121361493352e-06,4.662365845167162e-06,3.58979869315534e-06,2.7177463556627833e-06,2.023125524788847e-06,1.4808525487720444e-06,1.0658004158523825e-06,7.542495052394164e-07,5.248428232475868e-07,3.5910261893086057e-07,2.415922298635335e-07,1.6253517087735858e-07,2.415922298635335e-07,3.5309669523927864e-07,5.074338371209183e-07,7.17034868255399e-07,9.962680595927835e-07,1.3610911785683023e-06,1.8284088381836022e-06,2.415096480283747e-06,3.136683782276679e-06,4.0057336838254335e-06,5.030005810337511e-06,6.210548840505597e-06,7.539916852410434e-06,9.000739909002472e-06,1.0564889237215249e-05,1.2193454574181872e-05,1.3837692054236558e-05,1.544100767370253e-05,1.6941922723939227e-05,1.8277838455778248e-05,1.9389296555036418e-05,2.022433973497284e-05,2.074253021811188e-05,2.0918194232073078e-05,2.074253021811188e-05,2.022433973497284e-05,1.9389296555036418e-05,1.8277838455778248e-05,1.6941922723939227e-05,1.544100767370253e-05,1.3837692054236558e-05,1.2193454574181872e-05,1.0564889237215249e-05,9.000739909002472e-06,7.539916852410434e-06,6.210548840505597e-06,5.030005810337511e-06,4.0057336838254335e-06,3.136683782276679e-06,2.415096480283747e-06,1.8284088381836022e-06,1.3610911785683023e-06,9.962680595927835e-07,7.17034868255399e-07,5.074338371209183e-07,3.5309669523927864e-07,2.415922298635335e-07,1.6253517087735858e-07);
-const float kernel51[2601]=float[](1.4312700167302365e-07,2.098818723227657e-07,3.0299986491951354e-07,4.30649640176529e-07,6.025871846438092e-07,8.300989077867598e-07,1.125781071711261e-06,1.503114938723624e-06,1.9758073126246034e-06,2.5568846420332317e-06,3.257555543129043e-06,4.0858900240177576e-06,5.045400724681831e-06,6.133647397297426e-06,7.341014737720513e-06,8.649829248723157e-06,1.0033977470232404e-05,1.145916195431559e-05,1.2883882102250574e-05,1.4261157470293979e-05,1.554092832170822e-05,1.6672982262248714e-05,1.7610178886966095e-05,1.831168866324372e-05,1.8745937845727687e-05,1.8892964058477764e-05,1.8745937845727687e-05,1.831168866324372e-05,1.7610178886966095e-05,1.6672982262248714e-05,1.554092832170822e-05,1.4261157470293979e-05,1.2883882102250574e-05,1.145916195431559e-05,1.0033977470232404e-05,8.649829248723157e-06,7.341014737720513e-06,6.133647397297426e-06,5.045400724681831e-06,4.0858900240177576e-06,3.257555543129043e-06,2.5568846420332317e-06,1.9758073126246034e-06,1.503114938723624e-06,1.125781071711261e-06,8.300989077867598e-07,6.025871846438092e-07,4.30649640176529e-07,3.0299986491951354e-07,2.098818723227657e-07,1.4312700167302365e-07,2.098818723227657e-07,3.0777141849407074e-07,4.4431992719399447e-07,6.315059474372472e-07,8.836356876927722e-07,1.2172595732661479e-06,1.6508488013748636e-06,2.2041723362328634e-06,2.89732987679028e-06,3.74942344708116e-06,4.776889396099119e-06,5.991561608373912e-06,7.398591029902421e-06,8.994399273823946e-06,1.0764886428779256e-05,1.2684136024463438e-05,1.4713855203282381e-05,1.6803750082852904e-05,1.8892964058477754e-05,2.091260486398663e-05,2.278926474855925e-05,2.4449312103940866e-05,2.582362009636026e-05,2.6852316174506525e-05,2.7489100501775383e-05,2.7704700189128626e-05,2.7489100501775383e-05,2.6852316174506525e-05,2.582362009636026e-05,2.4449312103940866e-05,2.278926474855925e-05,2.091260486398663e-05,1.8892964058477754e-05,1.6803750082852904e-05,1.4713855203282381e-05,1.2684136024463438e-05,1.0764886428779256e-05,8.994399273823946e-06,7.398591029902421e-06,5.991561608373912e-06,4.776889396099119e-06,3.74942344708116e-06,2.89732987679028e-06,2.2041723362328634e-06,1.6508488013748636e-06,1.2172595732661479e-06,8.836356876927722e-07,6.315059474372472e-07,4.4431992719399447e-07,3.0777141849407074e-07,2.098818723227657e-07,3.0299986491951354e-07,4.4431992719399447e-07,6.414507190682486e-07,9.116852954079547e-07,1.2756770799015294e-06,1.7573194015747346e-06,2.3832785475149748e-06,3.1820943502486732e-06,4.182784113649731e-06,5.412924829661047e-06,6.896245138920899e-06,8.649829248723159e-06,1.068111341796904e-05,1.2984931641974946e-05,1.5540928321708225e-05,1.8311688663243728e-05,2.1241930471173213e-05,2.4259046047653445e-05,2.727517862450022e-05,3.0190870601528336e-05,3.290014551523271e-05,3.529670372616337e-05,3.728074899625941e-05,3.87658452042931e-05,3.96851507308257e-05,3.999640522566011e-05,3.96851507308257e-05,3.87658452042931e-05,3.728074899625941e-05,3.529670372616337e-05,3.290014551523271e-05,3.0190870601528336e-05,2.727517862450022e-05,2.4259046047653445e-05,2.1241930471173213e-05,1.8311688663243728e-05,1.5540928321708225e-05,1.2984931641974946e-05,1.068111341796904e-05,8.649829248723159e-06,6.896245138920899e-06,5.412924829661047e-06,4.182784113649731e-06,3.1820943502486732e-06,2.3832785475149748e-06,1.7573194015747346e-06,1.2756770799015294e-06,9.116852954079547e-07,6.414507190682486e-07,4.4431992719399447e-07,3.0299986491951354e-07,4.30649640176529e-07,6.315059474372472e-07,9.116852954079547e-07,1.2957660708065328e-06,1.813102707444999e-06,2.497654473094964e-06,3.3873218035935373e-06,4.522667979757584e-06,5.944934906019992e-06,7.693317390802592e-06,9.801540632482836e-06,1.2293886185528617e-05,1.5180923104882976e-05,1.8455309017443753e-05,2.2088112783583816e-05,2.602615725899842e-05,3.0190870601528315e-05,3.447905646500173e-05,3.876584520429308e-05,4.290987906749725e-05,4.676053512978958e-05,5.0166731140713714e-05,5.2986628046898034e-05,5.509737534966374e-05,5.640397195266461e-05,5.684635378751912e-05,5.640397195266461e-05,5.509737534966374e-05,5.2986628046898034e-05,5.0166731140713714e-05,4.676053512978958e-05,4.290987906749725e-05,3.876584520429308e-05,3.447905646500173e-05,3.0190870601528315e-05,2.602615725899842e-05,2.2088112783583816e-05,1.8455309017443753e-05,1.5180923104882976e-05,1.2293886185528617e-05,9.801540632482836e-06,7.693317390802592e-06,5.944934906019992e-06,4.522667979757584e-06,3.3873218035935373e-06,2.497654473094964e-06,1.813102707444999e-06,1.2957660708065328e-06,9.116852954079547e-07,6.315059474372472e-07,4.30649640176529e-07,6.025871846438092e-07,8.836356876927722e-07,1.2756770799015294e-06,1.813102707444999e-06,2.5369868078874937e-06,3.494846939935603e-06,4.739715347894688e-06,6.3283502660856495e-06,8.31845949398877e-06,1.0764886428779263e-05,1.371482110719672e-05,1.720223953242458e-05,2.1241930471173203e-05,2.5823620096360273e-05,3.090682646547377e-05,3.641714137591805e-05,4.224462305428397e-05,4.824487385129058e-05,5.424316972009355e-05,6.004171560456983e-05,6.542975214085304e-05,7.019587725296595e-05,7.414162242295346e-05,7.709508889780465e-05,7.89233462444141e-05,7.954234972086719e-05,7.89233462444141e-05,7.709508889780465e-05,7.414162242295346e-05,7.019587725296595e-05,6.542975214085304e-05,6.004171560456983e-05,5.424316972009355e-05,4.824487385129058e-05,4.224462305428397e-05,3.641714137591805e-05,3.090682646547377e-05,2.5823620096360273e-05,2.1241930471173203e-05,1.720223953242458e-05,1.371482110719672e-05,1.0764886428779263e-05,8.31845949398877e-06,6.3283502660856495e-06,4.739715347894688e-06,3.494846939935603e-06,2.5369868078874937e-06,1.813102707444999e-06,1.2756770799015294e-06,8.836356876927722e-07,6.025871846438092e-07,8.300989077867598e-07,1.2172595732661479e-06,1.7573194015747346e-06,2.497654473094964e-06,3.494846939935603e-06,4.814355003977181e-06,6.529233667379064e-06,8.717670700340074e-06,1.1459161954315591e-05,1.4829257399923341e-05,1.8892964058477774e-05,2.3697085851224252e-05,2.926199516477607e-05,3.557353920455486e-05,4.2575951739348496e-05,5.0166731140713735e-05,5.819442621892601e-05,6.64601208104663e-05,7.472312237466052e-05,8.271095671318925e-05,9.013329053950123e-05,9.669890519371693e-05,0.00010213439874465858,0.00010620297065829456,0.00010872150152859627,0.00010957421483351603,0.00010872150152859627,0.00010620297065829456,0.00010213439874465858,9.669890519371693e-05,9.013329053950123e-05,8.271095671318925e-05,7.472312237466052e-05,6.64601208104663e-05,5.819442621892601e-05,5.0166731140713735e-05,4.2575951739348496e-05,3.557353920455486e-05,2.926199516477607e-05,2.3697085851224252e-05,1.8892964058477774e-05,1.4829257399923341e-05,1.1459161954315591e-05,8.717670700340074e-06,6.529233667379064e-06,4.814355003977181e-06,3.494846939935603e-06,2.497654473094964e-06,1.7573194015747346e-06,1.2172595732661479e-06,8.300989077867598e-07,1.125781071711261e-06,1.6508488013748636e-06,2.3832785475149748e-06,3.3873218035935373e-06,4.739715347894688e-06,6.529233667379064e-06,8.854954038083713e-06,1.1822914801829645e-05,1.5540928321708215e-05,2.011145555278385e-05,2.562265909042639e-05,3.213801446523299e-05,3.9685150730825686e-05,4.8244873851290584e-05,5.77415536011806e-05,6.803617715679664e-05,7.89233462444141e-05,9.013329053950118e-05,0.00010133958254787473,0.00011217269245553278,0.00012223886993294102,0.00013114316390626217,0.00013851478636914903,0.00014403258817120135,0.00014744822256815022,0.0001486046733106702,0.00014744822256815022,0.00014403258817120135,0.00013851478636914903,0.00013114316390626217,0.00012223886993294102,0.00011217269245553278,0.00010133958254787473,9.013329053950118e-05,7.89233462444141e-05,6.803617715679664e-05,5.77415536011806e-05,4.8244873851290584e-05,3.9685150730825686e-05,3.213801446523299e-05,2.562265909042639e-05,2.011145555278385e-05,1.5540928321708215e-05,1.1822914801829645e-05,8.854954038083713e-06,6.529233667379064e-06,4.739715347894688e-06,3.3873218035935373e-06,2.3832785475149748e-06,1.6508488013748636e-06,1.125781071711261e-06,1.503114938723624e-06,2.2041723362328634e-06,3.1820943502486732e-06,4.522667979757584e-06,6.3283502660856495e-06,8.717670700340074e-06,1.1822914801829645e-05,1.5785662332085057e-05,2.0749861681795955e-05,2.6852316174506535e-05,3.421073831886255e-05,4.290987906749723e-05,5.298662804689805e-05,6.441535785681681e-05,7.709508889780464e-05,9.084021469873952e-05,0.00010537649258368611,0.00012034373191254797,0.00013530609479886027,0.0001497701942087783,0.0001632103044774081,0.00017509909673587177,0.00018494150404314063,0.00019230873602633052,0.00019686920627785815,0.00019841327059965164,0.00019686920627785815,0.00019230873602633052,0.00018494150404314063,0.00017509909673587177,0.0001632103044774081,0.0001497701942087783,0.00013530609479886027,0.00012034373191254797,0.00010537649258368611,9.084021469873952e-05,7.709508889780464e-05,6.441535785681681e-05,5.298662804689805e-05,4.290987906749723e-05,3.421073831886255e-05,2.6852316174506535e-05,2.0749861681795955e-05,1.5785662332085057e-05,1.1822914801829645e-05,8.717670700340074e-06,6.3283502660856495e-06,4.522667979757584e-06,3.1820943502486732e-06,2.2041723362328634e-06,1.503114938723624e-06,1.9758073126246034e-06,2.89732987679028e-06,4.182784113649731e-06,5.944934906019992e-06,8.31845949398877e-06,1.1459161954315591e-05,1.5540928321708215e-05,2.0749861681795955e-05,2.7275178624500183e-05,3.529670372616334e-05,4.496916716035895e-05,5.6403971952664574e-05,6.964960860230698e-05,8.467239052716964e-05,0.00010133958254787466,0.00011940720956081177,0.000138514786369149,0.00015818885130850708,0.00017785650628506004,0.0001968692062778581,0.00021453589793737224,0.00023016342054219303,0.0002431010208750358,0.00025278506462391164,0.0002587796896787505,0.0002608093239399554,0.0002587796896787505,0.00025278506462391164,0.0002431010208750358,0.00023016342054219303,0.00021453589793737224,0.0001968692062778581,0.00017785650628506004,0.00015818885130850708,0.000138514786369149,0.00011940720956081177,0.00010133958254787466,8.467239052716964e-05,6.964960860230698e-05,5.6403971952664574e-05,4.496916716035895e-05,3.529670372616334e-05,2.7275178624500183e-05,2.0749861681795955e-05,1.5540928321708215e-05,1.1459161954315591e-05,8.31845949398877e-06,5.944934906019992e-06,4.182784113649731e-06,2.89732987679028e-06,1.9758073126246034e-06,2.5568846420332317e-06,3.74942344708116e-06,5.412924829661047e-06,7.693317390802592e-06,1.0764886428779263e-05,1.4829257399923341e-05,2.011145555278385e-05,2.6852316174506535e-05,3.529670372616334e-05,4.567732850018625e-05,5.819442621892601e-05,7.2992163109198e-05,9.013329053950118e-05,0.00010957421483351597,0.00013114316390626214,0.00015452441051476727,0.00017925145215265306,0.0002047115839015261,0.00023016342054219314,0.00025476768245809533,0.0002776300801681957,0.00029785359704961406,0.00031459609586740987,0.00032712817962682604,0.00033488580084804954,0.00033751234273716,0.00033488580084804954,0.00032712817962682604,0.00031459609586740987,0.00029785359704961406,0.0002776300801681957,0.00025476768245809533,0.00023016342054219314,0.0002047115839015261,0.00017925145215265306,0.00015452441051476727,0.00013114316390626214,0.00010957421483351597,9.013329053950118e-05,7.2992163109198e-05,5.819442621892601e-05,4.567732850018625e-05,3.529670372616334e-05,2.6852316174506535e-05,2.011145555278385e-05,1.4829257399923341e-05,1.0764886428779263e-05,7.693317390802592e-06,5.412924829661047e-06,3.74942344708116e-06,2.5568846420332317e-06,3.257555543129043e-06,4.776889396099119e-06,6.896245138920899e-06,9.801540632482836e-06,1.371482110719672e-05,1.8892964058477774e-05,2.562265909042639e-05,3.421073831886255e-05,4.496916716035895e-05,5.819442621892601e-05,7.414162242295352e-05,9.299442831033158e-05,0.00011483279119856221,0.0001396011713031727,0.00016708072531055254,0.00019686920627785817,0.00022837227459330026,0.00026080932393995556,0.00029323580504458973,0.000324582447936156,0.0003537098982580976,0.0003794753271850127,0.00040080582404558763,0.0004167721129607499,0.0004266555787985347,0.00043000187997672496,0.0004266555787985347,0.0004167721129607499,0.00040080582404558763,0.0003794753271850127,0.0003537098982580976,0.000324582447936156,0.00029323580504458973,0.00026080932393995556,0.00022837227459330026,0.00019686920627785817,0.00016708072531055254,0.0001396011713031727,0.00011483279119856221,9.299442831033158e-05,7.414162242295352e-05,5.819442621892601e-05,4.496916716035895e-05,3.421073831886255e-05,2.562265909042639e-05,1.8892964058477774e-05,1.371482110719672e-05,9.801540632482836e-06,6.896245138920899e-06,4.776889396099119e-06,3.257555543129043e-06,4.0858900240177576e-06,5.991561608373912e-06,8.649829248723159e-06,1.2293886185528617e-05,1.720223953242458e-05,2.3697085851224252e-05,3.213801446523299e-05,4.290987906749723e-05,5.6403971952664574e-05,7.2992163109198e-05,9.299442831033158e-05,0.00011664114453055286,0.0001440325881712013,0.00017509909673587169,0.00020956617921433698,0.00024692930490890184,0.0002864430049369832,0.00032712817962682594,0.0003678000987714987,0.00040711759736250405,0.00044365160487820626,0.0004759686928367126,0.0005027231297683541,0.0005227493425943014,0.000535145986008257,0.0005393431879961603,0.000535145986008257,0.0005227493425943014,0.0005027231297683541,0.0004759686928367126,0.00044365160487820626,0.00040711759736250405,0.0003678000987714987,0.00032712817962682594,0.0002864430049369832,0.00024692930490890184,0.00020956617921433698,0.00017509909673587169,0.0001440325881712013,0.00011664114453055286,9.299442831033158e-05,7.2992163109198e-05,5.6403971952664574e-05,4.290987906749723e-05,3.213801446523299e-05,2.3697085851224252e-05,1.720223953242458e-05,1.2293886185528617e-05,8.649829248723159e-06,5.991561608373912e-06,4.0858900240177576e-06,5.045400724681831e-06,7.398591029902421e-06,1.068111341796904e-05,1.5180923104882976e-05,2.1241930471173203e-05,2.926199516477607e-05,3.9685150730825686e-05,5.298662804689805e-05,6.964960860230698e-05,9.013329053950118e-05,0.00011483279119856221,0.0001440325881712013,0.00017785650628506013,0.0002162185238391677,0.0002587796896787506,0.0003049169915511998,0.0003537098982580974,0.00040394938308448765,0.0004541724994974322,0.0005027231297683543,0.000547836607348938,0.0005877428843282485,0.0006207802041508271,0.0006455092761793767,0.0006608170875244532,0.0006659999401775893,0.0006608170875244532,0.0006455092761793767,0.0006207802041508271,0.0005877428843282485,0.000547836607348938,0.0005027231297683543,0.0004541724994974322,0.00040394938308448765,0.0003537098982580974,0.0003049169915511998,0.0002587796896787506,0.0002162185238391677,0.00017785650628506013,0.0001440325881712013,0.00011483279119856221,9.013329053950118e-05,6.964960860230698e-05,5.298662804689805e-05,3.9685150730825686e-05,2.926199516477607e-05,2.1241930471173203e-05,1.5180923104882976e-05,1.068111341796904e-05,7.398591029902421e-06,5.045400724681831e-06,6.133647397297426e-06,8.994399273823946e-06,1.2984931641974946e-05,1.8455309017443753e-05,2.5823620096360273e-05,3.557353920455486e-05,4.8244873851290584e-05,6.441535785681681e-05,8.467239052716964e-05,0.00010957421483351597,0.0001396011713031727,0.00017509909673587169,0.0002162185238391677,0.00026285487681996454,0.0003145960958674098,0.0003706847906987048,0.00043000187997672474,0.0004910775610102436,0.0005521333431136263,0.0006111558991499797,0.0006659999401775894,0.0007145136351815504,0.000754676801954834,0.0007847397080672239,0.0008033492739547718,0.0008096500204011286,0.0008033492739547718,0.0007847397080672239,0.000754676801954834,0.0007145136351815504,0.0006659999401775894,0.0006111558991499797,0.0005521333431136263,0.0004910775610102436,0.00043000187997672474,0.0003706847906987048,0.0003145960958674098,0.00026285487681996454,0.0002162185238391677,0.00017509909673587169,0.0001396011713031727,0.00010957421483351597,8.467239052716964e-05,6.441535785681681e-05,4.8244873851290584e-05,3.557353920455486e-05,2.5823620096360273e-05,1.8455309017443753e-05,1.2984931641974946e-05,8.994399273823946e-06,6.133647397297426e-06,7.341014737720513e-06,1.0764886428779256e-05,1.5540928321708225e-05,2.2088112783583816e-05,3.090682646547377e-05,4.2575951739348496e-05,5.77415536011806e-05,7.709508889780464e-05,0.00010133958254787466,0.00013114316390626214,0.00016708072531055254,0.00020956617921433698,0.0002587796896787506,0.0003145960958674098,0.0003765222267601444,0.0004436516048782062,0.0005146448652310091,0.0005877428843282484,0.0006608170875244531,0.0007314578377429474,0.0007970975603062673,0.00085516085070054,0.0009032298674043877,0.0009392104548974024,0.0009614831889810838,0.000969024195094628,0.0009614831889810838,0.0009392104548974024,0.0009032298674043877,0.00085516085070054,0.0007970975603062673,0.0007314578377429474,0.0006608170875244531,0.0005877428843282484,0.0005146448652310091,0.0004436516048782062,0.0003765222267601444,0.0003145960958674098,0.0002587796896787506,0.00020956617921433698,0.00016708072531055254,0.00013114316390626214,0.00010133958254787466,7.709508889780464e-05,5.77415536011806e-05,4.2575951739348496e-05,3.090682646547377e-05,2.2088112783583816e-05,1.5540928321708225e-05,1.0764886428779256e-05,7.341014737720513e-06,8.649829248723157e-06,1.2684136024463438e-05,1.8311688663243728e-05,2.602615725899842e-05,3.641714137591805e-05,5.0166731140713735e-05,6.803617715679664e-05,9.084021469873952e-05,0.00011940720956081177,0.00015452441051476727,0.00019686920627785817,0.00024692930490890184,0.0003049169915511998,0.0003706847906987048,0.0004436516048782062,0.0005227493425943015,0.000606399846210178,0.0006925303617044647,0.0007786328152094063,0.0008618679603797335,0.0009392104548974026,0.0010076257306424338,0.0010642648740711816,0.001106660366956401,0.0011329040612696865,0.0011417895379478044,0.0011329040612696865,0.001106660366956401,0.0010642648740711816,0.0010076257306424338,0.0009392104548974026,0.0008618679603797335,0.0007786328152094063,0.0006925303617044647,0.000606399846210178,0.0005227493425943015,0.0004436516048782062,0.0003706847906987048,0.0003049169915511998,0.00024692930490890184,0.00019686920627785817,0.00015452441051476727,0.00011940720956081177,9.084021469873952e-05,6.803617715679664e-05,5.0166731140713735e-05,3.641714137591805e-05,2.602615725899842e-05,1.8311688663243728e-05,1.2684136024463438e-05,8.649829248723157e-06,1.0033977470232404e-05,1.4713855203282381e-05,2.1241930471173213e-05,3.0190870601528315e-05,4.224462305428397e-05,5.819442621892601e-05,7.89233462444141e-05,0.00010537649258368611,0.000138514786369149,0.00017925145215265306,0.00022837227459330026,0.0002864430049369832,0.0003537098982580974,0.00043000187997672474,0.0005146448652310091,0.000606399846210178,0.0007034361280280184,0.0008033492739547717,0.000903229867404388,0.0009997843249960072,0.0010895031882436745,0.0011688662965439584,0.0012345688523696945,0.0012837484845008703,0.001314191702500121,0.0013244990357707367,0.001314191702500121,0.0012837484845008703,0.0012345688523696945,0.0011688662965439584,0.0010895031882436745,0.0009997843249960072,0.000903229867404388,0.0008033492739547717,0.0007034361280280184,0.000606399846210178,0.0005146448652310091,0.00043000187997672474,0.0003537098982580974,0.0002864430049369832,0.00022837227459330026,0.00017925145215265306,0.000138514786369149,0.00010537649258368611,7.89233462444141e-05,5.819442621892601e-05,4.224462305428397e-05,3.0190870601528315e-05,2.1241930471173213e-05,1.4713855203282381e-05,1.0033977470232404e-05,1.145916195431559e-05,1.6803750082852904e-05,2.4259046047653445e-05,3.447905646500173e-05,4.824487385129058e-05,6.64601208104663e-05,9.013329053950118e-05,0.00012034373191254797,0.00015818885130850708,0.0002047115839015261,0.00026080932393995556,0.00032712817962682594,0.00040394938308448765,0.0004910775610102436,0.0005877428843282484,0.0006925303617044647,0.0008033492739547717,0.0009174536681430632,0.0010315208862355706,0.0011417895379478046,0.0012442516958868835,0.0013348872104581334,0.0014099218844199966,0.0014660867872331334,0.0015008540334721134,0.0015126253775493248,0.0015008540334721134,0.0014660867872331334,0.0014099218844199966,0.0013348872104581334,0.0012442516958868835,0.0011417895379478046,0.0010315208862355706,0.0009174536681430632,0.0008033492739547717,0.0006925303617044647,0.0005877428843282484,0.0004910775610102436,0.00040394938308448765,0.00032712817962682594,0.00026080932393995556,0.0002047115839015261,0.00015818885130850708,0.00012034373191254797,9.013329053950118e-05,6.64601208104663e-05,4.824487385129058e-05,3.447905646500173e-05,2.4259046047653445e-05,1.6803750082852904e-05,1.145916195431559e-05,1.2883882102250574e-05,1.8892964058477754e-05,2.727517862450022e-05,3.876584520429308e-05,5.424316972009355e-05,7.472312237466052e-05,0.00010133958254787473,0.00013530609479886027,0.00017785650628506004,0.00023016342054219314,0.00029323580504458973,0.0003678000987714987,0.0004541724994974322,0.0005521333431136263,0.0006608170875244531,0.0007786328152094063,0.000903229867404388,0.0010315208862355706,0.0011597701068587329,0.0012837484845008706,0.001398949785267207,0.0015008540334721136,0.001585217785093704,0.0016483656827334869,0.0016874555484102903,0.0017006904263080322,0.0016874555484102903,0.0016483656827334869,0.001585217785093704,0.0015008540334721136,0.001398949785267207,0.0012837484845008706,0.0011597701068587329,0.0010315208862355706,0.000903229867404388,0.0007786328152094063,0.0006608170875244531,0.0005521333431136263,0.0004541724994974322,0.0003678000987714987,0.00029323580504458973,0.00023016342054219314,0.00017785650628506004,0.00013530609479886027,0.00010133958254787473,7.472312237466052e-05,5.424316972009355e-05,3.876584520429308e-05,2.727517862450022e-05,1.8892964058477754e-05,1.2883882102250574e-05,1.4261157470293979e-05,2.091260486398663e-05,3.0190870601528336e-05,4.290987906749725e-05,6.004171560456983e-05,8.271095671318925e-05,0.00011217269245553278,0.0001497701942087783,0.0001968692062778581,0.00025476768245809533,0.000324582447936156,0.00040711759736250405,0.0005027231297683543,0.0006111558991499797,0.0007314578377429474,0.0008618679603797335,0.0009997843249960072,0.0011417895379478046,0.0012837484845008706,0.0014209800388130021,0.0015484962546532912,0.0016612939750149387,0.0017546761355401507,0.001824574486441828,0.0018678430234778938,0.0018824926978774166,0.0018678430234778938,0.001824574486441828,0.0017546761355401507,0.0016612939750149387,0.0015484962546532912,0.0014209800388130021,0.0012837484845008706,0.0011417895379478046,0.0009997843249960072,0.0008618679603797335,0.0007314578377429474,0.0006111558991499797,0.0005027231297683543,0.00040711759736250405,0.000324582447936156,0.00025476768245809533,0.0001968692062778581,0.0001497701942087783,0.00011217269245553278,8.271095671318925e-05,6.004171560456983e-05,4.290987906749725e-05,3.0190870601528336e-05,2.091260486398663e-05,1.4261157470293979e-05,1.554092832170822e-05,2.278926474855925e-05,3.290014551523271e-05,4.676053512978958e-05,6.542975214085304e-05,9.013329053950123e-05,0.00012223886993294102,0.0001632103044774081,0.00021453589793737224,0.0002776300801681957,0.0003537098982580976,0.00044365160487820626,0.000547836607348938,0.0006659999401775894,0.0007970975603062673,0.0009392104548974026,0.0010895031882436745,0.0012442516958868835,0.001398949785267207,0.0015484962546532912,0.0016874555484102907,0.0018103755351395528,0.0019121376443001533,0.0019883085486205993,0.0020354599270457625,0.002051424237113412,0.0020354599270457625,0.0019883085486205993,0.0019121376443001533,0.0018103755351395528,0.0016874555484102907,0.0015484962546532912,0.001398949785267207,0.0012442516958868835,0.0010895031882436745,0.0009392104548974026,0.0007970975603062673,0.0006659999401775894,0.000547836607348938,0.00044365160487820626,0.0003537098982580976,0.0002776300801681957,0.00021453589793737224,0.0001632103044774081,0.00012223886993294102,9.013329053950123e-05,6.542975214085304e-05,4.676053512978958e-05,3.290014551523271e-05,2.278926474855925e-05,1.554092832170822e-05,1.6672982262248714e-05,2.4449312103940866e-05,3.529670372616337e-05,5.0166731140713714e-05,7.019587725296595e-05,9.669890519371693e-05,0.00013114316390626217,0.00017509909673587177,0.00023016342054219303,0.00029785359704961406,0.0003794753271850127,0.0004759686928367126,0.0005877428843282485,0.0007145136351815504,0.00085516085070054,0.0010076257306424338,0.0011688662965439584,0.0013348872104581334,0.0015008540334721136,0.0016612939750149387,0.0018103755351395528,0.0019422494307002242,0.0020514242371134114,0.002133143688509391,0.002183729733297024,0.002200856937867883,0.002183729733297024,0.002133143688509391,0.0020514242371134114,0.0019422494307002242,0.0018103755351395528,0.0016612939750149387,0.0015008540334721136,0.0013348872104581334,0.0011688662965439584,0.0010076257306424338,0.00085516085070054,0.0007145136351815504,0.0005877428843282485,0.0004759686928367126,0.0003794753271850127,0.00029785359704961406,0.00023016342054219303,0.00017509909673587177,0.00013114316390626217,9.669890519371693e-05,7.019587725296595e-05,5.0166731140713714e-05,3.529670372616337e-05,2.4449312103940866e-05,1.6672982262248714e-05,1.7610178886966095e-05,2.582362009636026e-05,3.728074899625941e-05,5.2986628046898034e-05,7.414162242295346e-05,0.00010213439874465858,0.00013851478636914903,0.00018494150404314063,0.0002431010208750358,0.00031459609586740987,0.00040080582404558763,0.0005027231297683541,0.0006207802041508271,0.000754676801954834,0.0009032298674043877,0.0010642648740711816,0.0012345688523696945,0.0014099218844199966,0.001585217785093704,0.0017546761355401507,0.0019121376443001533,0.0020514242371134114,0.002166735813689563,0.002253048756088978,0.00230647826761142,0.0023245682008688562,0.00230647826761142,0.002253048756088978,0.002166735813689563,0.0020514242371134114,0.0019121376443001533,0.0017546761355401507,0.001585217785093704,0.0014099218844199966,0.0012345688523696945,0.0010642648740711816,0.0009032298674043877,0.000754676801954834,0.0006207802041508271,0.0005027231297683541,0.00040080582404558763,0.00031459609586740987,0.0002431010208750358,0.00018494150404314063,0.00013851478636914903,0.00010213439874465858,7.414162242295346e-05,5.2986628046898034e-05,3.728074899625941e-05,2.582362009636026e-05,1.7610178886966095e-05,1.831168866324372e-05,2.6852316174506525e-05,3.87658452042931e-05,5.509737534966374e-05,7.709508889780465e-05,0.00010620297065829456,0.00014403258817120135,0.00019230873602633052,0.00025278506462391164,0.00032712817962682604,0.0004167721129607499,0.0005227493425943014,0.0006455092761793767,0.0007847397080672239,0.0009392104548974024,0.001106660366956401,0.0012837484845008703,0.0014660867872331334,0.0016483656827334869,0.001824574486441828,0.0019883085486205993,0.002133143688509391,0.002253048756088978,0.00234280001523129,0.002398357916528493,0.0024171684708036803,0.002398357916528493,0.00234280001523129,0.002253048756088978,0.002133143688509391,0.0019883085486205993,0.001824574486441828,0.0016483656827334869,0.0014660867872331334,0.0012837484845008703,0.001106660366956401,0.0009392104548974024,0.0007847397080672239,0.0006455092761793767,0.0005227493425943014,0.0004167721129607499,0.00032712817962682604,0.00025278506462391164,0.00019230873602633052,0.00014403258817120135,0.00010620297065829456,7.709508889780465e-05,5.509737534966374e-05,3.87658452042931e-05,2.6852316174506525e-05,1.831168866324372e-05,1.8745937845727687e-05,2.7489100501775383e-05,3.96851507308257e-05,5.640397195266461e-05,7.89233462444141e-05,0.00010872150152859627,0.00014744822256815022,0.00019686920627785815,0.0002587796896787505,0.00033488580084804954,0.0004266555787985347,0.000535145986008257,0.0006608170875244532,0.0008033492739547718,0.0009614831889810838,0.0011329040612696865,0.001314191702500121,0.0015008540334721134,0.0016874555484102903,0.0018678430234778938,0.0020354599270457625,0.002183729733297024,0.00230647826761142,0.002398357916528493,0.002455233335486821,0.0024744899692015557,0.002455233335486821,0.002398357916528493,0.00230647826761142,0.002183729733297024,0.0020354599270457625,0.0018678430234778938,0.0016874555484102903,0.0015008540334721134,0.001314191702500121,0.0011329040612696865,0.0009614831889810838,0.0008033492739547718,0.0006608170875244532,0.000535145986008257,0.0004266555787985347,0.00033488580084804954,0.0002587796896787505,0.00019686920627785815,0.00014744822256815022,0.00010872150152859627,7.89233462444141e-05,5.640397195266461e-05,3.96851507308257e-05,2.7489100501775383e-05,1.8745937845727687e-05,1.8892964058477764e-05,2.7704700189128626e-05,3.999640522566011e-05,5.684635378751912e-05,7.954234972086719e-05,0.00010957421483351603,0.0001486046733106702,0.00019841327059965164,0.0002608093239399554,0.00033751234273716,0.00043000187997672496,0.0005393431879961603,0.0006659999401775893,0.0008096500204011286,0.000969024195094628,0.0011417895379478044,0.0013244990357707367,0.0015126253775493248,0.0017006904263080322,0.0018824926978774166,0.002051424237113412,0.002200856937867883,0.0023245682008688562,0.0024171684708036803,0.0024744899692015557,0.002493897634566384,0.0024744899692015557,0.0024171684708036803,0.0023245682008688562,0.002200856937867883,0.002051424237113412,0.0018824926978774166,0.0017006904263080322,0.0015126253775493248,0.0013244990357707367,0.0011417895379478044,0.000969024195094628,0.0008096500204011286,0.0006659999401775893,0.0005393431879961603,0.00043000187997672496,0.00033751234273716,0.0002608093239399554,0.00019841327059965164,0.0001486046733106702,0.00010957421483351603,7.954234972086719e-05,5.684635378751912e-05,3.999640522566011e-05,2.7704700189128626e-05,1.8892964058477764e-05,1.8745937845727687e-05,2.7489100501775383e-05,3.96851507308257e-05,5.640397195266461e-05,7.89233462444141e-05,0.00010872150152859627,0.00014744822256815022,0.00019686920627785815,0.0002587796896787505,0.00033488580084804954,0.0004266555787985347,0.000535145986008257,0.0006608170875244532,0.0008033492739547718,0.0009614831889810838,0.0011329040612696865,0.001314191702500121,0.0015008540334721134,0.0016874555484102903,0.0018678430234778938,0.0020354599270457625,0.002183729733297024,0.00230647826761142,0.002398357916528493,0.002455233335486821,0.0024744899692015557,0.002455233335486821,0.002398357916528493,0.00230647826761142,0.002183729733297024,0.0020354599270457625,0.0018678430234778938,0.0016874555484102903,0.0015008540334721134,0.001314191702500121,0.0011329040612696865,0.0009614831889810838,0.0008033492739547718,0.0006608170875244532,0.000535145986008257,0.0004266555787985347,0.00033488580084804954,0.0002587796896787505,0.00019686920627785815,0.00014744822256815022,0.00010872150152859627,7.89233462444141e-05,5.640397195266461e-05,3.96851507308257e-05,2.7489100501775383e-05,1.8745937845727687e-05,1.831168866324372e-05,2.6852316174506525e-05,3.87658452042931e-05,5.509737534966374e-05,7.709508889780465e-05,0.00010620297065829456,0.00014403258817120135,0.00019230873602633052,0.00025278506462391164,0.00032712817962682604,0.0004167721129607499,0.0005227493425943014,0.0006455092761793767,0.0007847397080672239,0.0009392104548974024,0.001106660366956401,0.0012837484845008703,0.0014660867872331334,0.0016483656827334869,0.001824574486441828,0.0019883085486205993,0.002133143688509391,0.002253048756088978,0.00234280001523129,0.002398357916528493,0.0024171684708036803,0.002398357916528493,0.00234280001523129,0.002253048756088978,0.002133143688509391,0.0019883085486205993,0.001824574486441828,0.0016483656827334869,0.0014660867872331334,0.0012837484845008703,0.001106660366956401,0.0009392104548974024,0.0007847397080672239,0.0006455092761793767,0.0005227493425943014,0.0004167721129607499,0.00032712817962682604,0.00025278506462391164,0.00019230873602633052,0.00014403258817120135,0.00010620297065829456,7.709508889780465e-05,5.509737534966374e-05,3.87658452042931e-05,2.6852316174506525e-05,1.831168866324372e-05,1.7610178886966095e-05,2.582362009636026e-05,3.728074899625941e-05,5.2986628046898034e-05,7.414162242295346e-05,0.00010213439874465858,0.00013851478636914903,0.00018494150404314063,0.0002431010208750358,0.00031459609586740987,0.00040080582404558763,0.0005027231297683541,0.0006207802041508271,0.000754676801954834,0.0009032298674043877,0.0010642648740711816,0.0012345688523696945,0.0014099218844199966,0.001585217785093704,0.0017546761355401507,0.0019121376443001533,0.0020514242371134114,0.002166735813689563,0.002253048756088978,0.00230647826761142,0.0023245682008688562,0.00230647826761142,0.002253048756088978,0.002166735813689563,0.0020514242371134114,0.0019121376443001533,0.0017546761355401507,0.001585217785093704,0.0014099218844199966,0.0012345688523696945,0.0010642648740711816,0.0009032298674043877,0.000754676801954834,0.0006207802041508271,0.0005027231297683541,0.00040080582404558763,0.00031459609586740987,0.0002431010208750358,0.00018494150404314063,0.00013851478636914903,0.00010213439874465858,7.414162242295346e-05,5.2986628046898034e-05,3.728074899625941e-05,2.582362009636026e-05,1.7610178886966095e-05,1.6672982262248714e-05,2.4449312103940866e-05,3.529670372616337e-05,5.0166731140713714e-05,7.019587725296595e-05,9.669890519371693e-05,0.00013114316390626217,0.00017509909673587177,0.00023016342054219303,0.00029785359704961406,0.0003794753271850127,0.0004759686928367126,0.0005877428843282485,0.0007145136351815504,0.00085516085070054,0.0010076257306424338,0.0011688662965439584,0.0013348872104581334,0.0015008540334721136,0.0016612939750149387,0.0018103755351395528,0.0019422494307002242,0.0020514242371134114,0.002133143688509391,0.002183729733297024,0.002200856937867883,0.002183729733297024,0.002133143688509391,0.0020514242371134114,0.0019422494307002242,0.0018103755351395528,0.0016612939750149387,0.0015008540334721136,0.0013348872104581334,0.0011688662965439584,0.0010076257306424338,0.00085516085070054,0.0007145136351815504,0.0005877428843282485,0.0004759686928367126,0.0003794753271850127,0.00029785359704961406,0.00023016342054219303,0.00017509909673587177,0.00013114316390626217,9.669890519371693e-05,7.019587725296595e-05,5.0166731140713714e-05,3.529670372616337e-05,2.4449312103940866e-05,1.6672982262248714e-05,1.554092832170822e-05,2.278926474855925e-05,3.290014551523271e-05,4.676053512978958e-05,6.542975214085304e-05,9.013329053950123e-05,0.00012223886993294102,0.0001632103044774081,0.00021453589793737224,0.0002776300801681957,0.0003537098982580976,0.00044365160487820626,0.000547836607348938,0.0006659999401775894,0.0007970975603062673,0.0009392104548974026,0.0010895031882436745,0.0012442516958868835,0.001398949785267207,0.0015484962546532912,0.0016874555484102907,0.0018103755351395528,0.0019121376443001533,0.0019883085486205993,0.0020354599270457625,0.002051424237113412,0.0020354599270457625,0.0019883085486205993,0.0019121376443001533,0.0018103755351395528,0.0016874555484102907,0.0015484962546532912,0.001398949785267207,0.0012442516958868835,0.0010895031882436745,0.0009392104548974026,0.0007970975603062673,0.0006659999401775894,0.000547836607348938,0.00044365160487820626,0.0003537098982580976,0.0002776300801681957,0.00021453589793737224,0.0001632103044774081,0.00012223886993294102,9.013329053950123e-05,6.542975214085304e-05,4.676053512978958e-05,3.290014551523271e-05,2.278926474855925e-05,1.554092832170822e-05,1.4261157470293979e-05,2.091260486398663e-05,3.0190870601528336e-05,4.290987906749725e-05,6.004171560456983e-05,8.271095671318925e-05,0.00011217269245553278,0.0001497701942087783,0.0001968692062778581,0.00025476768245809533,0.000324582447936156,0.00040711759736250405,0.0005027231297683543,0.0006111558991499797,0.0007314578377429474,0.0008618679603797335,0.0009997843249960072,0.0011417895379478046,0.0012837484845008706,0.0014209800388130021,0.0015484962546532912,0.0016612939750149387,0.0017546761355401507,0.001824574486441828,0.0018678430234778938,0.0018824926978774166,0.0018678430234778938,0.001824574486441828,0.0017546761355401507,0.0016612939750149387,0.0015484962546532912,0.0014209800388130021,0.0012837484845008706,0.0011417895379478046,0.0009997843249960072,0.0008618679603797335,0.0007314578377429474,0.0006111558991499797,0.0005027231297683543,0.00040711759736250405,0.000324582447936156,0.00025476768245809533,0.0001968692062778581,0.0001497701942087783,0.00011217269245553278,8.271095671318925e-05,6.004171560456983e-05,4.290987906749725e-05,3.0190870601528336e-05,2.091260486398663e-05,1.4261157470293979e-05,1.2883882102250574e-05,1.8892964058477754e-05,2.727517862450022e-05,3.876584520429308e-05,5.424316972009355e-05,7.472312237466052e-05,0.00010133958254787473,0.00013530609479886027,0.00017785650628506004,0.00023016342054219314,0.00029323580504458973,0.0003678000987714987,0.0004541724994974322,0.0005521333431136263,0.0006608170875244531,0.0007786328152094063,0.000903229867404388,0.0010315208862355706,0.0011597701068587329,0.0012837484845008706,0.001398949785267207,0.0015008540334721136,0.001585217785093704,0.0016483656827334869,0.0016874555484102903,0.0017006904263080322,0.0016874555484102903,0.0016483656827334869,0.001585217785093704,0.0015008540334721136,0.001398949785267207,0.0012837484845008706,0.0011597701068587329,0.0010315208862355706,0.000903229867404388,0.0007786328152094063,0.0006608170875244531,0.0005521333431136263,0.0004541724994974322,0.0003678000987714987,0.00029323580504458973,0.00023016342054219314,0.00017785650628506004,0.00013530609479886027,0.00010133958254787473,7.472312237466052e-05,5.424316972009355e-05,3.876584520429308e-05,2.727517862450022e-05,1.8892964058477754e-05,1.2883882102250574e-05,1.145916195431559e-05,1.6803750082852904e-05,2.4259046047653445e-05,3.447905646500173e-05,4.824487385129058e-05,6.64601208104663e-05,9.013329053950118e-05,0.00012034373191254797,0.00015818885130850708,0.0002047115839015261,0.00026080932393995556,0.00032712817962682594,0.00040394938308448765,0.0004910775610102436,0.0005877428843282484,0.0006925303617044647,0.0008033492739547717,0.0009174536681430632,0.0010315208862355706,0.0011417895379478046,0.0012442516958868835,0.0013348872104581334,0.0014099218844199966,0.0014660867872331334,0.0015008540334721134,0.0015126253775493248,0.0015008540334721134,0.0014660867872331334,0.0014099218844199966,0.0013348872104581334,0.0012442516958868835,0.0011417895379478046,0.0010315208862355706,0.0009174536681430632,0.0008033492739547717,0.0006925303617044647,0.0005877428843282484,0.0004910775610102436,0.00040394938308448765,0.00032712817962682594,0.00026080932393995556,0.0002047115839015261,0.00015818885130850708,0.00012034373191254797,9.013329053950118e-05,6.64601208104663e-05,4.824487385129058e-05,3.447905646500173e-05,2.4259046047653445e-05,1.6803750082852904e-05,1.145916195431559e-05,1.0033977470232404e-05,1.4713855203282381e-05,2.1241930471173213e-05,3.0190870601528315e-05,4.224462305428397e-05,5.819442621892601e-05,7.89233462444141e-05,0.00010537649258368611,0.000138514786369149,0.00017925145215265306,0.00022837227459330026,0.0002864430049369832,0.0003537098982580974,0.00043000187997672474,0.0005146448652310091,0.000606399846210178,0.0007034361280280184,0.0008033492739547717,0.000903229867404388,0.0009997843249960072,0.0010895031882436745,0.0011688662965439584,0.0012345688523696945,0.0012837484845008703,0.001314191702500121,0.0013244990357707367,0.001314191702500121,0.0012837484845008703,0.0012345688523696945,0.0011688662965439584,0.0010895031882436745,0.0009997843249960072,0.000903229867404388,0.0008033492739547717,0.0007034361280280184,0.000606399846210178,0.0005146448652310091,0.00043000187997672474,0.0003537098982580974,0.0002864430049369832,0.00022837227459330026,0.00017925145215265306,0.000138514786369149,0.00010537649258368611,7.89233462444141e-05,5.819442621892601e-05,4.224462305428397e-05,3.0190870601528315e-05,2.1241930471173213e-05,1.4713855203282381e-05,1.0033977470232404e-05,8.649829248723157e-06,1.2684136024463438e-05,1.8311688663243728e-05,2.602615725899842e-05,3.641714137591805e-05,5.0166731140713735e-05,6.803617715679664e-05,9.084021469873952e-05,0.00011940720956081177,0.00015452441051476727,0.00019686920627785817,0.00024692930490890184,0.0003049169915511998,0.0003706847906987048,0.0004436516048782062,0.0005227493425943015,0.000606399846210178,0.0006925303617044647,0.0007786328152094063,0.0008618679603797335,0.0009392104548974026,0.0010076257306424338,0.0010642648740711816,0.001106660366956401,0.0011329040612696865,0.0011417895379478044,0.0011329040612696865,0.001106660366956401,0.0010642648740711816,0.0010076257306424338,0.0009392104548974026,0.0008618679603797335,0.0007786328152094063,0.0006925303617044647,0.000606399846210178,0.0005227493425943015,0.0004436516048782062,0.0003706847906987048,0.0003049169915511998,0.00024692930490890184,0.00019686920627785817,0.00015452441051476727,0.00011940720956081177,9.084021469873952e-05,6.803617715679664e-05,5.0166731140713735e-05,3.641714137591805e-05,2.602615725899842e-05,1.8311688663243728e-05,1.2684136024463438e-05,8.649829248723157e-06,7.341014737720513e-06,1.0764886428779256e-05,1.5540928321708225e-05,2.2088112783583816e-05,3.090682646547377e-05,4.2575951739348496e-05,5.77415536011806e-05,7.709508889780464e-05,0.00010133958254787466,0.00013114316390626214,0.00016708072531055254,0.00020956617921433698,0.0002587796896787506,0.0003145960958674098,0.0003765222267601444,0.0004436516048782062,0.0005146448652310091,0.0005877428843282484,0.0006608170875244531,0.0007314578377429474,0.0007970975603062673,0.00085516085070054,0.0009032298674043877,0.0009392104548974024,0.0009614831889810838,0.000969024195094628,0.0009614831889810838,0.0009392104548974024,0.0009032298674043877,0.00085516085070054,0.0007970975603062673,0.0007314578377429474,0.0006608170875244531,0.0005877428843282484,0.0005146448652310091,0.0004436516048782062,0.0003765222267601444,0.0003145960958674098,0.0002587796896787506,0.00020956617921433698,0.00016708072531055254,0.00013114316390626214,0.00010133958254787466,7.709508889780464e-05,5.77415536011806e-05,4.2575951739348496e-05,3.090682646547377e-05,2.2088112783583816e-05,1.5540928321708225e-05,1.0764886428779256e-05,7.341014737720513e-06,6.133647397297426e-06,8.994399273823946e-06,1.2984931641974946e-05,1.8455309017443753e-05,2.5823620096360273e-05,3.557353920455486e-05,4.8244873851290584e-05,6.441535785681681e-05,8.467239052716964e-05,0.00010957421483351597,0.0001396011713031727,0.00017509909673587169,0.0002162185238391677,0.00026285487681996454,0.0003145960958674098,0.0003706847906987048,0.00043000187997672474,0.0004910775610102436,0.0005521333431136263,0.0006111558991499797,0.0006659999401775894,0.0007145136351815504,0.000754676801954834,0.0007847397080672239,0.0008033492739547718,0.0008096500204011286,0.0008033492739547718,0.0007847397080672239,0.000754676801954834,0.0007145136351815504,0.0006659999401775894,0.0006111558991499797,0.0005521333431136263,0.0004910775610102436,0.00043000187997672474,0.0003706847906987048,0.0003145960958674098,0.00026285487681996454,0.0002162185238391677,0.00017509909673587169,0.0001396011713031727,0.00010957421483351597,8.467239052716964e-05,6.441535785681681e-05,4.8244873851290584e-05,3.557353920455486e-05,2.5823620096360273e-05,1.8455309017443753e-05,1.2984931641974946e-05,8.994399273823946e-06,6.133647397297426e-06,5.045400724681831e-06,7.398591029902421e-06,1.068111341796904e-05,1.5180923104882976e-05,2.1241930471173203e-05,2.926199516477607e-05,3.9685150730825686e-05,5.298662804689805e-05,6.964960860230698e-05,9.013329053950118e-05,0.00011483279119856221,0.0001440325881712013,0.00017785650628506013,0.0002162185238391677,0.0002587796896787506,0.0003049169915511998,0.0003537098982580974,0.00040394938308448765,0.0004541724994974322,0.0005027231297683543,0.000547836607348938,0.0005877428843282485,0.0006207802041508271,0.0006455092761793767,0.0006608170875244532,0.0006659999401775893,0.0006608170875244532,0.0006455092761793767,0.0006207802041508271,0.0005877428843282485,0.000547836607348938,0.0005027231297683543,0.0004541724994974322,0.00040394938308448765,0.0003537098982580974,0.0003049169915511998,0.0002587796896787506,0.0002162185238391677,0.00017785650628506013,0.0001440325881712013,0.00011483279119856221,9.013329053950118e-05,6.964960860230698e-05,5.298662804689805e-05,3.9685150730825686e-05,2.926199516477607e-05,2.1241930471173203e-05,1.5180923104882976e-05,1.068111341796904e-05,7.398591029902421e-06,5.045400724681831e-06,4.0858900240177576e-06,5.991561608373912e-06,8.649829248723159e-06,1.2293886185528617e-05,1.720223953242458e-05,2.3697085851224252e-05,3.213801446523299e-05,4.290987906749723e-05,5.6403971952664574e-05,7.2992163109198e-05,9.299442831033158e-05,0.00011664114453055286,0.0001440325881712013,0.00017509909673587169,0.00020956617921433698,0.00024692930490890184,0.0002864430049369832,0.00032712817962682594,0.0003678000987714987,0.00040711759736250405,0.00044365160487820626,0.0004759686928367126,0.0005027231297683541,0.0005227493425943014,0.000535145986008257,0.0005393431879961603,0.000535145986008257,0.0005227493425943014,0.0005027231297683541,0.0004759686928367126,0.00044365160487820626,0.00040711759736250405,0.0003678000987714987,0.00032712817962682594,0.0002864430049369832,0.00024692930490890184,0.00020956617921433698,0.00017509909673587169,0.0001440325881712013,0.00011664114453055286,9.299442831033158e-05,7.2992163109198e-05,5.6403971952664574e-05,4.290987906749723e-05,3.213801446523299e-05,2.3697085851224252e-05,1.720223953242458e-05,1.2293886185528617e-05,8.649829248723159e-06,5.991561608373912e-06,4.0858900240177576e-06,3.257555543129043e-06,4.776889396099119e-06,6.896245138920899e-06,9.801540632482836e-06,1.371482110719672e-05,1.8892964058477774e-05,2.562265909042639e-05,3.421073831886255e-05,4.496916716035895e-05,5.819442621892601e-05,7.414162242295352e-05,9.299442831033158e-05,0.00011483279119856221,0.0001396011713031727,0.00016708072531055254,0.00019686920627785817,0.00022837227459330026,0.00026080932393995556,0.00029323580504458973,0.000324582447936156,0.0003537098982580976,0.0003794753271850127,0.00040080582404558763,0.0004167721129607499,0.0004266555787985347,0.00043000187997672496,0.0004266555787985347,0.0004167721129607499,0.00040080582404558763,0.0003794753271850127,0.0003537098982580976,0.000324582447936156,0.00029323580504458973,0.00026080932393995556,0.00022837227459330026,0.00019686920627785817,0.00016708072531055254,0.0001396011713031727,0.00011483279119856221,9.299442831033158e-05,7.414162242295352e-05,5.819442621892601e-05,4.496916716035895e-05,3.421073831886255e-05,2.562265909042639e-05,1.8892964058477774e-05,1.371482110719672e-05,9.801540632482836e-06,6.896245138920899e-06,4.776889396099119e-06,3.257555543129043e-06,2.5568846420332317e-06,3.74942344708116e-06,5.412924829661047e-06,7.693317390802592e-06,1.0764886428779263e-05,1.4829257399923341e-05,2.011145555278385e-05,2.6852316174506535e-05,3.529670372616334e-05,4.567732850018625e-05,5.819442621892601e-05,7.2992163109198e-05,9.013329053950118e-05,0.00010957421483351597,0.00013114316390626214,0.00015452441051476727,0.00017925145215265306,0.0002047115839015261,0.00023016342054219314,0.00025476768245809533,0.0002776300801681957,0.00029785359704961406,0.00031459609586740987,0.00032712817962682604,0.00033488580084804954,0.00033751234273716,0.00033488580084804954,0.00032712817962682604,0.00031459609586740987,0.00029785359704961406,0.0002776300801681957,0.00025476768245809533,0.00023016342054219314,0.0002047115839015261,0.00017925145215265306,0.00015452441051476727,0.00013114316390626214,0.00010957421483351597,9.013329053950118e-05,7.2992163109198e-05,5.819442621892601e-05,4.567732850018625e-05,3.529670372616334e-05,2.6852316174506535e-05,2.011145555278385e-05,1.4829257399923341e-05,1.0764886428779263e-05,7.693317390802592e-06,5.412924829661047e-06,3.74942344708116e-06,2.5568846420332317e-06,1.9758073126246034e-06,2.89732987679028e-06,4.182784113649731e-06,5.944934906019992e-06,8.31845949398877e-06,1.1459161954315591e-05,1.5540928321708215e-05,2.0749861681795955e-05,2.7275178624500183e-05,3.529670372616334e-05,4.496916716035895e-05,5.6403971952664574e-05,6.964960860230698e-05,8.467239052716964e-05,0.00010133958254787466,0.00011940720956081177,0.000138514786369149,0.00015818885130850708,0.00017785650628506004,0.0001968692062778581,0.00021453589793737224,0.00023016342054219303,0.0002431010208750358,0.00025278506462391164,0.0002587796896787505,0.0002608093239399554,0.0002587796896787505,0.00025278506462391164,0.0002431010208750358,0.00023016342054219303,0.00021453589793737224,0.0001968692062778581,0.00017785650628506004,0.00015818885130850708,0.000138514786369149,0.00011940720956081177,0.00010133958254787466,8.467239052716964e-05,6.964960860230698e-05,5.6403971952664574e-05,4.496916716035895e-05,3.529670372616334e-05,2.7275178624500183e-05,2.0749861681795955e-05,1.5540928321708215e-05,1.1459161954315591e-05,8.31845949398877e-06,5.944934906019992e-06,4.182784113649731e-06,2.89732987679028e-06,1.9758073126246034e-06,1.503114938723624e-06,2.2041723362328634e-06,3.1820943502486732e-06,4.522667979757584e-06,6.3283502660856495e-06,8.717670700340074e-06,1.1822914801829645e-05,1.5785662332085057e-05,2.0749861681795955e-05,2.6852316174506535e-05,3.421073831886255e-05,4.290987906749723e-05,5.298662804689805e-05,6.441535785681681e-05,7.709508889780464e-05,9.084021469873952e-05,0.00010537649258368611,0.00012034373191254797,0.00013530609479886027,0.0001497701942087783,0.0001632103044774081,0.00017509909673587177,0.00018494150404314063,0.00019230873602633052,0.00019686920627785815,0.00019841327059965164,0.00019686920627785815,0.00019230873602633052,0.00018494150404314063,0.00017509909673587177,0.0001632103044774081,0.0001497701942087783,0.00013530609479886027,0.00012034373191254797,0.00010537649258368611,9.084021469873952e-05,7.709508889780464e-05,6.441535785681681e-05,5.298662804689805e-05,4.290987906749723e-05,3.421073831886255e-05,2.6852316174506535e-05,2.0749861681795955e-05,1.5785662332085057e-05,1.1822914801829645e-05,8.717670700340074e-06,6.3283502660856495e-06,4.522667979757584e-06,3.1820943502486732e-06,2.2041723362328634e-06,1.503114938723624e-06,1.125781071711261e-06,1.6508488013748636e-06,2.3832785475149748e-06,3.3873218035935373e-06,4.739715347894688e-06,6.529233667379064e-06,8.854954038083713e-06,1.1822914801829645e-05,1.5540928321708215e-05,2.011145555278385e-05,2.562265909042639e-05,3.213801446523299e-05,3.9685150730825686e-05,4.8244873851290584e-05,5.77415536011806e-05,6.803617715679664e-05,7.89233462444141e-05,9.013329053950118e-05,0.00010133958254787473,0.00011217269245553278,0.00012223886993294102,0.00013114316390626217,0.00013851478636914903,0.00014403258817120135,0.00014744822256815022,0.0001486046733106702,0.00014744822256815022,0.00014403258817120135,0.00013851478636914903,0.00013114316390626217,0.00012223886993294102,0.00011217269245553278,0.00010133958254787473,9.013329053950118e-05,7.89233462444141e-05,6.803617715679664e-05,5.77415536011806e-05,4.8244873851290584e-05,3.9685150730825686e-05,3.213801446523299e-05,2.562265909042639e-05,2.011145555278385e-05,1.5540928321708215e-05,1.1822914801829645e-05,8.854954038083713e-06,6.529233667379064e-06,4.739715347894688e-06,3.3873218035935373e-06,2.3832785475149748e-06,1.6508488013748636e-06,1.125781071711261e-06,8.300989077867598e-07,1.2172595732661479e-06,1.7573194015747346e-06,2.497654473094964e-06,3.494846939935603e-06,4.814355003977181e-06,6.529233667379064e-06,8.717670700340074e-06,1.1459161954315591e-05,1.4829257399923341e-05,1.8892964058477774e-05,2.3697085851224252e-05,2.926199516477607e-05,3.557353920455486e-05,4.2575951739348496e-05,5.0166731140713735e-05,5.819442621892601e-05,6.64601208104663e-05,7.472312237466052e-05,8.271095671318925e-05,9.013329053950123e-05,9.669890519371693e-05,0.00010213439874465858,0.00010620297065829456,0.00010872150152859627,0.00010957421483351603,0.00010872150152859627,0.00010620297065829456,0.00010213439874465858,9.669890519371693e-05,9.013329053950123e-05,8.271095671318925e-05,7.472312237466052e-05,6.64601208104663e-05,5.819442621892601e-05,5.0166731140713735e-05,4.2575951739348496e-05,3.557353920455486e-05,2.926199516477607e-05,2.3697085851224252e-05,1.8892964058477774e-05,1.4829257399923341e-05,1.1459161954315591e-05,8.717670700340074e-06,6.529233667379064e-06,4.814355003977181e-06,3.494846939935603e-06,2.497654473094964e-06,1.7573194015747346e-06,1.2172595732661479e-06,8.300989077867598e-07,6.025871846438092e-07,8.836356876927722e-07,1.2756770799015294e-06,1.813102707444999e-06,2.5369868078874937e-06,3.494846939935603e-06,4.739715347894688e-06,6.3283502660856495e-06,8.31845949398877e-06,1.0764886428779263e-05,1.371482110719672e-05,1.720223953242458e-05,2.1241930471173203e-05,2.5823620096360273e-05,3.090682646547377e-05,3.641714137591805e-05,4.224462305428397e-05,4.824487385129058e-05,5.424316972009355e-05,6.004171560456983e-05,6.542975214085304e-05,7.019587725296595e-05,7.414162242295346e-05,7.709508889780465e-05,7.89233462444141e-05,7.954234972086719e-05,7.89233462444141e-05,7.709508889780465e-05,7.414162242295346e-05,7.019587725296595e-05,6.542975214085304e-05,6.004171560456983e-05,5.424316972009355e-05,4.824487385129058e-05,4.224462305428397e-05,3.641714137591805e-05,3.090682646547377e-05,2.5823620096360273e-05,2.1241930471173203e-05,1.720223953242458e-05,1.371482110719672e-05,1.0764886428779263e-05,8.31845949398877e-06,6.3283502660856495e-06,4.739715347894688e-06,3.494846939935603e-06,2.5369868078874937e-06,1.813102707444999e-06,1.2756770799015294e-06,8.836356876927722e-07,6.025871846438092e-07,4.30649640176529e-07,6.315059474372472e-07,9.116852954079547e-07,1.2957660708065328e-06,1.813102707444999e-06,2.497654473094964e-06,3.3873218035935373e-06,4.522667979757584e-06,5.944934906019992e-06,7.693317390802592e-06,9.801540632482836e-06,1.2293886185528617e-05,1.5180923104882976e-05,1.8455309017443753e-05,2.2088112783583816e-05,2.602615725899842e-05,3.0190870601528315e-05,3.447905646500173e-05,3.876584520429308e-05,4.290987906749725e-05,4.676053512978958e-05,5.0166731140713714e-05,5.2986628046898034e-05,5.509737534966374e-05,5.640397195266461e-05,5.684635378751912e-05,5.640397195266461e-05,5.509737534966374e-05,5.2986628046898034e-05,5.0166731140713714e-05,4.676053512978958e-05,4.290987906749725e-05,3.876584520429308e-05,3.447905646500173e-05,3.0190870601528315e-05,2.602615725899842e-05,2.2088112783583816e-05,1.8455309017443753e-05,1.5180923104882976e-05,1.2293886185528617e-05,9.801540632482836e-06,7.693317390802592e-06,5.944934906019992e-06,4.522667979757584e-06,3.3873218035935373e-06,2.497654473094964e-06,1.813102707444999e-06,1.2957660708065328e-06,9.116852954079547e-07,6.315059474372472e-07,4.30649640176529e-07,3.0299986491951354e-07,4.4431992719399447e-07,6.414507190682486e-07,9.116852954079547e-07,1.2756770799015294e-06,1.7573194015747346e-06,2.3832785475149748e-06,3.1820943502486732e-06,4.182784113649731e-06,5.412924829661047e-06,6.896245138920899e-06,8.649829248723159e-06,1.068111341796904e-05,1.2984931641974946e-05,1.5540928321708225e-05,1.8311688663243728e-05,2.1241930471173213e-05,2.4259046047653445e-05,2.727517862450022e-05,3.0190870601528336e-05,3.290014551523271e-05,3.529670372616337e-05,3.728074899625941e-05,3.87658452042931e-05,3.96851507308257e-05,3.999640522566011e-05,3.96851507308257e-05,3.87658452042931e-05,3.728074899625941e-05,3.529670372616337e-05,3.290014551523271e-05,3.0190870601528336e-05,2.727517862450022e-05,2.4259046047653445e-05,2.1241930471173213e-05,1.8311688663243728e-05,1.5540928321708225e-05,1.2984931641974946e-05,1.068111341796904e-05,8.649829248723159e-06,6.896245138920899e-06,5.412924829661047e-06,4.182784113649731e-06,3.1820943502486732e-06,2.3832785475149748e-06,1.7573194015747346e-06,1.2756770799015294e-06,9.116852954079547e-07,6.414507190682486e-07,4.4431992719399447e-07,3.0299986491951354e-07,2.098818723227657e-07,3.0777141849407074e-07,4.4431992719399447e-07,6.315059474372472e-07,8.836356876927722e-07,1.2172595732661479e-06,1.6508488013748636e-06,2.2041723362328634e-06,2.89732987679028e-06,3.74942344708116e-06,4.776889396099119e-06,5.991561608373912e-06,7.398591029902421e-06,8.994399273823946e-06,1.0764886428779256e-05,1.2684136024463438e-05,1.4713855203282381e-05,1.6803750082852904e-05,1.8892964058477754e-05,2.091260486398663e-05,2.278926474855925e-05,2.4449312103940866e-05,2.582362009636026e-05,2.6852316174506525e-05,2.7489100501775383e-05,2.7704700189128626e-05,2.7489100501775383e-05,2.6852316174506525e-05,2.582362009636026e-05,2.4449312103940866e-05,2.278926474855925e-05,2.091260486398663e-05,1.8892964058477754e-05,1.6803750082852904e-05,1.4713855203282381e-05,1.2684136024463438e-05,1.0764886428779256e-05,8.994399273823946e-06,7.398591029902421e-06,5.991561608373912e-06,4.776889396099119e-06,3.74942344708116e-06,2.89732987679028e-06,2.2041723362328634e-06,1.6508488013748636e-06,1.2172595732661479e-06,8.836356876927722e-07,6.315059474372472e-07,4.4431992719399447e-07,3.0777141849407074e-07,2.098818723227657e-07,1.4312700167302365e-07,2.098818723227657e-07,3.0299986491951354e-07,4.30649640176529e-07,6.025871846438092e-07,8.300989077867598e-07,1.125781071711261e-06,1.503114938723624e-06,1.9758073126246034e-06,2.5568846420332317e-06,3.257555543129043e-06,4.0858900240177576e-06,5.045400724681831e-06,6.133647397297426e-06,7.341014737720513e-06,8.649829248723157e-06,1.0033977470232404e-05,1.145916195431559e-05,1.2883882102250574e-05,1.4261157470293979e-05,1.554092832170822e-05,1.6672982262248714e-05,1.7610178886966095e-05,1.831168866324372e-05,1.8745937845727687e-05,1.8892964058477764e-05,1.8745937845727687e-05,1.831168866324372e-05,1.7610178886966095e-05,1.6672982262248714e-05,1.554092832170822e-05,1.4261157470293979e-05,1.2883882102250574e-05,1.145916195431559e-05,1.0033977470232404e-05,8.649829248723157e-06,7.341014737720513e-06,6.133647397297426e-06,5.045400724681831e-06,4.0858900240177576e-06,3.257555543129043e-06,2.5568846420332317e-06,1.9758073126246034e-06,1.503114938723624e-06,1.125781071711261e-06,8.300989077867598e-07,6.025871846438092e-07,4.30649640176529e-07,3.0299986491951354e-07,2.098818723227657e-07,1.4312700167302365e-07);
-const float kernel53[2809]=float[](1.2684098938741355e-07,1.836606148596357e-07,2.621007561165031e-07,3.686517846371077e-07,5.110462836662139e-07,6.982323320000839e-07,9.402330281212451e-07,1.2478629128759592e-06,1.6322778188668345e-06,2.104345800117682e-06,2.6738433677922104e-06,3.3485026373750013e-06,4.132959548825006e-06,5.027678412396835e-06,6.02795017807154e-06,7.123077085922832e-06,8.295860899037921e-06,9.522502721341667e-06,1.0772997930835728e-05,1.2012070552790115e-05,1.320064035966482e-05,1.429775829641013e-05,1.526288843745824e-05,1.605836538733356e-05,1.6651822318404265e-05,1.701837259481309e-05,1.7142340380474314e-05,1.701837259481309e-05,1.6651822318404265e-05,1.605836538733356e-05,1.526288843745824e-05,1.429775829641013e-05,1.320064035966482e-05,1.2012070552790115e-05,1.0772997930835728e-05,9.522502721341667e-06,8.295860899037921e-06,7.123077085922832e-06,6.02795017807154e-06,5.027678412396835e-06,4.132959548825006e-06,3.3485026373750013e-06,2.6738433677922104e-06,2.104345800117682e-06,1.6322778188668345e-06,1.2478629128759592e-06,9.402330281212451e-07,6.982323320000839e-07,5.110462836662139e-07,3.686517846371077e-07,2.621007561165031e-07,1.836606148596357e-07,1.2684098938741355e-07,1.836606148596357e-07,2.659331310290661e-07,3.795112783021943e-07,5.337928516842029e-07,7.399743185004065e-07,1.0110121344002835e-06,1.361419339994682e-06,1.8068549523792707e-06,2.363472165288673e-06,3.0470074807320646e-06,3.871616890870817e-06,4.8484961857324475e-06,5.984358018595879e-06,7.279874691902612e-06,8.728227691968214e-06,1.0313927095738857e-05,1.2012070552790123e-05,1.378819822559433e-05,1.5598864636853796e-05,1.7392991604034844e-05,1.9113992540628518e-05,2.0702574873589825e-05,2.210004422462953e-05,2.3251862626759295e-05,2.411116422460676e-05,2.4641914177499312e-05,2.4821414509744334e-05,2.4641914177499312e-05,2.411116422460676e-05,2.3251862626759295e-05,2.210004422462953e-05,2.0702574873589825e-05,1.9113992540628518e-05,1.7392991604034844e-05,1.5598864636853796e-05,1.378819822559433e-05,1.2012070552790123e-05,1.0313927095738857e-05,8.728227691968214e-06,7.279874691902612e-06,5.984358018595879e-06,4.8484961857324475e-06,3.871616890870817e-06,3.0470074807320646e-06,2.363472165288673e-06,1.8068549523792707e-06,1.361419339994682e-06,1.0110121344002835e-06,7.399743185004065e-07,5.337928516842029e-07,3.795112783021943e-07,2.659331310290661e-07,1.836606148596357e-07,2.621007561165031e-07,3.795112783021943e-07,5.415978437933837e-07,7.617719789457286e-07,1.0560120825794744e-06,1.4428082203241709e-06,1.942871849127515e-06,2.5785498408212966e-06,3.372894303201064e-06,4.3483626862671145e-06,5.52515690566647e-06,6.91925439365251e-06,8.540234729936968e-06,1.0389057352548463e-05,1.2455991609144108e-05,1.4718931940795558e-05,1.7142340380474308e-05,1.9677039539339743e-05,2.2261028685997895e-05,2.482141450974431e-05,2.727744269577184e-05,2.9544497235149763e-05,3.153881579842517e-05,3.31825676411261e-05,3.440887083465548e-05,3.5166300314395885e-05,3.542246396080717e-05,3.5166300314395885e-05,3.440887083465548e-05,3.31825676411261e-05,3.153881579842517e-05,2.9544497235149763e-05,2.727744269577184e-05,2.482141450974431e-05,2.2261028685997895e-05,1.9677039539339743e-05,1.7142340380474308e-05,1.4718931940795558e-05,1.2455991609144108e-05,1.0389057352548463e-05,8.540234729936968e-06,6.91925439365251e-06,5.52515690566647e-06,4.3483626862671145e-06,3.372894303201064e-06,2.5785498408212966e-06,1.942871849127515e-06,1.4428082203241709e-06,1.0560120825794744e-06,7.617719789457286e-07,5.415978437933837e-07,3.795112783021943e-07,2.621007561165031e-07,3.686517846371077e-07,5.337928516842029e-07,7.617719789457286e-07,1.0714528400675675e-06,1.4853094840681375e-06,2.029348687094857e-06,2.7327016721145496e-06,3.6267999172500193e-06,4.744066834033503e-06,6.116089431765072e-06,7.771282249825351e-06,9.732117977730383e-06,1.2012070552790115e-05,1.4612489450476273e-05,1.751968824574743e-05,2.0702574873589818e-05,2.4111164224606753e-05,2.7676286974647852e-05,3.131073742230325e-05,3.491198915949439e-05,3.836645906379192e-05,4.15551324357979e-05,4.436019529933116e-05,4.6672176612513185e-05,4.8397005138379174e-05,4.946235013615911e-05,4.982265121581984e-05,4.946235013615911e-05,4.8397005138379174e-05,4.6672176612513185e-05,4.436019529933116e-05,4.15551324357979e-05,3.836645906379192e-05,3.491198915949439e-05,3.131073742230325e-05,2.7676286974647852e-05,2.4111164224606753e-05,2.0702574873589818e-05,1.751968824574743e-05,1.4612489450476273e-05,1.2012070552790115e-05,9.732117977730383e-06,7.771282249825351e-06,6.116089431765072e-06,4.744066834033503e-06,3.6267999172500193e-06,2.7327016721145496e-06,2.029348687094857e-06,1.4853094840681375e-06,1.0714528400675675e-06,7.617719789457286e-07,5.337928516842029e-07,3.686517846371077e-07,5.110462836662139e-07,7.399743185004065e-07,1.0560120825794744e-06,1.4853094840681375e-06,2.0590213408960063e-06,2.8131997403013404e-06,3.788228057209347e-06,5.027678412396837e-06,6.5764980017213895e-06,8.478474552213329e-06,1.0772997930835726e-05,1.3491221070897896e-05,1.665182231840426e-05,2.0256672393783868e-05,2.4286798388331058e-05,2.8699098695220735e-05,3.342428108406002e-05,3.8366459063791915e-05,4.340474308097538e-05,4.8397005138379174e-05,5.3185789786108054e-05,5.760611201021765e-05,6.149465130827068e-05,6.469965263267898e-05,6.70907090301761e-05,6.856755147235703e-05,6.906702152901984e-05,6.856755147235703e-05,6.70907090301761e-05,6.469965263267898e-05,6.149465130827068e-05,5.760611201021765e-05,5.3185789786108054e-05,4.8397005138379174e-05,4.340474308097538e-05,3.8366459063791915e-05,3.342428108406002e-05,2.8699098695220735e-05,2.4286798388331058e-05,2.0256672393783868e-05,1.665182231840426e-05,1.3491221070897896e-05,1.0772997930835726e-05,8.478474552213329e-06,6.5764980017213895e-06,5.027678412396837e-06,3.788228057209347e-06,2.8131997403013404e-06,2.0590213408960063e-06,1.4853094840681375e-06,1.0560120825794744e-06,7.399743185004065e-07,5.110462836662139e-07,6.982323320000839e-07,1.0110121344002835e-06,1.4428082203241709e-06,2.029348687094857e-06,2.8131997403013404e-06,3.843618626792679e-06,5.1757803452906685e-06,6.869216614296273e-06,8.98533788993366e-06,1.1583970469222406e-05,1.4718931940795566e-05,1.843278593532306e-05,2.2751052303952252e-05,2.767628697464786e-05,3.318256764112613e-05,3.921100543870235e-05,4.56669277767266e-05,5.241932685727938e-05,5.930303369760629e-05,6.612386165332484e-05,7.266668248756036e-05,7.870608047043994e-05,8.401891406092329e-05,8.839784336797325e-05,9.166469597551235e-05,9.368247631235988e-05,9.436489227657746e-05,9.368247631235988e-05,9.166469597551235e-05,8.839784336797325e-05,8.401891406092329e-05,7.870608047043994e-05,7.266668248756036e-05,6.612386165332484e-05,5.930303369760629e-05,5.241932685727938e-05,4.56669277767266e-05,3.921100543870235e-05,3.318256764112613e-05,2.767628697464786e-05,2.2751052303952252e-05,1.843278593532306e-05,1.4718931940795566e-05,1.1583970469222406e-05,8.98533788993366e-06,6.869216614296273e-06,5.1757803452906685e-06,3.843618626792679e-06,2.8131997403013404e-06,2.029348687094857e-06,1.4428082203241709e-06,1.0110121344002835e-06,6.982323320000839e-07,9.402330281212451e-07,1.361419339994682e-06,1.942871849127515e-06,2.7327016721145496e-06,3.788228057209347e-06,5.1757803452906685e-06,6.969656665716369e-06,9.250021865329171e-06,1.2099570681215417e-05,1.5598864636853792e-05,1.98203739860661e-05,2.4821414509744327e-05,3.0636350997116655e-05,3.726862523651025e-05,4.468333049643183e-05,5.280116759088334e-05,6.14946513082707e-05,7.058736779191599e-05,7.98569020580243e-05,8.904176421519311e-05,9.785226462242331e-05,0.00010598486059833055,0.00011313907186261761,0.00011903569648683504,0.00012343480918735074,0.00012615193302887093,0.0001270708678863225,0.00012615193302887093,0.00012343480918735074,0.00011903569648683504,0.00011313907186261761,0.00010598486059833055,9.785226462242331e-05,8.904176421519311e-05,7.98569020580243e-05,7.058736779191599e-05,6.14946513082707e-05,5.280116759088334e-05,4.468333049643183e-05,3.726862523651025e-05,3.0636350997116655e-05,2.4821414509744327e-05,1.98203739860661e-05,1.5598864636853792e-05,1.2099570681215417e-05,9.250021865329171e-06,6.969656665716369e-06,5.1757803452906685e-06,3.788228057209347e-06,2.7327016721145496e-06,1.942871849127515e-06,1.361419339994682e-06,9.402330281212451e-07,1.2478629128759592e-06,1.8068549523792707e-06,2.5785498408212966e-06,3.6267999172500193e-06,5.027678412396837e-06,6.869216614296273e-06,9.250021865329171e-06,1.2276487725708259e-05,1.6058365387333563e-05,2.070257487358983e-05,2.6305297598367227e-05,3.2942602190567835e-05,4.066009707353361e-05,4.946235013615912e-05,5.9303033697606294e-05,7.007690308951251e-05,8.161476188638492e-05,9.368247631235989e-05,0.00010598486059833056,0.00011817486935468204,0.00012986803091488556,0.00014066148806881812,0.00015015644797830135,0.0001579823581087028,0.00016382079328844133,0.00016742691854687764,0.00016864651485297007,0.00016742691854687764,0.00016382079328844133,0.0001579823581087028,0.00015015644797830135,0.00014066148806881812,0.00012986803091488556,0.00011817486935468204,0.00010598486059833056,9.368247631235989e-05,8.161476188638492e-05,7.007690308951251e-05,5.9303033697606294e-05,4.946235013615912e-05,4.066009707353361e-05,3.2942602190567835e-05,2.6305297598367227e-05,2.070257487358983e-05,1.6058365387333563e-05,1.2276487725708259e-05,9.250021865329171e-06,6.869216614296273e-06,5.027678412396837e-06,3.6267999172500193e-06,2.5785498408212966e-06,1.8068549523792707e-06,1.2478629128759592e-06,1.6322778188668345e-06,2.363472165288673e-06,3.372894303201064e-06,4.744066834033503e-06,6.5764980017213895e-06,8.98533788993366e-06,1.2099570681215417e-05,1.6058365387333563e-05,2.1005282999070114e-05,2.7080181172873417e-05,3.4408870834655485e-05,4.309085420888928e-05,5.3185789786108034e-05,6.469965263267896e-05,7.75718434271131e-05,9.166469597551231e-05,0.00010675689143787114,0.00012254216911435921,0.00013863440872013865,0.0001545796545476047,0.00016987499512564764,0.00018399346961468384,0.00019641343361181878,0.00020665018268616945,0.00021428719805255715,0.00021900422122126008,0.00022059952466193898,0.00021900422122126008,0.00021428719805255715,0.00020665018268616945,0.00019641343361181878,0.00018399346961468384,0.00016987499512564764,0.0001545796545476047,0.00013863440872013865,0.00012254216911435921,0.00010675689143787114,9.166469597551231e-05,7.75718434271131e-05,6.469965263267896e-05,5.3185789786108034e-05,4.309085420888928e-05,3.4408870834655485e-05,2.7080181172873417e-05,2.1005282999070114e-05,1.6058365387333563e-05,1.2099570681215417e-05,8.98533788993366e-06,6.5764980017213895e-06,4.744066834033503e-06,3.372894303201064e-06,2.363472165288673e-06,1.6322778188668345e-06,2.104345800117682e-06,3.0470074807320646e-06,4.3483626862671145e-06,6.116089431765072e-06,8.478474552213329e-06,1.1583970469222406e-05,1.5598864636853792e-05,2.070257487358983e-05,2.7080181172873417e-05,3.4911989159494404e-05,4.436019529933116e-05,5.5553078667031285e-05,6.856755147235703e-05,8.341131681932044e-05,0.00010000624957126202,0.00011817486935468204,0.00013763185012638542,0.00015798235810870275,0.00017872860389939687,0.00019928534411912634,0.0002190042212212602,0.00023720587301831608,0.00025321779131610186,0.0002664150912318865,0.00027626079337029385,0.0002823420178894195,0.0002843986960213544,0.0002823420178894195,0.00027626079337029385,0.0002664150912318865,0.00025321779131610186,0.00023720587301831608,0.0002190042212212602,0.00019928534411912634,0.00017872860389939687,0.00015798235810870275,0.00013763185012638542,0.00011817486935468204,0.00010000624957126202,8.341131681932044e-05,6.856755147235703e-05,5.5553078667031285e-05,4.436019529933116e-05,3.4911989159494404e-05,2.7080181172873417e-05,2.070257487358983e-05,1.5598864636853792e-05,1.1583970469222406e-05,8.478474552213329e-06,6.116089431765072e-06,4.3483626862671145e-06,3.0470074807320646e-06,2.104345800117682e-06,2.6738433677922104e-06,3.871616890870817e-06,5.52515690566647e-06,7.771282249825351e-06,1.0772997930835726e-05,1.4718931940795566e-05,1.98203739860661e-05,2.6305297598367227e-05,3.4408870834655485e-05,4.436019529933116e-05,5.636536256942686e-05,7.058736779191598e-05,8.71239378717414e-05,0.00010598486059833052,0.00012707086788632248,0.0001501564479783013,0.00017487905725229523,0.00020073700835362024,0.0002270977954975071,0.00025321779131610175,0.0002782731737332414,0.00030140072526859237,0.0003217459373263117,0.0003385148128840323,0.00035102505020461237,0.00035875203207594265,0.0003613653075093101,0.00035875203207594265,0.00035102505020461237,0.0003385148128840323,0.0003217459373263117,0.00030140072526859237,0.0002782731737332414,0.00025321779131610175,0.0002270977954975071,0.00020073700835362024,0.00017487905725229523,0.0001501564479783013,0.00012707086788632248,0.00010598486059833052,8.71239378717414e-05,7.058736779191598e-05,5.636536256942686e-05,4.436019529933116e-05,3.4408870834655485e-05,2.6305297598367227e-05,1.98203739860661e-05,1.4718931940795566e-05,1.0772997930835726e-05,7.771282249825351e-06,5.52515690566647e-06,3.871616890870817e-06,2.6738433677922104e-06,3.3485026373750013e-06,4.8484961857324475e-06,6.91925439365251e-06,9.732117977730383e-06,1.3491221070897896e-05,1.843278593532306e-05,2.4821414509744327e-05,3.2942602190567835e-05,4.309085420888928e-05,5.5553078667031285e-05,7.058736779191598e-05,8.839784336797324e-05,0.00010910689057411275,0.00013272676683689382,0.00015913315692916362,0.0001880436483792111,0.00021900422122126013,0.000251386603264601,0.00028439869602135437,0.0003171092414258917,0.0003484865521221072,0.000377449605173376,0.0004029282839373749,0.00042392825151483414,0.00043959504904184804,0.0004492716888505823,0.0004525443411630637,0.0004492716888505823,0.00043959504904184804,0.00042392825151483414,0.0004029282839373749,0.000377449605173376,0.0003484865521221072,0.0003171092414258917,0.00028439869602135437,0.000251386603264601,0.00021900422122126013,0.0001880436483792111,0.00015913315692916362,0.00013272676683689382,0.00010910689057411275,8.839784336797324e-05,7.058736779191598e-05,5.5553078667031285e-05,4.309085420888928e-05,3.2942602190567835e-05,2.4821414509744327e-05,1.843278593532306e-05,1.3491221070897896e-05,9.732117977730383e-06,6.91925439365251e-06,4.8484961857324475e-06,3.3485026373750013e-06,4.132959548825006e-06,5.984358018595879e-06,8.540234729936968e-06,1.2012070552790115e-05,1.665182231840426e-05,2.2751052303952252e-05,3.0636350997116655e-05,4.066009707353361e-05,5.3185789786108034e-05,6.856755147235703e-05,8.71239378717414e-05,0.00010910689057411275,0.00013466746605115003,0.00016382079328844124,0.00019641343361181878,0.0002320968135100548,0.0002703105493262971,0.00031027918294357343,0.00035102505020461237,0.0003913987263271844,0.0004301268295727694,0.0004658750847287533,0.0004973226779048077,0.0005232423279464498,0.0005425794010955216,0.0005545229965556705,0.0005585623362515344,0.0005545229965556705,0.0005425794010955216,0.0005232423279464498,0.0004973226779048077,0.0004658750847287533,0.0004301268295727694,0.0003913987263271844,0.00035102505020461237,0.00031027918294357343,0.0002703105493262971,0.0002320968135100548,0.00019641343361181878,0.00016382079328844124,0.00013466746605115003,0.00010910689057411275,8.71239378717414e-05,6.856755147235703e-05,5.3185789786108034e-05,4.066009707353361e-05,3.0636350997116655e-05,2.2751052303952252e-05,1.665182231840426e-05,1.2012070552790115e-05,8.540234729936968e-06,5.984358018595879e-06,4.132959548825006e-06,5.027678412396835e-06,7.279874691902612e-06,1.0389057352548463e-05,1.4612489450476273e-05,2.0256672393783868e-05,2.767628697464786e-05,3.726862523651025e-05,4.946235013615912e-05,6.469965263267896e-05,8.341131681932044e-05,0.00010598486059833052,0.00013272676683689382,0.00016382079328844124,0.00019928534411912632,0.000238933763664739,0.0002823420178894194,0.0003288284091426264,0.00037744960517337595,0.0004270162933547188,0.0004761302170388413,0.0005232423279464499,0.0005667295018723818,0.0006049849900922064,0.0006365158249411208,0.0006600390615182041,0.000674568252126533,0.000679482043502741,0.000674568252126533,0.0006600390615182041,0.0006365158249411208,0.0006049849900922064,0.0005667295018723818,0.0005232423279464499,0.0004761302170388413,0.0004270162933547188,0.00037744960517337595,0.0003288284091426264,0.0002823420178894194,0.000238933763664739,0.00019928534411912632,0.00016382079328844124,0.00013272676683689382,0.00010598486059833052,8.341131681932044e-05,6.469965263267896e-05,4.946235013615912e-05,3.726862523651025e-05,2.767628697464786e-05,2.0256672393783868e-05,1.4612489450476273e-05,1.0389057352548463e-05,7.279874691902612e-06,5.027678412396835e-06,6.02795017807154e-06,8.728227691968214e-06,1.2455991609144108e-05,1.751968824574743e-05,2.4286798388331058e-05,3.318256764112613e-05,4.468333049643183e-05,5.9303033697606294e-05,7.75718434271131e-05,0.00010000624957126202,0.00012707086788632248,0.00015913315692916362,0.00019641343361181878,0.000238933763664739,0.0002864703557170325,0.0003385148128840324,0.0003942498117140559,0.00045254434116306366,0.000511972471274254,0.0005708577580275807,0.0006273429653221857,0.0006794820435027411,0.0007253485763458732,0.0007631525657724059,0.0007913558211285993,0.0008087756379766222,0.0008146670429495786,0.0008087756379766222,0.0007913558211285993,0.0007631525657724059,0.0007253485763458732,0.0006794820435027411,0.0006273429653221857,0.0005708577580275807,0.000511972471274254,0.00045254434116306366,0.0003942498117140559,0.0003385148128840324,0.0002864703557170325,0.000238933763664739,0.00019641343361181878,0.00015913315692916362,0.00012707086788632248,0.00010000624957126202,7.75718434271131e-05,5.9303033697606294e-05,4.468333049643183e-05,3.318256764112613e-05,2.4286798388331058e-05,1.751968824574743e-05,1.2455991609144108e-05,8.728227691968214e-06,6.02795017807154e-06,7.123077085922832e-06,1.0313927095738857e-05,1.4718931940795558e-05,2.0702574873589818e-05,2.8699098695220735e-05,3.921100543870235e-05,5.280116759088334e-05,7.007690308951251e-05,9.166469597551231e-05,0.00011817486935468204,0.0001501564479783013,0.0001880436483792111,0.0002320968135100548,0.0002823420178894194,0.0003385148128840324,0.0004000144386845477,0.0004658750847287534,0.0005347602637176952,0.0006049849900922064,0.0006745682521265329,0.0007413154006410418,0.0008029268377129834,0.0008571261657522477,0.00090179818905798,0.000935125266429479,0.0009557098257847491,0.0009626715508367273,0.0009557098257847491,0.000935125266429479,0.00090179818905798,0.0008571261657522477,0.0008029268377129834,0.0007413154006410418,0.0006745682521265329,0.0006049849900922064,0.0005347602637176952,0.0004658750847287534,0.0004000144386845477,0.0003385148128840324,0.0002823420178894194,0.0002320968135100548,0.0001880436483792111,0.0001501564479783013,0.00011817486935468204,9.166469597551231e-05,7.007690308951251e-05,5.280116759088334e-05,3.921100543870235e-05,2.8699098695220735e-05,2.0702574873589818e-05,1.4718931940795558e-05,1.0313927095738857e-05,7.123077085922832e-06,8.295860899037921e-06,1.2012070552790123e-05,1.7142340380474308e-05,2.4111164224606753e-05,3.342428108406002e-05,4.56669277767266e-05,6.14946513082707e-05,8.161476188638492e-05,0.00010675689143787114,0.00013763185012638542,0.00017487905725229523,0.00021900422122126013,0.0002703105493262971,0.0003288284091426264,0.0003942498117140559,0.0004658750847287534,0.0005425794010955217,0.0006228062266660264,0.0007045931503014976,0.0007856329952694666,0.0008633697729014406,0.000935125266429479,0.0009982482792526388,0.0010502753578526063,0.0010890895942718393,0.0011130633122338129,0.0011211712551848579,0.0011130633122338129,0.0010890895942718393,0.0010502753578526063,0.0009982482792526388,0.000935125266429479,0.0008633697729014406,0.0007856329952694666,0.0007045931503014976,0.0006228062266660264,0.0005425794010955217,0.0004658750847287534,0.0003942498117140559,0.0003288284091426264,0.0002703105493262971,0.00021900422122126013,0.00017487905725229523,0.00013763185012638542,0.00010675689143787114,8.161476188638492e-05,6.14946513082707e-05,4.56669277767266e-05,3.342428108406002e-05,2.4111164224606753e-05,1.7142340380474308e-05,1.2012070552790123e-05,8.295860899037921e-06,9.522502721341667e-06,1.378819822559433e-05,1.9677039539339743e-05,2.7676286974647852e-05,3.8366459063791915e-05,5.241932685727938e-05,7.058736779191599e-05,9.368247631235989e-05,0.00012254216911435921,0.00015798235810870275,0.00020073700835362024,0.000251386603264601,0.00031027918294357343,0.00037744960517337595,0.00045254434116306366,0.0005347602637176952,0.0006228062266660264,0.0007148955437504452,0.0008087756379766221,0.0009017981890579798,0.000991029274964284,0.0010733946726858398,0.0011458511746333991,0.001205571076350785,0.0012501244598304682,0.0012776429774758213,0.0012869497763428038,0.0012776429774758213,0.0012501244598304682,0.001205571076350785,0.0011458511746333991,0.0010733946726858398,0.000991029274964284,0.0009017981890579798,0.0008087756379766221,0.0007148955437504452,0.0006228062266660264,0.0005347602637176952,0.00045254434116306366,0.00037744960517337595,0.00031027918294357343,0.000251386603264601,0.00020073700835362024,0.00015798235810870275,0.00012254216911435921,9.368247631235989e-05,7.058736779191599e-05,5.241932685727938e-05,3.8366459063791915e-05,2.7676286974647852e-05,1.9677039539339743e-05,1.378819822559433e-05,9.522502721341667e-06,1.0772997930835728e-05,1.5598864636853796e-05,2.2261028685997895e-05,3.131073742230325e-05,4.340474308097538e-05,5.930303369760629e-05,7.98569020580243e-05,0.00010598486059833056,0.00013863440872013865,0.00017872860389939687,0.0002270977954975071,0.00028439869602135437,0.00035102505020461237,0.0004270162933547188,0.000511972471274254,0.0006049849900922064,0.0007045931503014976,0.0008087756379766221,0.0009149840676763694,0.0010202223416518198,0.001121171255184858,0.001214352878251043,0.0012963243691918906,0.0013638866893568632,0.0014142908238668644,0.0014454230736890294,0.0014559520415319055,0.0014454230736890294,0.0014142908238668644,0.0013638866893568632,0.0012963243691918906,0.001214352878251043,0.001121171255184858,0.0010202223416518198,0.0009149840676763694,0.0008087756379766221,0.0007045931503014976,0.0006049849900922064,0.000511972471274254,0.0004270162933547188,0.00035102505020461237,0.00028439869602135437,0.0002270977954975071,0.00017872860389939687,0.00013863440872013865,0.00010598486059833056,7.98569020580243e-05,5.930303369760629e-05,4.340474308097538e-05,3.131073742230325e-05,2.2261028685997895e-05,1.5598864636853796e-05,1.0772997930835728e-05,1.2012070552790115e-05,1.7392991604034844e-05,2.482141450974431e-05,3.491198915949439e-05,4.8397005138379174e-05,6.612386165332484e-05,8.904176421519311e-05,0.00011817486935468204,0.0001545796545476047,0.00019928534411912634,0.00025321779131610175,0.0003171092414258917,0.0003913987263271844,0.0004761302170388413,0.0005708577580275807,0.0006745682521265329,0.0007856329952694666,0.0009017981890579798,0.0010202223416518198,0.001137564754596004,0.0012501244598304682,0.0013540235079580751,0.0014454230736890294,0.0015207561761125335,0.0015769576182527425,0.0016116705907912906,0.0016234105637671207,0.0016116705907912906,0.0015769576182527425,0.0015207561761125335,0.0014454230736890294,0.0013540235079580751,0.0012501244598304682,0.001137564754596004,0.0010202223416518198,0.0009017981890579798,0.0007856329952694666,0.0006745682521265329,0.0005708577580275807,0.0004761302170388413,0.0003913987263271844,0.0003171092414258917,0.00025321779131610175,0.00019928534411912634,0.0001545796545476047,0.00011817486935468204,8.904176421519311e-05,6.612386165332484e-05,4.8397005138379174e-05,3.491198915949439e-05,2.482141450974431e-05,1.7392991604034844e-05,1.2012070552790115e-05,1.320064035966482e-05,1.9113992540628518e-05,2.727744269577184e-05,3.836645906379192e-05,5.3185789786108054e-05,7.266668248756036e-05,9.785226462242331e-05,0.00012986803091488556,0.00016987499512564764,0.0002190042212212602,0.0002782731737332414,0.0003484865521221072,0.0004301268295727694,0.0005232423279464499,0.0006273429653221857,0.0007413154006410418,0.0008633697729014406,0.000991029274964284,0.001121171255184858,0.0012501244598304682,0.0013738217176229573,0.0014880013640058592,0.001588444729780432,0.0016712318885720933,0.0017329943484350257,0.0017711420985903773,0.0017840437178744998,0.0017711420985903773,0.0017329943484350257,0.0016712318885720933,0.001588444729780432,0.0014880013640058592,0.0013738217176229573,0.0012501244598304682,0.001121171255184858,0.000991029274964284,0.0008633697729014406,0.0007413154006410418,0.0006273429653221857,0.0005232423279464499,0.0004301268295727694,0.0003484865521221072,0.0002782731737332414,0.0002190042212212602,0.00016987499512564764,0.00012986803091488556,9.785226462242331e-05,7.266668248756036e-05,5.3185789786108054e-05,3.836645906379192e-05,2.727744269577184e-05,1.9113992540628518e-05,1.320064035966482e-05,1.429775829641013e-05,2.0702574873589825e-05,2.9544497235149763e-05,4.15551324357979e-05,5.760611201021765e-05,7.870608047043994e-05,0.00010598486059833055,0.00014066148806881812,0.00018399346961468384,0.00023720587301831608,0.00030140072526859237,0.000377449605173376,0.0004658750847287533,0.0005667295018723818,0.0006794820435027411,0.0008029268377129834,0.000935125266429479,0.0010733946726858398,0.001214352878251043,0.0013540235079580751,0.0014880013640058592,0.0016116705907912908,0.0017204619014545882,0.0018101295807640297,0.0018770251781632427,0.0019183434245825328,0.001932317309873759,0.0019183434245825328,0.0018770251781632427,0.0018101295807640297,0.0017204619014545882,0.0016116705907912908,0.0014880013640058592,0.0013540235079580751,0.001214352878251043,0.0010733946726858398,0.000935125266429479,0.0008029268377129834,0.0006794820435027411,0.0005667295018723818,0.0004658750847287533,0.000377449605173376,0.00030140072526859237,0.00023720587301831608,0.00018399346961468384,0.00014066148806881812,0.00010598486059833055,7.870608047043994e-05,5.760611201021765e-05,4.15551324357979e-05,2.9544497235149763e-05,2.0702574873589825e-05,1.429775829641013e-05,1.526288843745824e-05,2.210004422462953e-05,3.153881579842517e-05,4.436019529933116e-05,6.149465130827068e-05,8.401891406092329e-05,0.00011313907186261761,0.00015015644797830135,0.00019641343361181878,0.00025321779131610186,0.0003217459373263117,0.0004029282839373749,0.0004973226779048077,0.0006049849900922064,0.0007253485763458732,0.0008571261657522477,0.0009982482792526388,0.0011458511746333991,0.0012963243691918906,0.0014454230736890294,0.001588444729780432,0.0017204619014545882,0.0018365968649359386,0.001932317309873759,0.0020037285072722817,0.0020478358262278253,0.0020627529795197073,0.0020478358262278253,0.0020037285072722817,0.001932317309873759,0.0018365968649359386,0.0017204619014545882,0.001588444729780432,0.0014454230736890294,0.0012963243691918906,0.0011458511746333991,0.0009982482792526388,0.0008571261657522477,0.0007253485763458732,0.0006049849900922064,0.0004973226779048077,0.0004029282839373749,0.0003217459373263117,0.00025321779131610186,0.00019641343361181878,0.00015015644797830135,0.00011313907186261761,8.401891406092329e-05,6.149465130827068e-05,4.436019529933116e-05,3.153881579842517e-05,2.210004422462953e-05,1.526288843745824e-05,1.605836538733356e-05,2.3251862626759295e-05,3.31825676411261e-05,4.6672176612513185e-05,6.469965263267898e-05,8.839784336797325e-05,0.00011903569648683504,0.0001579823581087028,0.00020665018268616945,0.0002664150912318865,0.0003385148128840323,0.00042392825151483414,0.0005232423279464498,0.0006365158249411208,0.0007631525657724059,0.00090179818905798,0.0010502753578526063,0.001205571076350785,0.0013638866893568632,0.0015207561761125335,0.0016712318885720933,0.0018101295807640297,0.001932317309873759,0.002033026548898089,0.002108159581893215,0.0021545657026577156,0.002170260313745353,0.0021545657026577156,0.002108159581893215,0.002033026548898089,0.001932317309873759,0.0018101295807640297,0.0016712318885720933,0.0015207561761125335,0.0013638866893568632,0.001205571076350785,0.0010502753578526063,0.00090179818905798,0.0007631525657724059,0.0006365158249411208,0.0005232423279464498,0.00042392825151483414,0.0003385148128840323,0.0002664150912318865,0.00020665018268616945,0.0001579823581087028,0.00011903569648683504,8.839784336797325e-05,6.469965263267898e-05,4.6672176612513185e-05,3.31825676411261e-05,2.3251862626759295e-05,1.605836538733356e-05,1.6651822318404265e-05,2.411116422460676e-05,3.440887083465548e-05,4.8397005138379174e-05,6.70907090301761e-05,9.166469597551235e-05,0.00012343480918735074,0.00016382079328844133,0.00021428719805255715,0.00027626079337029385,0.00035102505020461237,0.00043959504904184804,0.0005425794010955216,0.0006600390615182041,0.0007913558211285993,0.000935125266429479,0.0010890895942718393,0.0012501244598304682,0.0014142908238668644,0.0015769576182527425,0.0017329943484350257,0.0018770251781632427,0.0020037285072722817,0.002108159581893215,0.0021860692498762643,0.002234190366740774,0.0022504649917654313,0.002234190366740774,0.0021860692498762643,0.002108159581893215,0.0020037285072722817,0.0018770251781632427,0.0017329943484350257,0.0015769576182527425,0.0014142908238668644,0.0012501244598304682,0.0010890895942718393,0.000935125266429479,0.0007913558211285993,0.0006600390615182041,0.0005425794010955216,0.00043959504904184804,0.00035102505020461237,0.00027626079337029385,0.00021428719805255715,0.00016382079328844133,0.00012343480918735074,9.166469597551235e-05,6.70907090301761e-05,4.8397005138379174e-05,3.440887083465548e-05,2.411116422460676e-05,1.6651822318404265e-05,1.701837259481309e-05,2.4641914177499312e-05,3.5166300314395885e-05,4.946235013615911e-05,6.856755147235703e-05,9.368247631235988e-05,0.00012615193302887093,0.00016742691854687764,0.00021900422122126008,0.0002823420178894195,0.00035875203207594265,0.0004492716888505823,0.0005545229965556705,0.000674568252126533,0.0008087756379766222,0.0009557098257847491,0.0011130633122338129,0.0012776429774758213,0.0014454230736890294,0.0016116705907912906,0.0017711420985903773,0.0019183434245825328,0.0020478358262278253,0.0021545657026577156,0.002234190366740774,0.0022833707555786754,0.002300003627778157,0.0022833707555786754,0.002234190366740774,0.0021545657026577156,0.0020478358262278253,0.0019183434245825328,0.0017711420985903773,0.0016116705907912906,0.0014454230736890294,0.0012776429774758213,0.0011130633122338129,0.0009557098257847491,0.0008087756379766222,0.000674568252126533,0.0005545229965556705,0.0004492716888505823,0.00035875203207594265,0.0002823420178894195,0.00021900422122126008,0.00016742691854687764,0.00012615193302887093,9.368247631235988e-05,6.856755147235703e-05,4.946235013615911e-05,3.5166300314395885e-05,2.4641914177499312e-05,1.701837259481309e-05,1.7142340380474314e-05,2.4821414509744334e-05,3.542246396080717e-05,4.982265121581984e-05,6.906702152901984e-05,9.436489227657746e-05,0.0001270708678863225,0.00016864651485297007,0.00022059952466193898,0.0002843986960213544,0.0003613653075093101,0.0004525443411630637,0.0005585623362515344,0.000679482043502741,0.0008146670429495786,0.0009626715508367273,0.0011211712551848579,0.0012869497763428038,0.0014559520415319055,0.0016234105637671207,0.0017840437178744998,0.001932317309873759,0.0020627529795197073,0.002170260313745353,0.0022504649917654313,0.002300003627778157,0.002316757659643421,0.002300003627778157,0.0022504649917654313,0.002170260313745353,0.0020627529795197073,0.001932317309873759,0.0017840437178744998,0.0016234105637671207,0.0014559520415319055,0.0012869497763428038,0.0011211712551848579,0.0009626715508367273,0.0008146670429495786,0.000679482043502741,0.0005585623362515344,0.0004525443411630637,0.0003613653075093101,0.0002843986960213544,0.00022059952466193898,0.00016864651485297007,0.0001270708678863225,9.436489227657746e-05,6.906702152901984e-05,4.982265121581984e-05,3.542246396080717e-05,2.4821414509744334e-05,1.7142340380474314e-05,1.701837259481309e-05,2.4641914177499312e-05,3.5166300314395885e-05,4.946235013615911e-05,6.856755147235703e-05,9.368247631235988e-05,0.00012615193302887093,0.00016742691854687764,0.00021900422122126008,0.0002823420178894195,0.00035875203207594265,0.0004492716888505823,0.0005545229965556705,0.000674568252126533,0.0008087756379766222,0.0009557098257847491,0.0011130633122338129,0.0012776429774758213,0.0014454230736890294,0.0016116705907912906,0.0017711420985903773,0.0019183434245825328,0.0020478358262278253,0.0021545657026577156,0.002234190366740774,0.0022833707555786754,0.002300003627778157,0.0022833707555786754,0.002234190366740774,0.0021545657026577156,0.0020478358262278253,0.0019183434245825328,0.0017711420985903773,0.0016116705907912906,0.0014454230736890294,0.0012776429774758213,0.0011130633122338129,0.0009557098257847491,0.0008087756379766222,0.000674568252126533,0.0005545229965556705,0.0004492716888505823,0.00035875203207594265,0.0002823420178894195,0.00021900422122126008,0.00016742691854687764,0.00012615193302887093,9.368247631235988e-05,6.856755147235703e-05,4.946235013615911e-05,3.5166300314395885e-05,2.4641914177499312e-05,1.701837259481309e-05,1.6651822318404265e-05,2.411116422460676e-05,3.440887083465548e-05,4.8397005138379174e-05,6.70907090301761e-05,9.166469597551235e-05,0.00012343480918735074,0.00016382079328844133,0.00021428719805255715,0.00027626079337029385,0.00035102505020461237,0.00043959504904184804,0.0005425794010955216,0.0006600390615182041,0.0007913558211285993,0.000935125266429479,0.0010890895942718393,0.0012501244598304682,0.0014142908238668644,0.0015769576182527425,0.0017329943484350257,0.0018770251781632427,0.0020037285072722817,0.002108159581893215,0.0021860692498762643,0.002234190366740774,0.0022504649917654313,0.002234190366740774,0.0021860692498762643,0.002108159581893215,0.0020037285072722817,0.0018770251781632427,0.0017329943484350257,0.0015769576182527425,0.0014142908238668644,0.0012501244598304682,0.0010890895942718393,0.000935125266429479,0.0007913558211285993,0.0006600390615182041,0.0005425794010955216,0.00043959504904184804,0.00035102505020461237,0.00027626079337029385,0.00021428719805255715,0.00016382079328844133,0.00012343480918735074,9.166469597551235e-05,6.70907090301761e-05,4.8397005138379174e-05,3.440887083465548e-05,2.411116422460676e-05,1.6651822318404265e-05,1.605836538733356e-05,2.3251862626759295e-05,3.31825676411261e-05,4.6672176612513185e-05,6.469965263267898e-05,8.839784336797325e-05,0.00011903569648683504,0.0001579823581087028,0.00020665018268616945,0.0002664150912318865,0.0003385148128840323,0.00042392825151483414,0.0005232423279464498,0.0006365158249411208,0.0007631525657724059,0.00090179818905798,0.0010502753578526063,0.001205571076350785,0.0013638866893568632,0.0015207561761125335,0.0016712318885720933,0.0018101295807640297,0.001932317309873759,0.002033026548898089,0.002108159581893215,0.0021545657026577156,0.002170260313745353,0.0021545657026577156,0.002108159581893215,0.002033026548898089,0.001932317309873759,0.0018101295807640297,0.0016712318885720933,0.0015207561761125335,0.0013638866893568632,0.001205571076350785,0.0010502753578526063,0.00090179818905798,0.0007631525657724059,0.0006365158249411208,0.0005232423279464498,0.00042392825151483414,0.0003385148128840323,0.0002664150912318865,0.00020665018268616945,0.0001579823581087028,0.00011903569648683504,8.839784336797325e-05,6.469965263267898e-05,4.6672176612513185e-05,3.31825676411261e-05,2.3251862626759295e-05,1.605836538733356e-05,1.526288843745824e-05,2.210004422462953e-05,3.153881579842517e-05,4.436019529933116e-05,6.149465130827068e-05,8.401891406092329e-05,0.00011313907186261761,0.00015015644797830135,0.00019641343361181878,0.00025321779131610186,0.0003217459373263117,0.0004029282839373749,0.0004973226779048077,0.0006049849900922064,0.0007253485763458732,0.0008571261657522477,0.0009982482792526388,0.0011458511746333991,0.0012963243691918906,0.0014454230736890294,0.001588444729780432,0.0017204619014545882,0.0018365968649359386,0.001932317309873759,0.0020037285072722817,0.0020478358262278253,0.0020627529795197073,0.0020478358262278253,0.0020037285072722817,0.001932317309873759,0.0018365968649359386,0.0017204619014545882,0.001588444729780432,0.0014454230736890294,0.0012963243691918906,0.0011458511746333991,0.0009982482792526388,0.0008571261657522477,0.0007253485763458732,0.0006049849900922064,0.0004973226779048077,0.0004029282839373749,0.0003217459373263117,0.00025321779131610186,0.00019641343361181878,0.00015015644797830135,0.00011313907186261761,8.401891406092329e-05,6.149465130827068e-05,4.436019529933116e-05,3.153881579842517e-05,2.210004422462953e-05,1.526288843745824e-05,1.429775829641013e-05,2.0702574873589825e-05,2.9544497235149763e-05,4.15551324357979e-05,5.760611201021765e-05,7.870608047043994e-05,0.00010598486059833055,0.00014066148806881812,0.00018399346961468384,0.00023720587301831608,0.00030140072526859237,0.000377449605173376,0.0004658750847287533,0.0005667295018723818,0.0006794820435027411,0.0008029268377129834,0.000935125266429479,0.0010733946726858398,0.001214352878251043,0.0013540235079580751,0.0014880013640058592,0.0016116705907912908,0.0017204619014545882,0.0018101295807640297,0.0018770251781632427,0.0019183434245825328,0.001932317309873759,0.0019183434245825328,0.0018770251781632427,0.0018101295807640297,0.0017204619014545882,0.0016116705907912908,0.0014880013640058592,0.0013540235079580751,0.001214352878251043,0.0010733946726858398,0.000935125266429479,0.0008029268377129834,0.0006794820435027411,0.0005667295018723818,0.0004658750847287533,0.000377449605173376,0.00030140072526859237,0.00023720587301831608,0.00018399346961468384,0.00014066148806881812,0.00010598486059833055,7.870608047043994e-05,5.760611201021765e-05,4.15551324357979e-05,2.9544497235149763e-05,2.0702574873589825e-05,1.429775829641013e-05,1.320064035966482e-05,1.9113992540628518e-05,2.727744269577184e-05,3.836645906379192e-05,5.3185789786108054e-05,7.266668248756036e-05,9.785226462242331e-05,0.00012986803091488556,0.00016987499512564764,0.0002190042212212602,0.0002782731737332414,0.0003484865521221072,0.0004301268295727694,0.0005232423279464499,0.0006273429653221857,0.0007413154006410418,0.0008633697729014406,0.000991029274964284,0.001121171255184858,0.0012501244598304682,0.0013738217176229573,0.0014880013640058592,0.001588444729780432,0.0016712318885720933,0.0017329943484350257,0.0017711420985903773,0.0017840437178744998,0.0017711420985903773,0.0017329943484350257,0.0016712318885720933,0.001588444729780432,0.0014880013640058592,0.0013738217176229573,0.0012501244598304682,0.001121171255184858,0.000991029274964284,0.0008633697729014406,0.0007413154006410418,0.0006273429653221857,0.0005232423279464499,0.0004301268295727694,0.0003484865521221072,0.0002782731737332414,0.0002190042212212602,0.00016987499512564764,0.00012986803091488556,9.785226462242331e-05,7.266668248756036e-05,5.3185789786108054e-05,3.836645906379192e-05,2.727744269577184e-05,1.9113992540628518e-05,1.320064035966482e-05,1.2012070552790115e-05,1.7392991604034844e-05,2.482141450974431e-05,3.491198915949439e-05,4.8397005138379174e-05,6.612386165332484e-05,8.904176421519311e-05,0.00011817486935468204,0.0001545796545476047,0.00019928534411912634,0.00025321779131610175,0.0003171092414258917,0.0003913987263271844,0.0004761302170388413,0.0005708577580275807,0.0006745682521265329,0.0007856329952694666,0.0009017981890579798,0.0010202223416518198,0.001137564754596004,0.0012501244598304682,0.0013540235079580751,0.0014454230736890294,0.0015207561761125335,0.0015769576182527425,0.0016116705907912906,0.0016234105637671207,0.0016116705907912906,0.0015769576182527425,0.0015207561761125335,0.0014454230736890294,0.0013540235079580751,0.0012501244598304682,0.001137564754596004,0.0010202223416518198,0.0009017981890579798,0.0007856329952694666,0.0006745682521265329,0.0005708577580275807,0.0004761302170388413,0.0003913987263271844,0.0003171092414258917,0.00025321779131610175,0.00019928534411912634,0.0001545796545476047,0.00011817486935468204,8.904176421519311e-05,6.612386165332484e-05,4.8397005138379174e-05,3.491198915949439e-05,2.482141450974431e-05,1.7392991604034844e-05,1.2012070552790115e-05,1.0772997930835728e-05,1.5598864636853796e-05,2.2261028685997895e-05,3.131073742230325e-05,4.340474308097538e-05,5.930303369760629e-05,7.98569020580243e-05,0.00010598486059833056,0.00013863440872013865,0.00017872860389939687,0.0002270977954975071,0.00028439869602135437,0.00035102505020461237,0.0004270162933547188,0.000511972471274254,0.0006049849900922064,0.0007045931503014976,0.0008087756379766221,0.0009149840676763694,0.0010202223416518198,0.001121171255184858,0.001214352878251043,0.0012963243691918906,0.0013638866893568632,0.0014142908238668644,0.0014454230736890294,0.0014559520415319055,0.0014454230736890294,0.0014142908238668644,0.0013638866893568632,0.0012963243691918906,0.001214352878251043,0.001121171255184858,0.0010202223416518198,0.0009149840676763694,0.0008087756379766221,0.0007045931503014976,0.0006049849900922064,0.000511972471274254,0.0004270162933547188,0.00035102505020461237,0.00028439869602135437,0.0002270977954975071,0.00017872860389939687,0.00013863440872013865,0.00010598486059833056,7.98569020580243e-05,5.930303369760629e-05,4.340474308097538e-05,3.131073742230325e-05,2.2261028685997895e-05,1.5598864636853796e-05,1.0772997930835728e-05,9.522502721341667e-06,1.378819822559433e-05,1.9677039539339743e-05,2.7676286974647852e-05,3.8366459063791915e-05,5.241932685727938e-05,7.058736779191599e-05,9.368247631235989e-05,0.00012254216911435921,0.00015798235810870275,0.00020073700835362024,0.000251386603264601,0.00031027918294357343,0.00037744960517337595,0.00045254434116306366,0.0005347602637176952,0.0006228062266660264,0.0007148955437504452,0.0008087756379766221,0.0009017981890579798,0.000991029274964284,0.0010733946726858398,0.0011458511746333991,0.001205571076350785,0.0012501244598304682,0.0012776429774758213,0.0012869497763428038,0.0012776429774758213,0.0012501244598304682,0.001205571076350785,0.0011458511746333991,0.0010733946726858398,0.000991029274964284,0.0009017981890579798,0.0008087756379766221,0.0007148955437504452,0.0006228062266660264,0.0005347602637176952,0.00045254434116306366,0.00037744960517337595,0.00031027918294357343,0.000251386603264601,0.00020073700835362024,0.00015798235810870275,0.00012254216911435921,9.368247631235989e-05,7.058736779191599e-05,5.241932685727938e-05,3.8366459063791915e-05,2.7676286974647852e-05,1.9677039539339743e-05,1.378819822559433e-05,9.522502721341667e-06,8.295860899037921e-06,1.2012070552790123e-05,1.7142340380474308e-05,2.4111164224606753e-05,3.342428108406002e-05,4.56669277767266e-05,6.14946513082707e-05,8.161476188638492e-05,0.00010675689143787114,0.00013763185012638542,0.00017487905725229523,0.00021900422122126013,0.0002703105493262971,0.0003288284091426264,0.0003942498117140559,0.0004658750847287534,0.0005425794010955217,0.0006228062266660264,0.0007045931503014976,0.0007856329952694666,0.0008633697729014406,0.000935125266429479,0.0009982482792526388,0.0010502753578526063,0.0010890895942718393,0.0011130633122338129,0.0011211712551848579,0.0011130633122338129,0.0010890895942718393,0.0010502753578526063,0.0009982482792526388,0.000935125266429479,0.0008633697729014406,0.0007856329952694666,0.0007045931503014976,0.0006228062266660264,0.0005425794010955217,0.0004658750847287534,0.0003942498117140559,0.0003288284091426264,0.0002703105493262971,0.00021900422122126013,0.00017487905725229523,0.00013763185012638542,0.00010675689143787114,8.161476188638492e-05,6.14946513082707e-05,4.56669277767266e-05,3.342428108406002e-05,2.4111164224606753e-05,1.7142340380474308e-05,1.2012070552790123e-05,8.295860899037921e-06,7.123077085922832e-06,1.0313927095738857e-05,1.4718931940795558e-05,2.0702574873589818e-05,2.8699098695220735e-05,3.921100543870235e-05,5.280116759088334e-05,7.007690308951251e-05,9.166469597551231e-05,0.00011817486935468204,0.0001501564479783013,0.0001880436483792111,0.0002320968135100548,0.0002823420178894194,0.0003385148128840324,0.0004000144386845477,0.0004658750847287534,0.0005347602637176952,0.0006049849900922064,0.0006745682521265329,0.0007413154006410418,0.0008029268377129834,0.0008571261657522477,0.00090179818905798,0.000935125266429479,0.0009557098257847491,0.0009626715508367273,0.0009557098257847491,0.000935125266429479,0.00090179818905798,0.0008571261657522477,0.0008029268377129834,0.0007413154006410418,0.0006745682521265329,0.0006049849900922064,0.0005347602637176952,0.0004658750847287534,0.0004000144386845477,0.0003385148128840324,0.0002823420178894194,0.0002320968135100548,0.0001880436483792111,0.0001501564479783013,0.00011817486935468204,9.166469597551231e-05,7.007690308951251e-05,5.280116759088334e-05,3.921100543870235e-05,2.8699098695220735e-05,2.0702574873589818e-05,1.4718931940795558e-05,1.0313927095738857e-05,7.123077085922832e-06,6.02795017807154e-06,8.728227691968214e-06,1.2455991609144108e-05,1.751968824574743e-05,2.4286798388331058e-05,3.318256764112613e-05,4.468333049643183e-05,5.9303033697606294e-05,7.75718434271131e-05,0.00010000624957126202,0.00012707086788632248,0.00015913315692916362,0.00019641343361181878,0.000238933763664739,0.0002864703557170325,0.0003385148128840324,0.0003942498117140559,0.00045254434116306366,0.000511972471274254,0.0005708577580275807,0.0006273429653221857,0.0006794820435027411,0.0007253485763458732,0.0007631525657724059,0.0007913558211285993,0.0008087756379766222,0.0008146670429495786,0.0008087756379766222,0.0007913558211285993,0.0007631525657724059,0.0007253485763458732,0.0006794820435027411,0.0006273429653221857,0.0005708577580275807,0.000511972471274254,0.00045254434116306366,0.0003942498117140559,0.0003385148128840324,0.0002864703557170325,0.000238933763664739,0.00019641343361181878,0.00015913315692916362,0.00012707086788632248,0.00010000624957126202,7.75718434271131e-05,5.9303033697606294e-05,4.468333049643183e-05,3.318256764112613e-05,2.4286798388331058e-05,1.751968824574743e-05,1.2455991609144108e-05,8.728227691968214e-06,6.02795017807154e-06,5.027678412396835e-06,7.279874691902612e-06,1.0389057352548463e-05,1.4612489450476273e-05,2.0256672393783868e-05,2.767628697464786e-05,3.726862523651025e-05,4.946235013615912e-05,6.469965263267896e-05,8.341131681932044e-05,0.00010598486059833052,0.00013272676683689382,0.00016382079328844124,0.00019928534411912632,0.000238933763664739,0.0002823420178894194,0.0003288284091426264,0.00037744960517337595,0.0004270162933547188,0.0004761302170388413,0.0005232423279464499,0.0005667295018723818,0.0006049849900922064,0.0006365158249411208,0.0006600390615182041,0.000674568252126533,0.000679482043502741,0.000674568252126533,0.0006600390615182041,0.0006365158249411208,0.0006049849900922064,0.0005667295018723818,0.0005232423279464499,0.0004761302170388413,0.0004270162933547188,0.00037744960517337595,0.0003288284091426264,0.0002823420178894194,0.000238933763664739,0.00019928534411912632,0.00016382079328844124,0.00013272676683689382,0.00010598486059833052,8.341131681932044e-05,6.469965263267896e-05,4.946235013615912e-05,3.726862523651025e-05,2.767628697464786e-05,2.0256672393783868e-05,1.4612489450476273e-05,1.0389057352548463e-05,7.279874691902612e-06,5.027678412396835e-06,4.132959548825006e-06,5.984358018595879e-06,8.540234729936968e-06,1.2012070552790115e-05,1.665182231840426e-05,2.2751052303952252e-05,3.0636350997116655e-05,4.066009707353361e-05,5.3185789786108034e-05,6.856755147235703e-05,8.71239378717414e-05,0.00010910689057411275,0.00013466746605115003,0.00016382079328844124,0.00019641343361181878,0.0002320968135100548,0.0002703105493262971,0.00031027918294357343,0.00035102505020461237,0.0003913987263271844,0.0004301268295727694,0.0004658750847287533,0.0004973226779048077,0.0005232423279464498,0.0005425794010955216,0.0005545229965556705,0.0005585623362515344,0.0005545229965556705,0.0005425794010955216,0.0005232423279464498,0.0004973226779048077,0.0004658750847287533,0.0004301268295727694,0.0003913987263271844,0.00035102505020461237,0.00031027918294357343,0.0002703105493262971,0.0002320968135100548,0.00019641343361181878,0.00016382079328844124,0.00013466746605115003,0.00010910689057411275,8.71239378717414e-05,6.856755147235703e-05,5.3185789786108034e-05,4.066009707353361e-05,3.0636350997116655e-05,2.2751052303952252e-05,1.665182231840426e-05,1.2012070552790115e-05,8.540234729936968e-06,5.984358018595879e-06,4.132959548825006e-06,3.3485026373750013e-06,4.8484961857324475e-06,6.91925439365251e-06,9.732117977730383e-06,1.3491221070897896e-05,1.843278593532306e-05,2.4821414509744327e-05,3.2942602190567835e-05,4.309085420888928e-05,5.5553078667031285e-05,7.058736779191598e-05,8.839784336797324e-05,0.00010910689057411275,0.00013272676683689382,0.00015913315692916362,0.0001880436483792111,0.00021900422122126013,0.000251386603264601,0.00028439869602135437,0.0003171092414258917,0.0003484865521221072,0.000377449605173376,0.0004029282839373749,0.00042392825151483414,0.00043959504904184804,0.0004492716888505823,0.0004525443411630637,0.0004492716888505823,0.00043959504904184804,0.00042392825151483414,0.0004029282839373749,0.000377449605173376,0.0003484865521221072,0.0003171092414258917,0.00028439869602135437,0.000251386603264601,0.00021900422122126013,0.0001880436483792111,0.00015913315692916362,0.00013272676683689382,0.00010910689057411275,8.839784336797324e-05,7.058736779191598e-05,5.5553078667031285e-05,4.309085420888928e-05,3.2942602190567835e-05,2.4821414509744327e-05,1.843278593532306e-05,1.3491221070897896e-05,9.732117977730383e-06,6.91925439365251e-06,4.8484961857324475e-06,3.3485026373750013e-06,2.6738433677922104e-06,3.871616890870817e-06,5.52515690566647e-06,7.771282249825351e-06,1.0772997930835726e-05,1.4718931940795566e-05,1.98203739860661e-05,2.6305297598367227e-05,3.4408870834655485e-05,4.436019529933116e-05,5.636536256942686e-05,7.058736779191598e-05,8.71239378717414e-05,0.00010598486059833052,0.00012707086788632248,0.0001501564479783013,0.00017487905725229523,0.00020073700835362024,0.0002270977954975071,0.00025321779131610175,0.0002782731737332414,0.00030140072526859237,0.0003217459373263117,0.0003385148128840323,0.00035102505020461237,0.00035875203207594265,0.0003613653075093101,0.00035875203207594265,0.00035102505020461237,0.0003385148128840323,0.0003217459373263117,0.00030140072526859237,0.0002782731737332414,0.00025321779131610175,0.0002270977954975071,0.00020073700835362024,0.00017487905725229523,0.0001501564479783013,0.00012707086788632248,0.00010598486059833052,8.71239378717414e-05,7.058736779191598e-05,5.636536256942686e-05,4.436019529933116e-05,3.4408870834655485e-05,2.6305297598367227e-05,1.98203739860661e-05,1.4718931940795566e-05,1.0772997930835726e-05,7.771282249825351e-06,5.52515690566647e-06,3.871616890870817e-06,2.6738433677922104e-06,2.104345800117682e-06,3.0470074807320646e-06,4.3483626862671145e-06,6.116089431765072e-06,8.478474552213329e-06,1.1583970469222406e-05,1.5598864636853792e-05,2.070257487358983e-05,2.7080181172873417e-05,3.4911989159494404e-05,4.436019529933116e-05,5.5553078667031285e-05,6.856755147235703e-05,8.341131681932044e-05,0.00010000624957126202,0.00011817486935468204,0.00013763185012638542,0.00015798235810870275,0.00017872860389939687,0.00019928534411912634,0.0002190042212212602,0.00023720587301831608,0.00025321779131610186,0.0002664150912318865,0.00027626079337029385,0.0002823420178894195,0.0002843986960213544,0.0002823420178894195,0.00027626079337029385,0.0002664150912318865,0.00025321779131610186,0.00023720587301831608,0.0002190042212212602,0.00019928534411912634,0.00017872860389939687,0.00015798235810870275,0.00013763185012638542,0.00011817486935468204,0.00010000624957126202,8.341131681932044e-05,6.856755147235703e-05,5.5553078667031285e-05,4.436019529933116e-05,3.4911989159494404e-05,2.7080181172873417e-05,2.070257487358983e-05,1.5598864636853792e-05,1.1583970469222406e-05,8.478474552213329e-06,6.116089431765072e-06,4.3483626862671145e-06,3.0470074807320646e-06,2.104345800117682e-06,1.6322778188668345e-06,2.363472165288673e-06,3.372894303201064e-06,4.744066834033503e-06,6.5764980017213895e-06,8.98533788993366e-06,1.2099570681215417e-05,1.6058365387333563e-05,2.1005282999070114e-05,2.7080181172873417e-05,3.4408870834655485e-05,4.309085420888928e-05,5.3185789786108034e-05,6.469965263267896e-05,7.75718434271131e-05,9.166469597551231e-05,0.00010675689143787114,0.00012254216911435921,0.00013863440872013865,0.0001545796545476047,0.00016987499512564764,0.00018399346961468384,0.00019641343361181878,0.00020665018268616945,0.00021428719805255715,0.00021900422122126008,0.00022059952466193898,0.00021900422122126008,0.00021428719805255715,0.00020665018268616945,0.00019641343361181878,0.00018399346961468384,0.00016987499512564764,0.0001545796545476047,0.00013863440872013865,0.00012254216911435921,0.00010675689143787114,9.166469597551231e-05,7.75718434271131e-05,6.469965263267896e-05,5.3185789786108034e-05,4.309085420888928e-05,3.4408870834655485e-05,2.7080181172873417e-05,2.1005282999070114e-05,1.6058365387333563e-05,1.2099570681215417e-05,8.98533788993366e-06,6.5764980017213895e-06,4.744066834033503e-06,3.372894303201064e-06,2.363472165288673e-06,1.6322778188668345e-06,1.2478629128759592e-06,1.8068549523792707e-06,2.5785498408212966e-06,3.6267999172500193e-06,5.027678412396837e-06,6.869216614296273e-06,9.250021865329171e-06,1.2276487725708259e-05,1.6058365387333563e-05,2.070257487358983e-05,2.6305297598367227e-05,3.2942602190567835e-05,4.066009707353361e-05,4.946235013615912e-05,5.9303033697606294e-05,7.007690308951251e-05,8.161476188638492e-05,9.368247631235989e-05,0.00010598486059833056,0.00011817486935468204,0.00012986803091488556,0.00014066148806881812,0.00015015644797830135,0.0001579823581087028,0.00016382079328844133,0.00016742691854687764,0.00016864651485297007,0.00016742691854687764,0.00016382079328844133,0.0001579823581087028,0.00015015644797830135,0.00014066148806881812,0.00012986803091488556,0.00011817486935468204,0.00010598486059833056,9.368247631235989e-05,8.161476188638492e-05,7.007690308951251e-05,5.9303033697606294e-05,4.946235013615912e-05,4.066009707353361e-05,3.2942602190567835e-05,2.6305297598367227e-05,2.070257487358983e-05,1.6058365387333563e-05,1.2276487725708259e-05,9.250021865329171e-06,6.869216614296273e-06,5.027678412396837e-06,3.6267999172500193e-06,2.5785498408212966e-06,1.8068549523792707e-06,1.2478629128759592e-06,9.402330281212451e-07,1.361419339994682e-06,1.942871849127515e-06,2.7327016721145496e-06,3.788228057209347e-06,5.1757803452906685e-06,6.969656665716369e-06,9.250021865329171e-06,1.2099570681215417e-05,1.5598864636853792e-05,1.98203739860661e-05,2.4821414509744327e-05,3.0636350997116655e-05,3.726862523651025e-05,4.468333049643183e-05,5.280116759088334e-05,6.14946513082707e-05,7.058736779191599e-05,7.98569020580243e-05,8.904176421519311e-05,9.785226462242331e-05,0.00010598486059833055,0.00011313907186261761,0.00011903569648683504,0.00012343480918735074,0.00012615193302887093,0.0001270708678863225,0.00012615193302887093,0.00012343480918735074,0.00011903569648683504,0.00011313907186261761,0.00010598486059833055,9.785226462242331e-05,8.904176421519311e-05,7.98569020580243e-05,7.058736779191599e-05,6.14946513082707e-05,5.280116759088334e-05,4.468333049643183e-05,3.726862523651025e-05,3.0636350997116655e-05,2.4821414509744327e-05,1.98203739860661e-05,1.5598864636853792e-05,1.2099570681215417e-05,9.250021865329171e-06,6.969656665716369e-06,5.1757803452906685e-06,3.788228057209347e-06,2.7327016721145496e-06,1.942871849127515e-06,1.361419339994682e-06,9.402330281212451e-07,6.982323320000839e-07,1.0110121344002835e-06,1.4428082203241709e-06,2.029348687094857e-06,2.8131997403013404e-06,3.843618626792679e-06,5.1757803452906685e-06,6.869216614296273e-06,8.98533788993366e-06,1.1583970469222406e-05,1.4718931940795566e-05,1.843278593532306e-05,2.2751052303952252e-05,2.767628697464786e-05,3.318256764112613e-05,3.921100543870235e-05,4.56669277767266e-05,5.241932685727938e-05,5.930303369760629e-05,6.612386165332484e-05,7.266668248756036e-05,7.870608047043994e-05,8.401891406092329e-05,8.839784336797325e-05,9.166469597551235e-05,9.368247631235988e-05,9.436489227657746e-05,9.368247631235988e-05,9.166469597551235e-05,8.839784336797325e-05,8.401891406092329e-05,7.870608047043994e-05,7.266668248756036e-05,6.612386165332484e-05,5.930303369760629e-05,5.241932685727938e-05,4.56669277767266e-05,3.921100543870235e-05,3.318256764112613e-05,2.767628697464786e-05,2.2751052303952252e-05,1.843278593532306e-05,1.4718931940795566e-05,1.1583970469222406e-05,8.98533788993366e-06,6.869216614296273e-06,5.1757803452906685e-06,3.843618626792679e-06,2.8131997403013404e-06,2.029348687094857e-06,1.4428082203241709e-06,1.0110121344002835e-06,6.982323320000839e-07,5.110462836662139e-07,7.399743185004065e-07,1.0560120825794744e-06,1.4853094840681375e-06,2.0590213408960063e-06,2.8131997403013404e-06,3.788228057209347e-06,5.027678412396837e-06,6.5764980017213895e-06,8.478474552213329e-06,1.0772997930835726e-05,1.3491221070897896e-05,1.665182231840426e-05,2.0256672393783868e-05,2.4286798388331058e-05,2.8699098695220735e-05,3.342428108406002e-05,3.8366459063791915e-05,4.340474308097538e-05,4.8397005138379174e-05,5.3185789786108054e-05,5.760611201021765e-05,6.149465130827068e-05,6.469965263267898e-05,6.70907090301761e-05,6.856755147235703e-05,6.906702152901984e-05,6.856755147235703e-05,6.70907090301761e-05,6.469965263267898e-05,6.149465130827068e-05,5.760611201021765e-05,5.3185789786108054e-05,4.8397005138379174e-05,4.340474308097538e-05,3.8366459063791915e-05,3.342428108406002e-05,2.8699098695220735e-05,2.4286798388331058e-05,2.0256672393783868e-05,1.665182231840426e-05,1.3491221070897896e-05,1.0772997930835726e-05,8.478474552213329e-06,6.5764980017213895e-06,5.027678412396837e-06,3.788228057209347e-06,2.8131997403013404e-06,2.0590213408960063e-06,1.4853094840681375e-06,1.0560120825794744e-06,7.399743185004065e-07,5.110462836662139e-07,3.686517846371077e-07,5.337928516842029e-07,7.617719789457286e-07,1.0714528400675675e-06,1.4853094840681375e-06,2.029348687094857e-06,2.7327016721145496e-06,3.6267999172500193e-06,4.744066834033503e-06,6.116089431765072e-06,7.771282249825351e-06,9.732117977730383e-06,1.2012070552790115e-05,1.4612489450476273e-05,1.751968824574743e-05,2.0702574873589818e-05,2.4111164224606753e-05,2.7676286974647852e-05,3.131073742230325e-05,3.491198915949439e-05,3.836645906379192e-05,4.15551324357979e-05,4.436019529933116e-05,4.6672176612513185e-05,4.8397005138379174e-05,4.946235013615911e-05,4.982265121581984e-05,4.946235013615911e-05,4.8397005138379174e-05,4.6672176612513185e-05,4.436019529933116e-05,4.15551324357979e-05,3.836645906379192e-05,3.491198915949439e-05,3.131073742230325e-05,2.7676286974647852e-05,2.4111164224606753e-05,2.0702574873589818e-05,1.751968824574743e-05,1.4612489450476273e-05,1.2012070552790115e-05,9.732117977730383e-06,7.771282249825351e-06,6.116089431765072e-06,4.744066834033503e-06,3.6267999172500193e-06,2.7327016721145496e-06,2.029348687094857e-06,1.4853094840681375e-06,1.0714528400675675e-06,7.617719789457286e-07,5.337928516842029e-07,3.686517846371077e-07,2.621007561165031e-07,3.795112783021943e-07,5.415978437933837e-07,7.617719789457286e-07,1.0560120825794744e-06,1.4428082203241709e-06,1.942871849127515e-06,2.5785498408212966e-06,3.372894303201064e-06,4.3483626862671145e-06,5.52515690566647e-06,6.91925439365251e-06,8.540234729936968e-06,1.0389057352548463e-05,1.2455991609144108e-05,1.4718931940795558e-05,1.7142340380474308e-05,1.9677039539339743e-05,2.2261028685997895e-05,2.482141450974431e-05,2.727744269577184e-05,2.9544497235149763e-05,3.153881579842517e-05,3.31825676411261e-05,3.440887083465548e-05,3.5166300314395885e-05,3.542246396080717e-05,3.5166300314395885e-05,3.440887083465548e-05,3.31825676411261e-05,3.153881579842517e-05,2.9544497235149763e-05,2.727744269577184e-05,2.482141450974431e-05,2.2261028685997895e-05,1.9677039539339743e-05,1.7142340380474308e-05,1.4718931940795558e-05,1.2455991609144108e-05,1.0389057352548463e-05,8.540234729936968e-06,6.91925439365251e-06,5.52515690566647e-06,4.3483626862671145e-06,3.372894303201064e-06,2.5785498408212966e-06,1.942871849127515e-06,1.4428082203241709e-06,1.0560120825794744e-06,7.617719789457286e-07,5.415978437933837e-07,3.795112783021943e-07,2.621007561165031e-07,1.836606148596357e-07,2.659331310290661e-07,3.795112783021943e-07,5.337928516842029e-07,7.399743185004065e-07,1.0110121344002835e-06,1.361419339994682e-06,1.8068549523792707e-06,2.363472165288673e-06,3.0470074807320646e-06,3.871616890870817e-06,4.8484961857324475e-06,5.984358018595879e-06,7.279874691902612e-06,8.728227691968214e-06,1.0313927095738857e-05,1.2012070552790123e-05,1.378819822559433e-05,1.5598864636853796e-05,1.7392991604034844e-05,1.9113992540628518e-05,2.0702574873589825e-05,2.210004422462953e-05,2.3251862626759295e-05,2.411116422460676e-05,2.4641914177499312e-05,2.4821414509744334e-05,2.4641914177499312e-05,2.411116422460676e-05,2.3251862626759295e-05,2.210004422462953e-05,2.0702574873589825e-05,1.9113992540628518e-05,1.7392991604034844e-05,1.5598864636853796e-05,1.378819822559433e-05,1.2012070552790123e-05,1.0313927095738857e-05,8.728227691968214e-06,7.279874691902612e-06,5.984358018595879e-06,4.8484961857324475e-06,3.871616890870817e-06,3.0470074807320646e-06,2.363472165288673e-06,1.8068549523792707e-06,1.361419339994682e-06,1.0110121344002835e-06,7.399743185004065e-07,5.337928516842029e-07,3.795112783021943e-07,2.659331310290661e-07,1.836606148596357e-07,1.2684098938741355e-07,1.836606148596357e-07,2.621007561165031e-07,3.686517846371077e-07,5.110462836662139e-07,6.982323320000839e-07,9.402330281212451e-07,1.2478629128759592e-06,1.6322778188668345e-06,2.104345800117682e-06,2.6738433677922104e-06,3.3485026373750013e-06,4.132959548825006e-06,5.027678412396835e-06,6.02795017807154e-06,7.123077085922832e-06,8.295860899037921e-06,9.522502721341667e-06,1.0772997930835728e-05,1.2012070552790115e-05,1.320064035966482e-05,1.429775829641013e-05,1.526288843745824e-05,1.605836538733356e-05,1.6651822318404265e-05,1.701837259481309e-05,1.7142340380474314e-05,1.701837259481309e-05,1.6651822318404265e-05,1.605836538733356e-05,1.526288843745824e-05,1.429775829641013e-05,1.320064035966482e-05,1.2012070552790115e-05,1.0772997930835728e-05,9.522502721341667e-06,8.295860899037921e-06,7.123077085922832e-06,6.02795017807154e-06,5.027678412396835e-06,4.132959548825006e-06,3.3485026373750013e-06,2.6738433677922104e-06,2.104345800117682e-06,1.6322778188668345e-06,1.2478629128759592e-06,9.402330281212451e-07,6.982323320000839e-07,5.110462836662139e-07,3.686517846371077e-07,2.621007561165031e-07,1.836606148596357e-07,1.2684098938741355e-07);
-const float kernel55[3025]=float[](1.1306247350033799e-07,1.6178079691949163e-07,2.2838282460586423e-07,3.180737953866271e-07,4.3703913085309566e-07,5.92435041178763e-07,7.922990478976193e-07,1.0453591176620935e-06,1.3607234542051932e-06,1.7474397525302735e-06,2.2139231091643913e-06,2.7672655550707622e-06,3.4124564905918015e-06,4.151560677342845e-06,4.982916829283069e-06,5.9004327996392544e-06,6.8930603412248976e-06,7.944531175849273e-06,9.03342511204346e-06,1.0133619776188636e-05,1.1215141133299758e-05,1.2245396808730241e-05,1.3190734047736783e-05,1.4018225666902872e-05,1.4697555589751094e-05,1.5202855145173355e-05,1.5514335722579434e-05,1.5619574336299427e-05,1.5514335722579434e-05,1.5202855145173355e-05,1.4697555589751094e-05,1.4018225666902872e-05,1.3190734047736783e-05,1.2245396808730241e-05,1.1215141133299758e-05,1.0133619776188636e-05,9.03342511204346e-06,7.944531175849273e-06,6.8930603412248976e-06,5.9004327996392544e-06,4.982916829283069e-06,4.151560677342845e-06,3.4124564905918015e-06,2.7672655550707622e-06,2.2139231091643913e-06,1.7474397525302735e-06,1.3607234542051932e-06,1.0453591176620935e-06,7.922990478976193e-07,5.92435041178763e-07,4.3703913085309566e-07,3.180737953866271e-07,2.2838282460586423e-07,1.6178079691949163e-07,1.1306247350033799e-07,1.6178079691949163e-07,2.3149171817674364e-07,3.2679238498484414e-07,4.5513095993519035e-07,6.253581465666805e-07,8.477137472553667e-07,1.1336986304925316e-06,1.4958016208793143e-06,1.9470556232586e-06,2.5004069606906466e-06,3.16789677273444e-06,3.959673027902303e-06,4.882875046063652e-06,5.940457289200753e-06,7.130042627473133e-06,8.442913824034569e-06,9.863261970950716e-06,1.1367808831608474e-05,1.292590431019157e-05,1.450016997077299e-05,1.604771604527457e-05,1.752190619026087e-05,1.8874586767196005e-05,2.005864235565339e-05,2.103069376128015e-05,2.1753725570406755e-05,2.2199422312018802e-05,2.235000796849015e-05,2.2199422312018802e-05,2.1753725570406755e-05,2.103069376128015e-05,2.005864235565339e-05,1.8874586767196005e-05,1.752190619026087e-05,1.604771604527457e-05,1.450016997077299e-05,1.292590431019157e-05,1.1367808831608474e-05,9.863261970950716e-06,8.442913824034569e-06,7.130042627473133e-06,5.940457289200753e-06,4.882875046063652e-06,3.959673027902303e-06,3.16789677273444e-06,2.5004069606906466e-06,1.9470556232586e-06,1.4958016208793143e-06,1.1336986304925316e-06,8.477137472553667e-07,6.253581465666805e-07,4.5513095993519035e-07,3.2679238498484414e-07,2.3149171817674364e-07,1.6178079691949163e-07,2.2838282460586423e-07,3.2679238498484414e-07,4.6132649463747155e-07,6.424995807586718e-07,8.828060104949278e-07,1.1967011149768707e-06,1.600420447999966e-06,2.1115942419077644e-06,2.748620796606766e-06,3.529776186174126e-06,4.472058654630878e-06,5.5897938930169085e-06,6.893060341224894e-06,8.386028756140377e-06,1.006534338950547e-05,1.1918698286524501e-05,1.3923776317372876e-05,1.604771604527457e-05,1.8247249322277244e-05,2.0469609732719033e-05,2.265425061984651e-05,2.473533635887674e-05,2.664488938885514e-05,2.831639778126853e-05,2.96886239657496e-05,3.070931399814198e-05,3.1338495475209645e-05,3.1551074336390366e-05,3.1338495475209645e-05,3.070931399814198e-05,2.96886239657496e-05,2.831639778126853e-05,2.664488938885514e-05,2.473533635887674e-05,2.265425061984651e-05,2.0469609732719033e-05,1.8247249322277244e-05,1.604771604527457e-05,1.3923776317372876e-05,1.1918698286524501e-05,1.006534338950547e-05,8.386028756140377e-06,6.893060341224894e-06,5.5897938930169085e-06,4.472058654630878e-06,3.529776186174126e-06,2.748620796606766e-06,2.1115942419077644e-06,1.600420447999966e-06,1.1967011149768707e-06,8.828060104949278e-07,6.424995807586718e-07,4.6132649463747155e-07,3.2679238498484414e-07,2.2838282460586423e-07,3.180737953866271e-07,4.5513095993519035e-07,6.424995807586718e-07,8.948233324415239e-07,1.229503395593953e-06,1.666672028603713e-06,2.2289408452155743e-06,2.940863858739158e-06,3.828064787113942e-06,4.915997121671949e-06,6.228334691651468e-06,7.785029202827474e-06,9.600117120655594e-06,1.1679407150210344e-05,1.401822566690287e-05,1.6599433896158208e-05,1.93919502792046e-05,2.235000796849016e-05,2.5413346460352658e-05,2.8508476804265797e-05,3.1551074336390386e-05,3.444944833049735e-05,3.710892493862433e-05,3.943687153142549e-05,4.1348001194437796e-05,4.276953870750001e-05,4.3645813623283404e-05,4.394187689035004e-05,4.3645813623283404e-05,4.276953870750001e-05,4.1348001194437796e-05,3.943687153142549e-05,3.710892493862433e-05,3.444944833049735e-05,3.1551074336390386e-05,2.8508476804265797e-05,2.5413346460352658e-05,2.235000796849016e-05,1.93919502792046e-05,1.6599433896158208e-05,1.401822566690287e-05,1.1679407150210344e-05,9.600117120655594e-06,7.785029202827474e-06,6.228334691651468e-06,4.915997121671949e-06,3.828064787113942e-06,2.940863858739158e-06,2.2289408452155743e-06,1.666672028603713e-06,1.229503395593953e-06,8.948233324415239e-07,6.424995807586718e-07,4.5513095993519035e-07,3.180737953866271e-07,4.3703913085309566e-07,6.253581465666805e-07,8.828060104949278e-07,1.229503395593953e-06,1.6893598378268123e-06,2.2900374232738724e-06,3.0626049169875593e-06,4.040799976050715e-06,5.25983005099815e-06,6.754668697936245e-06,8.557844185161014e-06,1.0696770516206864e-05,1.3190734047736782e-05,1.6047716045274578e-05,1.926129486435325e-05,2.2807921519634265e-05,2.664488938885515e-05,3.0709313998142e-05,3.491839632875359e-05,3.917116123740194e-05,4.3351745115301015e-05,4.7334163251105035e-05,5.0988332070410497e-05,5.418697267000331e-05,5.681289929138755e-05,5.87661174696679e-05,5.997013500628023e-05,6.0376931274294225e-05,5.997013500628023e-05,5.87661174696679e-05,5.681289929138755e-05,5.418697267000331e-05,5.0988332070410497e-05,4.7334163251105035e-05,4.3351745115301015e-05,3.917116123740194e-05,3.491839632875359e-05,3.0709313998142e-05,2.664488938885515e-05,2.2807921519634265e-05,1.926129486435325e-05,1.6047716045274578e-05,1.3190734047736782e-05,1.0696770516206864e-05,8.557844185161014e-06,6.754668697936245e-06,5.25983005099815e-06,4.040799976050715e-06,3.0626049169875593e-06,2.2900374232738724e-06,1.6893598378268123e-06,1.229503395593953e-06,8.828060104949278e-07,6.253581465666805e-07,4.3703913085309566e-07,5.92435041178763e-07,8.477137472553667e-07,1.1967011149768707e-06,1.666672028603713e-06,2.2900374232738724e-06,3.1042950605130126e-06,4.1515606773428465e-06,5.477567867970679e-06,7.130042627473142e-06,9.156393891776878e-06,1.1600715849724447e-05,1.4500169970773005e-05,1.7880900169041918e-05,2.175372557040678e-05,2.6109941217037337e-05,3.0917624923678644e-05,3.6118885078956484e-05,4.1628477677840305e-05,4.733416325110507e-05,5.309906340743814e-05,5.876611746966794e-05,6.416454494610634e-05,6.911800906890376e-05,7.345397498490043e-05,7.701358975677564e-05,7.966130436672801e-05,8.129342865155011e-05,8.184486752001439e-05,8.129342865155011e-05,7.966130436672801e-05,7.701358975677564e-05,7.345397498490043e-05,6.911800906890376e-05,6.416454494610634e-05,5.876611746966794e-05,5.309906340743814e-05,4.733416325110507e-05,4.1628477677840305e-05,3.6118885078956484e-05,3.0917624923678644e-05,2.6109941217037337e-05,2.175372557040678e-05,1.7880900169041918e-05,1.4500169970773005e-05,1.1600715849724447e-05,9.156393891776878e-06,7.130042627473142e-06,5.477567867970679e-06,4.1515606773428465e-06,3.1042950605130126e-06,2.2900374232738724e-06,1.666672028603713e-06,1.1967011149768707e-06,8.477137472553667e-07,5.92435041178763e-07,7.922990478976193e-07,1.1336986304925316e-06,1.600420447999966e-06,2.2289408452155743e-06,3.0626049169875593e-06,4.1515606773428465e-06,5.552132036962711e-06,7.325481284754452e-06,9.535435267259667e-06,1.224539680873025e-05,1.5514335722579434e-05,1.93919502792046e-05,2.3913204308942112e-05,2.9092566880186806e-05,3.491839632875357e-05,4.134800119443779e-05,4.8303959540005986e-05,5.5672269425447486e-05,6.330282625123254e-05,7.101257430394658e-05,7.859146688422894e-05,8.581110895876971e-05,9.243567475163474e-05,9.823442301629737e-05,0.0001029949101559972,0.00010653585830855065,0.00010871859637607313,0.00010945606877404048,0.00010871859637607313,0.00010653585830855065,0.0001029949101559972,9.823442301629737e-05,9.243567475163474e-05,8.581110895876971e-05,7.859146688422894e-05,7.101257430394658e-05,6.330282625123254e-05,5.5672269425447486e-05,4.8303959540005986e-05,4.134800119443779e-05,3.491839632875357e-05,2.9092566880186806e-05,2.3913204308942112e-05,1.93919502792046e-05,1.5514335722579434e-05,1.224539680873025e-05,9.535435267259667e-06,7.325481284754452e-06,5.552132036962711e-06,4.1515606773428465e-06,3.0626049169875593e-06,2.2289408452155743e-06,1.600420447999966e-06,1.1336986304925316e-06,7.922990478976193e-07,1.0453591176620935e-06,1.4958016208793143e-06,2.1115942419077644e-06,2.940863858739158e-06,4.040799976050715e-06,5.477567867970679e-06,7.325481284754452e-06,9.665237731385772e-06,1.2581050329363302e-05,1.6156572745308397e-05,2.046960973271904e-05,2.5585733174118358e-05,3.1551074336390366e-05,3.8384723703880274e-05,4.6071321268478834e-05,5.4554539930854495e-05,6.373222921107318e-05,7.34539749849004e-05,8.352172929034779e-05,9.36939684760039e-05,0.00010369355699198495,0.00011321915050229459,0.00012195960055142645,0.00012961046721039488,0.0001358914524636315,0.0001405633783560867,0.00014344328228429085,0.00014441630313706728,0.00014344328228429085,0.0001405633783560867,0.0001358914524636315,0.00012961046721039488,0.00012195960055142645,0.00011321915050229459,0.00010369355699198495,9.36939684760039e-05,8.352172929034779e-05,7.34539749849004e-05,6.373222921107318e-05,5.4554539930854495e-05,4.6071321268478834e-05,3.8384723703880274e-05,3.1551074336390366e-05,2.5585733174118358e-05,2.046960973271904e-05,1.6156572745308397e-05,1.2581050329363302e-05,9.665237731385772e-06,7.325481284754452e-06,5.477567867970679e-06,4.040799976050715e-06,2.940863858739158e-06,2.1115942419077644e-06,1.4958016208793143e-06,1.0453591176620935e-06,1.3607234542051932e-06,1.9470556232586e-06,2.748620796606766e-06,3.828064787113942e-06,5.25983005099815e-06,7.130042627473142e-06,9.535435267259667e-06,1.2581050329363302e-05,1.6376506381833028e-05,2.103069376128016e-05,2.6644889388855146e-05,3.330444689756131e-05,4.106941445243657e-05,4.99646417624104e-05,5.9970135006280207e-05,7.10125743039466e-05,8.295899237980435e-05,9.561359811936321e-05,0.00010871859637607316,0.00012195960055142643,0.00013497586873735583,0.00014737514692387171,0.00015875241927096873,0.00016871140229599658,0.00017688723757135183,0.00018296859184546002,0.0001867173062869901,0.00018798386844102262,0.0001867173062869901,0.00018296859184546002,0.00017688723757135183,0.00016871140229599658,0.00015875241927096873,0.00014737514692387171,0.00013497586873735583,0.00012195960055142643,0.00010871859637607316,9.561359811936321e-05,8.295899237980435e-05,7.10125743039466e-05,5.9970135006280207e-05,4.99646417624104e-05,4.106941445243657e-05,3.330444689756131e-05,2.6644889388855146e-05,2.103069376128016e-05,1.6376506381833028e-05,1.2581050329363302e-05,9.535435267259667e-06,7.130042627473142e-06,5.25983005099815e-06,3.828064787113942e-06,2.748620796606766e-06,1.9470556232586e-06,1.3607234542051932e-06,1.7474397525302735e-06,2.5004069606906466e-06,3.529776186174126e-06,4.915997121671949e-06,6.754668697936245e-06,9.156393891776878e-06,1.224539680873025e-05,1.6156572745308397e-05,2.103069376128016e-05,2.7007596722301807e-05,3.421734135320958e-05,4.276953870750003e-05,5.274130258102161e-05,6.416454494610635e-05,7.701358975677559e-05,9.119427969345024e-05,0.00010653585830855071,0.00012278689084096144,0.00013961631701116812,0.00015662040185142437,0.000173335880949985,0.00018925902208409234,0.00020386970430114385,0.0002166590207334625,0.00022715842053886971,0.00023496808985481733,0.00023978218533892898,0.00024140870324024607,0.00023978218533892898,0.00023496808985481733,0.00022715842053886971,0.0002166590207334625,0.00020386970430114385,0.00018925902208409234,0.000173335880949985,0.00015662040185142437,0.00013961631701116812,0.00012278689084096144,0.00010653585830855071,9.119427969345024e-05,7.701358975677559e-05,6.416454494610635e-05,5.274130258102161e-05,4.276953870750003e-05,3.421734135320958e-05,2.7007596722301807e-05,2.103069376128016e-05,1.6156572745308397e-05,1.224539680873025e-05,9.156393891776878e-06,6.754668697936245e-06,4.915997121671949e-06,3.529776186174126e-06,2.5004069606906466e-06,1.7474397525302735e-06,2.2139231091643913e-06,3.16789677273444e-06,4.472058654630878e-06,6.228334691651468e-06,8.557844185161014e-06,1.1600715849724447e-05,1.5514335722579434e-05,2.046960973271904e-05,2.6644889388855146e-05,3.421734135320958e-05,4.3351745115300995e-05,5.41869726700033e-05,6.682072353137246e-05,8.129342865155007e-05,9.757255770068542e-05,0.0001155388178302489,0.00013497586873735578,0.0001555651545305798,0.00017688723757135175,0.00019843060484540207,0.00021960832236239932,0.00023978218533892882,0.0002582932252498325,0.00027449668128253803,0.00028779892179062357,0.0002976934016137321,0.0003037926317740658,0.00030585335264526106,0.0003037926317740658,0.0002976934016137321,0.00028779892179062357,0.00027449668128253803,0.0002582932252498325,0.00023978218533892882,0.00021960832236239932,0.00019843060484540207,0.00017688723757135175,0.0001555651545305798,0.00013497586873735578,0.0001155388178302489,9.757255770068542e-05,8.129342865155007e-05,6.682072353137246e-05,5.41869726700033e-05,4.3351745115300995e-05,3.421734135320958e-05,2.6644889388855146e-05,2.046960973271904e-05,1.5514335722579434e-05,1.1600715849724447e-05,8.557844185161014e-06,6.228334691651468e-06,4.472058654630878e-06,3.16789677273444e-06,2.2139231091643913e-06,2.7672655550707622e-06,3.959673027902303e-06,5.5897938930169085e-06,7.785029202827474e-06,1.0696770516206864e-05,1.4500169970773005e-05,1.93919502792046e-05,2.5585733174118358e-05,3.330444689756131e-05,4.276953870750003e-05,5.41869726700033e-05,6.773033010159823e-05,8.352172929034776e-05,0.00010161170640020318,0.00012195960055142642,0.00014441630313706734,0.00016871140229599658,0.00019444672306809027,0.0002210979946126367,0.00024802585762239554,0.00027449668128253814,0.00029971274949040745,0.00032285039276353715,0.00034310370037246015,0.00035973066985072074,0.0003720981513980655,0.0003797218080035158,0.00038229758033357945,0.0003797218080035158,0.0003720981513980655,0.00035973066985072074,0.00034310370037246015,0.00032285039276353715,0.00029971274949040745,0.00027449668128253814,0.00024802585762239554,0.0002210979946126367,0.00019444672306809027,0.00016871140229599658,0.00014441630313706734,0.00012195960055142642,0.00010161170640020318,8.352172929034776e-05,6.773033010159823e-05,5.41869726700033e-05,4.276953870750003e-05,3.330444689756131e-05,2.5585733174118358e-05,1.93919502792046e-05,1.4500169970773005e-05,1.0696770516206864e-05,7.785029202827474e-06,5.5897938930169085e-06,3.959673027902303e-06,2.7672655550707622e-06,3.4124564905918015e-06,4.882875046063652e-06,6.893060341224894e-06,9.600117120655594e-06,1.3190734047736782e-05,1.7880900169041918e-05,2.3913204308942112e-05,3.1551074336390366e-05,4.106941445243657e-05,5.274130258102161e-05,6.682072353137246e-05,8.352172929034776e-05,0.0001029949101559971,0.00012530258485316027,0.00015039461237432858,0.00017808711928073587,0.0002080466468954752,0.0002397821853389288,0.00027264722946093625,0.000305853352645261,0.0003384958772648596,0.00036959109885119156,0.00039812330849753693,0.0004230986965225052,0.0004436022617878602,0.0004588532349375736,0.0004682543552664994,0.0004714306716810575,0.0004682543552664994,0.0004588532349375736,0.0004436022617878602,0.0004230986965225052,0.00039812330849753693,0.00036959109885119156,0.0003384958772648596,0.000305853352645261,0.00027264722946093625,0.0002397821853389288,0.0002080466468954752,0.00017808711928073587,0.00015039461237432858,0.00012530258485316027,0.0001029949101559971,8.352172929034776e-05,6.682072353137246e-05,5.274130258102161e-05,4.106941445243657e-05,3.1551074336390366e-05,2.3913204308942112e-05,1.7880900169041918e-05,1.3190734047736782e-05,9.600117120655594e-06,6.893060341224894e-06,4.882875046063652e-06,3.4124564905918015e-06,4.151560677342845e-06,5.940457289200753e-06,8.386028756140377e-06,1.1679407150210344e-05,1.6047716045274578e-05,2.175372557040678e-05,2.9092566880186806e-05,3.8384723703880274e-05,4.99646417624104e-05,6.416454494610635e-05,8.129342865155007e-05,0.00010161170640020318,0.00012530258485316027,0.0001524418803521741,0.00018296859184546,0.0002166590207334625,0.0002531074845014353,0.0002917166254060553,0.00033169991170208126,0.00037209815139806554,0.0004118107226773024,0.00044964086045253606,0.0004843528633548579,0.0005147376723954138,0.0005396821062763036,0.000558236288752805,0.0005696735983824343,0.0005735378733883821,0.0005696735983824343,0.000558236288752805,0.0005396821062763036,0.0005147376723954138,0.0004843528633548579,0.00044964086045253606,0.0004118107226773024,0.00037209815139806554,0.00033169991170208126,0.0002917166254060553,0.0002531074845014353,0.0002166590207334625,0.00018296859184546,0.0001524418803521741,0.00012530258485316027,0.00010161170640020318,8.129342865155007e-05,6.416454494610635e-05,4.99646417624104e-05,3.8384723703880274e-05,2.9092566880186806e-05,2.175372557040678e-05,1.6047716045274578e-05,1.1679407150210344e-05,8.386028756140377e-06,5.940457289200753e-06,4.151560677342845e-06,4.982916829283069e-06,7.130042627473133e-06,1.006534338950547e-05,1.401822566690287e-05,1.926129486435325e-05,2.6109941217037337e-05,3.491839632875357e-05,4.6071321268478834e-05,5.9970135006280207e-05,7.701358975677559e-05,9.757255770068542e-05,0.00012195960055142642,0.00015039461237432858,0.00018296859184546,0.00021960832236239916,0.00026004530935092593,0.00030379263177406573,0.00035013331011889647,0.00039812330849753693,0.00044661135530680863,0.000494276427587064,0.0005396821062763031,0.0005813452389830152,0.0006178146508716651,0.0006477542444467681,0.0006700239293438999,0.0006837515771044711,0.0006883896788827255,0.0006837515771044711,0.0006700239293438999,0.0006477542444467681,0.0006178146508716651,0.0005813452389830152,0.0005396821062763031,0.000494276427587064,0.00044661135530680863,0.00039812330849753693,0.00035013331011889647,0.00030379263177406573,0.00026004530935092593,0.00021960832236239916,0.00018296859184546,0.00015039461237432858,0.00012195960055142642,9.757255770068542e-05,7.701358975677559e-05,5.9970135006280207e-05,4.6071321268478834e-05,3.491839632875357e-05,2.6109941217037337e-05,1.926129486435325e-05,1.401822566690287e-05,1.006534338950547e-05,7.130042627473133e-06,4.982916829283069e-06,5.9004327996392544e-06,8.442913824034569e-06,1.1918698286524501e-05,1.6599433896158208e-05,2.2807921519634265e-05,3.0917624923678644e-05,4.134800119443779e-05,5.4554539930854495e-05,7.10125743039466e-05,9.119427969345024e-05,0.0001155388178302489,0.00014441630313706734,0.00017808711928073587,0.0002166590207334625,0.00026004530935092593,0.00030792805203359234,0.0003597306698507207,0.000414604164197748,0.00047143067168105784,0.0005288469344014279,0.0005852886863943183,0.000639055017442315,0.000688389678882726,0.0007315742877099828,0.0007670267277146504,0.0007933969810635453,0.0008096523322731748,0.000815144458431021,0.0008096523322731748,0.0007933969810635453,0.0007670267277146504,0.0007315742877099828,0.000688389678882726,0.000639055017442315,0.0005852886863943183,0.0005288469344014279,0.00047143067168105784,0.000414604164197748,0.0003597306698507207,0.00030792805203359234,0.00026004530935092593,0.0002166590207334625,0.00017808711928073587,0.00014441630313706734,0.0001155388178302489,9.119427969345024e-05,7.10125743039466e-05,5.4554539930854495e-05,4.134800119443779e-05,3.0917624923678644e-05,2.2807921519634265e-05,1.6599433896158208e-05,1.1918698286524501e-05,8.442913824034569e-06,5.9004327996392544e-06,6.8930603412248976e-06,9.863261970950716e-06,1.3923776317372876e-05,1.93919502792046e-05,2.664488938885515e-05,3.6118885078956484e-05,4.8303959540005986e-05,6.373222921107318e-05,8.295899237980435e-05,0.00010653585830855071,0.00013497586873735578,0.00016871140229599658,0.0002080466468954752,0.0002531074845014353,0.00030379263177406573,0.0003597306698507207,0.00042024802214879427,0.0004843528633548577,0.0005507392723463256,0.0006178146508716652,0.0006837515771044714,0.0007465629973553339,0.0008041972099241892,0.000854646748893038,0.0008960633392507437,0.0009268698501830322,0.0009458598328776287,0.0009522758973076767,0.0009458598328776287,0.0009268698501830322,0.0008960633392507437,0.000854646748893038,0.0008041972099241892,0.0007465629973553339,0.0006837515771044714,0.0006178146508716652,0.0005507392723463256,0.0004843528633548577,0.00042024802214879427,0.0003597306698507207,0.00030379263177406573,0.0002531074845014353,0.0002080466468954752,0.00016871140229599658,0.00013497586873735578,0.00010653585830855071,8.295899237980435e-05,6.373222921107318e-05,4.8303959540005986e-05,3.6118885078956484e-05,2.664488938885515e-05,1.93919502792046e-05,1.3923776317372876e-05,9.863261970950716e-06,6.8930603412248976e-06,7.944531175849273e-06,1.1367808831608474e-05,1.604771604527457e-05,2.235000796849016e-05,3.0709313998142e-05,4.1628477677840305e-05,5.5672269425447486e-05,7.34539749849004e-05,9.561359811936321e-05,0.00012278689084096144,0.0001555651545305798,0.00019444672306809027,0.0002397821853389288,0.0002917166254060553,0.00035013331011889647,0.000414604164197748,0.0004843528633548577,0.0005582362887528049,0.0006347493134148922,0.0007120564033643991,0.000788051380945448,0.0008604440863157994,0.0009268698501830325,0.0009850149867848717,0.0010327492843255925,0.0010682550356762642,0.0010901417597259265,0.0010975365337983257,0.0010901417597259265,0.0010682550356762642,0.0010327492843255925,0.0009850149867848717,0.0009268698501830325,0.0008604440863157994,0.000788051380945448,0.0007120564033643991,0.0006347493134148922,0.0005582362887528049,0.0004843528633548577,0.000414604164197748,0.00035013331011889647,0.0002917166254060553,0.0002397821853389288,0.00019444672306809027,0.0001555651545305798,0.00012278689084096144,9.561359811936321e-05,7.34539749849004e-05,5.5672269425447486e-05,4.1628477677840305e-05,3.0709313998142e-05,2.235000796849016e-05,1.604771604527457e-05,1.1367808831608474e-05,7.944531175849273e-06,9.03342511204346e-06,1.292590431019157e-05,1.8247249322277244e-05,2.5413346460352658e-05,3.491839632875359e-05,4.733416325110507e-05,6.330282625123254e-05,8.352172929034779e-05,0.00010871859637607316,0.00013961631701116812,0.00017688723757135175,0.0002210979946126367,0.00027264722946093625,0.00033169991170208126,0.00039812330849753693,0.00047143067168105784,0.0005507392723463256,0.0006347493134148922,0.0007217493720819177,0.0008096523322731747,0.0008960633392507437,0.0009783783391099253,0.001053908556075911,0.0011200231858125237,0.001174300045272894,0.0012146722886153519,0.001239558852501162,0.0012479671696598341,0.001239558852501162,0.0012146722886153519,0.001174300045272894,0.0011200231858125237,0.001053908556075911,0.0009783783391099253,0.0008960633392507437,0.0008096523322731747,0.0007217493720819177,0.0006347493134148922,0.0005507392723463256,0.00047143067168105784,0.00039812330849753693,0.00033169991170208126,0.00027264722946093625,0.0002210979946126367,0.00017688723757135175,0.00013961631701116812,0.00010871859637607316,8.352172929034779e-05,6.330282625123254e-05,4.733416325110507e-05,3.491839632875359e-05,2.5413346460352658e-05,1.8247249322277244e-05,1.292590431019157e-05,9.03342511204346e-06,1.0133619776188636e-05,1.450016997077299e-05,2.0469609732719033e-05,2.8508476804265797e-05,3.917116123740194e-05,5.309906340743814e-05,7.101257430394658e-05,9.36939684760039e-05,0.00012195960055142643,0.00015662040185142437,0.00019843060484540207,0.00024802585762239554,0.000305853352645261,0.00037209815139806554,0.00044661135530680863,0.0005288469344014279,0.0006178146508716652,0.0007120564033643991,0.0008096523322731747,0.000908261128464118,0.0010051962641770198,0.0010975365337983255,0.0011822656914382,0.0012564325230756375,0.0013173198442849234,0.0013626090849073748,0.0013905266214814483,0.0013999590004503057,0.0013905266214814483,0.0013626090849073748,0.0013173198442849234,0.0012564325230756375,0.0011822656914382,0.0010975365337983255,0.0010051962641770198,0.000908261128464118,0.0008096523322731747,0.0007120564033643991,0.0006178146508716652,0.0005288469344014279,0.00044661135530680863,0.00037209815139806554,0.000305853352645261,0.00024802585762239554,0.00019843060484540207,0.00015662040185142437,0.00012195960055142643,9.36939684760039e-05,7.101257430394658e-05,5.309906340743814e-05,3.917116123740194e-05,2.8508476804265797e-05,2.0469609732719033e-05,1.450016997077299e-05,1.0133619776188636e-05,1.1215141133299758e-05,1.604771604527457e-05,2.265425061984651e-05,3.1551074336390386e-05,4.3351745115301015e-05,5.876611746966794e-05,7.859146688422894e-05,0.00010369355699198495,0.00013497586873735583,0.000173335880949985,0.00021960832236239932,0.00027449668128253814,0.0003384958772648596,0.0004118107226773024,0.000494276427587064,0.0005852886863943183,0.0006837515771044714,0.000788051380945448,0.0008960633392507437,0.0010051962641770198,0.0011124769054292462,0.0012146722886153519,0.0013084442557923356,0.0013905266214814488,0.0014579122068568977,0.0015080349898918656,0.001538932055272984,0.0015493711149273705,0.001538932055272984,0.0015080349898918656,0.0014579122068568977,0.0013905266214814488,0.0013084442557923356,0.0012146722886153519,0.0011124769054292462,0.0010051962641770198,0.0008960633392507437,0.000788051380945448,0.0006837515771044714,0.0005852886863943183,0.000494276427587064,0.0004118107226773024,0.0003384958772648596,0.00027449668128253814,0.00021960832236239932,0.000173335880949985,0.00013497586873735583,0.00010369355699198495,7.859146688422894e-05,5.876611746966794e-05,4.3351745115301015e-05,3.1551074336390386e-05,2.265425061984651e-05,1.604771604527457e-05,1.1215141133299758e-05,1.2245396808730241e-05,1.752190619026087e-05,2.473533635887674e-05,3.444944833049735e-05,4.7334163251105035e-05,6.416454494610634e-05,8.581110895876971e-05,0.00011321915050229459,0.00014737514692387171,0.00018925902208409234,0.00023978218533892882,0.00029971274949040745,0.00036959109885119156,0.00044964086045253606,0.0005396821062763031,0.000639055017442315,0.0007465629973553339,0.0008604440863157994,0.0009783783391099253,0.0010975365337983255,0.0012146722886153519,0.0013262556386829138,0.001428641773103279,0.0015182644650440947,0.0015918402874348521,0.0016465674959582181,0.0016803028561574488,0.001691700878372115,0.0016803028561574488,0.0016465674959582181,0.0015918402874348521,0.0015182644650440947,0.001428641773103279,0.0013262556386829138,0.0012146722886153519,0.0010975365337983255,0.0009783783391099253,0.0008604440863157994,0.0007465629973553339,0.000639055017442315,0.0005396821062763031,0.00044964086045253606,0.00036959109885119156,0.00029971274949040745,0.00023978218533892882,0.00018925902208409234,0.00014737514692387171,0.00011321915050229459,8.581110895876971e-05,6.416454494610634e-05,4.7334163251105035e-05,3.444944833049735e-05,2.473533635887674e-05,1.752190619026087e-05,1.2245396808730241e-05,1.3190734047736783e-05,1.8874586767196005e-05,2.664488938885514e-05,3.710892493862433e-05,5.0988332070410497e-05,6.911800906890376e-05,9.243567475163474e-05,0.00012195960055142645,0.00015875241927096873,0.00020386970430114385,0.0002582932252498325,0.00032285039276353715,0.00039812330849753693,0.0004843528633548579,0.0005813452389830152,0.000688389678882726,0.0008041972099241892,0.0009268698501830325,0.001053908556075911,0.0011822656914382,0.0013084442557923356,0.001428641773103279,0.0015389320552729841,0.0016354735649111783,0.0017147293963602724,0.0017736815123335244,0.0018100212219683647,0.0018222991646150797,0.0018100212219683647,0.0017736815123335244,0.0017147293963602724,0.0016354735649111783,0.0015389320552729841,0.001428641773103279,0.0013084442557923356,0.0011822656914382,0.001053908556075911,0.0009268698501830325,0.0008041972099241892,0.000688389678882726,0.0005813452389830152,0.0004843528633548579,0.00039812330849753693,0.00032285039276353715,0.0002582932252498325,0.00020386970430114385,0.00015875241927096873,0.00012195960055142645,9.243567475163474e-05,6.911800906890376e-05,5.0988332070410497e-05,3.710892493862433e-05,2.664488938885514e-05,1.8874586767196005e-05,1.3190734047736783e-05,1.4018225666902872e-05,2.005864235565339e-05,2.831639778126853e-05,3.943687153142549e-05,5.418697267000331e-05,7.345397498490043e-05,9.823442301629737e-05,0.00012961046721039488,0.00016871140229599658,0.0002166590207334625,0.00027449668128253803,0.00034310370037246015,0.0004230986965225052,0.0005147376723954138,0.0006178146508716651,0.0007315742877099828,0.000854646748893038,0.0009850149867848717,0.0011200231858125237,0.0012564325230756375,0.0013905266214814488,0.0015182644650440947,0.0016354735649111783,0.0017380713933136003,0.0018222991646150801,0.0018849495116134922,0.0019235689128149227,0.0019366170851246717,0.0019235689128149227,0.0018849495116134922,0.0018222991646150801,0.0017380713933136003,0.0016354735649111783,0.0015182644650440947,0.0013905266214814488,0.0012564325230756375,0.0011200231858125237,0.0009850149867848717,0.000854646748893038,0.0007315742877099828,0.0006178146508716651,0.0005147376723954138,0.0004230986965225052,0.00034310370037246015,0.00027449668128253803,0.0002166590207334625,0.00016871140229599658,0.00012961046721039488,9.823442301629737e-05,7.345397498490043e-05,5.418697267000331e-05,3.943687153142549e-05,2.831639778126853e-05,2.005864235565339e-05,1.4018225666902872e-05,1.4697555589751094e-05,2.103069376128015e-05,2.96886239657496e-05,4.1348001194437796e-05,5.681289929138755e-05,7.701358975677564e-05,0.0001029949101559972,0.0001358914524636315,0.00017688723757135183,0.00022715842053886971,0.00028779892179062357,0.00035973066985072074,0.0004436022617878602,0.0005396821062763036,0.0006477542444467681,0.0007670267277146504,0.0008960633392507437,0.0010327492843255925,0.001174300045272894,0.0013173198442849234,0.0014579122068568977,0.0015918402874348521,0.0017147293963602724,0.0018222991646150801,0.0019106086540126674,0.001976295066801726,0.002016785982662858,0.0020304664756456447,0.002016785982662858,0.001976295066801726,0.0019106086540126674,0.0018222991646150801,0.0017147293963602724,0.0015918402874348521,0.0014579122068568977,0.0013173198442849234,0.001174300045272894,0.0010327492843255925,0.0008960633392507437,0.0007670267277146504,0.0006477542444467681,0.0005396821062763036,0.0004436022617878602,0.00035973066985072074,0.00028779892179062357,0.00022715842053886971,0.00017688723757135183,0.0001358914524636315,0.0001029949101559972,7.701358975677564e-05,5.681289929138755e-05,4.1348001194437796e-05,2.96886239657496e-05,2.103069376128015e-05,1.4697555589751094e-05,1.5202855145173355e-05,2.1753725570406755e-05,3.070931399814198e-05,4.276953870750001e-05,5.87661174696679e-05,7.966130436672801e-05,0.00010653585830855065,0.0001405633783560867,0.00018296859184546002,0.00023496808985481733,0.0002976934016137321,0.0003720981513980655,0.0004588532349375736,0.000558236288752805,0.0006700239293438999,0.0007933969810635453,0.0009268698501830322,0.0010682550356762642,0.0012146722886153519,0.0013626090849073748,0.0015080349898918656,0.0016465674959582181,0.0017736815123335244,0.0018849495116134922,0.001976295066801726,0.002044239767710663,0.002086122754631389,0.0021002735807236477,0.002086122754631389,0.002044239767710663,0.001976295066801726,0.0018849495116134922,0.0017736815123335244,0.0016465674959582181,0.0015080349898918656,0.0013626090849073748,0.0012146722886153519,0.0010682550356762642,0.0009268698501830322,0.0007933969810635453,0.0006700239293438999,0.000558236288752805,0.0004588532349375736,0.0003720981513980655,0.0002976934016137321,0.00023496808985481733,0.00018296859184546002,0.0001405633783560867,0.00010653585830855065,7.966130436672801e-05,5.87661174696679e-05,4.276953870750001e-05,3.070931399814198e-05,2.1753725570406755e-05,1.5202855145173355e-05,1.5514335722579434e-05,2.2199422312018802e-05,3.1338495475209645e-05,4.3645813623283404e-05,5.997013500628023e-05,8.129342865155011e-05,0.00010871859637607313,0.00014344328228429085,0.0001867173062869901,0.00023978218533892898,0.0003037926317740658,0.0003797218080035158,0.0004682543552664994,0.0005696735983824343,0.0006837515771044711,0.0008096523322731748,0.0009458598328776287,0.0010901417597259265,0.001239558852501162,0.0013905266214814483,0.001538932055272984,0.0016803028561574488,0.0018100212219683647,0.0019235689128149227,0.002016785982662858,0.002086122754631389,0.0021288638525335715,0.0021433046049219038,0.0021288638525335715,0.002086122754631389,0.002016785982662858,0.0019235689128149227,0.0018100212219683647,0.0016803028561574488,0.001538932055272984,0.0013905266214814483,0.001239558852501162,0.0010901417597259265,0.0009458598328776287,0.0008096523322731748,0.0006837515771044711,0.0005696735983824343,0.0004682543552664994,0.0003797218080035158,0.0003037926317740658,0.00023978218533892898,0.0001867173062869901,0.00014344328228429085,0.00010871859637607313,8.129342865155011e-05,5.997013500628023e-05,4.3645813623283404e-05,3.1338495475209645e-05,2.2199422312018802e-05,1.5514335722579434e-05,1.5619574336299427e-05,2.235000796849015e-05,3.1551074336390366e-05,4.394187689035004e-05,6.0376931274294225e-05,8.184486752001439e-05,0.00010945606877404048,0.00014441630313706728,0.00018798386844102262,0.00024140870324024607,0.00030585335264526106,0.00038229758033357945,0.0004714306716810575,0.0005735378733883821,0.0006883896788827255,0.000815144458431021,0.0009522758973076767,0.0010975365337983257,0.0012479671696598341,0.0013999590004503057,0.0015493711149273705,0.001691700878372115,0.0018222991646150797,0.0019366170851246717,0.0020304664756456447,0.0021002735807236477,0.0021433046049219038,0.0021578433134708864,0.0021433046049219038,0.0021002735807236477,0.0020304664756456447,0.0019366170851246717,0.0018222991646150797,0.001691700878372115,0.0015493711149273705,0.0013999590004503057,0.0012479671696598341,0.0010975365337983257,0.0009522758973076767,0.000815144458431021,0.0006883896788827255,0.0005735378733883821,0.0004714306716810575,0.00038229758033357945,0.00030585335264526106,0.00024140870324024607,0.00018798386844102262,0.00014441630313706728,0.00010945606877404048,8.184486752001439e-05,6.0376931274294225e-05,4.394187689035004e-05,3.1551074336390366e-05,2.235000796849015e-05,1.5619574336299427e-05,1.5514335722579434e-05,2.2199422312018802e-05,3.1338495475209645e-05,4.3645813623283404e-05,5.997013500628023e-05,8.129342865155011e-05,0.00010871859637607313,0.00014344328228429085,0.0001867173062869901,0.00023978218533892898,0.0003037926317740658,0.0003797218080035158,0.0004682543552664994,0.0005696735983824343,0.0006837515771044711,0.0008096523322731748,0.0009458598328776287,0.0010901417597259265,0.001239558852501162,0.0013905266214814483,0.001538932055272984,0.0016803028561574488,0.0018100212219683647,0.0019235689128149227,0.002016785982662858,0.002086122754631389,0.0021288638525335715,0.0021433046049219038,0.0021288638525335715,0.002086122754631389,0.002016785982662858,0.0019235689128149227,0.0018100212219683647,0.0016803028561574488,0.001538932055272984,0.0013905266214814483,0.001239558852501162,0.0010901417597259265,0.0009458598328776287,0.0008096523322731748,0.0006837515771044711,0.0005696735983824343,0.0004682543552664994,0.0003797218080035158,0.0003037926317740658,0.00023978218533892898,0.0001867173062869901,0.00014344328228429085,0.00010871859637607313,8.129342865155011e-05,5.997013500628023e-05,4.3645813623283404e-05,3.1338495475209645e-05,2.2199422312018802e-05,1.5514335722579434e-05,1.5202855145173355e-05,2.1753725570406755e-05,3.070931399814198e-05,4.276953870750001e-05,5.87661174696679e-05,7.966130436672801e-05,0.00010653585830855065,0.0001405633783560867,0.00018296859184546002,0.00023496808985481733,0.0002976934016137321,0.0003720981513980655,0.0004588532349375736,0.000558236288752805,0.0006700239293438999,0.0007933969810635453,0.0009268698501830322,0.0010682550356762642,0.0012146722886153519,0.0013626090849073748,0.0015080349898918656,0.0016465674959582181,0.0017736815123335244,0.0018849495116134922,0.001976295066801726,0.002044239767710663,0.002086122754631389,0.0021002735807236477,0.002086122754631389,0.002044239767710663,0.001976295066801726,0.0018849495116134922,0.0017736815123335244,0.0016465674959582181,0.0015080349898918656,0.0013626090849073748,0.0012146722886153519,0.0010682550356762642,0.0009268698501830322,0.0007933969810635453,0.0006700239293438999,0.000558236288752805,0.0004588532349375736,0.0003720981513980655,0.0002976934016137321,0.00023496808985481733,0.00018296859184546002,0.0001405633783560867,0.00010653585830855065,7.966130436672801e-05,5.87661174696679e-05,4.276953870750001e-05,3.070931399814198e-05,2.1753725570406755e-05,1.5202855145173355e-05,1.4697555589751094e-05,2.103069376128015e-05,2.96886239657496e-05,4.1348001194437796e-05,5.681289929138755e-05,7.701358975677564e-05,0.0001029949101559972,0.0001358914524636315,0.00017688723757135183,0.00022715842053886971,0.00028779892179062357,0.00035973066985072074,0.0004436022617878602,0.0005396821062763036,0.0006477542444467681,0.0007670267277146504,0.0008960633392507437,0.0010327492843255925,0.001174300045272894,0.0013173198442849234,0.0014579122068568977,0.0015918402874348521,0.0017147293963602724,0.0018222991646150801,0.0019106086540126674,0.001976295066801726,0.002016785982662858,0.0020304664756456447,0.002016785982662858,0.001976295066801726,0.0019106086540126674,0.0018222991646150801,0.0017147293963602724,0.0015918402874348521,0.0014579122068568977,0.0013173198442849234,0.001174300045272894,0.0010327492843255925,0.0008960633392507437,0.0007670267277146504,0.0006477542444467681,0.0005396821062763036,0.0004436022617878602,0.00035973066985072074,0.00028779892179062357,0.00022715842053886971,0.00017688723757135183,0.0001358914524636315,0.0001029949101559972,7.701358975677564e-05,5.681289929138755e-05,4.1348001194437796e-05,2.96886239657496e-05,2.103069376128015e-05,1.4697555589751094e-05,1.4018225666902872e-05,2.005864235565339e-05,2.831639778126853e-05,3.943687153142549e-05,5.418697267000331e-05,7.345397498490043e-05,9.823442301629737e-05,0.00012961046721039488,0.00016871140229599658,0.0002166590207334625,0.00027449668128253803,0.00034310370037246015,0.0004230986965225052,0.0005147376723954138,0.0006178146508716651,0.0007315742877099828,0.000854646748893038,0.0009850149867848717,0.0011200231858125237,0.0012564325230756375,0.0013905266214814488,0.0015182644650440947,0.0016354735649111783,0.0017380713933136003,0.0018222991646150801,0.0018849495116134922,0.0019235689128149227,0.0019366170851246717,0.0019235689128149227,0.0018849495116134922,0.0018222991646150801,0.0017380713933136003,0.0016354735649111783,0.0015182644650440947,0.0013905266214814488,0.0012564325230756375,0.0011200231858125237,0.0009850149867848717,0.000854646748893038,0.0007315742877099828,0.0006178146508716651,0.0005147376723954138,0.0004230986965225052,0.00034310370037246015,0.00027449668128253803,0.0002166590207334625,0.00016871140229599658,0.00012961046721039488,9.823442301629737e-05,7.345397498490043e-05,5.418697267000331e-05,3.943687153142549e-05,2.831639778126853e-05,2.005864235565339e-05,1.4018225666902872e-05,1.3190734047736783e-05,1.8874586767196005e-05,2.664488938885514e-05,3.710892493862433e-05,5.0988332070410497e-05,6.911800906890376e-05,9.243567475163474e-05,0.00012195960055142645,0.00015875241927096873,0.00020386970430114385,0.0002582932252498325,0.00032285039276353715,0.00039812330849753693,0.0004843528633548579,0.0005813452389830152,0.000688389678882726,0.0008041972099241892,0.0009268698501830325,0.001053908556075911,0.0011822656914382,0.0013084442557923356,0.001428641773103279,0.0015389320552729841,0.0016354735649111783,0.0017147293963602724,0.0017736815123335244,0.0018100212219683647,0.0018222991646150797,0.0018100212219683647,0.0017736815123335244,0.0017147293963602724,0.0016354735649111783,0.0015389320552729841,0.001428641773103279,0.0013084442557923356,0.0011822656914382,0.001053908556075911,0.0009268698501830325,0.0008041972099241892,0.000688389678882726,0.0005813452389830152,0.0004843528633548579,0.00039812330849753693,0.00032285039276353715,0.0002582932252498325,0.00020386970430114385,0.00015875241927096873,0.00012195960055142645,9.243567475163474e-05,6.911800906890376e-05,5.0988332070410497e-05,3.710892493862433e-05,2.664488938885514e-05,1.8874586767196005e-05,1.3190734047736783e-05,1.2245396808730241e-05,1.752190619026087e-05,2.473533635887674e-05,3.444944833049735e-05,4.7334163251105035e-05,6.416454494610634e-05,8.581110895876971e-05,0.00011321915050229459,0.00014737514692387171,0.00018925902208409234,0.00023978218533892882,0.00029971274949040745,0.00036959109885119156,0.00044964086045253606,0.0005396821062763031,0.000639055017442315,0.0007465629973553339,0.0008604440863157994,0.0009783783391099253,0.0010975365337983255,0.0012146722886153519,0.0013262556386829138,0.001428641773103279,0.0015182644650440947,0.0015918402874348521,0.0016465674959582181,0.0016803028561574488,0.001691700878372115,0.0016803028561574488,0.0016465674959582181,0.0015918402874348521,0.0015182644650440947,0.001428641773103279,0.0013262556386829138,0.0012146722886153519,0.0010975365337983255,0.0009783783391099253,0.0008604440863157994,0.0007465629973553339,0.000639055017442315,0.0005396821062763031,0.00044964086045253606,0.00036959109885119156,0.00029971274949040745,0.00023978218533892882,0.00018925902208409234,0.00014737514692387171,0.00011321915050229459,8.581110895876971e-05,6.416454494610634e-05,4.7334163251105035e-05,3.444944833049735e-05,2.473533635887674e-05,1.752190619026087e-05,1.2245396808730241e-05,1.1215141133299758e-05,1.604771604527457e-05,2.265425061984651e-05,3.1551074336390386e-05,4.3351745115301015e-05,5.876611746966794e-05,7.859146688422894e-05,0.00010369355699198495,0.00013497586873735583,0.000173335880949985,0.00021960832236239932,0.00027449668128253814,0.0003384958772648596,0.0004118107226773024,0.000494276427587064,0.0005852886863943183,0.0006837515771044714,0.000788051380945448,0.0008960633392507437,0.0010051962641770198,0.0011124769054292462,0.0012146722886153519,0.0013084442557923356,0.0013905266214814488,0.0014579122068568977,0.0015080349898918656,0.001538932055272984,0.0015493711149273705,0.001538932055272984,0.0015080349898918656,0.0014579122068568977,0.0013905266214814488,0.0013084442557923356,0.0012146722886153519,0.0011124769054292462,0.0010051962641770198,0.0008960633392507437,0.000788051380945448,0.0006837515771044714,0.0005852886863943183,0.000494276427587064,0.0004118107226773024,0.0003384958772648596,0.00027449668128253814,0.00021960832236239932,0.000173335880949985,0.00013497586873735583,0.00010369355699198495,7.859146688422894e-05,5.876611746966794e-05,4.3351745115301015e-05,3.1551074336390386e-05,2.265425061984651e-05,1.604771604527457e-05,1.1215141133299758e-05,1.0133619776188636e-05,1.450016997077299e-05,2.0469609732719033e-05,2.8508476804265797e-05,3.917116123740194e-05,5.309906340743814e-05,7.101257430394658e-05,9.36939684760039e-05,0.00012195960055142643,0.00015662040185142437,0.00019843060484540207,0.00024802585762239554,0.000305853352645261,0.00037209815139806554,0.00044661135530680863,0.0005288469344014279,0.0006178146508716652,0.0007120564033643991,0.0008096523322731747,0.000908261128464118,0.0010051962641770198,0.0010975365337983255,0.0011822656914382,0.0012564325230756375,0.0013173198442849234,0.0013626090849073748,0.0013905266214814483,0.0013999590004503057,0.0013905266214814483,0.0013626090849073748,0.0013173198442849234,0.0012564325230756375,0.0011822656914382,0.0010975365337983255,0.0010051962641770198,0.000908261128464118,0.0008096523322731747,0.0007120564033643991,0.0006178146508716652,0.0005288469344014279,0.00044661135530680863,0.00037209815139806554,0.000305853352645261,0.00024802585762239554,0.00019843060484540207,0.00015662040185142437,0.00012195960055142643,9.36939684760039e-05,7.101257430394658e-05,5.309906340743814e-05,3.917116123740194e-05,2.8508476804265797e-05,2.0469609732719033e-05,1.450016997077299e-05,1.0133619776188636e-05,9.03342511204346e-06,1.292590431019157e-05,1.8247249322277244e-05,2.5413346460352658e-05,3.491839632875359e-05,4.733416325110507e-05,6.330282625123254e-05,8.352172929034779e-05,0.00010871859637607316,0.00013961631701116812,0.00017688723757135175,0.0002210979946126367,0.00027264722946093625,0.00033169991170208126,0.00039812330849753693,0.00047143067168105784,0.0005507392723463256,0.0006347493134148922,0.0007217493720819177,0.0008096523322731747,0.0008960633392507437,0.0009783783391099253,0.001053908556075911,0.0011200231858125237,0.001174300045272894,0.0012146722886153519,0.001239558852501162,0.0012479671696598341,0.001239558852501162,0.0012146722886153519,0.001174300045272894,0.0011200231858125237,0.001053908556075911,0.0009783783391099253,0.0008960633392507437,0.0008096523322731747,0.0007217493720819177,0.0006347493134148922,0.0005507392723463256,0.00047143067168105784,0.00039812330849753693,0.00033169991170208126,0.00027264722946093625,0.0002210979946126367,0.00017688723757135175,0.00013961631701116812,0.00010871859637607316,8.352172929034779e-05,6.330282625123254e-05,4.733416325110507e-05,3.491839632875359e-05,2.5413346460352658e-05,1.8247249322277244e-05,1.292590431019157e-05,9.03342511204346e-06,7.944531175849273e-06,1.1367808831608474e-05,1.604771604527457e-05,2.235000796849016e-05,3.0709313998142e-05,4.1628477677840305e-05,5.5672269425447486e-05,7.34539749849004e-05,9.561359811936321e-05,0.00012278689084096144,0.0001555651545305798,0.00019444672306809027,0.0002397821853389288,0.0002917166254060553,0.00035013331011889647,0.000414604164197748,0.0004843528633548577,0.0005582362887528049,0.0006347493134148922,0.0007120564033643991,0.000788051380945448,0.0008604440863157994,0.0009268698501830325,0.0009850149867848717,0.0010327492843255925,0.0010682550356762642,0.0010901417597259265,0.0010975365337983257,0.0010901417597259265,0.0010682550356762642,0.0010327492843255925,0.0009850149867848717,0.0009268698501830325,0.0008604440863157994,0.000788051380945448,0.0007120564033643991,0.0006347493134148922,0.0005582362887528049,0.0004843528633548577,0.000414604164197748,0.00035013331011889647,0.0002917166254060553,0.0002397821853389288,0.00019444672306809027,0.0001555651545305798,0.00012278689084096144,9.561359811936321e-05,7.34539749849004e-05,5.5672269425447486e-05,4.1628477677840305e-05,3.0709313998142e-05,2.235000796849016e-05,1.604771604527457e-05,1.1367808831608474e-05,7.944531175849273e-06,6.8930603412248976e-06,9.863261970950716e-06,1.3923776317372876e-05,1.93919502792046e-05,2.664488938885515e-05,3.6118885078956484e-05,4.8303959540005986e-05,6.373222921107318e-05,8.295899237980435e-05,0.00010653585830855071,0.00013497586873735578,0.00016871140229599658,0.0002080466468954752,0.0002531074845014353,0.00030379263177406573,0.0003597306698507207,0.00042024802214879427,0.0004843528633548577,0.0005507392723463256,0.0006178146508716652,0.0006837515771044714,0.0007465629973553339,0.0008041972099241892,0.000854646748893038,0.0008960633392507437,0.0009268698501830322,0.0009458598328776287,0.0009522758973076767,0.0009458598328776287,0.0009268698501830322,0.0008960633392507437,0.000854646748893038,0.0008041972099241892,0.0007465629973553339,0.0006837515771044714,0.0006178146508716652,0.0005507392723463256,0.0004843528633548577,0.00042024802214879427,0.0003597306698507207,0.00030379263177406573,0.0002531074845014353,0.0002080466468954752,0.00016871140229599658,0.00013497586873735578,0.00010653585830855071,8.295899237980435e-05,6.373222921107318e-05,4.8303959540005986e-05,3.6118885078956484e-05,2.664488938885515e-05,1.93919502792046e-05,1.3923776317372876e-05,9.863261970950716e-06,6.8930603412248976e-06,5.9004327996392544e-06,8.442913824034569e-06,1.1918698286524501e-05,1.6599433896158208e-05,2.2807921519634265e-05,3.0917624923678644e-05,4.134800119443779e-05,5.4554539930854495e-05,7.10125743039466e-05,9.119427969345024e-05,0.0001155388178302489,0.00014441630313706734,0.00017808711928073587,0.0002166590207334625,0.00026004530935092593,0.00030792805203359234,0.0003597306698507207,0.000414604164197748,0.00047143067168105784,0.0005288469344014279,0.0005852886863943183,0.000639055017442315,0.000688389678882726,0.0007315742877099828,0.0007670267277146504,0.0007933969810635453,0.0008096523322731748,0.000815144458431021,0.0008096523322731748,0.0007933969810635453,0.0007670267277146504,0.0007315742877099828,0.000688389678882726,0.000639055017442315,0.0005852886863943183,0.0005288469344014279,0.00047143067168105784,0.000414604164197748,0.0003597306698507207,0.00030792805203359234,0.00026004530935092593,0.0002166590207334625,0.00017808711928073587,0.00014441630313706734,0.0001155388178302489,9.119427969345024e-05,7.10125743039466e-05,5.4554539930854495e-05,4.134800119443779e-05,3.0917624923678644e-05,2.2807921519634265e-05,1.6599433896158208e-05,1.1918698286524501e-05,8.442913824034569e-06,5.9004327996392544e-06,4.982916829283069e-06,7.130042627473133e-06,1.006534338950547e-05,1.401822566690287e-05,1.926129486435325e-05,2.6109941217037337e-05,3.491839632875357e-05,4.6071321268478834e-05,5.9970135006280207e-05,7.701358975677559e-05,9.757255770068542e-05,0.00012195960055142642,0.00015039461237432858,0.00018296859184546,0.00021960832236239916,0.00026004530935092593,0.00030379263177406573,0.00035013331011889647,0.00039812330849753693,0.00044661135530680863,0.000494276427587064,0.0005396821062763031,0.0005813452389830152,0.0006178146508716651,0.0006477542444467681,0.0006700239293438999,0.0006837515771044711,0.0006883896788827255,0.0006837515771044711,0.0006700239293438999,0.0006477542444467681,0.0006178146508716651,0.0005813452389830152,0.0005396821062763031,0.000494276427587064,0.00044661135530680863,0.00039812330849753693,0.00035013331011889647,0.00030379263177406573,0.00026004530935092593,0.00021960832236239916,0.00018296859184546,0.00015039461237432858,0.00012195960055142642,9.757255770068542e-05,7.701358975677559e-05,5.9970135006280207e-05,4.6071321268478834e-05,3.491839632875357e-05,2.6109941217037337e-05,1.926129486435325e-05,1.401822566690287e-05,1.006534338950547e-05,7.130042627473133e-06,4.982916829283069e-06,4.151560677342845e-06,5.940457289200753e-06,8.386028756140377e-06,1.1679407150210344e-05,1.6047716045274578e-05,2.175372557040678e-05,2.9092566880186806e-05,3.8384723703880274e-05,4.99646417624104e-05,6.416454494610635e-05,8.129342865155007e-05,0.00010161170640020318,0.00012530258485316027,0.0001524418803521741,0.00018296859184546,0.0002166590207334625,0.0002531074845014353,0.0002917166254060553,0.00033169991170208126,0.00037209815139806554,0.0004118107226773024,0.00044964086045253606,0.0004843528633548579,0.0005147376723954138,0.0005396821062763036,0.000558236288752805,0.0005696735983824343,0.0005735378733883821,0.0005696735983824343,0.000558236288752805,0.0005396821062763036,0.0005147376723954138,0.0004843528633548579,0.00044964086045253606,0.0004118107226773024,0.00037209815139806554,0.00033169991170208126,0.0002917166254060553,0.0002531074845014353,0.0002166590207334625,0.00018296859184546,0.0001524418803521741,0.00012530258485316027,0.00010161170640020318,8.129342865155007e-05,6.416454494610635e-05,4.99646417624104e-05,3.8384723703880274e-05,2.9092566880186806e-05,2.175372557040678e-05,1.6047716045274578e-05,1.1679407150210344e-05,8.386028756140377e-06,5.940457289200753e-06,4.151560677342845e-06,3.4124564905918015e-06,4.882875046063652e-06,6.893060341224894e-06,9.600117120655594e-06,1.3190734047736782e-05,1.7880900169041918e-05,2.3913204308942112e-05,3.1551074336390366e-05,4.106941445243657e-05,5.274130258102161e-05,6.682072353137246e-05,8.352172929034776e-05,0.0001029949101559971,0.00012530258485316027,0.00015039461237432858,0.00017808711928073587,0.0002080466468954752,0.0002397821853389288,0.00027264722946093625,0.000305853352645261,0.0003384958772648596,0.00036959109885119156,0.00039812330849753693,0.0004230986965225052,0.0004436022617878602,0.0004588532349375736,0.0004682543552664994,0.0004714306716810575,0.0004682543552664994,0.0004588532349375736,0.0004436022617878602,0.0004230986965225052,0.00039812330849753693,0.00036959109885119156,0.0003384958772648596,0.000305853352645261,0.00027264722946093625,0.0002397821853389288,0.0002080466468954752,0.00017808711928073587,0.00015039461237432858,0.00012530258485316027,0.0001029949101559971,8.352172929034776e-05,6.682072353137246e-05,5.274130258102161e-05,4.106941445243657e-05,3.1551074336390366e-05,2.3913204308942112e-05,1.7880900169041918e-05,1.3190734047736782e-05,9.600117120655594e-06,6.893060341224894e-06,4.882875046063652e-06,3.4124564905918015e-06,2.7672655550707622e-06,3.959673027902303e-06,5.5897938930169085e-06,7.785029202827474e-06,1.0696770516206864e-05,1.4500169970773005e-05,1.93919502792046e-05,2.5585733174118358e-05,3.330444689756131e-05,4.276953870750003e-05,5.41869726700033e-05,6.773033010159823e-05,8.352172929034776e-05,0.00010161170640020318,0.00012195960055142642,0.00014441630313706734,0.00016871140229599658,0.00019444672306809027,0.0002210979946126367,0.00024802585762239554,0.00027449668128253814,0.00029971274949040745,0.00032285039276353715,0.00034310370037246015,0.00035973066985072074,0.0003720981513980655,0.0003797218080035158,0.00038229758033357945,0.0003797218080035158,0.0003720981513980655,0.00035973066985072074,0.00034310370037246015,0.00032285039276353715,0.00029971274949040745,0.00027449668128253814,0.00024802585762239554,0.0002210979946126367,0.00019444672306809027,0.00016871140229599658,0.00014441630313706734,0.00012195960055142642,0.00010161170640020318,8.352172929034776e-05,6.773033010159823e-05,5.41869726700033e-05,4.276953870750003e-05,3.330444689756131e-05,2.5585733174118358e-05,1.93919502792046e-05,1.4500169970773005e-05,1.0696770516206864e-05,7.785029202827474e-06,5.5897938930169085e-06,3.959673027902303e-06,2.7672655550707622e-06,2.2139231091643913e-06,3.16789677273444e-06,4.472058654630878e-06,6.228334691651468e-06,8.557844185161014e-06,1.1600715849724447e-05,1.5514335722579434e-05,2.046960973271904e-05,2.6644889388855146e-05,3.421734135320958e-05,4.3351745115300995e-05,5.41869726700033e-05,6.682072353137246e-05,8.129342865155007e-05,9.757255770068542e-05,0.0001155388178302489,0.00013497586873735578,0.0001555651545305798,0.00017688723757135175,0.00019843060484540207,0.00021960832236239932,0.00023978218533892882,0.0002582932252498325,0.00027449668128253803,0.00028779892179062357,0.0002976934016137321,0.0003037926317740658,0.00030585335264526106,0.0003037926317740658,0.0002976934016137321,0.00028779892179062357,0.00027449668128253803,0.0002582932252498325,0.00023978218533892882,0.00021960832236239932,0.00019843060484540207,0.00017688723757135175,0.0001555651545305798,0.00013497586873735578,0.0001155388178302489,9.757255770068542e-05,8.129342865155007e-05,6.682072353137246e-05,5.41869726700033e-05,4.3351745115300995e-05,3.421734135320958e-05,2.6644889388855146e-05,2.046960973271904e-05,1.5514335722579434e-05,1.1600715849724447e-05,8.557844185161014e-06,6.228334691651468e-06,4.472058654630878e-06,3.16789677273444e-06,2.2139231091643913e-06,1.7474397525302735e-06,2.5004069606906466e-06,3.529776186174126e-06,4.915997121671949e-06,6.754668697936245e-06,9.156393891776878e-06,1.224539680873025e-05,1.6156572745308397e-05,2.103069376128016e-05,2.7007596722301807e-05,3.421734135320958e-05,4.276953870750003e-05,5.274130258102161e-05,6.416454494610635e-05,7.701358975677559e-05,9.119427969345024e-05,0.00010653585830855071,0.00012278689084096144,0.00013961631701116812,0.00015662040185142437,0.000173335880949985,0.00018925902208409234,0.00020386970430114385,0.0002166590207334625,0.00022715842053886971,0.00023496808985481733,0.00023978218533892898,0.00024140870324024607,0.00023978218533892898,0.00023496808985481733,0.00022715842053886971,0.0002166590207334625,0.00020386970430114385,0.00018925902208409234,0.000173335880949985,0.00015662040185142437,0.00013961631701116812,0.00012278689084096144,0.00010653585830855071,9.119427969345024e-05,7.701358975677559e-05,6.416454494610635e-05,5.274130258102161e-05,4.276953870750003e-05,3.421734135320958e-05,2.7007596722301807e-05,2.103069376128016e-05,1.6156572745308397e-05,1.224539680873025e-05,9.156393891776878e-06,6.754668697936245e-06,4.915997121671949e-06,3.529776186174126e-06,2.5004069606906466e-06,1.7474397525302735e-06,1.3607234542051932e-06,1.9470556232586e-06,2.748620796606766e-06,3.828064787113942e-06,5.25983005099815e-06,7.130042627473142e-06,9.535435267259667e-06,1.2581050329363302e-05,1.6376506381833028e-05,2.103069376128016e-05,2.6644889388855146e-05,3.330444689756131e-05,4.106941445243657e-05,4.99646417624104e-05,5.9970135006280207e-05,7.10125743039466e-05,8.295899237980435e-05,9.561359811936321e-05,0.00010871859637607316,0.00012195960055142643,0.00013497586873735583,0.00014737514692387171,0.00015875241927096873,0.00016871140229599658,0.00017688723757135183,0.00018296859184546002,0.0001867173062869901,0.00018798386844102262,0.0001867173062869901,0.00018296859184546002,0.00017688723757135183,0.00016871140229599658,0.00015875241927096873,0.00014737514692387171,0.00013497586873735583,0.00012195960055142643,0.00010871859637607316,9.561359811936321e-05,8.295899237980435e-05,7.10125743039466e-05,5.9970135006280207e-05,4.99646417624104e-05,4.106941445243657e-05,3.330444689756131e-05,2.6644889388855146e-05,2.103069376128016e-05,1.6376506381833028e-05,1.2581050329363302e-05,9.535435267259667e-06,7.130042627473142e-06,5.25983005099815e-06,3.828064787113942e-06,2.748620796606766e-06,1.9470556232586e-06,1.3607234542051932e-06,1.0453591176620935e-06,1.4958016208793143e-06,2.1115942419077644e-06,2.940863858739158e-06,4.040799976050715e-06,5.477567867970679e-06,7.325481284754452e-06,9.665237731385772e-06,1.2581050329363302e-05,1.6156572745308397e-05,2.046960973271904e-05,2.5585733174118358e-05,3.1551074336390366e-05,3.8384723703880274e-05,4.6071321268478834e-05,5.4554539930854495e-05,6.373222921107318e-05,7.34539749849004e-05,8.352172929034779e-05,9.36939684760039e-05,0.00010369355699198495,0.00011321915050229459,0.00012195960055142645,0.00012961046721039488,0.0001358914524636315,0.0001405633783560867,0.00014344328228429085,0.00014441630313706728,0.00014344328228429085,0.0001405633783560867,0.0001358914524636315,0.00012961046721039488,0.00012195960055142645,0.00011321915050229459,0.00010369355699198495,9.36939684760039e-05,8.352172929034779e-05,7.34539749849004e-05,6.373222921107318e-05,5.4554539930854495e-05,4.6071321268478834e-05,3.8384723703880274e-05,3.1551074336390366e-05,2.5585733174118358e-05,2.046960973271904e-05,1.6156572745308397e-05,1.2581050329363302e-05,9.665237731385772e-06,7.325481284754452e-06,5.477567867970679e-06,4.040799976050715e-06,2.940863858739158e-06,2.1115942419077644e-06,1.4958016208793143e-06,1.0453591176620935e-06,7.922990478976193e-07,1.1336986304925316e-06,1.600420447999966e-06,2.2289408452155743e-06,3.0626049169875593e-06,4.1515606773428465e-06,5.552132036962711e-06,7.325481284754452e-06,9.535435267259667e-06,1.224539680873025e-05,1.5514335722579434e-05,1.93919502792046e-05,2.3913204308942112e-05,2.9092566880186806e-05,3.491839632875357e-05,4.134800119443779e-05,4.8303959540005986e-05,5.5672269425447486e-05,6.330282625123254e-05,7.101257430394658e-05,7.859146688422894e-05,8.581110895876971e-05,9.243567475163474e-05,9.823442301629737e-05,0.0001029949101559972,0.00010653585830855065,0.00010871859637607313,0.00010945606877404048,0.00010871859637607313,0.00010653585830855065,0.0001029949101559972,9.823442301629737e-05,9.243567475163474e-05,8.581110895876971e-05,7.859146688422894e-05,7.101257430394658e-05,6.330282625123254e-05,5.5672269425447486e-05,4.8303959540005986e-05,4.134800119443779e-05,3.491839632875357e-05,2.9092566880186806e-05,2.3913204308942112e-05,1.93919502792046e-05,1.5514335722579434e-05,1.224539680873025e-05,9.535435267259667e-06,7.325481284754452e-06,5.552132036962711e-06,4.1515606773428465e-06,3.0626049169875593e-06,2.2289408452155743e-06,1.600420447999966e-06,1.1336986304925316e-06,7.922990478976193e-07,5.92435041178763e-07,8.477137472553667e-07,1.1967011149768707e-06,1.666672028603713e-06,2.2900374232738724e-06,3.1042950605130126e-06,4.1515606773428465e-06,5.477567867970679e-06,7.130042627473142e-06,9.156393891776878e-06,1.1600715849724447e-05,1.4500169970773005e-05,1.7880900169041918e-05,2.175372557040678e-05,2.6109941217037337e-05,3.0917624923678644e-05,3.6118885078956484e-05,4.1628477677840305e-05,4.733416325110507e-05,5.309906340743814e-05,5.876611746966794e-05,6.416454494610634e-05,6.911800906890376e-05,7.345397498490043e-05,7.701358975677564e-05,7.966130436672801e-05,8.129342865155011e-05,8.184486752001439e-05,8.129342865155011e-05,7.966130436672801e-05,7.701358975677564e-05,7.345397498490043e-05,6.911800906890376e-05,6.416454494610634e-05,5.876611746966794e-05,5.309906340743814e-05,4.733416325110507e-05,4.1628477677840305e-05,3.6118885078956484e-05,3.0917624923678644e-05,2.6109941217037337e-05,2.175372557040678e-05,1.7880900169041918e-05,1.4500169970773005e-05,1.1600715849724447e-05,9.156393891776878e-06,7.130042627473142e-06,5.477567867970679e-06,4.1515606773428465e-06,3.1042950605130126e-06,2.2900374232738724e-06,1.666672028603713e-06,1.1967011149768707e-06,8.477137472553667e-07,5.92435041178763e-07,4.3703913085309566e-07,6.253581465666805e-07,8.828060104949278e-07,1.229503395593953e-06,1.6893598378268123e-06,2.2900374232738724e-06,3.0626049169875593e-06,4.040799976050715e-06,5.25983005099815e-06,6.754668697936245e-06,8.557844185161014e-06,1.0696770516206864e-05,1.3190734047736782e-05,1.6047716045274578e-05,1.926129486435325e-05,2.2807921519634265e-05,2.664488938885515e-05,3.0709313998142e-05,3.491839632875359e-05,3.917116123740194e-05,4.3351745115301015e-05,4.7334163251105035e-05,5.0988332070410497e-05,5.418697267000331e-05,5.681289929138755e-05,5.87661174696679e-05,5.997013500628023e-05,6.0376931274294225e-05,5.997013500628023e-05,5.87661174696679e-05,5.681289929138755e-05,5.418697267000331e-05,5.0988332070410497e-05,4.7334163251105035e-05,4.3351745115301015e-05,3.917116123740194e-05,3.491839632875359e-05,3.0709313998142e-05,2.664488938885515e-05,2.2807921519634265e-05,1.926129486435325e-05,1.6047716045274578e-05,1.3190734047736782e-05,1.0696770516206864e-05,8.557844185161014e-06,6.754668697936245e-06,5.25983005099815e-06,4.040799976050715e-06,3.0626049169875593e-06,2.2900374232738724e-06,1.6893598378268123e-06,1.229503395593953e-06,8.828060104949278e-07,6.253581465666805e-07,4.3703913085309566e-07,3.180737953866271e-07,4.5513095993519035e-07,6.424995807586718e-07,8.948233324415239e-07,1.229503395593953e-06,1.666672028603713e-06,2.2289408452155743e-06,2.940863858739158e-06,3.828064787113942e-06,4.915997121671949e-06,6.228334691651468e-06,7.785029202827474e-06,9.600117120655594e-06,1.1679407150210344e-05,1.401822566690287e-05,1.6599433896158208e-05,1.93919502792046e-05,2.235000796849016e-05,2.5413346460352658e-05,2.8508476804265797e-05,3.1551074336390386e-05,3.444944833049735e-05,3.710892493862433e-05,3.943687153142549e-05,4.1348001194437796e-05,4.276953870750001e-05,4.3645813623283404e-05,4.394187689035004e-05,4.3645813623283404e-05,4.276953870750001e-05,4.1348001194437796e-05,3.943687153142549e-05,3.710892493862433e-05,3.444944833049735e-05,3.1551074336390386e-05,2.8508476804265797e-05,2.5413346460352658e-05,2.235000796849016e-05,1.93919502792046e-05,1.6599433896158208e-05,1.401822566690287e-05,1.1679407150210344e-05,9.600117120655594e-06,7.785029202827474e-06,6.228334691651468e-06,4.915997121671949e-06,3.828064787113942e-06,2.940863858739158e-06,2.2289408452155743e-06,1.666672028603713e-06,1.229503395593953e-06,8.948233324415239e-07,6.424995807586718e-07,4.5513095993519035e-07,3.180737953866271e-07,2.2838282460586423e-07,3.2679238498484414e-07,4.6132649463747155e-07,6.424995807586718e-07,8.828060104949278e-07,1.1967011149768707e-06,1.600420447999966e-06,2.1115942419077644e-06,2.748620796606766e-06,3.529776186174126e-06,4.472058654630878e-06,5.5897938930169085e-06,6.893060341224894e-06,8.386028756140377e-06,1.006534338950547e-05,1.1918698286524501e-05,1.3923776317372876e-05,1.604771604527457e-05,1.8247249322277244e-05,2.0469609732719033e-05,2.265425061984651e-05,2.473533635887674e-05,2.664488938885514e-05,2.831639778126853e-05,2.96886239657496e-05,3.070931399814198e-05,3.1338495475209645e-05,3.1551074336390366e-05,3.1338495475209645e-05,3.070931399814198e-05,2.96886239657496e-05,2.831639778126853e-05,2.664488938885514e-05,2.473533635887674e-05,2.265425061984651e-05,2.0469609732719033e-05,1.8247249322277244e-05,1.604771604527457e-05,1.3923776317372876e-05,1.1918698286524501e-05,1.006534338950547e-05,8.386028756140377e-06,6.893060341224894e-06,5.5897938930169085e-06,4.472058654630878e-06,3.529776186174126e-06,2.748620796606766e-06,2.1115942419077644e-06,1.600420447999966e-06,1.1967011149768707e-06,8.828060104949278e-07,6.424995807586718e-07,4.6132649463747155e-07,3.2679238498484414e-07,2.2838282460586423e-07,1.6178079691949163e-07,2.3149171817674364e-07,3.2679238498484414e-07,4.5513095993519035e-07,6.253581465666805e-07,8.477137472553667e-07,1.1336986304925316e-06,1.4958016208793143e-06,1.9470556232586e-06,2.5004069606906466e-06,3.16789677273444e-06,3.959673027902303e-06,4.882875046063652e-06,5.940457289200753e-06,7.130042627473133e-06,8.442913824034569e-06,9.863261970950716e-06,1.1367808831608474e-05,1.292590431019157e-05,1.450016997077299e-05,1.604771604527457e-05,1.752190619026087e-05,1.8874586767196005e-05,2.005864235565339e-05,2.103069376128015e-05,2.1753725570406755e-05,2.2199422312018802e-05,2.235000796849015e-05,2.2199422312018802e-05,2.1753725570406755e-05,2.103069376128015e-05,2.005864235565339e-05,1.8874586767196005e-05,1.752190619026087e-05,1.604771604527457e-05,1.450016997077299e-05,1.292590431019157e-05,1.1367808831608474e-05,9.863261970950716e-06,8.442913824034569e-06,7.130042627473133e-06,5.940457289200753e-06,4.882875046063652e-06,3.959673027902303e-06,3.16789677273444e-06,2.5004069606906466e-06,1.9470556232586e-06,1.4958016208793143e-06,1.1336986304925316e-06,8.477137472553667e-07,6.253581465666805e-07,4.5513095993519035e-07,3.2679238498484414e-07,2.3149171817674364e-07,1.6178079691949163e-07,1.1306247350033799e-07,1.6178079691949163e-07,2.2838282460586423e-07,3.180737953866271e-07,4.3703913085309566e-07,5.92435041178763e-07,7.922990478976193e-07,1.0453591176620935e-06,1.3607234542051932e-06,1.7474397525302735e-06,2.2139231091643913e-06,2.7672655550707622e-06,3.4124564905918015e-06,4.151560677342845e-06,4.982916829283069e-06,5.9004327996392544e-06,6.8930603412248976e-06,7.944531175849273e-06,9.03342511204346e-06,1.0133619776188636e-05,1.1215141133299758e-05,1.2245396808730241e-05,1.3190734047736783e-05,1.4018225666902872e-05,1.4697555589751094e-05,1.5202855145173355e-05,1.5514335722579434e-05,1.5619574336299427e-05,1.5514335722579434e-05,1.5202855145173355e-05,1.4697555589751094e-05,1.4018225666902872e-05,1.3190734047736783e-05,1.2245396808730241e-05,1.1215141133299758e-05,1.0133619776188636e-05,9.03342511204346e-06,7.944531175849273e-06,6.8930603412248976e-06,5.9004327996392544e-06,4.982916829283069e-06,4.151560677342845e-06,3.4124564905918015e-06,2.7672655550707622e-06,2.2139231091643913e-06,1.7474397525302735e-06,1.3607234542051932e-06,1.0453591176620935e-06,7.922990478976193e-07,5.92435041178763e-07,4.3703913085309566e-07,3.180737953866271e-07,2.2838282460586423e-07,1.6178079691949163e-07,1.1306247350033799e-07);
-
-
-const int KernelSize = 9;
-
-out vec4 FragColor;
-in vec3  DefaultColor;
-in vec2  TexCoords;
-
-uniform sampler2D imageTexture;
-uniform sampler2D filterZones;
+// GAUSSIAN_BLUR_LUT_MAX_TAPS of gaussian_blur_kernel_lut.h, the core defines it
+#ifndef LUT_MAX_TAPS
+#define LUT_MAX_TAPS 17
+#endif
+
+#include "gauss_blur_common.glsl"
+
 uniform float kernelPixelSizeX;
 uniform float kernelPixelSizeY;
 
-
-void gaussianBulr39(out vec4 color,in vec2 uv,in float pixelSizeX, float pixelSizeY, in int kernalSize, in float kernel[1521])
+// one row per zone value: (tap count, mip level), then (weight, offset) of
+// the centre tap and of the taps on one side. the profile picked on the cpu
+// decides how many there are and whether offsets fall between texels
+uniform sampler2D sigmaLut;
+
+// half resolution mode, heavy zones are blurred into a smaller target first
+const int BLUR_PASS_FULL = 0;
+const int BLUR_PASS_LOW_RES = 1;
+const int BLUR_PASS_COMPOSITE = 2;
+const int UPSAMPLE_BILINEAR = 0;
+const int UPSAMPLE_BILATERAL = 1;
+
+uniform int blurPass;
+uniform float sourceLod;        // mip level of imageTexture the kernels read
+uniform sampler2D lowResTexture;
+uniform vec2 lowResTexelSize;
+uniform float lowResScale;      // 2 or 4
+uniform float halfResZone;      // zone value from which the low resolution result is used
+uniform float halfResBlend;     // zone range below halfResZone blending both results
+uniform int upsampleMode;
+
+// batch mode, imageTexture is an atlas and CellRect the image of this pixel
+uniform int batchMode;
+uniform vec2 batchTexelSize;
+
+// multisampled source (FrameBuffer::getMsaaColorId), resolved by the taps
+// themselves instead of a blit into imageTexture. it has no mip levels, the
+// caller only sets sourceSamples when every kernel of the zone map reads
+// level 0 and resolves into a mipmapped imageTexture otherwise. a tap costs
+// 4 x sourceSamples fetches instead of one, what is saved is the resolve
+// pass and the single-sample texture
+uniform sampler2DMS imageTextureMS;
+uniform int sourceSamples;      // 0 reads imageTexture
+
+// taps must not read the neighbouring images of an atlas. cells start on a
+// texel of the coarsest level read and repeat the image edge up to the next
+// one, taps stay on the texel centres of their level inside that range
+vec2 clampToCell(vec2 uv, float level)
 {
-    vec4 sum = vec4(0.0);
-    int halfKernalSize = int(kernalSize / 2);    
-    for(int i = 0; i < kernalSize; i++)
+    if(batchMode == 0)
     {
-        for(int j = 0 ; j < kernalSize; j++)
-        {
-            sum += texture(imageTexture, uv + vec2((i - halfKernalSize)*pixelSizeX,(j- halfKernalSize)*pixelSizeY)) * kernel[i*j];
-        }
+        return uv;
     }
-    color =  sum;
+    vec2 texel = batchTexelSize * exp2(level);
+    vec2 cellEnd = CellRect.xy + ceil(CellRect.zw / texel - 0.001) * texel;
+    return clamp(uv, CellRect.xy + 0.5 * texel, cellEnd - 0.5 * texel);
 }
 
-void gaussianBulr35(out vec4 color,in vec2 uv,in float pixelSizeX, float pixelSizeY, in int kernalSize, in float kernel[1225])
+// box resolve of one texel, clamped to the edge like imageTexture
+vec4 resolveTexel(ivec2 texel)
 {
+    texel = clamp(texel, ivec2(0), textureSize(imageTextureMS) - 1);
     vec4 sum = vec4(0.0);
-    int halfKernalSize = int(kernalSize / 2);    
-    for(int i = 0; i < kernalSize; i++)
+    for(int s = 0; s < sourceSamples; s++)
     {
-        for(int j = 0 ; j < kernalSize; j++)
-        {
-            sum += texture(imageTexture, uv + vec2((i - halfKernalSize)*pixelSizeX,(j- halfKernalSize)*pixelSizeY)) * kernel[i*j];
-        }
+        sum += texelFetch(imageTextureMS, texel, s);
     }
-    color =  sum;
+    return sum / float(sourceSamples);
 }
 
-void gaussianBulr29(out vec4 color,in vec2 uv,in float pixelSizeX, float pixelSizeY, in int kernalSize, in float kernel[841])
+// what textureLod(imageTexture, uv, 0.0) reads once the source is resolved,
+// level is only honoured by imageTexture. the bilinear weights are applied by
+// hand, the paired LUT offsets rely on them
+vec4 fetchSource(vec2 uv, float level)
 {
-    vec4 sum = vec4(0.0);
-    int halfKernalSize = int(kernalSize / 2);    
-    for(int i = 0; i < kernalSize; i++)
+    if(sourceSamples == 0)
     {
-        for(int j = 0 ; j < kernalSize; j++)
-        {
-            sum += texture(imageTexture, uv + vec2((i - halfKernalSize)*pixelSizeX,(j- halfKernalSize)*pixelSizeY)) * kernel[i*j];
-        }
+        return textureLod(imageTexture, uv, level);
     }
-    color =  sum;
+    vec2 pos = uv * vec2(textureSize(imageTextureMS)) - 0.5;
+    ivec2 texel = ivec2(floor(pos));
+    vec2 f = pos - floor(pos);
+    vec4 bottom = mix(resolveTexel(texel), resolveTexel(texel + ivec2(1, 0)), f.x);
+    vec4 top = mix(resolveTexel(texel + ivec2(0, 1)), resolveTexel(texel + ivec2(1, 1)), f.x);
+    return mix(bottom, top, f.y);
 }
 
-void gaussianBulr27(out vec4 color,in vec2 uv,in float pixelSizeX, float pixelSizeY, in int kernalSize, in float kernel[729])
+vec4 sampleSource(vec2 uv)
 {
-    vec4 sum = vec4(0.0);
-    int halfKernalSize = int(kernalSize / 2);    
-    for(int i = 0; i < kernalSize; i++)
-    {
-        for(int j = 0 ; j < kernalSize; j++)
-        {
-            sum += texture(imageTexture, uv + vec2((i - halfKernalSize)*pixelSizeX,(j- halfKernalSize)*pixelSizeY)) * kernel[i*j];
-        }
-    }
-    color =  sum;
+    return fetchSource(uv, sourceLod);
 }
 
-void gaussianBulr19(out vec4 color,in vec2 uv,in float pixelSizeX, float pixelSizeY, in int kernalSize, in float kernel[361])
+// the zone value is the kernel width in pixels, sigma is a sixth of it.
+// the tap count follows sigma, kernels wider than the profile allows read
+// a coarser mip level instead of spreading their taps apart
+void blurZone(out vec4 color, in vec2 uv, in float zoneValue, in float pixelSizeX, in float pixelSizeY)
 {
-    vec4 sum = vec4(0.0);
-    int halfKernalSize = int(kernalSize / 2);    
-    for(int i = 0; i < kernalSize; i++)
-    {
-        for(int j = 0 ; j < kernalSize; j++)
-        {
-            sum += texture(imageTexture, uv + vec2((i - halfKernalSize)*pixelSizeX,(j- halfKernalSize)*pixelSizeY)) * kernel[i*j];
-        }
-    }
-    color =  sum;
-}
+    int row = clamp(int(zoneValue + 0.5), 0, 255);
+    vec2 header = texelFetch(sigmaLut, ivec2(0, row), 0).rg;
+    int taps = int(header.x);
+    float lod = header.y;
 
-void gaussianBulr17(out vec4 color,in vec2 uv,in float pixelSizeX, float pixelSizeY, in int kernalSize, in float kernel[289])
-{
-    vec4 sum = vec4(0.0);
-    int halfKernalSize = int(kernalSize / 2);    
-    for(int i = 0; i < kernalSize; i++)
+    vec2 kernel[LUT_MAX_TAPS];
+    for(int k = 0; k < taps; k++)
     {
-        for(int j = 0 ; j < kernalSize; j++)
-        {
-            sum += texture(imageTexture, uv + vec2((i - halfKernalSize)*pixelSizeX,(j- halfKernalSize)*pixelSizeY)) * kernel[i*j];
-        }
+        kernel[k] = texelFetch(sigmaLut, ivec2(1 + k, row), 0).rg;
     }
-    color =  sum;
-}
 
-void gaussianBulr9(out vec4 color,in vec2 uv,in float pixelSizeX, float pixelSizeY, in int kernalSize, in float kernel[81])
-{
+    vec2 stepUv = vec2(pixelSizeX, pixelSizeY) * exp2(lod);
+    float level = sourceLod + lod;
     vec4 sum = vec4(0.0);
-    int halfKernalSize = int(kernalSize / 2);    
-    for(int i = 0; i < kernalSize; i++)
+    for(int j = 1 - taps; j < taps; j++)
     {
-        for(int j = 0 ; j < kernalSize; j++)
+        vec2 tapY = kernel[abs(j)];
+        float offsetY = sign(float(j)) * tapY.y;
+        for(int i = 1 - taps; i < taps; i++)
         {
-            //sum += texture(imageTexture, uv + vec2(i - halfKernalSize,j- halfKernalSize) * stepValue) * kernel[i*j];
-            sum += texture(imageTexture, uv + vec2((i - halfKernalSize)*pixelSizeX,(j- halfKernalSize)*pixelSizeY)) * kernel[i*j];
+            vec2 tapX = kernel[abs(i)];
+            vec2 offset = vec2(sign(float(i)) * tapX.y, offsetY);
+            sum += fetchSource(clampToCell(uv + offset * stepUv, level), level) * (tapX.x * tapY.x);
         }
     }
-    color =  sum;
+    color = sum;
 }
 
-void gaussianBulr7(out vec4 color,in vec2 uv,in float pixelSizeX, float pixelSizeY, in int kernalSize, in float kernel[49])
+// the 2x2 low resolution texels around uv, weighted by distance like a
+// bilinear fetch and by how close their source colour is to this pixel's.
+// texels outside the heavy zones were never blurred and only count when
+// nothing else is there
+vec4 upsampleLowRes(vec2 uv)
 {
-    vec4 sum = vec4(0.0);
-    int halfKernalSize = int(kernalSize / 2);    
-    for(int i = 0; i < kernalSize; i++)
+    if(upsampleMode == UPSAMPLE_BILINEAR)
     {
-        for(int j = 0 ; j < kernalSize; j++)
-        {
-            sum += texture(imageTexture, uv + vec2((i - halfKernalSize)*pixelSizeX,(j- halfKernalSize)*pixelSizeY)) * kernel[i*j];
-        }
+        return textureLod(lowResTexture, uv, 0.0);
     }
-    color =  sum;
-}
 
-void gaussianBulr3(out vec4 color,in vec2 uv,in float pixelSizeX, float pixelSizeY, in int kernalSize, in float kernel[9])
-{
+    float lowResLod = log2(lowResScale);
+    vec4 guide = fetchSource(uv, 0.0);
+    vec2 pos = uv / lowResTexelSize - 0.5;
+    vec2 cell = floor(pos);
+    vec2 f = pos - cell;
     vec4 sum = vec4(0.0);
-    int halfKernalSize = int(kernalSize / 2);    
-    for(int i = 0; i < kernalSize; i++)
+    float weightSum = 0.0;
+    for(int j = 0; j < 2; j++)
     {
-        for(int j = 0 ; j < kernalSize; j++)
+        for(int i = 0; i < 2; i++)
         {
-            sum += texture(imageTexture, uv + vec2((i - halfKernalSize)*pixelSizeX,(j- halfKernalSize)*pixelSizeY)) * kernel[i*j];
+            vec2 texelUv = (cell + vec2(i, j) + 0.5) * lowResTexelSize;
+            float spatial = (i == 0 ? 1.0 - f.x : f.x) * (j == 0 ? 1.0 - f.y : f.y);
+            vec3 diff = fetchSource(texelUv, lowResLod).rgb - guide.rgb;
+            float range = exp(-dot(diff, diff) * 50.0);
+            float valid = step(halfResZone - halfResBlend, zoneAt(texelUv));
+            float weight = spatial * (range * valid + 0.0001);
+            sum += textureLod(lowResTexture, texelUv, 0.0) * weight;
+            weightSum += weight;
         }
     }
-    color =  sum;
+    return sum / weightSum;
 }
 
 void main(){
     vec2 uv = TexCoords;
-    vec4 kernalSizeV4 = texture(filterZones,uv);
-    float scaleKernelSize = kernalSizeV4.x*255;//scale back to 0-255
-    if(scaleKernelSize <= 13.0)
+    // every image of a batch gets the whole zone map
+    vec2 zoneUv = (batchMode != 0) ? (uv - CellRect.xy) / CellRect.zw : uv;
+    float zoneValue = zoneAt(zoneUv);
+
+    if(blurPass == BLUR_PASS_LOW_RES)
     {
-        int kernalSize = 7;
-        float scaleFactor = scaleKernelSize/kernalSize;
-        float stepValueX = kernelPixelSizeX*scaleFactor;
-        float stepValueY = kernelPixelSizeY*scaleFactor;
-        gaussianBulr7(FragColor,uv,stepValueX,stepValueY,kernalSize,kernel7);
+        // the zone shrinks with the image, so does the kernel picked for it
+        if(zoneValue < halfResZone - halfResBlend)
+        {
+            FragColor = sampleSource(uv);
+            return;
+        }
+        blurZone(FragColor, uv, zoneValue / lowResScale, kernelPixelSizeX * lowResScale, kernelPixelSizeY * lowResScale);
+        return;
     }
-    else if(scaleKernelSize > 13.0 && scaleKernelSize <= 26.0)
-    {
-        int kernalSize = 17;
-        float scaleFactor = scaleKernelSize/kernalSize;
-        float stepValueX = kernelPixelSizeX*scaleFactor;
-        float stepValueY = kernelPixelSizeY*scaleFactor;
-        gaussianBulr17(FragColor,uv,stepValueX,stepValueY,kernalSize,kernel17);
 
-    }else if(scaleKernelSize > 26.0 && scaleKernelSize <= 39.0)
+    if(blurPass == BLUR_PASS_COMPOSITE)
     {
-        int kernalSize = 27;
-        float scaleFactor = scaleKernelSize/kernalSize;
-        float stepValueX = kernelPixelSizeX*scaleFactor;
-        float stepValueY = kernelPixelSizeY*scaleFactor;
-
-        gaussianBulr27(FragColor,uv,stepValueX,stepValueY,kernalSize,kernel27);
+        float t = smoothstep(halfResZone - halfResBlend, halfResZone, zoneValue);
+        if(t >= 1.0)
+        {
+            FragColor = upsampleLowRes(uv);
+            return;
+        }
+        vec4 full;
+        blurZone(full, uv, zoneValue, kernelPixelSizeX, kernelPixelSizeY);
+        FragColor = (t <= 0.0) ? full : mix(full, upsampleLowRes(uv), t);
+        return;
     }
-    else
-    {
-        int kernalSize = 35;
-        float scaleFactor = scaleKernelSize/kernalSize;
-        float stepValueX = kernelPixelSizeX*scaleFactor;
-        float stepValueY = kernelPixelSizeY*scaleFactor;
 
-        gaussianBulr35(FragColor,uv,stepValueX,stepValueY,kernalSize,kernel35);
-    }
+    blurZone(FragColor, uv, zoneValue, kernelPixelSizeX, kernelPixelSizeY);
 }
 
 
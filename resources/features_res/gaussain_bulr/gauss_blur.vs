@@ -3,12 +3,33 @@ layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 attrColor;
 layout (location = 2) in vec2 aTexCoord;
 
+// GAUSSIAN_BLUR_BATCH_MAX of gaussian_blur_defines.h, the core defines it
+#ifndef BATCH_MAX
+#define BATCH_MAX 64
+#endif
+
+// batch mode draws one instance per image of an atlas, every instance
+// covers its own rectangle (atlas uv: x, y, w, h) of the target
+uniform int batchMode;
+uniform vec4 batchRects[BATCH_MAX];
+
 out vec3 DefaultColor;
 out vec2 TexCoords;
+flat out vec4 CellRect;
 
 void main()
 {
-	gl_Position = vec4(aPos, 1.0);
 	DefaultColor = attrColor;
+	if(batchMode != 0)
+	{
+		vec4 rect = batchRects[gl_InstanceID];
+		vec2 uv = rect.xy + aTexCoord * rect.zw;
+		gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+		TexCoords = uv;
+		CellRect = rect;
+		return;
+	}
+	gl_Position = vec4(aPos, 1.0);
 	TexCoords = vec2(aTexCoord.x, aTexCoord.y);
+	CellRect = vec4(0.0, 0.0, 1.0, 1.0);
 }
\ No newline at end of file
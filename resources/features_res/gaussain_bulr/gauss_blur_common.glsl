@@ -0,0 +1,15 @@
+// shared by gauss_blur.fs and gauss_blur_copy.fs, included after #version
+
+out vec4 FragColor;
+in vec3  DefaultColor;
+in vec2  TexCoords;
+flat in vec4 CellRect;
+
+uniform sampler2D imageTexture;
+uniform sampler2D filterZones;
+
+// zone value scaled back to 0-255, the kernel width in pixels
+float zoneAt(vec2 uv)
+{
+    return texture(filterZones, uv).x * 255.0;
+}
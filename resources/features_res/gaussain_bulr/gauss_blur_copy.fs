@@ -0,0 +1,20 @@
+#version 330 core
+
+// zero radius pixels of the zone map are copied here before the blur pass,
+// the rest is discarded and keeps the cleared depth, so the blur pass only
+// runs where this pass left nothing (depth test GL_LESS)
+
+#include "gauss_blur_common.glsl"
+
+// largest zone value whose kernel is the centre tap alone
+uniform float passThroughZone;
+
+void main(){
+    // same fetch and rounding as the blur shader
+    float zoneValue = zoneAt(TexCoords);
+    if(float(int(zoneValue + 0.5)) > passThroughZone)
+    {
+        discard;
+    }
+    FragColor = textureLod(imageTexture, TexCoords, 0.0);
+}
@@ -0,0 +1,112 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 09:12:31
+ * @LastEditTime: 2026-10-19 09:12:31
+ * @LastEditors: Matt.SHI
+ * @Description: fixed capacity FIFO shared between producer and consumer threads
+ * @FilePath: /opengl_demo/tools/bounded_queue.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _CIT_BOUNDED_QUEUE_H_
+#define _CIT_BOUNDED_QUEUE_H_
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+namespace tools
+{
+    template<typename T>
+    class BoundedQueue
+    {
+        public:
+            explicit BoundedQueue(size_t capacity) : m_capacity(capacity > 0 ? capacity : 1), m_closed(false) {}
+            ~BoundedQueue() {}
+
+        public:
+            // returns false instead of waiting when the queue is full
+            bool TryPush(T item)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if(m_closed || m_items.size() >= m_capacity)
+                        return false;
+                    m_items.push_back(std::move(item));
+                }
+                m_not_empty.notify_one();
+                return true;
+            }
+
+            // waits for a free slot, returns false once the queue is closed
+            bool Push(T item)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_not_full.wait(lock, [this]() { return m_closed || m_items.size() < m_capacity; });
+                    if(m_closed)
+                        return false;
+                    m_items.push_back(std::move(item));
+                }
+                m_not_empty.notify_one();
+                return true;
+            }
+
+            bool TryPop(T& item)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if(m_items.empty())
+                        return false;
+                    item = std::move(m_items.front());
+                    m_items.pop_front();
+                }
+                m_not_full.notify_one();
+                return true;
+            }
+
+            // waits for an item, returns false once the queue is closed and drained
+            bool Pop(T& item)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_not_empty.wait(lock, [this]() { return m_closed || !m_items.empty(); });
+                    if(m_items.empty())
+                        return false;
+                    item = std::move(m_items.front());
+                    m_items.pop_front();
+                }
+                m_not_full.notify_one();
+                return true;
+            }
+
+            // wake up every waiter, queued items can still be popped
+            void Close()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_closed = true;
+                }
+                m_not_empty.notify_all();
+                m_not_full.notify_all();
+            }
+
+            size_t Size()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_items.size();
+            }
+
+            size_t Capacity() const { return m_capacity; }
+
+        private:
+            std::deque<T> m_items;
+            size_t m_capacity;
+            bool m_closed;
+            std::mutex m_mutex;
+            std::condition_variable m_not_empty;
+            std::condition_variable m_not_full;
+    };
+}
+
+#endif //_CIT_BOUNDED_QUEUE_H_
@@ -0,0 +1,331 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 09:20:05
+ * @LastEditTime: 2026-10-19 10:41:17
+ * @LastEditors: Matt.SHI
+ * @Description: background image writer fed by a pool of frame buffers
+ * @FilePath: /opengl_demo/tools/frame_writer.cpp
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#include "frame_writer.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <iostream>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <tools/stb_image_write.h>
+
+namespace tools
+{
+    FrameWriter::FrameWriter() : m_w(0), m_h(0), m_c(0),
+                                 m_format(FRAME_WRITER_FMT_PNG),
+                                 m_written_count(0),
+                                 m_dropped_count(0)
+    {
+    }
+
+    FrameWriter::~FrameWriter()
+    {
+        Stop();
+    }
+
+    bool FrameWriter::Start(unsigned int w, unsigned int h, unsigned int c,
+                            FrameWriterFormat format, int png_compression_level,
+                            unsigned int worker_count, unsigned int pool_size)
+    {
+        Stop();
+        if(w == 0 || h == 0 || c == 0 || c > 4)
+        {
+            std::cout << "[WRITER] invalid frame size w:" << w << " h:" << h << " c:" << c << std::endl;
+            return false;
+        }
+        if(worker_count == 0)
+            worker_count = 1;
+        if(pool_size == 0)
+            pool_size = 1;
+
+        m_w = w;
+        m_h = h;
+        m_c = c;
+        m_format = format;
+        m_written_count = 0;
+        m_dropped_count = 0;
+
+        // stb keeps the level in a global, every worker writes with the same one
+        stbi_write_png_compression_level = png_compression_level;
+
+        m_free_buffers.reset(new BoundedQueue<unsigned char*>(pool_size));
+        m_jobs.reset(new BoundedQueue<FrameJob>(pool_size));
+        for(unsigned int i = 0; i < pool_size; i++)
+        {
+            unsigned char* buffer = new unsigned char[(size_t)w * h * c];
+            m_pool_buffers.push_back(buffer);
+            m_free_buffers->TryPush(buffer);
+        }
+        for(unsigned int i = 0; i < worker_count; i++)
+        {
+            m_workers.push_back(std::thread(&FrameWriter::WorkerLoop, this));
+        }
+        std::cout << "[WRITER] start " << worker_count << " workers, pool:" << pool_size
+                  << " format:" << GetFileExtension() << std::endl;
+        return true;
+    }
+
+    void FrameWriter::Stop()
+    {
+        if(m_jobs)
+        {
+            m_jobs->Close();
+        }
+        for(size_t i = 0; i < m_workers.size(); i++)
+        {
+            m_workers[i].join();
+        }
+        m_workers.clear();
+        m_jobs.reset();
+        m_free_buffers.reset();
+
+        for(size_t i = 0; i < m_pool_buffers.size(); i++)
+        {
+            delete[] m_pool_buffers[i];
+        }
+        m_pool_buffers.clear();
+    }
+
+    bool FrameWriter::Submit(const unsigned char* buf, const char* file_path)
+    {
+        if(!m_free_buffers || nullptr == buf)
+            return false;
+
+        unsigned char* buffer = nullptr;
+        if(!m_free_buffers->TryPop(buffer))
+        {
+            // every pooled buffer is still waiting for disk, drop this frame
+            m_dropped_count++;
+            return false;
+        }
+        memcpy(buffer, buf, (size_t)m_w * m_h * m_c);
+
+        FrameJob job;
+        job.buffer = buffer;
+        job.path = std::string(file_path) + GetFileExtension();
+        // the job queue is as deep as the pool, so this never fails while running
+        if(!m_jobs->TryPush(job))
+        {
+            m_free_buffers->TryPush(buffer);
+            m_dropped_count++;
+            return false;
+        }
+        return true;
+    }
+
+    const char* FrameWriter::GetFileExtension() const
+    {
+        switch(m_format)
+        {
+        case FRAME_WRITER_FMT_PPM:
+            return (m_c == 1) ? ".pgm" : ((m_c == 3) ? ".ppm" : ".pam");
+        case FRAME_WRITER_FMT_RAW:
+            return ".raw";
+        case FRAME_WRITER_FMT_QOI:
+            return ".qoi";
+        case FRAME_WRITER_FMT_PNG:
+        default:
+            return ".png";
+        }
+    }
+
+    bool FrameWriter::ParseFormat(const char* name, FrameWriterFormat& format)
+    {
+        if(0 == strcmp(name, "png"))
+            format = FRAME_WRITER_FMT_PNG;
+        else if(0 == strcmp(name, "ppm"))
+            format = FRAME_WRITER_FMT_PPM;
+        else if(0 == strcmp(name, "raw"))
+            format = FRAME_WRITER_FMT_RAW;
+        else if(0 == strcmp(name, "qoi"))
+            format = FRAME_WRITER_FMT_QOI;
+        else
+            return false;
+        return true;
+    }
+
+    void FrameWriter::WorkerLoop()
+    {
+        FrameJob job;
+        while(m_jobs->Pop(job))
+        {
+            if(WriteFrame(job))
+            {
+                m_written_count++;
+            }
+            else
+            {
+                std::cout << "[WRITER] failed to write " << job.path << std::endl;
+            }
+            m_free_buffers->TryPush(job.buffer);
+        }
+    }
+
+    bool FrameWriter::WriteFrame(const FrameJob& job)
+    {
+        switch(m_format)
+        {
+        case FRAME_WRITER_FMT_PPM:
+            return WritePPM(job.path.c_str(), job.buffer);
+        case FRAME_WRITER_FMT_RAW:
+            return WriteRaw(job.path.c_str(), job.buffer);
+        case FRAME_WRITER_FMT_QOI:
+            return WriteQOI(job.path.c_str(), job.buffer);
+        case FRAME_WRITER_FMT_PNG:
+        default:
+            return 0 != stbi_write_png(job.path.c_str(), m_w, m_h, m_c, job.buffer, m_w * m_c);
+        }
+    }
+
+    bool FrameWriter::WritePPM(const char* path, const unsigned char* buf)
+    {
+        FILE* fp = fopen(path, "wb");
+        if(nullptr == fp)
+            return false;
+
+        if(m_c == 1)
+            fprintf(fp, "P5\n%u %u\n255\n", m_w, m_h);
+        else if(m_c == 3)
+            fprintf(fp, "P6\n%u %u\n255\n", m_w, m_h);
+        else
+            fprintf(fp, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH %u\nMAXVAL 255\nTUPLTYPE %s\nENDHDR\n",
+                    m_w, m_h, m_c, (m_c == 4) ? "RGB_ALPHA" : "GRAYSCALE_ALPHA");
+
+        size_t len = (size_t)m_w * m_h * m_c;
+        bool ok = (fwrite(buf, 1, len, fp) == len);
+        fclose(fp);
+        return ok;
+    }
+
+    bool FrameWriter::WriteRaw(const char* path, const unsigned char* buf)
+    {
+        // keep the geometry next to the data, e.g. frame_1920x1440x3.raw
+        std::string raw_path(path);
+        size_t ext_pos = raw_path.rfind(".raw");
+        char geometry[64] = {0};
+        snprintf(geometry, sizeof(geometry), "_%ux%ux%u", m_w, m_h, m_c);
+        raw_path.insert(ext_pos, geometry);
+
+        FILE* fp = fopen(raw_path.c_str(), "wb");
+        if(nullptr == fp)
+            return false;
+        size_t len = (size_t)m_w * m_h * m_c;
+        bool ok = (fwrite(buf, 1, len, fp) == len);
+        fclose(fp);
+        return ok;
+    }
+
+    // encoder for https://qoiformat.org/qoi-specification.pdf, rgb(a) only
+    bool FrameWriter::WriteQOI(const char* path, const unsigned char* buf)
+    {
+        if(m_c != 3 && m_c != 4)
+            return false;
+
+        const unsigned char QOI_OP_INDEX = 0x00;
+        const unsigned char QOI_OP_DIFF = 0x40;
+        const unsigned char QOI_OP_LUMA = 0x80;
+        const unsigned char QOI_OP_RUN = 0xc0;
+        const unsigned char QOI_OP_RGB = 0xfe;
+        const unsigned char QOI_OP_RGBA = 0xff;
+
+        size_t pixel_count = (size_t)m_w * m_h;
+        // worst case every pixel is a full QOI_OP_RGBA
+        std::vector<unsigned char> out;
+        out.reserve(14 + pixel_count * (m_c + 1) + 8);
+
+        const unsigned char header[14] = {
+            'q', 'o', 'i', 'f',
+            (unsigned char)(m_w >> 24), (unsigned char)(m_w >> 16), (unsigned char)(m_w >> 8), (unsigned char)m_w,
+            (unsigned char)(m_h >> 24), (unsigned char)(m_h >> 16), (unsigned char)(m_h >> 8), (unsigned char)m_h,
+            (unsigned char)m_c, 0};
+        out.insert(out.end(), header, header + 14);
+
+        unsigned char index[64][4];
+        memset(index, 0, sizeof(index));
+        unsigned char prev[4] = {0, 0, 0, 255};
+        unsigned char px[4] = {0, 0, 0, 255};
+        int run = 0;
+
+        for(size_t i = 0; i < pixel_count; i++)
+        {
+            const unsigned char* src = buf + i * m_c;
+            px[0] = src[0];
+            px[1] = src[1];
+            px[2] = src[2];
+            if(m_c == 4)
+                px[3] = src[3];
+
+            if(0 == memcmp(px, prev, 4))
+            {
+                run++;
+                if(run == 62 || i == pixel_count - 1)
+                {
+                    out.push_back(QOI_OP_RUN | (run - 1));
+                    run = 0;
+                }
+                continue;
+            }
+            if(run > 0)
+            {
+                out.push_back(QOI_OP_RUN | (run - 1));
+                run = 0;
+            }
+
+            int hash = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64;
+            if(0 == memcmp(index[hash], px, 4))
+            {
+                out.push_back(QOI_OP_INDEX | hash);
+            }
+            else
+            {
+                memcpy(index[hash], px, 4);
+                if(px[3] == prev[3])
+                {
+                    signed char vr = px[0] - prev[0];
+                    signed char vg = px[1] - prev[1];
+                    signed char vb = px[2] - prev[2];
+                    signed char vg_r = vr - vg;
+                    signed char vg_b = vb - vg;
+                    if(vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+                    {
+                        out.push_back(QOI_OP_DIFF | ((vr + 2) << 4) | ((vg + 2) << 2) | (vb + 2));
+                    }
+                    else if(vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8)
+                    {
+                        out.push_back(QOI_OP_LUMA | (vg + 32));
+                        out.push_back(((vg_r + 8) << 4) | (vg_b + 8));
+                    }
+                    else
+                    {
+                        out.push_back(QOI_OP_RGB);
+                        out.insert(out.end(), px, px + 3);
+                    }
+                }
+                else
+                {
+                    out.push_back(QOI_OP_RGBA);
+                    out.insert(out.end(), px, px + 4);
+                }
+            }
+            memcpy(prev, px, 4);
+        }
+
+        const unsigned char padding[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+        out.insert(out.end(), padding, padding + 8);
+
+        FILE* fp = fopen(path, "wb");
+        if(nullptr == fp)
+            return false;
+        bool ok = (fwrite(out.data(), 1, out.size(), fp) == out.size());
+        fclose(fp);
+        return ok;
+    }
+}
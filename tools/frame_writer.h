@@ -0,0 +1,85 @@
+/***
+ * @Author: Matt.SHI
+ * @Date: 2026-10-19 09:20:05
+ * @LastEditTime: 2026-10-19 10:41:17
+ * @LastEditors: Matt.SHI
+ * @Description: background image writer fed by a pool of frame buffers,
+ *               frames are dropped instead of stalling the render loop
+ * @FilePath: /opengl_demo/tools/frame_writer.h
+ * @Copyright © 2022 Essilor. All rights reserved.
+ */
+
+#ifndef _CIT_FRAME_WRITER_H_
+#define _CIT_FRAME_WRITER_H_
+
+#include "bounded_queue.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tools
+{
+    enum FrameWriterFormat
+    {
+        FRAME_WRITER_FMT_PNG = 0,   // stb png, zlib level from Start()
+        FRAME_WRITER_FMT_PPM,       // uncompressed P5/P6/P7 netpbm
+        FRAME_WRITER_FMT_RAW,       // plain pixel dump, size is kept in the file name
+        FRAME_WRITER_FMT_QOI,       // "quite ok image" lossless format
+    };
+
+    class FrameWriter
+    {
+        public:
+            FrameWriter();
+            ~FrameWriter();
+
+        public:
+            // pool_size frames can be queued at most, anything above is dropped
+            bool Start(unsigned int w, unsigned int h, unsigned int c,
+                FrameWriterFormat format = FRAME_WRITER_FMT_PNG, int png_compression_level = 1,
+                unsigned int worker_count = 2, unsigned int pool_size = 4);
+            // write what is queued and join the workers
+            void Stop();
+
+            // copy buf and queue it, file_path is given without extension
+            bool Submit(const unsigned char* buf, const char* file_path);
+
+            const char* GetFileExtension() const;
+            unsigned long GetWrittenCount() const { return m_written_count; }
+            unsigned long GetDroppedCount() const { return m_dropped_count; }
+
+            static bool ParseFormat(const char* name, FrameWriterFormat& format);
+
+        private:
+            struct FrameJob
+            {
+                unsigned char* buffer;
+                std::string path;
+            };
+
+            void WorkerLoop();
+            bool WriteFrame(const FrameJob& job);
+            bool WritePPM(const char* path, const unsigned char* buf);
+            bool WriteRaw(const char* path, const unsigned char* buf);
+            bool WriteQOI(const char* path, const unsigned char* buf);
+
+        private:
+            unsigned int m_w;
+            unsigned int m_h;
+            unsigned int m_c;
+            FrameWriterFormat m_format;
+
+            std::vector<unsigned char*> m_pool_buffers;
+            std::unique_ptr<BoundedQueue<unsigned char*> > m_free_buffers;
+            std::unique_ptr<BoundedQueue<FrameJob> > m_jobs;
+            std::vector<std::thread> m_workers;
+
+            std::atomic<unsigned long> m_written_count;
+            std::atomic<unsigned long> m_dropped_count;
+    };
+}
+
+#endif //_CIT_FRAME_WRITER_H_